@@ -51,6 +51,12 @@ void Broadcast_impl( Matrix<T,D>& A, mpi::Comm const& comm, int rank )
     }
 }
 
+template<typename T, Device D>
+void Broadcast( Matrix<T,D>& A, mpi::Comm const& comm, int rank )
+{
+    Broadcast_impl( A, comm, rank );
+}
+
 template<typename T>
 void Broadcast( AbstractMatrix<T>& A, mpi::Comm const& comm, int rank )
 {
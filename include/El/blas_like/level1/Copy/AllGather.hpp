@@ -45,7 +45,8 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            simple_buffer<T,D> buf((distStride+1)*portionSize, syncInfoB);
+            simple_buffer<T,D> buf((distStride+1)*portionSize, syncInfoB,
+                                   TemporaryMemoryMode<D>());
             T* sendBuf = buf.data();
             T* recvBuf = buf.data() + portionSize;
 
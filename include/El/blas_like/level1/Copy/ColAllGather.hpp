@@ -64,7 +64,8 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad(maxLocalHeight*localWidth);
 
-                simple_buffer<T,D> buffer((colStride+1)*portionSize, syncInfoB);
+                simple_buffer<T,D> buffer((colStride+1)*portionSize, syncInfoB,
+                                          TemporaryMemoryMode<D>());
                 T* sendBuf = buffer.data();
                 T* recvBuf = buffer.data() + portionSize;
 
@@ -99,7 +100,8 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
             if (height == 1)
             {
                 const Int localWidthB = B.LocalWidth();
-                simple_buffer<T,D> buffer(0, syncInfoB);
+                simple_buffer<T,D> buffer(0, syncInfoB,
+                                          TemporaryMemoryMode<D>());
                 T* bcastBuf;
 
                 if (A.ColRank() == A.ColAlign())
@@ -143,7 +145,8 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                 const Int portionSize =
                     mpi::Pad(maxLocalHeight*maxLocalWidth);
 
-                simple_buffer<T,D> buffer((colStride+1)*portionSize, syncInfoB);
+                simple_buffer<T,D> buffer((colStride+1)*portionSize, syncInfoB,
+                                          TemporaryMemoryMode<D>());
                 T* firstBuf  = buffer.data();
                 T* secondBuf = buffer.data() + portionSize;
 
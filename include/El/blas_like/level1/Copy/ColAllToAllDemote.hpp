@@ -55,7 +55,8 @@ void ColAllToAllDemote
         }
         else
         {
-            simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB);
+            simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB,
+                                      TemporaryMemoryMode<D>());
             T* firstBuf  = buffer.data();
             T* secondBuf = buffer.data() + colStrideUnion*portionSize;
 
@@ -91,7 +92,8 @@ void ColAllToAllDemote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB);
+        simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* firstBuf  = buffer.data();
         T* secondBuf = buffer.data() + colStrideUnion*portionSize;
 
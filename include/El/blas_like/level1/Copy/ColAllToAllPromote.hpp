@@ -50,7 +50,8 @@ void ColAllToAllPromote
         }
         else
         {
-            simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB);
+            simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB,
+                                      TemporaryMemoryMode<D>());
             T* firstBuf  = buffer.data();
             T* secondBuf = buffer.data() + colStrideUnion*portionSize;
 
@@ -86,7 +87,8 @@ void ColAllToAllPromote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB);
+        simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* firstBuf  = buffer.data();
         T* secondBuf = buffer.data() + colStrideUnion*portionSize;
 
@@ -64,7 +64,8 @@ void ColFilter_impl( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         const Int localWidthA = A.LocalWidth();
         const Int sendSize = localHeight*localWidthA;
         const Int recvSize = localHeight*localWidth;
-        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB);
+        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* sendBuf = buffer.data();
         T* recvBuf = buffer.data() + sendSize;
 
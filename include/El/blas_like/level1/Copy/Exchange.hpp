@@ -65,7 +65,7 @@ void Exchange_impl
     else if( contigB )
     {
         // Pack A's data
-        simple_buffer<T,D> buf(sendSize, syncInfoB);
+        simple_buffer<T,D> buf(sendSize, syncInfoB, TemporaryMemoryMode<D>());
         copy::util::InterleaveMatrix(
             localHeightA, localWidthA,
             A.LockedBuffer(), 1, A.LDim(),
@@ -79,7 +79,7 @@ void Exchange_impl
     else if( contigA )
     {
         // Exchange with the partner
-        simple_buffer<T,D> buf(recvSize, syncInfoB);
+        simple_buffer<T,D> buf(recvSize, syncInfoB, TemporaryMemoryMode<D>());
 
         mpi::SendRecv(
             A.LockedBuffer(), sendSize, sendRank,
@@ -95,14 +95,16 @@ void Exchange_impl
     else
     {
         // Pack A's data
-        simple_buffer<T,D> sendBuf(sendSize, syncInfoB);
+        simple_buffer<T,D> sendBuf(sendSize, syncInfoB,
+                                   TemporaryMemoryMode<D>());
         copy::util::InterleaveMatrix(
             localHeightA, localWidthA,
             A.LockedBuffer(), 1, A.LDim(),
             sendBuf.data(),   1, localHeightA, syncInfoB);
 
         // Exchange with the partner
-        simple_buffer<T,D> recvBuf(recvSize, syncInfoB);
+        simple_buffer<T,D> recvBuf(recvSize, syncInfoB,
+                                   TemporaryMemoryMode<D>());
 
         mpi::SendRecv(
             sendBuf.data(), sendSize, sendRank,
@@ -70,8 +70,8 @@ void Gather(
         syncInfoCPU);
     int totalRecv = Scan(recvCounts, recvOffsets);
 
-    simple_buffer<T,D> sendBuf(totalSend, syncInfoB),
-        recvBuf(totalRecv, syncInfoB);
+    simple_buffer<T,D> sendBuf(totalSend, syncInfoB, TemporaryMemoryMode<D>()),
+        recvBuf(totalRecv, syncInfoB, TemporaryMemoryMode<D>());
     if (!irrelevant)
         copy::util::InterleaveMatrix(
             A.LocalHeight(), A.LocalWidth(),
@@ -70,7 +70,8 @@ void PartialColAllGather
         else
         {
             simple_buffer<T,D> buffer(
-                (colStrideUnion+1)*portionSize, syncInfoB);
+                (colStrideUnion+1)*portionSize, syncInfoB,
+                TemporaryMemoryMode<D>());
             T* firstBuf = buffer.data();
             T* secondBuf = buffer.data() + portionSize;
 
@@ -101,7 +102,8 @@ void PartialColAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllGather" << endl;
 #endif
-        simple_buffer<T,D> buffer((colStrideUnion+1)*portionSize, syncInfoB);
+        simple_buffer<T,D> buffer((colStrideUnion+1)*portionSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* firstBuf = buffer.data();
         T* secondBuf = buffer.data() + portionSize;
 
@@ -75,7 +75,8 @@ void PartialColFilter_impl
         const Int localHeightSend = Length( height, sendColShift, colStride );
         const Int sendSize = localHeightSend*width;
         const Int recvSize = localHeight    *width;
-        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB);
+        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* sendBuf = buffer.data();
         T* recvBuf = buffer.data() + sendSize;
         // Pack
@@ -45,7 +45,8 @@ void PartialRowAllGather_impl
         else
         {
             simple_buffer<T,D> buffer((rowStrideUnion+1)*portionSize,
-                                      syncInfoB);
+                                      syncInfoB,
+                                      TemporaryMemoryMode<D>());
             T* firstBuf = buffer.data();
             T* secondBuf = buffer.data() + portionSize;
 
@@ -77,7 +78,8 @@ void PartialRowAllGather_impl
             cerr << "Unaligned PartialRowAllGather" << endl;
 #endif
         simple_buffer<T,D> buffer((rowStrideUnion+1)*portionSize,
-                                  syncInfoB);
+                                  syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* firstBuf = buffer.data();
         T* secondBuf = buffer.data() + portionSize;
 
@@ -73,7 +73,8 @@ void PartialRowFilter_impl
         const Int localWidthSend = Length( width, sendRowShift, rowStride );
         const Int sendSize = height*localWidthSend;
         const Int recvSize = height*localWidth;
-        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB);
+        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* sendBuf = buffer.data();
         T* recvBuf = buffer.data() + sendSize;
 
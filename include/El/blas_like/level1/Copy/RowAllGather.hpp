@@ -51,7 +51,8 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(localHeight*maxLocalWidth);
-                simple_buffer<T,D> buffer((rowStride+1)*portionSize, syncInfoB);
+                simple_buffer<T,D> buffer((rowStride+1)*portionSize, syncInfoB,
+                                          TemporaryMemoryMode<D>());
                 T* sendBuf = buffer.data();
                 T* recvBuf = buffer.data() + portionSize;
 
@@ -108,7 +109,8 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                simple_buffer<T,D> buffer((rowStride+1)*portionSize, syncInfoB);
+                simple_buffer<T,D> buffer((rowStride+1)*portionSize, syncInfoB,
+                                          TemporaryMemoryMode<D>());
                 T* firstBuf = buffer.data();
                 T* secondBuf = buffer.data() + portionSize;
 
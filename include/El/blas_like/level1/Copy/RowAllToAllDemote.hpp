@@ -51,7 +51,8 @@ void RowAllToAllDemote(
         else
         {
             simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize,
-                                      syncInfoB);
+                                      syncInfoB,
+                                      TemporaryMemoryMode<D>());
             T* firstBuf  = buffer.data();
             T* secondBuf = buffer.data() + rowStrideUnion*portionSize;
 
@@ -88,7 +89,8 @@ void RowAllToAllDemote(
         const Int recvRowRankPart = Mod(rowRankPart-rowDiff, rowStridePart);
 
         simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize,
-                                  syncInfoB);
+                                  syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* firstBuf  = buffer.data();
         T* secondBuf = buffer.data() + rowStrideUnion*portionSize;
 
@@ -52,7 +52,8 @@ void RowAllToAllPromote
         }
         else
         {
-            simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize, syncInfoB);
+            simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize, syncInfoB,
+                                      TemporaryMemoryMode<D>());
             T* firstBuf  = buffer.data();
             T* secondBuf = buffer.data() + rowStrideUnion*portionSize;
 
@@ -88,7 +89,8 @@ void RowAllToAllPromote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize, syncInfoB);
+        simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* firstBuf  = buffer.data();
         T* secondBuf = buffer.data() + rowStrideUnion*portionSize;
 
@@ -62,7 +62,8 @@ void RowFilter_impl
         const Int sendSize = localHeightA*localWidth;
         const Int recvSize = localHeight *localWidth;
 
-        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB);
+        simple_buffer<T,D> buffer(sendSize+recvSize, syncInfoB,
+                                  TemporaryMemoryMode<D>());
         T* sendBuf = buffer.data();
         T* recvBuf = buffer.data() + sendSize;
 
@@ -57,7 +57,7 @@ void Scatter
         return;
     }
 
-    simple_buffer<T,D> buffer(0, syncInfoB);
+    simple_buffer<T,D> buffer(0, syncInfoB, TemporaryMemoryMode<D>());
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if (A.CrossRank() == root)
     {
@@ -50,7 +50,9 @@ void TransposeDist(DistMatrix<T,U,V,ELEMENT,Device::CPU> const& A,
         const Int recvRankB =
             (recvRankA/colStrideA)+rowStrideA*(recvRankA%colStrideA);
 
-        simple_buffer<T,Device::CPU> buffer((colStrideA+rowStrideA)*portionSize);
+        simple_buffer<T,Device::CPU> buffer(
+            (colStrideA+rowStrideA)*portionSize, SyncInfo<Device::CPU>{},
+            TemporaryMemoryMode<Device::CPU>());
         T* sendBuf = buffer.data();
         T* recvBuf = buffer.data() + colStrideA*portionSize;
 
@@ -124,7 +126,9 @@ void TransposeDist(DistMatrix<T,U,V,ELEMENT,Device::CPU> const& A,
         const Int recvRankA =
             (recvRankB/rowStrideA)+colStrideA*(recvRankB%rowStrideA);
 
-        simple_buffer<T,Device::CPU> buffer((colStrideA+rowStrideA)*portionSize);
+        simple_buffer<T,Device::CPU> buffer(
+            (colStrideA+rowStrideA)*portionSize, SyncInfo<Device::CPU>{},
+            TemporaryMemoryMode<Device::CPU>());
         T* sendBuf = buffer.data();
         T* recvBuf = buffer.data() + rowStrideA*portionSize;
 
@@ -185,14 +189,21 @@ void TransposeDist(DistMatrix<T,U,V,ELEMENT,Device::CPU> const& A,
     }
     else
     {
+        // The two product-distribution temporaries, and the buffers of the
+        // redistributions between them, are drawn from the workspace
         if (A.Height() >= A.Width())
         {
+            WorkspaceScope workspace(
+              4*MaxLength(A.Height(),distSize)*A.Width()*sizeof(T));
             DistMatrix<T,ProductDist<U,V>(),ProductDistPartner<U,V>(),
                        ELEMENT,Device::CPU>
-                A_ProdDistA(A);
+                A_ProdDistA(g);
             DistMatrix<T,ProductDist<V,U>(),ProductDistPartner<V,U>(),
                        ELEMENT,Device::CPU>
                 A_ProdDistB(g);
+            UseWorkspace(A_ProdDistA);
+            UseWorkspace(A_ProdDistB);
+            A_ProdDistA = A;
             A_ProdDistB.AlignColsWith(B);
             A_ProdDistB = A_ProdDistA;
             A_ProdDistA.Empty();
@@ -200,12 +211,17 @@ void TransposeDist(DistMatrix<T,U,V,ELEMENT,Device::CPU> const& A,
         }
         else
         {
+            WorkspaceScope workspace(
+              4*A.Height()*MaxLength(A.Width(),distSize)*sizeof(T));
             DistMatrix<T,ProductDistPartner<V,U>(),ProductDist<V,U>(),
                        ELEMENT,Device::CPU>
-                A_ProdDistB(A);
+                A_ProdDistB(g);
             DistMatrix<T,ProductDistPartner<U,V>(),ProductDist<U,V>(),
                        ELEMENT,Device::CPU>
                 A_ProdDistA(g);
+            UseWorkspace(A_ProdDistB);
+            UseWorkspace(A_ProdDistA);
+            A_ProdDistB = A;
 
             A_ProdDistA.AlignRowsWith(B);
             A_ProdDistA = A_ProdDistB;
@@ -49,7 +49,13 @@ void Copy(ElementalMatrix<S> const& A,
             return;
         }
     }
+    // BOrig (and the buffers of its redistribution) are drawn from the
+    // workspace, which is trimmed once the conversion is complete
+    WorkspaceScope workspace(
+      2*MaxLength(A.Height(),B.ColStride())*
+        MaxLength(A.Width(),B.RowStride())*sizeof(S));
     DistMatrix<S,U,V,ELEMENT,D> BOrig(A.Grid());
+    UseWorkspace(BOrig);
     BOrig.AlignWith(B);
     BOrig = A;
     B.Resize(A.Height(), A.Width());
@@ -80,7 +80,7 @@ void SafeScale
         done =
           SafeScaleStep
           ( numerator, denominator, scaleStep, zero, smallNum, bigNum );
-        A *= scaleStep;
+        Scale( scaleStep, A );
     }
 }
 
@@ -111,7 +111,20 @@ void SafeScale
 ( Base<Field> numerator, Base<Field> denominator, AbstractDistMatrix<Field>& A )
 {
     EL_DEBUG_CSE
-    SafeScale( numerator, denominator, A.Matrix() );
+    typedef Base<Field> Real;
+    const Real zero(0);
+    const Real smallNum = limits::SafeMin<Real>();
+    const Real bigNum = Real(1) / smallNum;
+
+    bool done = false;
+    Real scaleStep;
+    while( !done )
+    {
+        done =
+          SafeScaleStep
+          ( numerator, denominator, scaleStep, zero, smallNum, bigNum );
+        Scale( scaleStep, A );
+    }
 }
 
 template<typename Field>
@@ -154,8 +167,8 @@ void SafeScaleHermitianTridiag
         done =
           SafeScaleStep
           ( numerator, denominator, scaleStep, zero, smallNum, bigNum );
-        d *= scaleStep;
-        e *= scaleStep;
+        Scale( scaleStep, d );
+        Scale( scaleStep, e );
     }
 }
 
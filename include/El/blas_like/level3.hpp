@@ -89,6 +89,24 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Multiply (sequential) out-of-core matrices with a common tile size,
+// holding blocks of tiles of C in memory while streaming the tiles of A and B
+// which update them. C may not alias A or B, but A and B may be the same
+// matrix, in which case each tile is pinned once.
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, OutOfCoreMatrix<T>& A, OutOfCoreMatrix<T>& B,
+  T beta,  OutOfCoreMatrix<T>& C );
+
+// Multiply tile-major matrices with a common tile size, passing their tiles
+// directly to the sequential kernel
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const TileMatrix<T>& A, const TileMatrix<T>& B,
+  T beta,        TileMatrix<T>& C );
+
 // Hemm
 // ====
 template<typename T>
@@ -126,6 +144,14 @@ void Herk(
     Base<T> alpha, const AbstractDistMatrix<T>& A,
     AbstractDistMatrix<T>& C);
 
+// Update the triangle of a tile-major matrix from the tiles of a tile-major
+// matrix with the same tile size
+template<typename T>
+void Herk(
+    UpperOrLower uplo, Orientation orientation,
+    Base<T> alpha, TileMatrix<T> const& A,
+    Base<T> beta, TileMatrix<T>& C);
+
 // Her2k
 // =====
 template<typename T>
@@ -391,12 +417,19 @@ void LocalTrmm
 
 // Trsm
 // ====
+// TRSM_DEFAULT selects an algorithm from the order of the triangle, the number
+// of right-hand sides, and the grid; TRSM_RECURSIVE recursively halves the
+// triangle so that most of the work is performed by distributed Gemms; and
+// TRSM_LOOKAHEAD (which only supports solving from the left) overlaps the
+// communication of each panel of the solution with the trailing update
 namespace TrsmAlgorithmNS {
 enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  TRSM_RECURSIVE,
+  TRSM_LOOKAHEAD
 };
 }
 using namespace TrsmAlgorithmNS;
@@ -426,6 +459,14 @@ void LocalTrsm
         AbstractDistMatrix<F>& X,
   bool checkIfSingular=false );
 
+// Solve against a tile-major triangle, with a tile-major right-hand side
+// which shares its tile size
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const TileMatrix<F>& A, TileMatrix<F>& B );
+
 // Trstrm
 // ======
 template<typename F>
@@ -569,6 +610,110 @@ void LocalTrr2k
   T beta,  const AbstractDistMatrix<T>& C, const AbstractDistMatrix<T>& D,
   T gamma,       AbstractDistMatrix<T>& E );
 
+// Batched Gemm, Trsm, and Herk
+// ============================
+// Each routine applies the same operation to a batch of independent small
+// matrices while avoiding the per-call overhead of the AbstractMatrix
+// interface. The matrices of a 'StridedBatched' batch are of uniform size and
+// the b'th of them begins at, e.g., A+b*strideA, whereas the 'Batched' routines
+// accept arrays of the dimensions, pointers, and leading dimensions of each
+// matrix. The batch is divided between the OpenMP threads. Gemms with
+// m = n = k equal to 2, 4, or 8 are performed with fully-unrolled kernels, and
+// those of every other size call the BLAS.
+//
+// The Matrix and AbstractDistMatrix variants store one (column-major) matrix
+// per column of their arguments, with leading dimension equal to the number of
+// rows of the stored matrix; the distributed batches are spread over the
+// processes of the grid within a [* ,VR] distribution so that each process
+// independently operates upon the matrices that it owns.
+
+template<typename T>
+void GemmStridedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* B, Int BLDim, Int strideB,
+  T beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount );
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  const Int* m, const Int* n, const Int* k,
+  T alpha, const T* const* A, const Int* ALDim,
+           const T* const* B, const Int* BLDim,
+  T beta,        T* const* C, const Int* CLDim,
+  Int batchCount );
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C );
+
+// B := alpha op(A)^-1 B or B := alpha B op(A)^-1, where B is m x n
+template<typename F>
+void TrsmStridedBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* A, Int ALDim, Int strideA,
+                 F* B, Int BLDim, Int strideB,
+  Int batchCount );
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  const Int* m, const Int* n,
+  F alpha, const F* const* A, const Int* ALDim,
+                 F* const* B, const Int* BLDim,
+  Int batchCount );
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const Matrix<F>& A, Matrix<F>& B );
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B );
+
+// C := alpha op(A) op(A)^H + beta C, where C is n x n and op(A) is n x k
+template<typename T>
+void HerkStridedBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* A, Int ALDim, Int strideA,
+  Base<T> beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount );
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  const Int* n, const Int* k,
+  Base<T> alpha, const T* const* A, const Int* ALDim,
+  Base<T> beta,        T* const* C, const Int* CLDim,
+  Int batchCount );
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const Matrix<T>& A,
+  Base<T> beta,        Matrix<T>& C );
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const AbstractDistMatrix<T>& A,
+  Base<T> beta,        AbstractDistMatrix<T>& C );
+
 // Hermitian from EVD
 // ==================
 // A := Z diag(w) Z^H, where w is real
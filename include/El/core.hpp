@@ -301,6 +301,9 @@ class DistMatrix;
 
 } // namespace El
 
+#include <El/core/HugePages.hpp>
+#include <El/core/Numa.hpp>
+#include <El/core/Workspace.hpp>
 #include <El/core/MemoryPool.hpp>
 #include <El/core/Memory.hpp>
 #include <El/core/AbstractMatrix.hpp>
@@ -334,5 +337,7 @@ class DistMatrix;
 
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
+#include <El/core/OutOfCoreMatrix.hpp>
+#include <El/core/TileMatrix.hpp>
 
 #endif // ifndef EL_CORE_HPP
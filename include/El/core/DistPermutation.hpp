@@ -10,13 +10,19 @@
 #define EL_PERM_DISTPERMUTATION_HPP
 
 #include <map>
+#include <tuple>
 
 namespace El {
 
+// The exchange plan for applying a permutation to the rows (or columns) of a
+// distributed matrix whose rows (or columns) are distributed over 'comm' with
+// the alignment 'align'
 struct PermutationMeta
 {
     Int align;
-    mpi::Comm comm;
+    // The communicator is owned by the Grid of the permuted matrix (and is
+    // refreshed whenever the plan is retrieved from the cache)
+    const mpi::Comm* comm;
 
     // Will treat vector lengths as one
     vector<int> sendCounts, sendDispls,
@@ -52,22 +58,25 @@ struct PermutationMeta
     }
 
     PermutationMeta()
-        : align(0), /*comm(mpi::COMM_SELF), FIXME (trb)*/
+        : align(0), comm(nullptr),
           sendCounts(1,0), sendDispls(1,0),
           recvCounts(1,0), recvDispls(1,0)
     { }
 
+    // Move index sources[k] to index dests[k] for each k; the moves must
+    // form a permutation of the union of the sources
     PermutationMeta
-    ( const DistMatrix<Int,STAR,STAR>& p,
-      const DistMatrix<Int,STAR,STAR>& pInv,
+    ( const vector<Int>& sources,
+      const vector<Int>& dests,
             Int permAlign,
-            mpi::Comm permComm );
+      const mpi::Comm& permComm );
 
-    void Update
+    // The partial permutation of a pivot sequence over the first b indices
+    PermutationMeta
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
             Int permAlign,
-            mpi::Comm permComm );
+      const mpi::Comm& permComm );
 };
 
 // TODO(poulson): Convert to accepting Grid rather than mpi::Comm
@@ -185,10 +194,17 @@ private:
     mutable DistMatrix<Int,VC,STAR> invPerm_;
     mutable bool staleInverse_=true;
 
-    // Use the alignment and communicator as a key
-    typedef std::pair<Int,mpi::Comm> keyType_;
-    mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
+    // The exchange plans are cached using the alignment, the context id of
+    // the communicator, and the offset as a key; the plans of communicators
+    // which have since been freed are discarded. Swap sequences are applied
+    // through the same plans, so that all of their swaps are performed with a
+    // single exchange.
+    typedef std::tuple<Int,unsigned long long,Int> keyType_;
+    mutable std::map<keyType_,PermutationMeta> meta_;
     mutable bool staleMeta_=false;
+
+    const PermutationMeta& Meta
+    ( Int align, const mpi::Comm& comm, Int offset ) const;
 };
 
 } // namespace El
@@ -0,0 +1,60 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_HUGEPAGES_HPP
+#define EL_CORE_HUGEPAGES_HPP
+
+#include <cstddef>
+
+namespace El {
+
+// HUGE_PAGE_MEMORY_MODE (see El/core/Memory/decl.hpp) is the CPU memory mode
+// of Memory (and Matrix::SetMemoryMode) which draws from a host memory pool
+// whose allocations of at least hugepages::Threshold() bytes are aligned to,
+// and backed by, huge pages: explicit (hugetlbfs) pages when the system has
+// reserved them, and otherwise transparent huge pages requested with madvise.
+// Smaller allocations are ordinary pooled memory.
+
+struct HugePageStats
+{
+    // The bytes currently mapped for huge-page allocations (including those
+    // cached by the memory pools)
+    size_t mappedBytes=0;
+    // The portion backed by explicit huge pages
+    size_t explicitBytes=0;
+    // The portion which the kernel reports as transparent huge pages
+    size_t transparentBytes=0;
+    // The number of allocations which could not obtain explicit huge pages
+    size_t explicitFailures=0;
+};
+
+namespace hugepages {
+
+// The huge page size (typically 2 MB)
+size_t PageSize();
+
+// The smallest allocation which is backed by huge pages
+size_t Threshold();
+void SetThreshold( size_t bytes );
+
+// Whether to first attempt to use explicit huge pages
+bool UseExplicit();
+void SetUseExplicit( bool useExplicit );
+
+// Allocations are rounded up to a multiple of, and aligned to, PageSize()
+void* Allocate( size_t bytes );
+// Returns false (and does nothing) if ptr was not returned by Allocate
+bool Free( void* ptr );
+
+// Measured from /proc/self/smaps for the transparent huge pages
+HugePageStats Stats();
+
+} // namespace hugepages
+} // namespace El
+
+#endif // ifndef EL_CORE_HUGEPAGES_HPP
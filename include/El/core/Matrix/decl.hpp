@@ -182,6 +182,13 @@ public:
     void SetMemoryMode(memory_mode_type mode) override;
     memory_mode_type MemoryMode() const EL_NO_EXCEPT override;
 
+    /** Declare that the columns will be divided evenly among numThreads
+     *  threads (all of the OpenMP threads if zero), as by a static
+     *  schedule. In NUMA_FIRST_TOUCH_MEMORY_MODE, each new buffer is then
+     *  first touched by the threads which own its columns. */
+    void SetThreadPartition(Int numThreads);
+    Int ThreadPartition() const EL_NO_EXCEPT;
+
     ///@}
 
     // Single-entry manipulation
@@ -236,6 +243,10 @@ private:
         size_type const&, size_type const&, size_type const&) override;
     void do_swap_(AbstractMatrix<T>& A) override;
 
+    // Zero the first width columns of a fresh buffer with the given leading
+    // dimension using the declared partition of the columns
+    void FirstTouch_(Int ldim, Int width);
+
     void Attach_(
         size_type height, size_type width, value_type* buffer,
         size_type leadingDimension);
@@ -281,6 +292,8 @@ private:
     // Const-correctness is internally managed to avoid the need for storing
     // two separate pointers with different 'const' attributes
     T* data_ = nullptr;
+    // The number of threads among which the columns are divided
+    Int threadPartition_ = 0;
 };
 
 template <typename T, Device D>
@@ -86,7 +86,8 @@ Matrix<T, Device::CPU>::Matrix(Matrix<T, Device::GPU> const& A)
 template <typename T>
 Matrix<T, Device::CPU>::Matrix(Matrix<T, Device::CPU>&& A) EL_NO_EXCEPT
     : AbstractMatrix<T>(std::move(A)),
-    memory_{std::move(A.memory_)}, data_{A.data_}
+    memory_{std::move(A.memory_)}, data_{A.data_},
+    threadPartition_{A.threadPartition_}
 {
     A.data_ = nullptr;
 }
@@ -276,9 +277,15 @@ template <typename T>
 void Matrix<T, Device::CPU>::SetMemoryMode(memory_mode_type mode)
 {
     const auto oldBuffer = memory_.Buffer();
+    const auto oldMode = memory_.Mode();
     memory_.SetMode(mode);
     if (data_ == oldBuffer)
+    {
         data_ = memory_.Buffer();
+        if (data_ != nullptr && mode != oldMode &&
+            mode == NUMA_FIRST_TOUCH_MEMORY_MODE)
+            FirstTouch_(this->LDim(), this->Width());
+    }
 }
 
 template <typename T>
@@ -286,6 +293,19 @@ auto Matrix<T, Device::CPU>::MemoryMode() const EL_NO_EXCEPT
     -> memory_mode_type
 { return memory_.Mode(); }
 
+template <typename T>
+void Matrix<T, Device::CPU>::SetThreadPartition(Int numThreads)
+{
+    EL_DEBUG_CSE;
+    if (numThreads < 0)
+        LogicError("Invalid thread partition: ",numThreads);
+    threadPartition_ = numThreads;
+}
+
+template <typename T>
+Int Matrix<T, Device::CPU>::ThreadPartition() const EL_NO_EXCEPT
+{ return threadPartition_; }
+
 // Single-entry manipulation
 // =========================
 
@@ -544,6 +564,7 @@ void Matrix<T, Device::CPU>::SwapImpl_(
     EL_DEBUG_CSE;
     memory_.ShallowSwap(A.memory_);
     std::swap(data_, A.data_);
+    std::swap(threadPartition_, A.threadPartition_);
 }
 
 template <typename T>
@@ -639,7 +660,39 @@ void Matrix<T, Device::CPU>::do_resize_(
     size_type const& /*height*/, size_type const& width,
     size_type const& ldim)
 {
+    const bool allocating = size_t(ldim * width) > memory_.Size();
     data_ = memory_.Require(ldim * width);
+    // The new sizes have not yet been recorded, so they are passed through
+    if (allocating && memory_.Mode() == NUMA_FIRST_TOUCH_MEMORY_MODE)
+        FirstTouch_(ldim, width);
+}
+
+template <typename T>
+void Matrix<T, Device::CPU>::FirstTouch_(Int ldim, Int width)
+{
+    // Each page is placed on the node of the first thread to write to it, so
+    // the columns are zeroed with the same static partition as the kernels:
+    // the first width % team threads own one more column than the rest
+    T* buffer = memory_.Buffer();
+#ifdef EL_HYBRID
+    const int numThreads =
+      (threadPartition_ > 0 ? int(threadPartition_) : omp_get_max_threads());
+    #pragma omp parallel num_threads(numThreads)
+#endif
+    {
+#ifdef EL_HYBRID
+        const Int thread = omp_get_thread_num();
+        const Int team = omp_get_num_threads();
+#else
+        const Int thread = 0, team = 1;
+#endif
+        const Int quotient = width / team, remainder = width % team;
+        const Int beg = thread*quotient + Min(thread,remainder);
+        const Int end = beg + quotient + (thread < remainder ? 1 : 0);
+        MemZero(buffer+beg*ldim, (end-beg)*ldim);
+        numa::ReportFirstTouch(
+            buffer+beg*ldim, (end-beg)*ldim*sizeof(T), int(thread));
+    }
 }
 
 // For supporting duck typing
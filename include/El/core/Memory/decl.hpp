@@ -39,6 +39,29 @@ constexpr unsigned DefaultMemoryMode<Device::GPU>()
 }
 #endif // HYDROGEN_HAVE_GPU
 
+// The CPU memory modes beyond the built-in ones (0-3), each of which is
+// described alongside the allocator which implements it:
+//
+//   4-6: NUMA placement (see El/core/Numa.hpp),
+//   7:   huge pages (see El/core/HugePages.hpp), and
+//   8:   the workspace arenas (see El/core/Workspace.hpp).
+constexpr unsigned NUMA_INTERLEAVED_MEMORY_MODE = 4;
+constexpr unsigned NUMA_FIRST_TOUCH_MEMORY_MODE = 5;
+constexpr unsigned NUMA_LOCAL_POOL_MEMORY_MODE = 6;
+constexpr unsigned HUGE_PAGE_MEMORY_MODE = 7;
+constexpr unsigned WORKSPACE_MEMORY_MODE = 8;
+
+// The mode of short-lived buffers, which on the CPU are drawn from the calling
+// thread's workspace arena (see El/core/Workspace.hpp) unless it is disabled
+template <Device D>
+unsigned TemporaryMemoryMode()
+{
+    return DefaultMemoryMode<D>();
+}
+
+template <>
+unsigned TemporaryMemoryMode<Device::CPU>();
+
 template<typename G, Device D=Device::CPU>
 class Memory
 {
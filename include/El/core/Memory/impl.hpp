@@ -65,6 +65,22 @@ G* New(size_t size, unsigned int mode, SyncInfo<Device::CPU> const&)
     }
     break;
 #endif // HYDROGEN_HAVE_GPU
+    case NUMA_INTERLEAVED_MEMORY_MODE:
+        ptr = static_cast<G*>(numa::AllocateInterleaved(size * sizeof(G)));
+        break;
+    case NUMA_FIRST_TOUCH_MEMORY_MODE:
+        ptr = static_cast<G*>(numa::Allocate(size * sizeof(G)));
+        break;
+    case NUMA_LOCAL_POOL_MEMORY_MODE:
+        ptr = static_cast<G*>(
+            NodeHostMemoryPool(numa::CurrentNode()).Allocate(size * sizeof(G)));
+        break;
+    case HUGE_PAGE_MEMORY_MODE:
+        ptr = static_cast<G*>(HugePageHostMemoryPool().Allocate(size * sizeof(G)));
+        break;
+    case WORKSPACE_MEMORY_MODE:
+        ptr = static_cast<G*>(DefaultWorkspaceArena().Allocate(size * sizeof(G)));
+        break;
     default: RuntimeError("Invalid CPU memory allocation mode");
     }
     return ptr;
@@ -96,6 +112,15 @@ void Delete( G*& ptr, unsigned int mode, SyncInfo<Device::CPU> const& )
     }
     break;
 #endif // HYDROGEN_HAVE_GPU
+    case NUMA_INTERLEAVED_MEMORY_MODE:
+    case NUMA_FIRST_TOUCH_MEMORY_MODE:
+        numa::Free(ptr);
+        break;
+    case NUMA_LOCAL_POOL_MEMORY_MODE:
+        OwningNodeHostMemoryPool(ptr).Free(ptr);
+        break;
+    case HUGE_PAGE_MEMORY_MODE: HugePageHostMemoryPool().Free(ptr); break;
+    case WORKSPACE_MEMORY_MODE: WorkspaceArena::FreeBlock(ptr); break;
     default: RuntimeError("Invalid CPU memory deallocation mode");
     }
     ptr = nullptr;
@@ -105,7 +130,12 @@ template <typename G>
 void MemZero( G* buffer, size_t numEntries, unsigned int mode,
               SyncInfo<Device::CPU> const& )
 {
-    MemZero(buffer, numEntries);
+    // Zeroing in parallel places the pages of a fresh first-touch buffer
+    // next to the threads which own them
+    if (mode == NUMA_FIRST_TOUCH_MEMORY_MODE && IsPacked<G>::value)
+        numa::FirstTouch(buffer, numEntries*sizeof(G));
+    else
+        MemZero(buffer, numEntries);
 }
 
 #ifdef HYDROGEN_HAVE_GPU
@@ -17,6 +17,9 @@
 #include <unordered_map>
 #include <vector>
 
+#include "El/core/HugePages.hpp"
+#include "El/core/Numa.hpp"
+
 namespace El
 {
 namespace details
@@ -38,6 +41,8 @@ void ThrowRuntimeError(Args&&... args)
  *  and freed directly.
  *  This memory pool is thread-safe.
  *  @tparam Pinned Whether this pool allocates CUDA pinned memory.
+ *  Unpinned pools may bind their memory to a NUMA node, or back their
+ *  allocations of at least hugepages::Threshold() bytes with huge pages.
  */
 template <bool Pinned>
 class MemoryPool
@@ -50,10 +55,15 @@ public:
      *  @param bin_growth Controls how fast bins grow.
      *  @param min_bin_size Smallest bin size (in bytes).
      *  @param max_bin_size Largest bin size (in bytes).
+     *  @param numa_node NUMA node of the allocations (-1 for any).
+     *  @param huge_pages Whether large allocations use huge pages.
      */
     MemoryPool(float bin_growth = 1.6,
                size_t min_bin_size = 1,
-               size_t max_bin_size = 1<<26)
+               size_t max_bin_size = 1<<26,
+               int numa_node = -1,
+               bool huge_pages = false)
+        : numa_node_(numa_node), huge_pages_(huge_pages)
     {
         std::set<size_t> bin_sizes;
         for (float bin_size = min_bin_size;
@@ -131,13 +141,31 @@ public:
             }
         }
     }
+    /** Whether ptr is currently allocated from this pool. */
+    bool Owns(void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return alloc_to_bin_.count(ptr) > 0;
+    }
+    /** NUMA node of the allocations (-1 for any). */
+    int NumaNode() const noexcept { return numa_node_; }
+    /** Whether subsequent large allocations use huge pages. */
+    void SetHugePages(bool huge_pages)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        huge_pages_ = huge_pages;
+    }
+    bool HugePages() const noexcept { return huge_pages_; }
     /** Release all unused memory. */
     void FreeAllUnused()
     {
         std::lock_guard<std::mutex> lock(mutex_);
         for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+        {
             for (auto&& ptr : free_data_[bin])
                 do_free(ptr);
+            free_data_[bin].clear();
+        }
     }
 
 private:
@@ -148,6 +176,11 @@ private:
     /** Serialize access from multiple threads. */
     std::mutex mutex_;
 
+    /** NUMA node of the allocations (-1 for any). */
+    int numa_node_;
+    /** Whether large allocations use huge pages. */
+    bool huge_pages_;
+
     /** Size in bytes of each bin. */
     std::vector<size_t> bin_sizes_;
     /** Data available to allocate.
@@ -233,6 +266,10 @@ inline void MemoryPool<true>::do_free(void* ptr)
 
 template <>
 inline void* MemoryPool<false>::do_allocation(size_t bytes) {
+    if (numa_node_ >= 0)
+        return numa::AllocateOnNode(bytes, numa_node_);
+    if (huge_pages_ && bytes >= hugepages::Threshold())
+        return hugepages::Allocate(bytes);
     void* ptr = std::malloc(bytes);
     if (ptr == nullptr)
     {
@@ -244,7 +281,11 @@ inline void* MemoryPool<false>::do_allocation(size_t bytes) {
 template<>
 inline void MemoryPool<false>::do_free(void* ptr)
 {
-    return std::free(ptr);
+    // Huge pages may have been enabled or disabled since ptr was allocated
+    if (numa_node_ >= 0)
+        numa::Free(ptr);
+    else if (!hugepages::Free(ptr))
+        std::free(ptr);
 }
 
 #ifdef HYDROGEN_HAVE_GPU
@@ -257,6 +298,18 @@ void DestroyPinnedHostMemoryPool();
 MemoryPool<false>& HostMemoryPool();
 /** Destroy singleton instance of host memory pool. */
 void DestroyHostMemoryPool();
+/** Get singleton instance of the huge-page host memory pool. */
+MemoryPool<false>& HugePageHostMemoryPool();
+/** Release the cached memory of the huge-page host memory pool (which,
+ *  unlike the other pools, lives until exit so that its first use is
+ *  thread-safe). */
+void DestroyHugePageHostMemoryPool();
+/** Get the host memory pool bound to a NUMA node. */
+MemoryPool<false>& NodeHostMemoryPool(int node);
+/** Get the NUMA-node host memory pool which allocated ptr. */
+MemoryPool<false>& OwningNodeHostMemoryPool(void* ptr);
+/** Destroy the NUMA-node host memory pools. */
+void DestroyNodeHostMemoryPools();
 
 }  // namespace El
 
@@ -0,0 +1,59 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_NUMA_HPP
+#define EL_CORE_NUMA_HPP
+
+#include <cstddef>
+
+namespace El {
+
+// The CPU memory modes of Memory (and Matrix::SetMemoryMode) which control
+// the NUMA placement of their pages (see El/core/Memory/decl.hpp):
+//
+//   NUMA_INTERLEAVED_MEMORY_MODE: fresh pages interleaved over all nodes,
+//   NUMA_FIRST_TOUCH_MEMORY_MODE: fresh pages which are placed by the first
+//     thread to touch them (zero-initialization, and the first touch of a
+//     Matrix, are performed in parallel by the threads which own each part
+//     of the buffer; see Matrix::SetThreadPartition), and
+//   NUMA_LOCAL_POOL_MEMORY_MODE: memory from the pool of the allocating
+//     thread's node, whose pages are bound to that node and are returned to
+//     it when freed.
+//
+// Without multiple NUMA nodes (or support for binding memory to them), the
+// placement requests are simply ignored.
+
+namespace numa {
+
+// The number of NUMA nodes and the node of the calling thread
+int NumNodes();
+int CurrentNode();
+
+// Page-aligned allocations of fresh pages which are either left to be placed
+// by their first touch, interleaved over all nodes, or bound to a single node
+void* Allocate( size_t bytes );
+void* AllocateInterleaved( size_t bytes );
+void* AllocateOnNode( size_t bytes, int node );
+void Free( void* ptr );
+
+// Zero a buffer with numThreads threads (all of the OpenMP threads if it is
+// zero), each of which touches an equal contiguous chunk
+void FirstTouch( void* buffer, size_t bytes, int numThreads=0 );
+
+// A callback which is handed each contiguous range zeroed by a first-touch
+// pass along with the OpenMP thread which zeroed it, so that the placement
+// can be checked without multiple NUMA nodes. ReportFirstTouch invokes it
+// (if one is set) and is called by every first-touch pass.
+typedef void (*FirstTouchHook)( const void* begin, size_t bytes, int thread );
+void SetFirstTouchHook( FirstTouchHook hook );
+void ReportFirstTouch( const void* begin, size_t bytes, int thread );
+
+} // namespace numa
+} // namespace El
+
+#endif // ifndef EL_CORE_NUMA_HPP
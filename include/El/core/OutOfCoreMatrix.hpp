@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_OUTOFCOREMATRIX_HPP
+#define EL_CORE_OUTOFCOREMATRIX_HPP
+
+namespace El {
+
+struct OutOfCoreCtrl
+{
+    // The height and width of the (square) tiles; zero selects Blocksize()
+    Int tileSize=0;
+
+    // The number of tiles which may be held in memory at once
+    Int cacheTiles=64;
+
+    // The directory holding the scratch file, which should be node-local.
+    // The file is unlinked as soon as it is created, so that it disappears
+    // along with the process.
+    string directory=".";
+
+    // Whether tiles are copied to and from a shared mapping of the scratch
+    // file rather than read and written with explicit I/O calls
+    bool memoryMapped=false;
+
+    // Whether Prefetch reads tiles and modified tiles are written back from
+    // a background thread, rather than only on demand
+    bool asyncIO=true;
+};
+
+struct OutOfCoreStats
+{
+    Int hits=0;       // pins of tiles which were already (being) cached
+    Int misses=0;     // pins of tiles which had to be loaded or zeroed
+    Int reads=0;      // tiles read from the scratch file
+    Int writes=0;     // tiles written to the scratch file
+    Int prefetches=0; // reads begun by Prefetch
+};
+
+namespace ooc {
+
+// The type-agnostic tile cache behind OutOfCoreMatrix: 'numTiles' tiles of
+// 'tileBytes' bytes each, at most 'ctrl.cacheTiles' of which are held in
+// memory, with the least recently used unpinned tile evicted first
+class TileCache
+{
+public:
+    TileCache( Int numTiles, size_t tileBytes, const OutOfCoreCtrl& ctrl );
+    ~TileCache();
+
+    TileCache( const TileCache& ) = delete;
+    TileCache& operator=( const TileCache& ) = delete;
+
+    // If 'load' is false, the previous contents of the tile are not needed
+    // and the returned buffer is left uninitialized
+    char* Pin( Int tile, bool load );
+    void Unpin( Int tile, bool modified );
+    void Prefetch( Int tile );
+    void Flush();
+
+    Int Capacity() const EL_NO_EXCEPT;
+    OutOfCoreStats Stats() const;
+
+private:
+    struct Impl;
+    unique_ptr<Impl> impl_;
+};
+
+} // namespace ooc
+
+// A (sequential) matrix whose square tiles are stored in a scratch file
+// belonging to the calling process, of which only a bounded number are cached
+// in memory. There is no distributed counterpart: each process may hold its
+// own out-of-core matrices, but the Gemm and Cholesky drivers over them are
+// sequential. Tile (i,j) covers rows [i*TileSize(),(i+1)*TileSize()) and
+// columns [j*TileSize(),(j+1)*TileSize()), clipped to the matrix, and the
+// matrix is initially zero.
+//
+// The entries of a tile may only be accessed between a call to Pin, which
+// returns a view of the cached tile, and the matching call to Unpin. Since
+// pinned tiles are never evicted, no more than CacheTiles() may be pinned at
+// once. The pins of different tiles may come from different threads.
+template<typename T>
+class OutOfCoreMatrix
+{
+public:
+    OutOfCoreMatrix
+    ( Int height, Int width, const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
+    OutOfCoreMatrix( const OutOfCoreMatrix<T>& ) = delete;
+    OutOfCoreMatrix<T>& operator=( const OutOfCoreMatrix<T>& ) = delete;
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int TileSize() const EL_NO_EXCEPT { return tileSize_; }
+    Int TileRows() const EL_NO_EXCEPT { return tileRows_; }
+    Int TileCols() const EL_NO_EXCEPT { return tileCols_; }
+    Int TileHeight( Int i ) const EL_NO_EXCEPT
+    { return Min(tileSize_,height_-i*tileSize_); }
+    Int TileWidth( Int j ) const EL_NO_EXCEPT
+    { return Min(tileSize_,width_-j*tileSize_); }
+    Int CacheTiles() const EL_NO_EXCEPT { return cache_->Capacity(); }
+
+    // If 'load' is false, the tile is about to be overwritten, and the view
+    // is returned without reading its previous contents
+    Matrix<T> Pin( Int i, Int j, bool load=true );
+    void Unpin( Int i, Int j, bool modified );
+
+    // Hint that tile (i,j) will soon be pinned
+    void Prefetch( Int i, Int j );
+
+    // Write every modified tile which is not pinned back to the scratch file
+    // (pinned tiles may still be changing, and are written back once they
+    // have been unpinned and are either evicted or flushed)
+    void Flush();
+
+    // Copy an in-memory matrix of the same size into the tiles, or the tiles
+    // into an in-memory matrix
+    void Import( const Matrix<T>& A );
+    void Export( Matrix<T>& A );
+
+    OutOfCoreStats Stats() const { return cache_->Stats(); }
+
+private:
+    Int height_, width_, tileSize_, tileRows_, tileCols_;
+    unique_ptr<ooc::TileCache> cache_;
+
+    Int Index( Int i, Int j ) const EL_NO_EXCEPT { return i + j*tileRows_; }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_OUTOFCOREMATRIX_HPP
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_TILEMATRIX_HPP
+#define EL_CORE_TILEMATRIX_HPP
+
+namespace El {
+
+// A sequential matrix stored in tile-major order: each of its square tiles is
+// contiguous (and column-major), and the tiles are themselves ordered by
+// columns. Every tile, including those along the bottom and right edges,
+// occupies TileSize() x TileSize() entries, so that Tile(i,j) is an ordinary
+// Matrix with leading dimension TileSize() which may be handed directly to the
+// sequential kernels.
+//
+// Views of submatrices are only supported when their first row and column
+// lie on tile boundaries, in which case the view shares the tiles of its
+// parent.
+template<typename T>
+class TileMatrix
+{
+public:
+    // A tile size of zero selects Blocksize()
+    explicit TileMatrix( Int tileSize=0 );
+    TileMatrix( Int height, Int width, Int tileSize=0 );
+
+    // Copies are deep (and owned), while moves preserve views
+    TileMatrix( const TileMatrix<T>& A );
+    TileMatrix( TileMatrix<T>&& A );
+    TileMatrix<T>& operator=( const TileMatrix<T>& A );
+
+    // The entries are not preserved, and views may not change size
+    void Resize( Int height, Int width );
+    void Empty();
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int TileSize() const EL_NO_EXCEPT { return tileSize_; }
+    Int TileRows() const EL_NO_EXCEPT
+    { return (height_+tileSize_-1) / tileSize_; }
+    Int TileCols() const EL_NO_EXCEPT
+    { return (width_+tileSize_-1) / tileSize_; }
+    Int TileHeight( Int i ) const EL_NO_EXCEPT
+    { return Min(tileSize_,height_-i*tileSize_); }
+    Int TileWidth( Int j ) const EL_NO_EXCEPT
+    { return Min(tileSize_,width_-j*tileSize_); }
+    bool Viewing() const EL_NO_EXCEPT { return viewing_; }
+    bool Locked() const EL_NO_EXCEPT { return locked_; }
+
+    // Views of tile (i,j)
+    Matrix<T> Tile( Int i, Int j );
+    const Matrix<T> LockedTile( Int i, Int j ) const;
+
+    // Views of tile-aligned submatrices
+    TileMatrix<T> operator()( Range<Int> I, Range<Int> J );
+    const TileMatrix<T> operator()( Range<Int> I, Range<Int> J ) const;
+
+    T Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        return CRef( i, j );
+    }
+    void Set( Int i, Int j, const T& alpha ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        Ref( i, j ) = alpha;
+    }
+    void Update( Int i, Int j, const T& alpha ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        Ref( i, j ) += alpha;
+    }
+
+    const T& CRef( Int i, Int j ) const EL_NO_RELEASE_EXCEPT
+    { return buffer_[Offset(i,j)]; }
+    T& Ref( Int i, Int j ) EL_NO_RELEASE_EXCEPT
+    { return buffer_[Offset(i,j)]; }
+
+private:
+    Int height_=0, width_=0, tileSize_;
+    // The number of tiles between the starts of consecutive tile columns
+    Int tileStride_=0;
+    bool viewing_=false, locked_=false;
+    T* buffer_=nullptr;
+    Memory<T,Device::CPU> memory_;
+
+    Int Offset( Int i, Int j ) const EL_NO_EXCEPT
+    {
+        const Int b = tileSize_;
+        return (i/b + (j/b)*tileStride_)*b*b + i%b + (j%b)*b;
+    }
+    void AssertValidEntry( Int i, Int j ) const;
+    TileMatrix<T> ViewOf( Range<Int> I, Range<Int> J, bool locked ) const;
+};
+
+template<typename T>
+void Copy( const Matrix<T>& A, TileMatrix<T>& B );
+template<typename T>
+void Copy( const TileMatrix<T>& A, Matrix<T>& B );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_TILEMATRIX_HPP
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_WORKSPACE_HPP
+#define EL_CORE_WORKSPACE_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <El/core/Memory/decl.hpp>
+
+namespace El {
+
+// WORKSPACE_MEMORY_MODE (see El/core/Memory/decl.hpp) is the CPU memory mode
+// of Memory (and Matrix::SetMemoryMode) which draws from the calling thread's
+// workspace arena. Such memory may be freed by any thread, and outlives the
+// thread which allocated it.
+
+// A bump allocator with stack discipline for the temporaries of algorithms.
+// Blocks are carved off of the top of the most recent chunk and are returned
+// by popping them off of the top of the stack; a block which is freed out of
+// order is only reclaimed once every block above it has been freed. When the
+// arena is empty, the chunks which it acquired while growing are merged into
+// one, so that the next pass of an algorithm runs within a single chunk.
+//
+// Each thread should allocate from its own arena (see DefaultWorkspaceArena),
+// but a block may be freed from any thread. An arena must outlive its
+// blocks; the default arenas are kept alive until their last block is freed.
+class WorkspaceArena
+{
+public:
+    // Every block is aligned to (at least) this many bytes
+    static constexpr size_t Alignment = 64;
+
+    WorkspaceArena() = default;
+    ~WorkspaceArena();
+    WorkspaceArena( const WorkspaceArena& ) = delete;
+    WorkspaceArena& operator=( const WorkspaceArena& ) = delete;
+
+    void* Allocate( size_t bytes );
+    // ptr must have been returned by Allocate from this arena
+    void Free( void* ptr );
+    // Free a block on behalf of whichever arena allocated it
+    static void FreeBlock( void* ptr );
+
+    // Ensure that bytes can be allocated without acquiring another chunk
+    void Reserve( size_t bytes );
+    // Merge the chunks into one if no blocks are outstanding
+    void Trim();
+    // Free all of the chunks which do not hold outstanding blocks
+    void Release();
+
+    // The bytes held in chunks
+    size_t Capacity() const EL_NO_EXCEPT;
+    // The bytes of the blocks on the stack, including their headers and the
+    // freed blocks which are buried beneath outstanding ones
+    size_t Used() const EL_NO_EXCEPT { return used_; }
+    // The largest value of Used() since the arena was created
+    size_t HighWater() const EL_NO_EXCEPT { return highWater_; }
+    // The number of blocks on the stack
+    size_t NumBlocks() const EL_NO_EXCEPT { return blocks_.size(); }
+    size_t NumChunks() const EL_NO_EXCEPT { return chunks_.size(); }
+
+private:
+    struct Chunk
+    {
+        char* raw;
+        char* data;
+        size_t capacity;
+        size_t top;
+    };
+    struct Block
+    {
+        size_t chunk;
+        size_t offset;
+        size_t bytes;
+        bool freed;
+    };
+    std::vector<Chunk> chunks_;
+    std::vector<Block> blocks_;
+    size_t current_=0, used_=0, highWater_=0;
+    // Guards the stack against frees from other threads
+    mutable std::mutex mutex_;
+    // Whether the thread which owned the arena has exited, in which case the
+    // last free deletes it
+    bool orphaned_=false;
+
+    void PushChunk( size_t capacity );
+    void FreeChunks( size_t first );
+    void TrimLocked();
+    // Delete the arena now if it is empty, or else once it has emptied
+    void Orphan();
+
+    friend class WorkspaceArenaHolder;
+};
+
+// The workspace arena of the calling thread
+WorkspaceArena& DefaultWorkspaceArena();
+
+// Whether temporaries are drawn from the workspace arenas (the default) or
+// from the default memory mode
+bool UsingWorkspace();
+void SetUseWorkspace( bool useWorkspace );
+
+// Marks the extent of an algorithm's temporaries within the calling thread's
+// arena. The constructor reserves room for hintBytes so that the algorithm
+// does not acquire new chunks mid-flight, and leaving the outermost scope
+// trims the arena back to a single chunk (blocks which outlive the scope are
+// left in place).
+class WorkspaceScope
+{
+public:
+    explicit WorkspaceScope( size_t hintBytes=0 );
+    ~WorkspaceScope();
+    WorkspaceScope( const WorkspaceScope& ) = delete;
+    WorkspaceScope& operator=( const WorkspaceScope& ) = delete;
+};
+
+// Draw the (CPU) memory of a temporary from the workspace. This should be
+// called before the matrix is first resized, and only for temporaries which
+// do not escape the routine which creates them.
+template<typename T>
+void UseWorkspace( AbstractMatrix<T>& A )
+{
+    if( UsingWorkspace() && A.GetDevice() == Device::CPU )
+        A.SetMemoryMode( WORKSPACE_MEMORY_MODE );
+}
+
+template<typename T>
+void UseWorkspace( AbstractDistMatrix<T>& A )
+{ UseWorkspace( A.Matrix() ); }
+
+} // namespace El
+
+#endif // ifndef EL_CORE_WORKSPACE_HPP
@@ -81,6 +81,14 @@ void ApplyReflector
         F* C, BlasInt CLDim,
         F* work );
 
+// Compute the Cholesky factorization of a Hermitian positive-definite matrix
+// ==========================================================================
+// A NonHPDMatrixException is thrown if the matrix is not numerically HPD
+void Cholesky( char uplo, BlasInt n, float* A, BlasInt ldA );
+void Cholesky( char uplo, BlasInt n, double* A, BlasInt ldA );
+void Cholesky( char uplo, BlasInt n, scomplex* A, BlasInt ldA );
+void Cholesky( char uplo, BlasInt n, dcomplex* A, BlasInt ldA );
+
 // Compute the eigen-values/pairs of a symmetric tridiagonal matrix
 // ================================================================
 
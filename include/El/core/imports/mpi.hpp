@@ -237,12 +237,19 @@ void Create
 ( Comm const& parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm const& original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm const& comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into the subsets of processes which can share memory (i.e., nodes)
+void SplitShared( Comm const& comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm const& comm1, Comm const& comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm const& comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
 bool CongruentToCommSelf( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
 bool CongruentToCommWorld( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
+// A (process-local) identifier of the communicator which, unlike its handle,
+// is never reused once the communicator has been freed
+unsigned long long ContextId( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
+// Whether the communicator with the given context id has yet to be freed
+bool ContextIdLive( unsigned long long contextId ) EL_NO_EXCEPT;
 
 Comm NewWorldComm() EL_NO_RELEASE_EXCEPT;
 
@@ -828,6 +835,28 @@ void IGather
         T* rbuf, int rc, int root, Comm const& comm,
   Request<T>& request );
 
+// Non-blocking AllGather
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm const& comm,
+  Request<T>& request );
+
 // Gather with variable recv sizes
 // -------------------------------
 template <typename Real, Device D,
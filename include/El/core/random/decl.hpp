@@ -13,6 +13,19 @@ namespace El {
 
 std::mt19937& Generator();
 
+// Counter-based generation
+// ------------------------
+// MakeUniform and MakeGaussian (and hence Uniform and Gaussian) fill the
+// standard floating-point types by evaluating a counter-based generator at
+// the global index of each entry, keyed by the (seed,stream) pair. The seed
+// is shared by every process, and each call consumes one stream, so that the
+// result is independent of the grid, distribution, and number of threads as
+// long as every process makes the same sequence of calls.
+void SetRandomSeed( unsigned long long seed );
+unsigned long long RandomSeed();
+// Return the current stream and advance to the next one
+unsigned long long NextRandomStream();
+
 template<typename Real>
 Real Choose( Int n, Int k );
 template<typename Real>
@@ -555,6 +555,7 @@ enum FileFormat
     PPM,
     XBM,
     XPM,
+    NUMPY, // The NumPy .npy format
     FileFormat_MAX // For detecting number of entries in enum
 };
 }
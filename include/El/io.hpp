@@ -78,6 +78,123 @@ void Read
 ( AbstractDistMatrix<T>& A,
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Collectively read the submatrix (I,J) of a matrix stored in the BINARY or
+// BINARY_FLAT format, with each process reading its entries directly from the
+// file via MPI-IO. Since BINARY_FLAT files do not store their dimensions,
+// the height of the stored matrix must be given for that format.
+template<typename T>
+void ReadSubmatrix
+( AbstractDistMatrix<T>& A, const string filename,
+  Range<Int> I, Range<Int> J, FileFormat format=AUTO, Int fileHeight=-1 );
+
+// Memory-mapped reading
+// =====================
+namespace MapAdviceNS {
+enum MapAdvice
+{
+    ADVISE_NORMAL,     // Use the default read-ahead policy
+    ADVISE_SEQUENTIAL, // Read ahead aggressively
+    ADVISE_RANDOM,     // Disable read-ahead
+    ADVISE_WILLNEED    // Prefetch the entire file
+};
+}
+using namespace MapAdviceNS;
+
+// A read-only, shared memory mapping of a file. Mappings of the same file by
+// different processes on a node share the page cache.
+class MappedFile
+{
+public:
+    explicit MappedFile
+    ( const string& filename, MapAdvice advice=ADVISE_NORMAL );
+    ~MappedFile();
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+
+    // Apply a new access policy to the byte range [offset,offset+numBytes)
+    void Advise( MapAdvice advice, size_t offset, size_t numBytes ) const;
+
+    const char* Data() const EL_NO_EXCEPT { return data_; }
+    size_t Size() const EL_NO_EXCEPT { return size_; }
+    const string& Filename() const EL_NO_EXCEPT { return filename_; }
+
+private:
+    string filename_;
+    const char* data_=nullptr;
+    size_t size_=0;
+};
+
+// Map a BINARY, BINARY_FLAT, or (Fortran-ordered) NUMPY file and attach A to
+// its column-major payload without copying. The returned mapping must outlive
+// every use of A. If the payload cannot be viewed in place (a C-ordered NumPy
+// array or a misaligned payload), it is instead copied into A. As with Read,
+// A must be sized beforehand for the BINARY_FLAT format.
+template<typename T>
+shared_ptr<MappedFile> ReadMapped
+( Matrix<T>& A, const string filename, FileFormat format=AUTO,
+  MapAdvice advice=ADVISE_NORMAL );
+
+// Checkpointing
+// =============
+
+// Asynchronously checkpoints a collection of distributed matrices. Each call
+// to Stage copies the local entries and distribution of a matrix into a
+// staging buffer (which is reused from one checkpoint to the next), and
+// Commit hands the staged snapshots to a background thread that writes one
+// file per process, "<basename>.<step>.<rank>.ckpt", while the caller
+// continues. Each file is renamed into place only once it is complete.
+//
+// A checkpoint is complete once its manifest, "<basename>.<step>.manifest",
+// exists. The manifest is written by Wait (which Commit calls before starting
+// the next checkpoint) after a barrier which follows every process's file,
+// so Commit and Wait are collective over the grid; Wait must be called to
+// complete the final checkpoint. The background thread performs no MPI
+// calls, which is why the files are not written with Write (whose
+// distributed formats gather onto the root or write collectively); each
+// records the global indices of its rows and columns, so that Restore can
+// route the entries of any distribution to their new owners.
+class Checkpointer
+{
+public:
+    Checkpointer( const Grid& grid, const string& basename );
+    ~Checkpointer();
+
+    Checkpointer( const Checkpointer& ) = delete;
+    Checkpointer& operator=( const Checkpointer& ) = delete;
+
+    // Snapshot A (which must be distributed over the grid of the
+    // Checkpointer) under the given name for the next checkpoint
+    template<typename T>
+    void Stage( const string& name, const AbstractDistMatrix<T>& A );
+
+    // Begin writing the staged snapshots as checkpoint 'step', after waiting
+    // for the previous checkpoint (if any) to be written
+    void Commit( Int step );
+
+    // Wait for the pending checkpoint, if any, and write its manifest,
+    // rethrowing any error raised while writing it on any process
+    void Wait();
+
+    // Whether a checkpoint is still being written
+    bool Pending() const;
+
+private:
+    struct Impl;
+    unique_ptr<Impl> impl_;
+};
+
+// Collectively rebuild the matrix checkpointed under 'name' at the given step
+// into A, whose grid and distribution need not match those of the
+// checkpoint. The processes split the files among themselves and read each
+// once; if the distribution matches, each process's share is its own file,
+// which is copied into its local matrix, and otherwise the entries are routed
+// to their new owners.
+template<typename T>
+void Restore
+( AbstractDistMatrix<T>& A, const string& basename, Int step,
+  const string& name );
+
 // Spy
 // ===
 template<typename T>
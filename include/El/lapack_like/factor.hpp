@@ -52,11 +52,99 @@ void CholeskyMod
   Base<Field> alpha,
   AbstractDistMatrix<Field>& V );
 
+// Accumulate many small modifications, alpha V V^H, of the matrix whose
+// Cholesky factor is T so that they may be applied by CholeskyMod in a single
+// blocked pass. Flush applies all of the pending updates (alpha > 0) before
+// all of the pending downdates (alpha < 0), and is called automatically
+// whenever the pending modifications of either sign would exceed maxRank
+// columns. Any modifications still pending when the queue is destroyed are
+// discarded, so Flush must be called before T is next used.
+template<typename Field>
+class CholeskyModQueue
+{
+public:
+    CholeskyModQueue
+    ( UpperOrLower uplo, Matrix<Field>& T, Int maxRank=Blocksize() );
+
+    void Push( Base<Field> alpha, const Matrix<Field>& V );
+    void Flush();
+
+    Int NumPendingUpdates() const;
+    Int NumPendingDowndates() const;
+
+private:
+    UpperOrLower uplo_;
+    Matrix<Field>& T_;
+    Int maxRank_;
+
+    Int numUpdates_=0, numDowndates_=0;
+    Matrix<Field> updates_, downdates_;
+};
+
+template<typename Field>
+class DistCholeskyModQueue
+{
+public:
+    DistCholeskyModQueue
+    ( UpperOrLower uplo, AbstractDistMatrix<Field>& T,
+      Int maxRank=Blocksize() );
+
+    void Push( Base<Field> alpha, const AbstractDistMatrix<Field>& V );
+    void Flush();
+
+    Int NumPendingUpdates() const;
+    Int NumPendingDowndates() const;
+
+private:
+    UpperOrLower uplo_;
+    AbstractDistMatrix<Field>& T_;
+    Int maxRank_;
+
+    Int numUpdates_=0, numDowndates_=0;
+    DistMatrix<Field> updates_, downdates_;
+};
+
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// The lookahead depth of the distributed lower Cholesky factorization: the
+// number of panels which are factored (and redistributed) ahead of the
+// oldest incomplete trailing-matrix update, so that their communication
+// overlaps with those updates (zero disables the lookahead)
+void SetCholeskyLookahead( Int lookahead );
+Int CholeskyLookahead();
+
+// Factor each of a batch of small HPD matrices in-place (see the batched
+// Gemm routines for the storage conventions). The whole batch is processed
+// before a NonHPDMatrixException naming the first failed matrix is thrown, and
+// the distributed variant throws it from every process of the grid.
+template<typename Field>
+void CholeskyStridedBatched
+( UpperOrLower uplo, Int n,
+  Field* A, Int ALDim, Int strideA, Int batchCount );
+template<typename Field>
+void CholeskyBatched
+( UpperOrLower uplo, const Int* n,
+  Field* const* A, const Int* ALDim, Int batchCount );
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, Int n, Matrix<Field>& A );
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, Int n, AbstractDistMatrix<Field>& A );
+
+// Factor a (sequential) matrix stored out-of-core (see OutOfCoreMatrix) with
+// a left-looking tiled algorithm which keeps each tile column in the cache
+// while the previous tile columns are streamed through it. The cache must
+// hold at least four tiles.
+template<typename Field>
+void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<Field>& A );
+
+// Factor a tile-major matrix (see TileMatrix) by scheduling the tile
+// operations as tasks, with each tile passed to the kernels in place
+template<typename Field>
+void Cholesky( UpperOrLower uplo, TileMatrix<Field>& A );
+
 namespace cholesky {
 
 template<typename Field>
@@ -485,6 +573,23 @@ struct QRCtrl
     bool smallestFirst=false;
 };
 
+template<typename Real>
+struct CholeskyQRCtrl
+{
+    // Two passes (CholeskyQR2) yield a Q which is orthonormal to working
+    // precision for condition numbers up to roughly 1/sqrt(eps)
+    Int numPasses=2;
+
+    // If the first Gram matrix is not numerically HPD, or its Cholesky factor
+    // has a condition number estimate exceeding maxCond, restart with a
+    // shifted first pass (which requires one additional pass)
+    bool allowShift=true;
+    bool forceShift=false;
+
+    // If zero, 1/sqrt(eps) is used
+    Real maxCond=Real(0);
+};
+
 // Return an implicit representation of Q and R such that A = Q R
 // --------------------------------------------------------------
 template<typename Field>
@@ -563,6 +668,19 @@ void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
 template<typename Field>
 void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
 
+// (Shifted) CholeskyQR2 for tall-skinny matrices, which overwrites A with Q
+// -------------------------------------------------------------------------
+template<typename Field>
+void CholeskyQR2
+( Matrix<Field>& A,
+  Matrix<Field>& R,
+  const CholeskyQRCtrl<Base<Field>>& ctrl=CholeskyQRCtrl<Base<Field>>() );
+template<typename Field>
+void CholeskyQR2
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  const CholeskyQRCtrl<Base<Field>>& ctrl=CholeskyQRCtrl<Base<Field>>() );
+
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
 template<typename Field>
@@ -636,6 +754,26 @@ void DisjointNeighborColSwaps
         Matrix<Field>& R,
   const Matrix<Int>& colSwaps );
 
+namespace TSQRTreeNS {
+enum TSQRTree
+{
+  // A binary reduction of the triangular factors to the root process
+  TSQR_BINARY,
+  // A butterfly all-reduction, which leaves the final triangular factor
+  // (and enough information to apply Q locally) on every process, but
+  // requires a power-of-two number of processes
+  TSQR_BUTTERFLY,
+  // A binary reduction within each shared-memory node followed by a binary
+  // reduction over the roots of the nodes
+  TSQR_HIERARCHICAL
+};
+}
+using namespace TSQRTreeNS;
+
+// The implicit representation of a tall-skinny QR factorization: the local
+// QR factorization of each process's rows, followed by the factorizations of
+// the pairs of stacked triangular factors in each step of the tree in which
+// this process combined its factor with that of its partner
 template<typename Field>
 struct TreeData
 {
@@ -645,10 +783,18 @@ struct TreeData
     vector<Matrix<Field>> householderScalarsList;
     vector<Matrix<Base<Field>>> signatureList;
 
-    TreeData( Int numStages=0 )
+    TSQRTree tree=TSQR_BINARY;
+    // The partner of each step and, for the non-butterfly trees, the process
+    // which this process's final triangular factor was sent to (or -1 if this
+    // process is the root)
+    vector<int> partners;
+    int parent=-1;
+
+    TreeData( Int numStages=0, TSQRTree treeType=TSQR_BINARY )
     : QRList(numStages),
       householderScalarsList(numStages),
-      signatureList(numStages)
+      signatureList(numStages),
+      tree(treeType)
     { }
 
     TreeData( TreeData<Field>&& treeData )
@@ -657,7 +803,10 @@ struct TreeData
       signature0(move(treeData.signature0)),
       QRList(move(treeData.QRList)),
       householderScalarsList(move(treeData.householderScalarsList)),
-      signatureList(move(treeData.signatureList))
+      signatureList(move(treeData.signatureList)),
+      tree(treeData.tree),
+      partners(move(treeData.partners)),
+      parent(treeData.parent)
     { }
 
     TreeData<Field>& operator=( TreeData<Field>&& treeData )
@@ -668,17 +817,24 @@ struct TreeData
         QRList = move(treeData.QRList);
         householderScalarsList = move(treeData.householderScalarsList);
         signatureList = move(treeData.signatureList);
+        tree = treeData.tree;
+        partners = move(treeData.partners);
+        parent = treeData.parent;
         return *this;
     }
 };
 
 // Return an implicit tall-skinny QR factorization
 template<typename Field>
-TreeData<Field> TS( const AbstractDistMatrix<Field>& A );
+TreeData<Field>
+TS( const AbstractDistMatrix<Field>& A, TSQRTree tree=TSQR_BINARY );
 
 // Return an explicit tall-skinny QR factorization
 template<typename Field>
-void ExplicitTS( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+void ExplicitTS
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  TSQRTree tree=TSQR_BINARY );
 
 namespace ts {
 
@@ -696,6 +852,31 @@ void Reduce( const AbstractDistMatrix<Field>& A, TreeData<Field>& treeData );
 template<typename Field>
 void Scatter( AbstractDistMatrix<Field>& A, const TreeData<Field>& treeData );
 
+// Apply the implicit Q (or its adjoint) from a tall-skinny QR factorization
+// without forming it. B is distributed identically to A and C is the n x k
+// matrix known to every process, so that either B := Q C or C := Q^H B.
+template<typename Field>
+void ApplyQ
+( const AbstractDistMatrix<Field>& A,
+  const TreeData<Field>& treeData,
+  const Matrix<Field>& C,
+        AbstractDistMatrix<Field>& B );
+template<typename Field>
+void ApplyQAdjoint
+( const AbstractDistMatrix<Field>& A,
+  const TreeData<Field>& treeData,
+  const AbstractDistMatrix<Field>& B,
+        Matrix<Field>& C );
+
+// Solve the least-squares problem min || A X - B ||_F, returning X on every
+// process
+template<typename Field>
+void SolveAfter
+( const AbstractDistMatrix<Field>& A,
+  const TreeData<Field>& treeData,
+  const AbstractDistMatrix<Field>& B,
+        Matrix<Field>& X );
+
 } // namespace ts
 
 } // namespace qr
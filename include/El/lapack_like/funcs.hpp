@@ -30,9 +30,20 @@ struct SignCtrl
     Real tol=Real(0);
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
+    // Switch to the inverse-free Newton-Schulz iteration once it is
+    // guaranteed to converge
+    bool newtonSchulz=true;
     bool progress=false;
 };
 
+struct SignInfo
+{
+    // The total number of iterations and how many of them were
+    // Newton-Schulz steps
+    Int numIts=0;
+    Int numNewtonSchulzIts=0;
+};
+
 template<typename Real>
 struct SquareRootCtrl
 {
@@ -141,19 +152,19 @@ void HermitianPseudoinverse
 // Sign
 // ====
 template<typename Field>
-void Sign
+SignInfo Sign
 ( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 template<typename Field>
-void Sign
+SignInfo Sign
 ( AbstractDistMatrix<Field>& A,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 
 template<typename Field>
-void Sign
+SignInfo Sign
 ( Matrix<Field>& A, Matrix<Field>& N,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 template<typename Field>
-void Sign
+SignInfo Sign
 ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& N,
   const SignCtrl<Base<Field>> ctrl=SignCtrl<Base<Field>>() );
 
@@ -358,6 +358,68 @@ Int ZeroNorm( const AbstractDistMatrix<T>& A, Base<T> tol=0 );
 
 // Two-norm estimate
 // -----------------
+namespace TwoNormEstimateAlgNS {
+enum TwoNormEstimateAlg
+{
+  // Block power iteration on A^H A, with the block orthonormalized after
+  // each application of A and A^H
+  TWO_NORM_EST_POWER,
+  // Golub-Kahan-Lanczos bidiagonalization, with the estimate taken as the
+  // largest singular value of the (small) bidiagonal projection
+  TWO_NORM_EST_LANCZOS
+};
+}
+using namespace TwoNormEstimateAlgNS;
+
+// Every estimate is a lower bound on the two-norm which only requires
+// applications of A and A^H to a few vectors
+template<typename Real>
+struct TwoNormEstimateCtrl
+{
+    TwoNormEstimateAlg alg=TWO_NORM_EST_LANCZOS;
+
+    // Stop once successive estimates differ by at most 'tol' times the latest
+    // or by at most 'absTol' times the larger dimension of A (the criterion
+    // of the overloads below which take a tolerance directly)
+    Real tol=Real(1e-6);
+    Real absTol=Real(0);
+    Int maxIts=1000;
+
+    // The number of vectors iterated by TWO_NORM_EST_POWER
+    Int blockSize=1;
+
+    // If false, the last estimate is returned (rather than a RuntimeError
+    // being thrown) when 'tol' is not met within 'maxIts' iterations
+    bool demandConverged=true;
+};
+
+template<typename F>
+Base<F> TwoNormEstimate
+( const Matrix<F>& A, const TwoNormEstimateCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> TwoNormEstimate
+( const AbstractDistMatrix<F>& A, const TwoNormEstimateCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Base<F> HermitianTwoNormEstimate
+( UpperOrLower uplo, const Matrix<F>& A,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> HermitianTwoNormEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Base<F> SymmetricTwoNormEstimate
+( UpperOrLower uplo, const Matrix<F>& A,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> SymmetricTwoNormEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl );
+
+// Single-vector power iteration which stops once successive estimates differ
+// by at most tol times the larger dimension of A
 template<typename F>
 Base<F> TwoNormEstimate
 ( const Matrix<F>& A, Base<F> tol=1e-6, Int maxIts=1000 );
@@ -383,6 +445,54 @@ Base<F> SymmetricTwoNormEstimate
 ( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
   Base<F> tol=1e-6, Int maxIts=1000 );
 
+// Condition number estimates
+// ==========================
+// Estimates for Hermitian positive-definite matrices which, beyond a single
+// Cholesky factorization, only require triangular solves against a handful
+// of vectors. The one-norm estimate follows Hager's method with Higham's
+// refinements (as in LAPACK's xLACN2), while the two-norm estimate applies
+// TwoNormEstimate to the inverse.
+
+template<typename F>
+Base<F> HPDOneConditionEstimate
+( UpperOrLower uplo, const Matrix<F>& A, Int maxIts=5 );
+template<typename F>
+Base<F> HPDOneConditionEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A, Int maxIts=5 );
+
+template<typename F>
+Base<F> HPDTwoConditionEstimate
+( UpperOrLower uplo, const Matrix<F>& A,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl=TwoNormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> HPDTwoConditionEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl=TwoNormEstimateCtrl<Base<F>>() );
+
+namespace hpd_cond {
+
+// Estimate the condition number of A given its Cholesky factor (as computed
+// by Cholesky( uplo, A )) and the corresponding norm of the original matrix
+
+template<typename F>
+Base<F> OneAfterCholesky
+( UpperOrLower uplo, const Matrix<F>& A, Base<F> oneNormA, Int maxIts=5 );
+template<typename F>
+Base<F> OneAfterCholesky
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A, Base<F> oneNormA,
+  Int maxIts=5 );
+
+template<typename F>
+Base<F> TwoAfterCholesky
+( UpperOrLower uplo, const Matrix<F>& A, Base<F> twoNormA,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl=TwoNormEstimateCtrl<Base<F>>() );
+template<typename F>
+Base<F> TwoAfterCholesky
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A, Base<F> twoNormA,
+  const TwoNormEstimateCtrl<Base<F>>& ctrl=TwoNormEstimateCtrl<Base<F>>() );
+
+} // namespace hpd_cond
+
 // Trace
 // =====
 template<typename T>
@@ -169,6 +169,82 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// Mixed-precision Hermitian Positive-Definite
+// ===========================================
+// Compute the Cholesky factorization of A in the next lower precision (e.g.,
+// in single-precision when Field is double) and iteratively refine the
+// solution with residuals computed in the original precision. If classical
+// refinement stalls, the corrections are instead computed with GMRES
+// preconditioned by the low-precision factorization (GMRES-IR), and, if that
+// also fails to converge, A is refactored in the original precision.
+//
+// The backward error of each column, x, of the solution is measured as
+//
+//   || b - A x ||_2 / ( || A ||_F || x ||_2 + || b ||_2 ).
+//
+template<typename Real>
+struct MixedPrecisionHPDSolveCtrl
+{
+    // The backward error which every column must reach. Since even a
+    // backward-stable solve in the original precision is only expected to
+    // reach a modest multiple of n eps, where n is the order of A, the
+    // default of zero selects n eps.
+    Real relTol=Real(0);
+
+    // Classical refinement is considered to have stalled once a step fails
+    // to reduce the largest backward error by at least this factor
+    Int maxRefineIts=10;
+    Real stallRatio=Real(1)/Real(2);
+
+    bool tryGMRES=true;
+    Int maxGMRESRefineIts=10;
+    Int restart=20;
+    Real gmresRelTol=Real(1)/Real(1000000);
+
+    bool fallback=true;
+    bool progress=false;
+};
+
+template<typename Real>
+struct MixedPrecisionHPDSolveInfo
+{
+    // Whether the low-precision Cholesky factorization succeeded
+    bool lowPrecisionFactored=false;
+
+    Int refineIts=0;
+    Int gmresRefineIts=0;
+    Int gmresIts=0;
+
+    // Whether A was refactored in the original precision
+    bool fellBack=false;
+
+    bool converged=false;
+    Real backwardError=Real(0);
+
+    // The largest backward error after the initial solve and after each
+    // subsequent correction
+    vector<Real> backwardErrors;
+};
+
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>>
+MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl=
+        MixedPrecisionHPDSolveCtrl<Base<Field>>() );
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>>
+MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl=
+        MixedPrecisionHPDSolveCtrl<Base<Field>>() );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
@@ -416,6 +416,10 @@ struct HermitianEigCtrl
     bool useScaLAPACK=false;
     bool useSDC=false;
     bool timeStages=false;
+
+    // The intermediate bandwidth of the two-stage tridiagonalization
+    // (Blocksize() if zero)
+    Int bandwidth=0;
 };
 
 struct HermitianEigInfo
@@ -587,11 +591,24 @@ struct QDWHCtrl
 {
     bool colPiv=false;
     Int maxIts=20;
+
+    // Iterations whose weight c is at most this threshold use a Cholesky
+    // factorization of I + c A^H A rather than a QR factorization of the
+    // stacked matrix [sqrt(c) A; I]
+    double cholThreshold=100;
+
+    // The relative tolerance for the Lanczos estimates of || A ||_2 and of
+    // the smallest singular value of A which initialize the iteration
+    double normEstTol=1e-2;
 };
 
+// Sequential matrices use the SVD unless qdwh is set. Since the SVD of a
+// distributed matrix is computed after gathering it onto a single process,
+// distributed matrices use QDWH unless gatherSVD is set (and qdwh is not).
 struct PolarCtrl
 {
     bool qdwh=false;
+    bool gatherSVD=false;
     QDWHCtrl qdwhCtrl;
 };
 
@@ -1357,6 +1374,78 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized SVD
+// ==============
+// Approximate the dominant singular triplets using the randomized range finder
+// of Halko, Martinsson, and Tropp, "Finding structure with randomness:
+// Probabilistic algorithms for constructing approximate matrix
+// decompositions", SIAM Review, 53(2), 2011.
+
+template<typename Real>
+struct RandomizedSVDCtrl
+{
+    // The number of samples beyond the requested rank
+    Int oversampling=10;
+
+    // The number of power (subspace) iterations, each of which applies A A^H
+    // to the sampled range (with reorthogonalization in between)
+    Int numPowerIts=2;
+
+    // If true, the sampled range is grown in blocks of 'blockSize' columns
+    // until the probabilistic estimate of the spectral-norm error,
+    //
+    //   10 sqrt(2/pi) max_j || (I - Q Q^H) A omega_j ||_2,
+    //
+    // drops below 'tol' times the largest norm || A omega_j ||_2 of the first
+    // block of samples. The requested rank is then an upper bound, and only
+    // the singular values above 'tol' times the largest are kept.
+    bool adaptive=false;
+    Int blockSize=10;
+    Real tol=Real(0); // If zero, sqrt(eps) is used
+
+    // The reduction tree of the tall-skinny QR factorizations
+    qr::TSQRTree tree=qr::TSQR_BINARY;
+
+    bool progress=false;
+};
+
+// Return an approximation of the (at most) 'rank' dominant singular triplets
+// of A
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+
+// Return approximations of the (at most) 'rank' dominant singular values of A
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+        Int rank,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+        Int rank,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+        RandomizedSVDCtrl<Base<Field>>() );
+
 // Hermitian SVD
 // =============
 
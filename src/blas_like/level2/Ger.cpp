@@ -136,7 +136,12 @@ void LocalGer
 {
     EL_DEBUG_CSE
     // TODO(poulson): Add error checking here
-    Ger( alpha, x.LockedMatrix(), y.LockedMatrix(), A.Matrix() );
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("LocalGer: Only implemented for CPU matrices");
+    Ger
+    ( alpha, static_cast<const Matrix<T>&>( x.LockedMatrix() ),
+             static_cast<const Matrix<T>&>( y.LockedMatrix() ),
+             static_cast<Matrix<T>&>( A.Matrix() ) );
 }
 
 #define PROTO(T) \
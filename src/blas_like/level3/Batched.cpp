@@ -0,0 +1,378 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include "./Batched/Fixed.hpp"
+
+namespace El {
+
+namespace batched {
+
+// Ensure that each of the batch's matrices is stored within a column of A
+template<typename T>
+void CheckColumnBatch
+( const AbstractMatrix<T>& A, Int height, Int width, Int batchCount,
+  string name )
+{
+    if( A.Height() != height*width || A.Width() != batchCount )
+        LogicError
+        (name," was ",A.Height()," x ",A.Width()," but should have been ",
+         height*width," x ",batchCount);
+}
+
+// Form the [* ,VR] proxy of a batch which is aligned with the batch C
+template<typename T>
+ElementalProxyCtrl AlignedCtrl( const DistMatrix<T,STAR,VR>& C )
+{
+    ElementalProxyCtrl ctrl;
+    ctrl.rowConstrain = true;
+    ctrl.rowAlign = C.RowAlign();
+    return ctrl;
+}
+
+} // namespace batched
+
+template<typename T>
+void GemmStridedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* B, Int BLDim, Int strideB,
+  T beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    auto kernel = batched::FixedGemmKernel<T>( orientA, orientB, m, n, k );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const T* Ab = &A[b*strideA];
+        const T* Bb = &B[b*strideB];
+        T* Cb = &C[b*strideC];
+        if( kernel != nullptr )
+            kernel( m, n, k, alpha, Ab, ALDim, Bb, BLDim, beta, Cb, CLDim );
+        else
+            blas::Gemm
+            ( transA, transB, m, n, k,
+              alpha, Ab, ALDim, Bb, BLDim, beta, Cb, CLDim );
+    }
+}
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  const Int* m, const Int* n, const Int* k,
+  T alpha, const T* const* A, const Int* ALDim,
+           const T* const* B, const Int* BLDim,
+  T beta,        T* const* C, const Int* CLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto kernel =
+          batched::FixedGemmKernel<T>( orientA, orientB, m[b], n[b], k[b] );
+        if( kernel != nullptr )
+            kernel
+            ( m[b], n[b], k[b],
+              alpha, A[b], ALDim[b], B[b], BLDim[b], beta, C[b], CLDim[b] );
+        else
+            blas::Gemm
+            ( transA, transB, m[b], n[b], k[b],
+              alpha, A[b], ALDim[b], B[b], BLDim[b], beta, C[b], CLDim[b] );
+    }
+}
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = C.Width();
+    EL_DEBUG_ONLY(
+      batched::CheckColumnBatch( A, m, k, batchCount, "A" );
+      batched::CheckColumnBatch( B, k, n, batchCount, "B" );
+      batched::CheckColumnBatch( C, m, n, batchCount, "C" );
+    )
+    GemmStridedBatched
+    ( orientA, orientB, m, n, k,
+      alpha, A.LockedBuffer(), ( orientA == NORMAL ? m : k ), A.LDim(),
+             B.LockedBuffer(), ( orientB == NORMAL ? k : n ), B.LDim(),
+      beta,  C.Buffer(),       m,                           C.LDim(),
+      batchCount );
+}
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const AbstractDistMatrix<T>& APre, const AbstractDistMatrix<T>& BPre,
+  T beta,        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<T,T,STAR,VR> CProx( CPre );
+    auto& C = CProx.Get();
+    const auto ctrl = batched::AlignedCtrl( C );
+    DistMatrixReadProxy<T,T,STAR,VR> AProx( APre, ctrl );
+    DistMatrixReadProxy<T,T,STAR,VR> BProx( BPre, ctrl );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B, C );
+      batched::CheckColumnBatch( A, m, k, C.Width(), "A" );
+      batched::CheckColumnBatch( B, k, n, C.Width(), "B" );
+      batched::CheckColumnBatch( C, m, n, C.Width(), "C" );
+    )
+    GemmBatched
+    ( orientA, orientB, m, n, k,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), beta, C.Matrix() );
+}
+
+template<typename F>
+void TrsmStridedBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* A, Int ALDim, Int strideA,
+                 F* B, Int BLDim, Int strideB,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar, m, n,
+          alpha, &A[b*strideA], ALDim, &B[b*strideB], BLDim );
+}
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  const Int* m, const Int* n,
+  F alpha, const F* const* A, const Int* ALDim,
+                 F* const* B, const Int* BLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, transChar, diagChar, m[b], n[b],
+          alpha, A[b], ALDim[b], B[b], BLDim[b] );
+}
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const Matrix<F>& A, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int order = ( side == LEFT ? m : n );
+    EL_DEBUG_ONLY(
+      batched::CheckColumnBatch( A, order, order, B.Width(), "A" );
+      batched::CheckColumnBatch( B, m, n, B.Width(), "B" );
+    )
+    TrsmStridedBatched
+    ( side, uplo, orientation, diag, m, n,
+      alpha, A.LockedBuffer(), order, A.LDim(),
+             B.Buffer(),       m,     B.LDim(),
+      B.Width() );
+}
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( BPre );
+    auto& B = BProx.Get();
+    DistMatrixReadProxy<F,F,STAR,VR> AProx( APre, batched::AlignedCtrl(B) );
+    auto& A = AProx.GetLocked();
+    EL_DEBUG_ONLY(AssertSameGrids( A, B ))
+    TrsmBatched
+    ( side, uplo, orientation, diag, m, n,
+      alpha, A.LockedMatrix(), B.Matrix() );
+}
+
+template<typename T>
+void HerkStridedBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* A, Int ALDim, Int strideA,
+  Base<T> beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = ( orientation == NORMAL ? 'N' : 'C' );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Herk
+        ( uploChar, transChar, n, k,
+          alpha, &A[b*strideA], ALDim, beta, &C[b*strideC], CLDim );
+}
+
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  const Int* n, const Int* k,
+  Base<T> alpha, const T* const* A, const Int* ALDim,
+  Base<T> beta,        T* const* C, const Int* CLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = ( orientation == NORMAL ? 'N' : 'C' );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Herk
+        ( uploChar, transChar, n[b], k[b],
+          alpha, A[b], ALDim[b], beta, C[b], CLDim[b] );
+}
+
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const Matrix<T>& A,
+  Base<T> beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      batched::CheckColumnBatch( A, n, k, C.Width(), "A" );
+      batched::CheckColumnBatch( C, n, n, C.Width(), "C" );
+    )
+    HerkStridedBatched
+    ( uplo, orientation, n, k,
+      alpha, A.LockedBuffer(), ( orientation == NORMAL ? n : k ), A.LDim(),
+      beta,  C.Buffer(),       n,                                 C.LDim(),
+      C.Width() );
+}
+
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const AbstractDistMatrix<T>& APre,
+  Base<T> beta,        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadWriteProxy<T,T,STAR,VR> CProx( CPre );
+    auto& C = CProx.Get();
+    DistMatrixReadProxy<T,T,STAR,VR> AProx( APre, batched::AlignedCtrl(C) );
+    auto& A = AProx.GetLocked();
+    EL_DEBUG_ONLY(AssertSameGrids( A, C ))
+    HerkBatched
+    ( uplo, orientation, n, k, alpha, A.LockedMatrix(), beta, C.Matrix() );
+}
+
+#define PROTO(T) \
+  template void GemmStridedBatched \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const T* A, Int ALDim, Int strideA, \
+             const T* B, Int BLDim, Int strideB, \
+    T beta,        T* C, Int CLDim, Int strideC, \
+    Int batchCount ); \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, \
+    const Int* m, const Int* n, const Int* k, \
+    T alpha, const T* const* A, const Int* ALDim, \
+             const T* const* B, const Int* BLDim, \
+    T beta,        T* const* C, const Int* CLDim, \
+    Int batchCount ); \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const Matrix<T>& A, const Matrix<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C ); \
+  template void TrsmStridedBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    T alpha, const T* A, Int ALDim, Int strideA, \
+                   T* B, Int BLDim, Int strideB, \
+    Int batchCount ); \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    const Int* m, const Int* n, \
+    T alpha, const T* const* A, const Int* ALDim, \
+                   T* const* B, const Int* BLDim, \
+    Int batchCount ); \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    T alpha, const Matrix<T>& A, Matrix<T>& B ); \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    T alpha, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  template void HerkStridedBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Int n, Int k, \
+    Base<T> alpha, const T* A, Int ALDim, Int strideA, \
+    Base<T> beta,        T* C, Int CLDim, Int strideC, \
+    Int batchCount ); \
+  template void HerkBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Int* n, const Int* k, \
+    Base<T> alpha, const T* const* A, const Int* ALDim, \
+    Base<T> beta,        T* const* C, const Int* CLDim, \
+    Int batchCount ); \
+  template void HerkBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Int n, Int k, \
+    Base<T> alpha, const Matrix<T>& A, \
+    Base<T> beta,        Matrix<T>& C ); \
+  template void HerkBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Int n, Int k, \
+    Base<T> alpha, const AbstractDistMatrix<T>& A, \
+    Base<T> beta,        AbstractDistMatrix<T>& C );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_FIXED_HPP
+#define EL_BATCHED_FIXED_HPP
+
+namespace El {
+namespace batched {
+
+// The (i,j) entry of op(A)
+template<Orientation orient,typename T>
+inline T OpEntry( const T* A, Int ALDim, Int i, Int j )
+{
+    if( orient == NORMAL )
+        return A[i+j*ALDim];
+    else if( orient == TRANSPOSE )
+        return A[j+i*ALDim];
+    else
+        return Conj(A[j+i*ALDim]);
+}
+
+// C := alpha op(A) op(B) + beta C, where C is M x N and the inner dimension is
+// K. Since the loop bounds are known at compile-time, the compiler is free to
+// fully unroll the loops and to hold the M x N accumulators in registers.
+template<Int M,Int N,Int K,Orientation orientA,Orientation orientB,typename T>
+void FixedGemm
+( Int /*m*/, Int /*n*/, Int /*k*/,
+  T alpha, const T* A, Int ALDim,
+           const T* B, Int BLDim,
+  T beta,        T* C, Int CLDim )
+{
+    T AB[M*N];
+    for( Int j=0; j<N; ++j )
+        for( Int i=0; i<M; ++i )
+            AB[i+j*M] = T(0);
+    for( Int l=0; l<K; ++l )
+        for( Int j=0; j<N; ++j )
+        {
+            const T beta_lj = OpEntry<orientB>( B, BLDim, l, j );
+            for( Int i=0; i<M; ++i )
+                AB[i+j*M] += OpEntry<orientA>( A, ALDim, i, l )*beta_lj;
+        }
+
+    // Following the BLAS convention, C is not read when beta is zero
+    if( beta == T(0) )
+    {
+        for( Int j=0; j<N; ++j )
+            for( Int i=0; i<M; ++i )
+                C[i+j*CLDim] = alpha*AB[i+j*M];
+    }
+    else
+    {
+        for( Int j=0; j<N; ++j )
+            for( Int i=0; i<M; ++i )
+                C[i+j*CLDim] = alpha*AB[i+j*M] + beta*C[i+j*CLDim];
+    }
+}
+
+template<typename T>
+using GemmKernel =
+  void(*)
+  ( Int m, Int n, Int k,
+    T alpha, const T* A, Int ALDim,
+             const T* B, Int BLDim,
+    T beta,        T* C, Int CLDim );
+
+template<Int M,Int N,Int K,Orientation orientA,typename T>
+GemmKernel<T> FixedGemmKernel( Orientation orientB )
+{
+    if( orientB == NORMAL )
+        return &FixedGemm<M,N,K,orientA,NORMAL,T>;
+    else if( orientB == TRANSPOSE )
+        return &FixedGemm<M,N,K,orientA,TRANSPOSE,T>;
+    else
+        return &FixedGemm<M,N,K,orientA,ADJOINT,T>;
+}
+
+template<Int M,Int N,Int K,typename T>
+GemmKernel<T> FixedGemmKernel( Orientation orientA, Orientation orientB )
+{
+    if( orientA == NORMAL )
+        return FixedGemmKernel<M,N,K,NORMAL,T>( orientB );
+    else if( orientA == TRANSPOSE )
+        return FixedGemmKernel<M,N,K,TRANSPOSE,T>( orientB );
+    else
+        return FixedGemmKernel<M,N,K,ADJOINT,T>( orientB );
+}
+
+// Return a fully-unrolled kernel for the (cubic) problem sizes 2, 4, and 8,
+// and a null pointer otherwise
+template<typename T>
+GemmKernel<T> FixedGemmKernel
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k )
+{
+    if( m != n || n != k )
+        return nullptr;
+    switch( m )
+    {
+    case 2: return FixedGemmKernel<2,2,2,T>( orientA, orientB );
+    case 4: return FixedGemmKernel<4,4,4,T>( orientA, orientB );
+    case 8: return FixedGemmKernel<8,8,8,T>( orientA, orientB );
+    default: return nullptr;
+    }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_FIXED_HPP
@@ -89,10 +89,13 @@ GetSyncInfoPool(El::Grid const& g)
 }// namespace <anon>
 #endif // HYDROGEN_HAVE_MS_GEMM
 
+#include "./Gemm/Workspace.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/OutOfCore.hpp"
+#include "./Gemm/TileMajor.hpp"
 
 namespace El
 {
@@ -439,6 +442,26 @@ void LocalGemm
     LocalGemm(orientA, orientB, alpha, A, B, TypeTraits<T>::Zero(), C);
 }
 
+template<typename T>
+void Gemm
+(Orientation orientA, Orientation orientB,
+  T alpha, OutOfCoreMatrix<T>& A, OutOfCoreMatrix<T>& B,
+  T beta,  OutOfCoreMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    gemm::OutOfCore(orientA, orientB, alpha, A, B, beta, C);
+}
+
+template<typename T>
+void Gemm
+(Orientation orientA, Orientation orientB,
+  T alpha, const TileMatrix<T>& A, const TileMatrix<T>& B,
+  T beta,        TileMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    gemm::TileMajor(orientA, orientB, alpha, A, B, beta, C);
+}
+
 #ifdef HYDROGEN_HAVE_GPU
 template void Gemm(Orientation orientA, Orientation orientB,
                    float alpha,
@@ -513,4 +536,19 @@ ABSTRACT_PROTO(gpu_half_type);
 #define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
+// Products of out-of-core and tile-major matrices
+#define PROTO(T)                                        \
+    template void Gemm(                                 \
+        Orientation orientA, Orientation orientB,       \
+        T alpha, OutOfCoreMatrix<T>& A,                 \
+        OutOfCoreMatrix<T>& B,                          \
+        T beta,  OutOfCoreMatrix<T>& C);                \
+    template void Gemm(                                 \
+        Orientation orientA, Orientation orientB,       \
+        T alpha, const TileMatrix<T>& A,                \
+        const TileMatrix<T>& B,                         \
+        T beta,        TileMatrix<T>& C);
+
+#include <El/macros/Instantiate.h>
+
 } // namespace El
@@ -128,10 +128,14 @@ void SUMMA_NNA_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(3, A, B));
     DistMatrix<T,VR,STAR,ELEMENT,D> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR,ELEMENT,D> B1Trans_STAR_MR(g);
     DistMatrix<T,MC,STAR,ELEMENT,D> D1_MC_STAR(g);
+    UseWorkspace(B1_VR_STAR);
+    UseWorkspace(B1Trans_STAR_MR);
+    UseWorkspace(D1_MC_STAR);
 
     B1_VR_STAR.AlignWith(A);
     B1Trans_STAR_MR.AlignWith(A);
@@ -247,9 +251,12 @@ void SUMMA_NNB_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(2, A, B));
     DistMatrix<T,STAR,MC,ELEMENT,D> A1_STAR_MC(g);
     DistMatrix<T,MR,STAR,ELEMENT,D> D1Trans_MR_STAR(g);
+    UseWorkspace(A1_STAR_MC);
+    UseWorkspace(D1Trans_MR_STAR);
 
     A1_STAR_MC.AlignWith(B);
     D1Trans_MR_STAR.AlignWith(B);
@@ -361,9 +368,12 @@ void SUMMA_NNC_impl(T alpha,
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(2, A, B));
     DistMatrix<T,MC,STAR,ELEMENT,D> A1_MC_STAR(g);
     DistMatrix<T,MR,STAR,ELEMENT,D> B1Trans_MR_STAR(g);
+    UseWorkspace(A1_MC_STAR);
+    UseWorkspace(B1Trans_MR_STAR);
 
     A1_MC_STAR.AlignWith(C);
     B1Trans_MR_STAR.AlignWith(C);
@@ -36,9 +36,12 @@ void SUMMA_NTA_impl(
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(2, A, B));
     DistMatrix<T,MR,STAR,ELEMENT,D> B1Trans_MR_STAR(g);
     DistMatrix<T,MC,STAR,ELEMENT,D> D1_MC_STAR(g);
+    UseWorkspace(B1Trans_MR_STAR);
+    UseWorkspace(D1_MC_STAR);
 
     B1Trans_MR_STAR.AlignWith(A);
     D1_MC_STAR.AlignWith(A);
@@ -150,10 +153,14 @@ void SUMMA_NTB_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(3, A, B));
     DistMatrix<T,MR,STAR,ELEMENT,D> A1Trans_MR_STAR(g);
     DistMatrix<T,STAR,MC,ELEMENT,D> D1_STAR_MC(g);
     DistMatrix<T,MR,MC,ELEMENT,D> D1_MR_MC(g);
+    UseWorkspace(A1Trans_MR_STAR);
+    UseWorkspace(D1_STAR_MC);
+    UseWorkspace(D1_MR_MC);
 
     A1Trans_MR_STAR.AlignWith(B);
     D1_STAR_MC.AlignWith(B);
@@ -268,10 +275,14 @@ void SUMMA_NTC_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(3, A, B));
     DistMatrix<T,MC,STAR,ELEMENT,D> A1_MC_STAR(g);
     DistMatrix<T,VR,STAR,ELEMENT,D> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR,ELEMENT,D> B1Trans_STAR_MR(g);
+    UseWorkspace(A1_MC_STAR);
+    UseWorkspace(B1_VR_STAR);
+    UseWorkspace(B1Trans_STAR_MR);
 
     A1_MC_STAR.AlignWith(C);
     B1_VR_STAR.AlignWith(C);
@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_OUTOFCORE_HPP
+#define EL_GEMM_OUTOFCORE_HPP
+
+namespace El {
+namespace gemm {
+
+// C := alpha op(A) op(B) + beta C, for out-of-core matrices with a common tile
+// size. C is traversed in blocks of r x c tiles which are held in its cache
+// while the corresponding tile rows of op(A) and tile columns of op(B) are
+// streamed through (with the tiles of the next step prefetched), so that each
+// tile of A is read about once per block column of C and each tile of B about
+// once per block row. The direction of the k loop alternates from one block to
+// the next so that the last tiles of A and B read for a block are still
+// cached when the next one begins.
+template<typename T>
+void OutOfCore
+( Orientation orientA, Orientation orientB,
+  T alpha, OutOfCoreMatrix<T>& A, OutOfCoreMatrix<T>& B,
+  T beta,  OutOfCoreMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    if( (normalA ? A.Height() : A.Width()) != m ||
+        (normalB ? B.Height() : B.Width()) != k ||
+        (normalB ? B.Width() : B.Height()) != n )
+        LogicError
+        ("Nonconformal out-of-core Gemm: A is ",A.Height()," x ",A.Width(),
+         ", B is ",B.Height()," x ",B.Width(),", and C is ",m," x ",n);
+    if( A.TileSize() != C.TileSize() || B.TileSize() != C.TileSize() )
+        LogicError("Out-of-core Gemm requires a common tile size");
+    if( &A == &C || &B == &C )
+        LogicError("C may not alias A or B in an out-of-core Gemm");
+
+    const Int tileRows = C.TileRows();
+    const Int tileCols = C.TileCols();
+    const Int numSteps = ( normalA ? A.TileCols() : A.TileRows() );
+
+    // Half of the caches of A and B are reserved for read-ahead (and, if A
+    // and B are the same matrix, they split its cache)
+    const Int shares = ( &A == &B ? 2 : 1 );
+    Int r = Min( Max(A.CacheTiles()/(2*shares),Int(1)), tileRows );
+    Int c = Min( Max(B.CacheTiles()/(2*shares),Int(1)), tileCols );
+    while( r*c > C.CacheTiles() )
+    {
+        if( r >= c )
+            --r;
+        else
+            --c;
+    }
+
+    // The stored indices of tile (i,l) of op(A) and tile (l,j) of op(B)
+    auto tileA =
+      [&]( Int i, Int l )
+      { return normalA ? std::make_pair(i,l) : std::make_pair(l,i); };
+    auto tileB =
+      [&]( Int l, Int j )
+      { return normalB ? std::make_pair(l,j) : std::make_pair(j,l); };
+    auto prefetchA =
+      [&]( Int i, Int l )
+      { const auto t = tileA(i,l); A.Prefetch( t.first, t.second ); };
+    auto prefetchB =
+      [&]( Int l, Int j )
+      { const auto t = tileB(l,j); B.Prefetch( t.first, t.second ); };
+
+    // If A and B are the same matrix, a tile needed by both strips is pinned
+    // once, and if its cache cannot hold both strips at once, the strip of A
+    // is copied out of the cache before the strip of B is pinned
+    const bool aliased = ( &A == &B );
+    const bool copyA = aliased && r+c > A.CacheTiles();
+
+    vector<Matrix<T>> CBlock, AStrip, BStrip;
+    vector<Int> BSource;
+    bool forward = true;
+    for( Int jBeg=0; jBeg<tileCols; jBeg+=c )
+    {
+        const Int jEnd = Min(jBeg+c,tileCols);
+        for( Int iBeg=0; iBeg<tileRows; iBeg+=r )
+        {
+            const Int iEnd = Min(iBeg+r,tileRows);
+            CBlock.clear();
+            for( Int j=jBeg; j<jEnd; ++j )
+            {
+                for( Int i=iBeg; i<iEnd; ++i )
+                {
+                    // The previous contents are not needed if beta is zero
+                    CBlock.emplace_back( C.Pin( i, j, beta != T(0) ) );
+                    auto& CTile = CBlock.back();
+                    if( beta == T(0) )
+                        Zero( CTile );
+                    else if( beta != T(1) )
+                        Scale( beta, CTile );
+                }
+            }
+
+            for( Int step=0; step<numSteps; ++step )
+            {
+                const Int l = ( forward ? step : numSteps-1-step );
+                AStrip.clear();
+                BStrip.clear();
+                BSource.clear();
+                for( Int i=iBeg; i<iEnd; ++i )
+                {
+                    const auto t = tileA(i,l);
+                    if( copyA )
+                    {
+                        // The copy constructor makes a deep copy
+                        const Matrix<T> tile = A.Pin( t.first, t.second );
+                        AStrip.emplace_back( tile );
+                        A.Unpin( t.first, t.second, false );
+                    }
+                    else
+                        AStrip.emplace_back( A.Pin( t.first, t.second ) );
+                }
+                for( Int j=jBeg; j<jEnd; ++j )
+                {
+                    const auto t = tileB(l,j);
+                    Int source = -1;
+                    for( Int i=iBeg; aliased && !copyA && i<iEnd; ++i )
+                        if( tileA(i,l) == t )
+                            source = i-iBeg;
+                    BSource.push_back( source );
+                    if( source < 0 )
+                        BStrip.emplace_back( B.Pin( t.first, t.second ) );
+                    else
+                        BStrip.emplace_back();
+                }
+                // Prefetching only after pinning keeps the read-ahead from
+                // evicting the tiles it brought in for this step
+                if( step+1 < numSteps )
+                {
+                    const Int lNext = ( forward ? l+1 : l-1 );
+                    for( Int i=iBeg; i<iEnd; ++i )
+                        prefetchA( i, lNext );
+                    for( Int j=jBeg; j<jEnd; ++j )
+                        prefetchB( lNext, j );
+                }
+
+                for( Int j=jBeg; j<jEnd; ++j )
+                {
+                    const Int source = BSource[j-jBeg];
+                    const Matrix<T>& BTile =
+                      ( source < 0 ? BStrip[j-jBeg] : AStrip[source] );
+                    for( Int i=iBeg; i<iEnd; ++i )
+                        Gemm
+                        ( orientA, orientB,
+                          alpha, AStrip[i-iBeg], BTile,
+                          T(1), CBlock[(i-iBeg)+(j-jBeg)*(iEnd-iBeg)] );
+                }
+
+                for( Int i=iBeg; i<iEnd && !copyA; ++i )
+                {
+                    const auto t = tileA(i,l);
+                    A.Unpin( t.first, t.second, false );
+                }
+                for( Int j=jBeg; j<jEnd; ++j )
+                {
+                    if( BSource[j-jBeg] >= 0 )
+                        continue;
+                    const auto t = tileB(l,j);
+                    B.Unpin( t.first, t.second, false );
+                }
+            }
+            forward = !forward;
+
+            for( Int j=jBeg; j<jEnd; ++j )
+                for( Int i=iBeg; i<iEnd; ++i )
+                    C.Unpin( i, j, true );
+        }
+    }
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_OUTOFCORE_HPP
@@ -35,10 +35,14 @@ void SUMMA_TNA_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(3, A, B));
     DistMatrix<T,MC,STAR,ELEMENT,D> B1_MC_STAR(g);
     DistMatrix<T,MR,STAR,ELEMENT,D> D1_MR_STAR(g);
     DistMatrix<T,MR,MC  ,ELEMENT,D> D1_MR_MC(g);
+    UseWorkspace(B1_MC_STAR);
+    UseWorkspace(D1_MR_STAR);
+    UseWorkspace(D1_MR_MC);
 
     B1_MC_STAR.AlignWith(A);
     D1_MR_STAR.AlignWith(A);
@@ -154,9 +158,12 @@ void SUMMA_TNB_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(2, A, B));
     DistMatrix<T,MC,STAR,ELEMENT,D> A1_MC_STAR(g);
     DistMatrix<T,MR,STAR,ELEMENT,D> D1Trans_MR_STAR(g);
+    UseWorkspace(A1_MC_STAR);
+    UseWorkspace(D1Trans_MR_STAR);
 
     A1_MC_STAR.AlignWith(B);
     D1Trans_MR_STAR.AlignWith(B);
@@ -268,9 +275,12 @@ void SUMMA_TNC_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(2, A, B));
     DistMatrix<T,STAR,MC,ELEMENT,D> A1_STAR_MC(g);
     DistMatrix<T,MR,STAR,ELEMENT,D> B1Trans_MR_STAR(g);
+    UseWorkspace(A1_STAR_MC);
+    UseWorkspace(B1Trans_MR_STAR);
 
     A1_STAR_MC.AlignWith(C);
     B1Trans_MR_STAR.AlignWith(C);
@@ -34,10 +34,14 @@ void SUMMA_TTA_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(3, A, B));
     DistMatrix<T,STAR,MC  ,ELEMENT,D> B1_STAR_MC(g);
     DistMatrix<T,MR,  MC  ,ELEMENT,D> D1_MR_MC(g);
     DistMatrix<T,MR,  STAR,ELEMENT,D> D1_MR_STAR(g);
+    UseWorkspace(B1_STAR_MC);
+    UseWorkspace(D1_MR_MC);
+    UseWorkspace(D1_MR_STAR);
 
     B1_STAR_MC.AlignWith(A);
     D1_MR_STAR.AlignWith(A);
@@ -123,11 +127,16 @@ void SUMMA_TTB_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(4, A, B));
     DistMatrix<T,VR,  STAR,ELEMENT,D> A1_VR_STAR(g);
     DistMatrix<T,STAR,MR  ,ELEMENT,D> A1Trans_STAR_MR(g);
     DistMatrix<T,STAR,MC  ,ELEMENT,D> D1_STAR_MC(g);
     DistMatrix<T,MR,  MC  ,ELEMENT,D> D1_MR_MC(g);
+    UseWorkspace(A1_VR_STAR);
+    UseWorkspace(A1Trans_STAR_MR);
+    UseWorkspace(D1_STAR_MC);
+    UseWorkspace(D1_MR_MC);
 
     A1_VR_STAR.AlignWith(B);
     A1Trans_STAR_MR.AlignWith(B);
@@ -213,10 +222,14 @@ void SUMMA_TTC_impl
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
-    // Temporary distributions
+    // Temporary distributions, drawn from the workspace
+    WorkspaceScope workspace(SUMMAWorkspaceHint<D>(3, A, B));
     DistMatrix<T,STAR,MC  ,ELEMENT,D> A1_STAR_MC(g);
     DistMatrix<T,VR,  STAR,ELEMENT,D> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR  ,ELEMENT,D> B1Trans_STAR_MR(g);
+    UseWorkspace(A1_STAR_MC);
+    UseWorkspace(B1_VR_STAR);
+    UseWorkspace(B1Trans_STAR_MR);
 
     A1_STAR_MC.AlignWith(C);
     B1_VR_STAR.AlignWith(C);
@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_TILEMAJOR_HPP
+#define EL_GEMM_TILEMAJOR_HPP
+
+namespace El {
+namespace gemm {
+
+// C := alpha op(A) op(B) + beta C, for tile-major matrices with a common tile
+// size. Each tile of C is owned by a single thread, which accumulates the
+// products of the (contiguous) tiles of op(A) and op(B) into it in place.
+template<typename T>
+void TileMajor
+( Orientation orientA, Orientation orientB,
+  T alpha, const TileMatrix<T>& A, const TileMatrix<T>& B,
+  T beta,        TileMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( normalA ? A.Width() : A.Height() );
+    if( (normalA ? A.Height() : A.Width()) != m ||
+        (normalB ? B.Height() : B.Width()) != k ||
+        (normalB ? B.Width() : B.Height()) != n )
+        LogicError
+        ("Nonconformal tile-major Gemm: A is ",A.Height()," x ",A.Width(),
+         ", B is ",B.Height()," x ",B.Width(),", and C is ",m," x ",n);
+    if( A.TileSize() != C.TileSize() || B.TileSize() != C.TileSize() )
+        LogicError("Tile-major Gemm requires a common tile size");
+
+    const Int tileRows = C.TileRows();
+    const Int tileCols = C.TileCols();
+    const Int numSteps = ( normalA ? A.TileCols() : A.TileRows() );
+#ifdef EL_HYBRID
+    #pragma omp parallel for collapse(2) schedule(dynamic,1)
+#endif
+    for( Int j=0; j<tileCols; ++j )
+    {
+        for( Int i=0; i<tileRows; ++i )
+        {
+            auto CTile = C.Tile( i, j );
+            if( beta == T(0) )
+                Zero( CTile );
+            else if( beta != T(1) )
+                Scale( beta, CTile );
+            for( Int l=0; l<numSteps; ++l )
+                Gemm
+                ( orientA, orientB,
+                  alpha, normalA ? A.LockedTile(i,l) : A.LockedTile(l,i),
+                         normalB ? B.LockedTile(l,j) : B.LockedTile(j,l),
+                  T(1), CTile );
+        }
+    }
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_TILEMAJOR_HPP
@@ -0,0 +1,38 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GEMM_WORKSPACE_HPP
+#define EL_GEMM_WORKSPACE_HPP
+
+namespace El {
+namespace gemm {
+
+// A pre-sizing hint for the workspace of a SUMMA variant which holds
+// numPanels redistributed panels of width Blocksize() in each iteration. Each
+// panel is no longer than the largest dimension of A and B, is spread over
+// at least the smaller dimension of the grid, and is assumed to need a
+// communication buffer of the same size.
+template<Device D,typename T>
+size_t SUMMAWorkspaceHint
+(Int numPanels,
+ const AbstractDistMatrix<T>& A,
+ const AbstractDistMatrix<T>& B)
+{
+    if (D != Device::CPU)
+        return 0;
+    const Grid& g = A.Grid();
+    const Int maxDim =
+      Max(Max(A.Height(),A.Width()), Max(B.Height(),B.Width()));
+    const Int stride = Min(g.Height(), g.Width());
+    return 2*size_t(numPanels)*MaxLength(maxDim,stride)*Blocksize()*sizeof(T);
+}
+
+} // namespace gemm
+} // namespace El
+
+#endif // ifndef EL_GEMM_WORKSPACE_HPP
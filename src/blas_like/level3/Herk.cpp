@@ -57,6 +57,60 @@ void Herk(
     Syrk(uplo, orientation, T(alpha), A, T(0), C, true);
 }
 
+// Each tile of the triangle of C is owned by a single thread, which
+// accumulates the products of the (contiguous) tiles of op(A) into it in place
+template<typename T>
+void Herk(
+    UpperOrLower uplo, Orientation orientation,
+    Base<T> alpha, TileMatrix<T> const& A,
+    Base<T> beta, TileMatrix<T>& C)
+{
+    EL_DEBUG_CSE;
+    const bool normal = (orientation == NORMAL);
+    const Int n = (normal ? A.Height() : A.Width());
+    if (C.Height() != n || C.Width() != n)
+        LogicError
+        ("Nonconformal tile-major Herk: A is ",A.Height()," x ",A.Width(),
+         " and C is ",C.Height()," x ",C.Width());
+    if (A.TileSize() != C.TileSize())
+        LogicError("Tile-major Herk requires a common tile size");
+
+    const Int numTiles = C.TileRows();
+    const Int numSteps = (normal ? A.TileCols() : A.TileRows());
+    auto opA =
+      [&](Int i, Int l)
+      { return normal ? A.LockedTile(i,l) : A.LockedTile(l,i); };
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(dynamic,1)
+#endif
+    for (Int j=0; j<numTiles; ++j)
+    {
+        const Int iBeg = (uplo == LOWER ? j : 0);
+        const Int iEnd = (uplo == LOWER ? numTiles : j+1);
+        for (Int i=iBeg; i<iEnd; ++i)
+        {
+            auto CTile = C.Tile(i, j);
+            if (i == j)
+            {
+                ScaleTrapezoid(beta, uplo, CTile);
+                for (Int l=0; l<numSteps; ++l)
+                    Herk
+                    (uplo, orientation,
+                     alpha, opA(i,l), Base<T>(1), CTile);
+            }
+            else
+            {
+                Scale(T(beta), CTile);
+                const Orientation orientB = (normal ? ADJOINT : NORMAL);
+                for (Int l=0; l<numSteps; ++l)
+                    Gemm
+                    (orientation, orientB,
+                     T(alpha), opA(i,l), opA(j,l), T(1), CTile);
+            }
+        }
+    }
+}
+
 #define PROTO(T)                                        \
     template void Herk(                                 \
         UpperOrLower uplo, Orientation orientation,     \
@@ -83,4 +137,15 @@ void Herk(
 #define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
+// ScaleTrapezoid, which scales the diagonal tiles by beta, is not
+// instantiated for Int
+#define PROTO(T)                                        \
+    template void Herk(                                 \
+        UpperOrLower uplo, Orientation orientation,     \
+        Base<T> alpha, TileMatrix<T> const& A,          \
+        Base<T> beta, TileMatrix<T>& C);
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
 } // namespace El
@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Gemm/Workspace.hpp"
 #include "./Syrk/LN.hpp"
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
@@ -53,6 +54,7 @@ void SyrkImpl_(
     RuntimeError("Function not implemented for type on CPU.");
 }
 
+#ifdef HYDROGEN_HAVE_GPU
 template <typename T, typename=EnableWhen<IsComputeType<T,Device::GPU>>>
 void SyrkImpl_(
     UpperOrLower uplo_in, Orientation orientation,
@@ -92,6 +94,7 @@ void SyrkImpl_(
 {
     RuntimeError("Function not implemented for type on GPU.");
 }
+#endif // HYDROGEN_HAVE_GPU
 
 }// namespace
 
@@ -28,9 +28,14 @@ void LN_C
     auto& C = CProx.Get();
 
     // Temporary distributions
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, APre, CPre ) );
     DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
     DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
     DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+    UseWorkspace( A1_MC_STAR );
+    UseWorkspace( A1_VR_STAR );
+    UseWorkspace( A1Trans_STAR_MR );
 
     A1_MC_STAR.AlignWith( C );
     A1_VR_STAR.AlignWith( C );
@@ -65,9 +70,14 @@ void LNDot
     auto& C = CProx.Get();
 
     // Temporary distributions
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, APre, CPre ) );
     DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
     DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
     DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+    UseWorkspace( A1_MC_STAR );
+    UseWorkspace( A1_VR_STAR );
+    UseWorkspace( A1Trans_STAR_MR );
 
     A1_MC_STAR.AlignWith( C );
     A1_VR_STAR.AlignWith( C );
@@ -29,9 +29,14 @@ void LT_C
     auto& C = CProx.Get();
 
     // Temporary distributions
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, APre, CPre ) );
     DistMatrix<T,MR,  STAR> A1Trans_MR_STAR(g);
     DistMatrix<T,STAR,VR  > A1_STAR_VR(g);
     DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+    UseWorkspace( A1Trans_MR_STAR );
+    UseWorkspace( A1_STAR_VR );
+    UseWorkspace( A1_STAR_MC );
 
     A1Trans_MR_STAR.AlignWith( C );
     A1_STAR_MC.AlignWith( C );
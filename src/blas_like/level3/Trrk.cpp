@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Gemm/Workspace.hpp"
 #include "./Trrk/Local.hpp"
 #include "./Trrk/NN.hpp"
 #include "./Trrk/NT.hpp"
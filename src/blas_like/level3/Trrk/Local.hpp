@@ -120,372 +120,139 @@ void CheckInputTT
 
 #endif // ifndef EL_RELEASE
 
-// Local C := alpha A B + C
+// The triangle of C is partitioned into tiles of order bsize (with respect to
+// the global indices, so that the process grid's strides are accounted for),
+// and each work item consists of a diagonal tile along with the rectangle of
+// off-diagonal tiles which shares its rows (if lower) or its columns (if
+// upper), e.g., item k of the lower case is
+//
+//   C(k,0:k-1) += alpha op(A)(k,:) op(B)(:,0:k-1),
+//   C(k,k)     += tril(alpha op(A)(k,:) op(B)(:,k)).
+//
+// The rectangles are updated in-place with a single Gemm, and only the
+// diagonal tiles are formed within a (per-thread) scratch matrix before their
+// triangles are added into C, so no more than O(bsize^2) workspace is needed.
+// Since the items update disjoint portions of C, they are distributed over the
+// OpenMP threads, longest first.
+//
+// The local row i of C corresponds to global row colShift+i*colStride and the
+// local column j to global column rowShift+j*rowStride.
 template<typename T>
-void TrrkNNKernel
-(UpperOrLower uplo,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputNN(A, B, C))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm(NORMAL, NORMAL, alpha, AB, BL, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm(NORMAL, NORMAL, alpha, AT, BR, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm(NORMAL, NORMAL, alpha, AT, BL, DTL);
-    AxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm(NORMAL, NORMAL, alpha, AB, BR, DBR);
-    AxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Distributed C := alpha A B + C
-template<typename T>
-void LocalTrrkKernel
-(UpperOrLower uplo,
-  T alpha, const DistMatrix<T,MC,  STAR>& A,
-           const DistMatrix<T,STAR,MR  >& B,
-                 DistMatrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm(NORMAL, NORMAL, alpha, AB, BL, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm(NORMAL, NORMAL, alpha, AT, BR, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith(CTL);
-    LocalGemm(NORMAL, NORMAL, alpha, AT, BL, DTL);
-    LocalAxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith(CBR);
-    LocalGemm(NORMAL, NORMAL, alpha, AB, BR, DBR);
-    LocalAxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Local C := alpha A B^{T/H} + C
-template<typename T>
-void TrrkNTKernel
-(UpperOrLower uplo,
-  Orientation orientationOfB,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputNT(orientationOfB, A, B, C))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm(NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm(NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm(NORMAL, orientationOfB, alpha, AT, BT, DTL);
-    AxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm(NORMAL, orientationOfB, alpha, AB, BB, DBR);
-    AxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Distributed C := alpha A B^{T/H} + C
-template<typename T>
-void LocalTrrkKernel
-(UpperOrLower uplo,
-  Orientation orientationOfB,
-  T alpha, const DistMatrix<T,MC,STAR>& A,
-           const DistMatrix<T,MR,STAR>& B,
-                 DistMatrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AT = A(indTL,ALL);
-    auto AB = A(indBR,ALL);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm(NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm(NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith(CTL);
-    LocalGemm(NORMAL, orientationOfB, alpha, AT, BT, DTL);
-    LocalAxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith(CBR);
-    LocalGemm(NORMAL, orientationOfB, alpha, AB, BB, DBR);
-    LocalAxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Local C := alpha A^{T/H} B + C
-template<typename T>
-void TrrkTNKernel
-(UpperOrLower uplo,
-  Orientation orientationOfA,
-  T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputTN(orientationOfA, A, B, C))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm(orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm(orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm(orientationOfA, NORMAL, alpha, AL, BL, DTL);
-    AxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm(orientationOfA, NORMAL, alpha, AR, BR, DBR);
-    AxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Distributed C := alpha A^{T/H} B + C
-template<typename T>
-void LocalTrrkKernel
-(UpperOrLower uplo,
-  Orientation orientationOfA,
-  T alpha, const DistMatrix<T,STAR,MC>& A,
-           const DistMatrix<T,STAR,MR>& B,
-                 DistMatrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BL = B(ALL,indTL);
-    auto BR = B(ALL,indBR);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        LocalGemm(orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm(orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith(CTL);
-    LocalGemm(orientationOfA, NORMAL, alpha, AL, BL, DTL);
-    LocalAxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith(CBR);
-    LocalGemm(orientationOfA, NORMAL, alpha, AR, BR, DBR);
-    LocalAxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Local C := alpha A^{T/H} B^{T/H} + C
-template<typename T>
-void TrrkTTKernel
+void TiledKernel
 (UpperOrLower uplo,
   Orientation orientationOfA,
   Orientation orientationOfB,
   T alpha, const Matrix<T>& A, const Matrix<T>& B,
-                 Matrix<T>& C)
-{
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInputTT(orientationOfA, orientationOfB, A, B, C))
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
-
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
-
-    if (uplo == LOWER)
-    {
-        auto CBL = C(indBR,indTL);
-        Gemm(orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        Gemm(orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR);
-    }
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DTL;
-    Gemm(orientationOfA, orientationOfB, alpha, AL, BT, DTL);
-    AxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    Matrix<T> DBR;
-    Gemm(orientationOfA, orientationOfB, alpha, AR, BB, DBR);
-    AxpyTrapezoid(uplo, T(1), DBR, CBR);
-}
-
-// Distributed C := alpha A^{T/H} B^{T/H} + C
-template<typename T>
-void LocalTrrkKernel
-(UpperOrLower uplo,
-  Orientation orientationOfA,
-  Orientation orientationOfB,
-  T alpha, const DistMatrix<T,STAR,MC  >& A,
-           const DistMatrix<T,MR,  STAR>& B,
-                 DistMatrix<T>& C)
+                 Matrix<T>& C,
+  Int height, Int bsize,
+  Int colShift, Int colStride,
+  Int rowShift, Int rowStride)
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
-
-    const Int half = C.Height()/2;
-    const auto indTL = IR(0,half);
-    const auto indBR = IR(half,END);
+    const Int innerDim =
+      ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    if (height == 0 || innerDim == 0 || C.Height() == 0 || C.Width() == 0)
+        return;
+    const Int numTiles = (height+bsize-1)/bsize;
+
+    // Views of the rows, I, of op(A) and the columns, J, of op(B)
+    auto opARows =
+      [&](const Range<Int>& I)
+      {
+        Matrix<T> AI;
+        if (orientationOfA == NORMAL)
+            LockedView(AI, A, I, ALL);
+        else
+            LockedView(AI, A, ALL, I);
+        return AI;
+      };
+    auto opBCols =
+      [&](const Range<Int>& J)
+      {
+        Matrix<T> BJ;
+        if (orientationOfB == NORMAL)
+            LockedView(BJ, B, ALL, J);
+        else
+            LockedView(BJ, B, J, ALL);
+        return BJ;
+      };
+
+    auto item =
+      [&](Int k, Matrix<T>& D)
+      {
+        // The local indices of the global range [k bsize,(k+1) bsize)
+        const Int kBeg = k*bsize;
+        const Int kEnd = Min(kBeg+bsize,height);
+        const Range<Int>
+          rowInd(Length(kBeg,colShift,colStride),
+                 Length(kEnd,colShift,colStride)),
+          colInd(Length(kBeg,rowShift,rowStride),
+                 Length(kEnd,rowShift,rowStride));
+
+        auto A1 = opARows(rowInd);
+        auto B1 = opBCols(colInd);
+        if (uplo == LOWER)
+        {
+            const Range<Int> offInd(0,colInd.beg);
+            if (offInd.end > 0)
+            {
+                auto BL = opBCols(offInd);
+                auto C1L = C(rowInd,offInd);
+                Gemm(orientationOfA, orientationOfB, alpha, A1, BL, T(1), C1L);
+            }
+        }
+        else
+        {
+            const Range<Int> offInd(0,rowInd.beg);
+            if (offInd.end > 0)
+            {
+                auto AT = opARows(offInd);
+                auto CT1 = C(offInd,colInd);
+                Gemm(orientationOfA, orientationOfB, alpha, AT, B1, T(1), CT1);
+            }
+        }
 
-    auto AL = A(ALL,indTL);
-    auto AR = A(ALL,indBR);
-    auto BT = B(indTL,ALL);
-    auto BB = B(indBR,ALL);
-    auto CTL = C(indTL,indTL);
-    auto CBR = C(indBR,indBR);
+        const Int tileHeight = rowInd.end - rowInd.beg;
+        const Int tileWidth = colInd.end - colInd.beg;
+        if (tileHeight == 0 || tileWidth == 0)
+            return;
+        Gemm(orientationOfA, orientationOfB, alpha, A1, B1, D);
+        auto C11 = C(rowInd,colInd);
+        for (Int jLoc=0; jLoc<tileWidth; ++jLoc)
+        {
+            const Int j = rowShift + (colInd.beg+jLoc)*rowStride;
+            // The number of rows of the tile above (lower) or through (upper)
+            // the diagonal of global column j
+            const Int iSplit =
+              Length(uplo == LOWER ? j : j+1, colShift, colStride) -
+              rowInd.beg;
+            const Int iBeg = (uplo == LOWER ? Max(iSplit,Int(0)) : 0);
+            const Int iEnd =
+              (uplo == LOWER ? tileHeight : Min(iSplit,tileHeight));
+            for (Int iLoc=iBeg; iLoc<iEnd; ++iLoc)
+                C11(iLoc,jLoc) += D(iLoc,jLoc);
+        }
+      };
 
-    if (uplo == LOWER)
+#ifdef EL_HYBRID
+    // When called from within a parallel region (e.g., by a threaded caller),
+    // the tiles are processed by the calling thread rather than by a nested
+    // team
+    if (!omp_in_parallel())
     {
-        auto CBL = C(indBR,indTL);
-        LocalGemm(orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL);
-    }
-    else
-    {
-        auto CTR = C(indTL,indBR);
-        LocalGemm(orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR);
+        #pragma omp parallel
+        {
+            Matrix<T> D;
+            #pragma omp for schedule(dynamic,1)
+            for (Int t=0; t<numTiles; ++t)
+                item(numTiles-1-t, D);
+        }
+        return;
     }
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DTL(g);
-    DTL.AlignWith(CTL);
-    LocalGemm(orientationOfA, orientationOfB, alpha, AL, BT, DTL);
-    LocalAxpyTrapezoid(uplo, T(1), DTL, CTL);
-
-    // TODO(poulson): Avoid the temporary copy
-    DistMatrix<T> DBR(g);
-    DBR.AlignWith(CBR);
-    LocalGemm(orientationOfA, orientationOfB, alpha, AR, BB, DBR);
-    LocalAxpyTrapezoid(uplo, T(1), DBR, CBR);
+#endif
+    Matrix<T> D;
+    for (Int k=0; k<numTiles; ++k)
+        item(k, D);
 }
 
 // Local C := alpha A B + C
@@ -496,42 +263,10 @@ void TrrkNN
                  Matrix<T>& C)
 {
     EL_DEBUG_CSE
-    using namespace trrk;
     EL_DEBUG_ONLY(CheckInputNN(A, B, C))
-    if (C.Height() < LocalTrrkBlocksize<T>())
-    {
-        TrrkNNKernel(uplo, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm(NORMAL, NORMAL, alpha, AB, BL, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm(NORMAL, NORMAL, alpha, AT, BR, T(1), CTR);
-        }
-
-        // Recurse
-        TrrkNN(uplo, alpha, AT, BL, CTL);
-        TrrkNN(uplo, alpha, AB, BR, CBR);
-    }
+    TiledKernel
+    (uplo, NORMAL, NORMAL, alpha, A, B, C,
+     C.Height(), LocalTrrkBlocksize<T>(), 0, 1, 0, 1);
 }
 
 // Local C := alpha A B^{T/H} + C
@@ -543,42 +278,10 @@ void TrrkNT
                  Matrix<T>& C)
 {
     EL_DEBUG_CSE
-    using namespace trrk;
     EL_DEBUG_ONLY(CheckInputNT(orientationOfB, A, B, C))
-    if (C.Height() < LocalTrrkBlocksize<T>())
-    {
-        TrrkNTKernel(uplo, orientationOfB, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm(NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm(NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR);
-        }
-
-        // Recurse
-        TrrkNT(uplo, orientationOfB, alpha, AT, BT, CTL);
-        TrrkNT(uplo, orientationOfB, alpha, AB, BB, CBR);
-    }
+    TiledKernel
+    (uplo, NORMAL, orientationOfB, alpha, A, B, C,
+     C.Height(), LocalTrrkBlocksize<T>(), 0, 1, 0, 1);
 }
 
 // Local C := alpha A^{T/H} B + C
@@ -590,42 +293,10 @@ void TrrkTN
                  Matrix<T>& C)
 {
     EL_DEBUG_CSE
-    using namespace trrk;
     EL_DEBUG_ONLY(CheckInputTN(orientationOfA, A, B, C))
-    if (C.Height() < LocalTrrkBlocksize<T>())
-    {
-        TrrkTNKernel(uplo, orientationOfA, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm(orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm(orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR);
-        }
-
-        // Recurse
-        TrrkTN(uplo, orientationOfA, alpha, AL, BL, CTL);
-        TrrkTN(uplo, orientationOfA, alpha, AR, BR, CBR);
-    }
+    TiledKernel
+    (uplo, orientationOfA, NORMAL, alpha, A, B, C,
+     C.Height(), LocalTrrkBlocksize<T>(), 0, 1, 0, 1);
 }
 
 // Local C := alpha A^{T/H} B^{T/H} + C
@@ -637,42 +308,27 @@ void TrrkTT
                  Matrix<T>& C)
 {
     EL_DEBUG_CSE
-    using namespace trrk;
     EL_DEBUG_ONLY(CheckInputTT(orientationOfA, orientationOfB, A, B, C))
-    if (C.Height() < LocalTrrkBlocksize<T>())
-    {
-        TrrkTTKernel(uplo, orientationOfA, orientationOfB, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            Gemm(orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            Gemm(orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR);
-        }
+    TiledKernel
+    (uplo, orientationOfA, orientationOfB, alpha, A, B, C,
+     C.Height(), LocalTrrkBlocksize<T>(), 0, 1, 0, 1);
+}
 
-        // Recurse
-        TrrkTT(uplo, orientationOfA, orientationOfB, alpha, AL, BT, CTL);
-        TrrkTT(uplo, orientationOfA, orientationOfB, alpha, AR, BB, CBR);
-    }
+// Distributed C := alpha op(A) op(B) + C, where the local data of A, B, and C
+// are conformal
+template<typename T>
+void LocalTiledKernel
+(UpperOrLower uplo,
+  Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const Matrix<T>& ALoc, const Matrix<T>& BLoc,
+                 DistMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    const Grid& g = C.Grid();
+    TiledKernel
+    (uplo, orientationOfA, orientationOfB, alpha, ALoc, BLoc, C.Matrix(),
+     C.Height(), g.Width()*LocalTrrkBlocksize<T>(),
+     C.ColShift(), C.ColStride(), C.RowShift(), C.RowStride());
 }
 
 } // namespace trrk
@@ -688,43 +344,9 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
-
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
-    {
-        LocalTrrkKernel(uplo, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm(NORMAL, NORMAL, alpha, AB, BL, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm(NORMAL, NORMAL, alpha, AT, BR, T(1), CTR);
-        }
-
-        // Recurse
-        LocalTrrk(uplo, alpha, AT, BL, T(1), CTL);
-        LocalTrrk(uplo, alpha, AB, BR, T(1), CBR);
-    }
+    LocalTiledKernel
+    (uplo, NORMAL, NORMAL, alpha, A.LockedMatrix(), B.LockedMatrix(), C);
 }
 
 // Distributed C := alpha A B^{T/H} + beta C
@@ -739,43 +361,10 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
-
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
-    {
-        LocalTrrkKernel(uplo, orientationOfB, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AT = A(indTL,ALL);
-        auto AB = A(indBR,ALL);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm(NORMAL, orientationOfB, alpha, AB, BT, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm(NORMAL, orientationOfB, alpha, AT, BB, T(1), CTR);
-        }
-
-        // Recurse
-        LocalTrrk(uplo, orientationOfB, alpha, AT, BT, T(1), CTL);
-        LocalTrrk(uplo, orientationOfB, alpha, AB, BB, T(1), CBR);
-    }
+    LocalTiledKernel
+    (uplo, NORMAL, orientationOfB, alpha,
+     A.LockedMatrix(), B.LockedMatrix(), C);
 }
 
 // Distributed C := alpha A^{T/H} B + beta C
@@ -790,43 +379,10 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
-
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
-    {
-        LocalTrrkKernel(uplo, orientationOfA, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BL = B(ALL,indTL);
-        auto BR = B(ALL,indBR);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm(orientationOfA, NORMAL, alpha, AR, BL, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm(orientationOfA, NORMAL, alpha, AL, BR, T(1), CTR);
-        }
-
-        // Recurse
-        LocalTrrk(uplo, orientationOfA, alpha, AL, BL, T(1), CTL);
-        LocalTrrk(uplo, orientationOfA, alpha, AR, BR, T(1), CBR);
-    }
+    LocalTiledKernel
+    (uplo, orientationOfA, NORMAL, alpha,
+     A.LockedMatrix(), B.LockedMatrix(), C);
 }
 
 // Distributed C := alpha A^{T/H} B^{T/H} + beta C
@@ -841,47 +397,10 @@ void LocalTrrk
     EL_DEBUG_CSE
     using namespace trrk;
     EL_DEBUG_ONLY(CheckInput(A, B, C))
-    const Grid& g = C.Grid();
     ScaleTrapezoid(beta, uplo, C);
-
-    if (C.Height() < g.Width()*LocalTrrkBlocksize<T>())
-    {
-        LocalTrrkKernel(uplo, orientationOfA, orientationOfB, alpha, A, B, C);
-    }
-    else
-    {
-        // Split C in four roughly equal pieces, perform a large gemm on corner
-        // and recurse on CTL and CBR.
-        const Int half = C.Height()/2;
-        const auto indTL = IR(0,half);
-        const auto indBR = IR(half,END);
-
-        auto AL = A(ALL,indTL);
-        auto AR = A(ALL,indBR);
-        auto BT = B(indTL,ALL);
-        auto BB = B(indBR,ALL);
-        auto CTL = C(indTL,indTL);
-        auto CBR = C(indBR,indBR);
-
-        if (uplo == LOWER)
-        {
-            auto CBL = C(indBR,indTL);
-            LocalGemm
-            (orientationOfA, orientationOfB, alpha, AR, BT, T(1), CBL);
-        }
-        else
-        {
-            auto CTR = C(indTL,indBR);
-            LocalGemm
-            (orientationOfA, orientationOfB, alpha, AL, BB, T(1), CTR);
-        }
-
-        // Recurse
-        LocalTrrk
-        (uplo, orientationOfA, orientationOfB, alpha, AL, BT, T(1), CTL);
-        LocalTrrk
-        (uplo, orientationOfA, orientationOfB, alpha, AR, BB, T(1), CBR);
-    }
+    LocalTiledKernel
+    (uplo, orientationOfA, orientationOfB, alpha,
+     A.LockedMatrix(), B.LockedMatrix(), C);
 }
 
 } // namespace El
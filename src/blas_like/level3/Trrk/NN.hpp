@@ -37,8 +37,12 @@ void TrrkNN
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 2, APre, BPre ) );
     DistMatrix<T,MC,STAR> A1_MC_STAR(g);
     DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
+    UseWorkspace( A1_MC_STAR );
+    UseWorkspace( B1Trans_MR_STAR );
 
     A1_MC_STAR.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -40,9 +40,14 @@ void TrrkNT
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, APre, BPre ) );
     DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
     DistMatrix<T,VR,  STAR> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR  > B1Trans_STAR_MR(g);
+    UseWorkspace( A1_MC_STAR );
+    UseWorkspace( B1_VR_STAR );
+    UseWorkspace( B1Trans_STAR_MR );
 
     A1_MC_STAR.AlignWith( C );
     B1_VR_STAR.AlignWith( C );
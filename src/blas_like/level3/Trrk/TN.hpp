@@ -40,8 +40,12 @@ void TrrkTN
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 2, APre, BPre ) );
     DistMatrix<T,STAR,MC> A1_STAR_MC(g);
     DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
+    UseWorkspace( A1_STAR_MC );
+    UseWorkspace( B1Trans_MR_STAR );
 
     A1_STAR_MC.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
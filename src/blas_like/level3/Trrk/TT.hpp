@@ -41,9 +41,14 @@ void TrrkTT
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, APre, BPre ) );
     DistMatrix<T,STAR,MC> A1_STAR_MC(g);
     DistMatrix<T,VR,STAR> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
+    UseWorkspace( A1_STAR_MC );
+    UseWorkspace( B1_VR_STAR );
+    UseWorkspace( B1Trans_STAR_MR );
 
     A1_STAR_MC.AlignWith( C );
     B1_VR_STAR.AlignWith( C );
@@ -10,7 +10,9 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level2.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/blas_like/level1/Copy.hpp>
 
+#include "./Gemm/Workspace.hpp"
 #include "./Trsm/LLN.hpp"
 #include "./Trsm/LLT.hpp"
 #include "./Trsm/LUN.hpp"
@@ -19,6 +21,9 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Recursive.hpp"
+#include "./Trsm/Lookahead.hpp"
+#include "./Trsm/TileMajor.hpp"
 
 namespace El {
 
@@ -124,52 +129,22 @@ void Trsm(
     }
 }
 
-// TODO: Make the TRSM_DEFAULT switching mechanism smarter (perhaps, empirical)
+namespace trsm {
+
+// The blocked variants, with TRSM_DEFAULT choosing between the large and
+// medium variants by the number of right-hand sides
 template<typename F>
-void Trsm
+void Blocked
 ( LeftOrRight side,
   UpperOrLower uplo,
   Orientation orientation,
   UnitOrNonUnit diag,
-  F alpha,
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
-  bool checkIfSingular, TrsmAlgorithm alg )
+  bool checkIfSingular,
+  TrsmAlgorithm alg )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      AssertSameGrids( A, B );
-      if( A.Height() != A.Width() )
-          LogicError("A must be square");
-      if( side == LEFT )
-      {
-          if( A.Height() != B.Height() )
-              LogicError("Nonconformal Trsm");
-      }
-      else
-      {
-          if( A.Height() != B.Width() )
-              LogicError("Nonconformal Trsm");
-      }
-    )
-    B *= alpha;
-
-    // Call the single right-hand side algorithm if appropriate
-    if( side == LEFT && B.Width() == 1 )
-    {
-        Trsv( uplo, orientation, diag, A, B );
-        return;
-    }
-    // TODO: Compute appropriate transpose/conjugation options to convert
-    //       to Trsv.
-    /*
-    else if( side == RIGHT && B.Height() == 1 )
-    {
-        Trsv( uplo, orientation, diag, A, B );
-        return;
-    }
-    */
-
     const Int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
     {
@@ -435,6 +410,92 @@ void Trsm
     }
 }
 
+// Choose an algorithm from the order of the triangle, n, the number of
+// right-hand sides, and the grid. Small triangles, few right-hand sides, and
+// single processes are left to the blocked variants, whose panel updates are
+// then not dominated by communication. Otherwise, for many right-hand sides
+// the recursive variant recasts the bulk of the work as large Gemms, while for
+// moderate numbers of right-hand sides (when the solve is latency-bound) the
+// lookahead variant hides the panel communication behind the trailing update.
+inline TrsmAlgorithm SelectAlgorithm
+( LeftOrRight side, Int n, Int numRHS, const Grid& grid )
+{
+    const Int p = grid.Size();
+    if( p == 1 || n <= RecursiveCutoff() || numRHS <= p )
+        return TRSM_DEFAULT;
+    if( numRHS > 5*p )
+        return TRSM_RECURSIVE;
+    if( side == LEFT )
+        return TRSM_LOOKAHEAD;
+    return TRSM_DEFAULT;
+}
+
+} // namespace trsm
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& B,
+  bool checkIfSingular, TrsmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( side == LEFT )
+      {
+          if( A.Height() != B.Height() )
+              LogicError("Nonconformal Trsm");
+      }
+      else
+      {
+          if( A.Height() != B.Width() )
+              LogicError("Nonconformal Trsm");
+      }
+    )
+    B *= alpha;
+
+    // Call the single right-hand side algorithm if appropriate
+    if( side == LEFT && B.Width() == 1 )
+    {
+        Trsv( uplo, orientation, diag, A, B );
+        return;
+    }
+    // TODO: Compute appropriate transpose/conjugation options to convert
+    //       to Trsv.
+    /*
+    else if( side == RIGHT && B.Height() == 1 )
+    {
+        Trsv( uplo, orientation, diag, A, B );
+        return;
+    }
+    */
+
+    if( alg == TRSM_DEFAULT )
+    {
+        const Int numRHS = ( side == LEFT ? B.Width() : B.Height() );
+        alg = trsm::SelectAlgorithm( side, A.Height(), numRHS, B.Grid() );
+    }
+
+    if( alg == TRSM_RECURSIVE )
+        trsm::Recursive( side, uplo, orientation, diag, A, B, checkIfSingular );
+    else if( alg == TRSM_LOOKAHEAD )
+    {
+        if( side != LEFT )
+            LogicError("Unsupported TRSM algorithm");
+        trsm::LeftLookahead( uplo, orientation, diag, A, B, checkIfSingular );
+    }
+    else
+        trsm::Blocked
+        ( side, uplo, orientation, diag, A, B, checkIfSingular, alg );
+}
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side,
@@ -458,6 +519,20 @@ void LocalTrsm
       alpha, A.LockedMatrix(), X.Matrix(), checkIfSingular );
 }
 
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const TileMatrix<F>& A,
+        TileMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    trsm::TileMajor( side, uplo, orientation, diag, alpha, A, B );
+}
+
 #define PROTO(F) \
   template void Trsm \
   ( LeftOrRight side, \
@@ -496,4 +571,19 @@ void LocalTrsm
 #define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
+// Tile-major triangular solves, which are restricted to fields like the
+// other variants above
+#define PROTO(F) \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const TileMatrix<F>& A, \
+          TileMatrix<F>& B );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
 } // namespace El
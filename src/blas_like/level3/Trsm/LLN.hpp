@@ -32,10 +32,16 @@ void LLNLarge
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, LPre, XPre ) );
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( L21_MC_STAR );
+    UseWorkspace( X1_STAR_MR );
+    UseWorkspace( X1_STAR_VR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -87,9 +93,14 @@ void LLNMedium
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 2, LPre, XPre ) );
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( L21_MC_STAR );
+    UseWorkspace( X1Trans_MR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -141,6 +152,8 @@ void LLNSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( X1_STAR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
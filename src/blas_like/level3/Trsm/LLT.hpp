@@ -39,10 +39,16 @@ void LLTLarge
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, LPre, XPre ) );
     DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    UseWorkspace( L10_STAR_MC );
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( X1_STAR_MR );
+    UseWorkspace( X1_STAR_VR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -102,9 +108,14 @@ void LLTMedium
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 2, LPre, XPre ) );
     DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    UseWorkspace( L10_STAR_MC );
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( X1Trans_MR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -168,6 +179,8 @@ void LLTSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( Z1_STAR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -221,6 +234,8 @@ void LLTSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( X1_STAR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -31,10 +31,16 @@ void LUNLarge
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, UPre, XPre ) );
     DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    UseWorkspace( U01_MC_STAR );
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( X1_STAR_MR );
+    UseWorkspace( X1_STAR_VR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -86,9 +92,14 @@ void LUNMedium
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 2, UPre, XPre ) );
     DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    UseWorkspace( U01_MC_STAR );
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( X1Trans_MR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -145,6 +156,8 @@ void LUNSmall
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( X1_STAR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
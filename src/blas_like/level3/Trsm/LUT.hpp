@@ -39,10 +39,16 @@ void LUTLarge
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, UPre, XPre ) );
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
     DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( U12_STAR_MC );
+    UseWorkspace( X1_STAR_MR );
+    UseWorkspace( X1_STAR_VR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -101,9 +107,14 @@ void LUTMedium
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 2, UPre, XPre ) );
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
     DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( U12_STAR_MC );
+    UseWorkspace( X1Trans_MR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -166,6 +177,8 @@ void LUTSmall
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( X1_STAR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
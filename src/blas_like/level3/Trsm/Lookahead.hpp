@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// A nonblocking version of the [MC,MR] -> [* ,MR] redistribution (see
+// copy::ColAllGather): Start packs the local data and begins the AllGather
+// over the column communicator, and Finish waits upon it and unpacks the result
+template<typename F>
+class PanelColGather
+{
+public:
+    void Start( const DistMatrix<F>& A, DistMatrix<F,STAR,MR>& B )
+    {
+        EL_DEBUG_CSE
+        pending_ = false;
+        B.AlignRowsAndResize
+        ( A.RowAlign(), A.Height(), A.Width(), false, false );
+        if( !A.Participating() )
+            return;
+        if( A.ColStride() == 1 || A.Height() == 1 ||
+            B.RowAlign() != A.RowAlign() )
+        {
+            B = A;
+            return;
+        }
+
+        B_ = &B;
+        height_ = A.Height();
+        localWidth_ = A.LocalWidth();
+        colAlign_ = A.ColAlign();
+        colStride_ = A.ColStride();
+        portionSize_ = mpi::Pad(MaxLength(height_,colStride_)*localWidth_);
+        buffer_.resize( (colStride_+1)*portionSize_ );
+
+        copy::util::InterleaveMatrix
+        ( A.LocalHeight(), localWidth_,
+          A.LockedBuffer(), 1, A.LDim(),
+          buffer_.data(),   1, A.LocalHeight(), syncInfo_ );
+        mpi::IAllGather
+        ( buffer_.data(),              portionSize_,
+          buffer_.data()+portionSize_, portionSize_,
+          A.ColComm(), request_ );
+        pending_ = true;
+    }
+
+    void Finish()
+    {
+        EL_DEBUG_CSE
+        if( !pending_ )
+            return;
+        mpi::Wait( request_ );
+        copy::util::ColStridedUnpack
+        ( height_, localWidth_, colAlign_, colStride_,
+          buffer_.data()+portionSize_, portionSize_,
+          B_->Buffer(), B_->LDim(), syncInfo_ );
+        pending_ = false;
+    }
+
+private:
+    bool pending_=false;
+    DistMatrix<F,STAR,MR>* B_=nullptr;
+    Int height_, localWidth_, colAlign_, colStride_, portionSize_;
+    vector<F> buffer_;
+    mpi::Request<F> request_;
+    SyncInfo<Device::CPU> syncInfo_;
+};
+
+// Left (Non)Unit Trsm with a lookahead of one panel: once panel k of X has
+// been solved, only the rows of X belonging to the next panel are updated
+// before the gather of that panel into [* ,MR] is started, so that its
+// communication overlaps with the update of the remaining rows. Each panel is
+// then solved redundantly within each process column, which avoids the
+// [* ,VR] round trip of the non-lookahead variants.
+template<typename F>
+void LeftLookahead
+( UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    const Int m = XPre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& X = XProx.Get();
+
+    // The panels, in the order in which they are solved
+    const bool forward = ( (uplo == LOWER) == (orientation == NORMAL) );
+    vector<Range<Int>> panels;
+    if( forward )
+        for( Int k=0; k<m; k+=bsize )
+            panels.emplace_back( k, Min(k+bsize,m) );
+    else
+        for( Int k=LastOffset(m,bsize); k>=0; k-=bsize )
+            panels.emplace_back( k, Min(k+bsize,m) );
+    const Int numPanels = panels.size();
+    if( numPanels == 0 )
+        return;
+
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 4, APre, XPre ) );
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,MC,STAR> AR1_MC_STAR(g);
+    DistMatrix<F,STAR,MC> A1R_STAR_MC(g);
+    DistMatrix<F,STAR,MR> X1A_STAR_MR(g), X1B_STAR_MR(g);
+    UseWorkspace( A11_STAR_STAR );
+    UseWorkspace( AR1_MC_STAR );
+    UseWorkspace( A1R_STAR_MC );
+    UseWorkspace( X1A_STAR_MR );
+    UseWorkspace( X1B_STAR_MR );
+    DistMatrix<F,STAR,MR>* X1_STAR_MR = &X1A_STAR_MR;
+    DistMatrix<F,STAR,MR>* X1Next_STAR_MR = &X1B_STAR_MR;
+    PanelColGather<F> gather;
+
+    X1_STAR_MR->AlignWith( X );
+    X1Next_STAR_MR->AlignWith( X );
+    {
+        auto X1 = X( panels[0], ALL );
+        gather.Start( X1, *X1_STAR_MR );
+    }
+    for( Int i=0; i<numPanels; ++i )
+    {
+        const Range<Int> ind1 = panels[i];
+        const Range<Int> indR =
+          ( forward ? Range<Int>(ind1.end,m) : Range<Int>(0,ind1.beg) );
+        const bool last = ( i+1 == numPanels );
+
+        auto A11 = A( ind1, ind1 );
+        auto X1 = X( ind1, ALL );
+        auto XR = X( indR, ALL );
+
+        // Redistribute the triangle's blocks while the gather of X1 completes
+        A11_STAR_STAR = A11;
+        if( !last )
+        {
+            if( orientation == NORMAL )
+            {
+                AR1_MC_STAR.AlignWith( XR );
+                AR1_MC_STAR = A( indR, ind1 );
+            }
+            else
+            {
+                A1R_STAR_MC.AlignWith( XR );
+                A1R_STAR_MC = A( ind1, indR );
+            }
+        }
+
+        // X1[* ,MR] := op(A11)^-1[* ,* ] X1[* ,MR]
+        gather.Finish();
+        LocalTrsm
+        ( LEFT, uplo, orientation, diag, F(1), A11_STAR_STAR, *X1_STAR_MR,
+          checkIfSingular );
+        X1 = *X1_STAR_MR;
+        if( last )
+            break;
+
+        // XB[MC,MR] -= op(A)[MC,* ] X1[* ,MR] over the rows, indB, of XR
+        auto update =
+          [&]( const Range<Int>& indB )
+          {
+              auto XB = XR( indB, ALL );
+              if( orientation == NORMAL )
+              {
+                  auto AB1_MC_STAR = AR1_MC_STAR( indB, ALL );
+                  LocalGemm
+                  ( NORMAL, NORMAL,
+                    F(-1), AB1_MC_STAR, *X1_STAR_MR, F(1), XB );
+              }
+              else
+              {
+                  auto A1B_STAR_MC = A1R_STAR_MC( ALL, indB );
+                  LocalGemm
+                  ( orientation, NORMAL,
+                    F(-1), A1B_STAR_MC, *X1_STAR_MR, F(1), XB );
+              }
+          };
+
+        // Update the next panel and start gathering it before updating the
+        // remainder
+        const Range<Int> indNext
+        ( panels[i+1].beg-indR.beg, panels[i+1].end-indR.beg );
+        const Range<Int> indRest =
+          ( forward ? Range<Int>(indNext.end,indR.end-indR.beg)
+                    : Range<Int>(0,indNext.beg) );
+        update( indNext );
+        {
+            auto XNext = XR( indNext, ALL );
+            gather.Start( XNext, *X1Next_STAR_MR );
+        }
+        update( indRest );
+
+        std::swap( X1_STAR_MR, X1Next_STAR_MR );
+    }
+}
+
+} // namespace trsm
+} // namespace El
@@ -33,10 +33,16 @@ void RLN
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, LPre, XPre ) );
     DistMatrix<F,MR,  STAR> L10Trans_MR_STAR(g);
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
+    UseWorkspace( L10Trans_MR_STAR );
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( X1Trans_STAR_MC );
+    UseWorkspace( X1_VC_STAR );
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -37,11 +37,18 @@ void RLT
     auto& L = LProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 4, LPre, XPre ) );
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,VR,  STAR> L21_VR_STAR(g);
     DistMatrix<F,STAR,MR  > L21Trans_STAR_MR(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    UseWorkspace( L11_STAR_STAR );
+    UseWorkspace( L21_VR_STAR );
+    UseWorkspace( L21Trans_STAR_MR );
+    UseWorkspace( X1_VC_STAR );
+    UseWorkspace( X1Trans_STAR_MC );
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -30,10 +30,16 @@ void RUN
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 3, UPre, XPre ) );
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
     DistMatrix<F,STAR,MR  > U12_STAR_MR(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);    
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( U12_STAR_MR );
+    UseWorkspace( X1_VC_STAR );
+    UseWorkspace( X1Trans_STAR_MC );
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -37,11 +37,18 @@ void RUT
     auto& U = UProx.GetLocked();
     auto& X = XProx.Get();
 
+    WorkspaceScope workspace
+    ( gemm::SUMMAWorkspaceHint<Device::CPU>( 4, UPre, XPre ) );
     DistMatrix<F,VR,  STAR> U01_VR_STAR(g);
     DistMatrix<F,STAR,MR  > U01Trans_STAR_MR(g);
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    UseWorkspace( U01_VR_STAR );
+    UseWorkspace( U01Trans_STAR_MR );
+    UseWorkspace( U11_STAR_STAR );
+    UseWorkspace( X1_VC_STAR );
+    UseWorkspace( X1Trans_STAR_MC );
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
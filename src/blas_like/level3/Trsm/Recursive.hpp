@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+template<typename F>
+void Blocked
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& B,
+  bool checkIfSingular,
+  TrsmAlgorithm alg );
+
+// Triangles of at most this order are solved with the blocked variants
+inline Int RecursiveCutoff()
+{ return 4*Blocksize(); }
+
+// Recursively halve the triangle, e.g., for the left lower normal case,
+//
+//   | A11 0   | | X1 | = | B1 |,
+//   | A21 A22 | | X2 |   | B2 |
+//
+// solve A11 X1 = B1, update B2 := B2 - A21 X1 with a distributed Gemm, and
+// then solve A22 X2 = B2, so that all but O(n nb w) of the O(n^2 w) work is
+// performed within large Gemms rather than within rank-nb panel updates
+template<typename F>
+void Recursive
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const DistMatrix<F>& A,
+        DistMatrix<F>& B,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n <= RecursiveCutoff() )
+    {
+        Blocked
+        ( side, uplo, orientation, diag, A, B, checkIfSingular, TRSM_DEFAULT );
+        return;
+    }
+
+    const Int n1 = bsize*Max(Int(1),(n/bsize)/2);
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A22 = A( ind2, ind2 );
+    DistMatrix<F> AOff(A.Grid()), B1(B.Grid()), B2(B.Grid());
+    if( uplo == LOWER )
+        LockedView( AOff, A, ind2, ind1 );
+    else
+        LockedView( AOff, A, ind1, ind2 );
+    if( side == LEFT )
+    {
+        View( B1, B, ind1, ALL );
+        View( B2, B, ind2, ALL );
+    }
+    else
+    {
+        View( B1, B, ALL, ind1 );
+        View( B2, B, ALL, ind2 );
+    }
+
+    // Whether the leading block of the solution is determined first
+    const bool forward =
+      ( (side == LEFT) == ((uplo == LOWER) == (orientation == NORMAL)) );
+    auto& AFirst = ( forward ? A11 : A22 );
+    auto& ASecond = ( forward ? A22 : A11 );
+    auto& BFirst = ( forward ? B1 : B2 );
+    auto& BSecond = ( forward ? B2 : B1 );
+
+    Recursive( side, uplo, orientation, diag, AFirst, BFirst, checkIfSingular );
+    if( side == LEFT )
+        Gemm( orientation, NORMAL, F(-1), AOff, BFirst, F(1), BSecond );
+    else
+        Gemm( NORMAL, orientation, F(-1), BFirst, AOff, F(1), BSecond );
+    Recursive
+    ( side, uplo, orientation, diag, ASecond, BSecond, checkIfSingular );
+}
+
+template<typename F>
+void Recursive
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& BPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    Recursive( side, uplo, orientation, diag, A, B, checkIfSingular );
+}
+
+} // namespace trsm
+} // namespace El
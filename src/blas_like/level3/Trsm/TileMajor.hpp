@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// Solve op(A) X = alpha B or X op(A) = alpha B, overwriting B, for tile-major
+// matrices with a common tile size. The tile columns (or, from the right, the
+// tile rows) of B are independent and are distributed over the threads, each
+// of which substitutes through the tiles of op(A) in place.
+template<typename F>
+void TileMajor
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const TileMatrix<F>& A, TileMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool normal = ( orientation == NORMAL );
+    const Int n = ( side == LEFT ? B.Height() : B.Width() );
+    if( A.Height() != A.Width() || A.Height() != n )
+        LogicError
+        ("Nonconformal tile-major Trsm: A is ",A.Height()," x ",A.Width(),
+         " and B is ",B.Height()," x ",B.Width());
+    if( A.TileSize() != B.TileSize() )
+        LogicError("Tile-major Trsm requires a common tile size");
+
+    // Whether op(A) is lower-triangular, and tile (i,j) of op(A)
+    const bool lower = ( (uplo == LOWER) == normal );
+    const Int numTiles = A.TileRows();
+    auto opA =
+      [&]( Int i, Int j )
+      { return normal ? A.LockedTile(i,j) : A.LockedTile(j,i); };
+
+    if( side == LEFT )
+    {
+        const Int tileCols = B.TileCols();
+#ifdef EL_HYBRID
+        #pragma omp parallel for schedule(dynamic,1)
+#endif
+        for( Int j=0; j<tileCols; ++j )
+        {
+            for( Int i=0; i<numTiles; ++i )
+            {
+                auto BTile = B.Tile( i, j );
+                Scale( alpha, BTile );
+            }
+            for( Int t=0; t<numTiles; ++t )
+            {
+                const Int k = ( lower ? t : numTiles-1-t );
+                auto Bk = B.Tile( k, j );
+                Trsm
+                ( LEFT, uplo, orientation, diag,
+                  F(1), A.LockedTile(k,k), Bk );
+                const Int iBeg = ( lower ? k+1 : 0 );
+                const Int iEnd = ( lower ? numTiles : k );
+                for( Int i=iBeg; i<iEnd; ++i )
+                {
+                    auto Bi = B.Tile( i, j );
+                    Gemm( orientation, NORMAL, F(-1), opA(i,k), Bk, F(1), Bi );
+                }
+            }
+        }
+    }
+    else
+    {
+        const Int tileRows = B.TileRows();
+#ifdef EL_HYBRID
+        #pragma omp parallel for schedule(dynamic,1)
+#endif
+        for( Int i=0; i<tileRows; ++i )
+        {
+            for( Int j=0; j<numTiles; ++j )
+            {
+                auto BTile = B.Tile( i, j );
+                Scale( alpha, BTile );
+            }
+            for( Int t=0; t<numTiles; ++t )
+            {
+                const Int k = ( lower ? numTiles-1-t : t );
+                auto Bk = B.Tile( i, k );
+                Trsm
+                ( RIGHT, uplo, orientation, diag,
+                  F(1), A.LockedTile(k,k), Bk );
+                const Int jBeg = ( lower ? 0 : k+1 );
+                const Int jEnd = ( lower ? k : numTiles );
+                for( Int j=jBeg; j<jEnd; ++j )
+                {
+                    auto Bj = B.Tile( i, j );
+                    Gemm( NORMAL, orientation, F(-1), Bk, opA(k,j), F(1), Bj );
+                }
+            }
+        }
+    }
+}
+
+} // namespace trsm
+} // namespace El
@@ -692,11 +692,10 @@ template <typename T, Device D>
 void DM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const Int totalSend = remoteUpdates_.size();
-    LogicError("Test.");
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
@@ -779,14 +778,12 @@ template <typename T, Device D>
 void DM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = this->Root();
     const Int totalRecv = remotePulls_.size();
 
-    LogicError("Test.");
-
     // Compute the metadata
     // ====================
     mpi::Comm const& comm
@@ -288,6 +288,10 @@ mpi::Comm const& Grid::Comm() const EL_NO_EXCEPT
 // Advanced routines
 // =================
 
+Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height )
+    : Grid{std::move(viewers), owners, height, COLUMN_MAJOR}
+{}
+
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
     : haveViewers_(true), order_(order),
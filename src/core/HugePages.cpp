@@ -0,0 +1,206 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include <sys/mman.h>
+
+namespace El {
+namespace hugepages {
+
+namespace {
+
+struct Mapping
+{
+    size_t bytes;
+    bool explicitPages;
+};
+
+// As with the NUMA mappings, the registry outlives the memory pools which
+// return their cached allocations during static destruction
+std::mutex& MappingMutex()
+{
+    static auto* mutex = new std::mutex;
+    return *mutex;
+}
+
+std::map<char*,Mapping>& Mappings()
+{
+    static auto* mappings = new std::map<char*,Mapping>;
+    return *mappings;
+}
+
+std::atomic<size_t> threshold(0);
+std::atomic<bool> useExplicit(true);
+std::atomic<size_t> explicitFailures(0);
+
+// Read a "<name>: <value> kB" entry of a /proc file
+size_t ReadKilobytes( const string& line, const string& name )
+{
+    if( line.compare( 0, name.size(), name ) != 0 )
+        return size_t(-1);
+    return size_t(std::atoll( line.c_str()+name.size() ))*1024;
+}
+
+} // anonymous namespace
+
+size_t PageSize()
+{
+    static const size_t pageSize =
+      []()
+      {
+          std::ifstream file( "/proc/meminfo" );
+          string line;
+          while( std::getline( file, line ) )
+          {
+              const size_t bytes = ReadKilobytes( line, "Hugepagesize:" );
+              if( bytes != size_t(-1) && bytes > 0 )
+                  return bytes;
+          }
+          return size_t(2) << 20;
+      }();
+    return pageSize;
+}
+
+size_t Threshold()
+{
+    const size_t bytes = threshold;
+    return bytes == 0 ? PageSize() : bytes;
+}
+
+void SetThreshold( size_t bytes ) { threshold = bytes; }
+
+bool UseExplicit() { return useExplicit; }
+void SetUseExplicit( bool use ) { useExplicit = use; }
+
+void* Allocate( size_t bytes )
+{
+    EL_DEBUG_CSE
+    const size_t pageSize = PageSize();
+    bytes = Max( (bytes+pageSize-1)/pageSize, size_t(1) )*pageSize;
+
+    char* ptr = nullptr;
+    bool explicitPages = false;
+#ifdef MAP_HUGETLB
+    if( useExplicit )
+    {
+        void* mapping =
+          mmap
+          ( nullptr, bytes, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0 );
+        if( mapping != MAP_FAILED )
+        {
+            ptr = static_cast<char*>(mapping);
+            explicitPages = true;
+        }
+        else
+            ++explicitFailures;
+    }
+#endif
+    if( ptr == nullptr )
+    {
+        // Over-allocate by a page so that the mapping can be trimmed to a
+        // huge-page boundary
+        void* mapping =
+          mmap
+          ( nullptr, bytes+pageSize, PROT_READ|PROT_WRITE,
+            MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+        if( mapping == MAP_FAILED )
+            RuntimeError("Could not map ",bytes," bytes for huge pages");
+        char* raw = static_cast<char*>(mapping);
+        const size_t offset =
+          (pageSize - reinterpret_cast<uintptr_t>(raw) % pageSize) % pageSize;
+        ptr = raw + offset;
+        if( offset > 0 )
+            munmap( raw, offset );
+        munmap( ptr+bytes, pageSize-offset );
+#ifdef MADV_HUGEPAGE
+        madvise( ptr, bytes, MADV_HUGEPAGE );
+#endif
+    }
+
+    std::lock_guard<std::mutex> lock( MappingMutex() );
+    Mappings()[ptr] = Mapping{ bytes, explicitPages };
+    return ptr;
+}
+
+bool Free( void* ptr )
+{
+    EL_DEBUG_CSE
+    Mapping mapping;
+    {
+        std::lock_guard<std::mutex> lock( MappingMutex() );
+        auto& mappings = Mappings();
+        auto iter = mappings.find( static_cast<char*>(ptr) );
+        if( iter == mappings.end() )
+            return false;
+        mapping = iter->second;
+        mappings.erase( iter );
+    }
+    munmap( ptr, mapping.bytes );
+    return true;
+}
+
+HugePageStats Stats()
+{
+    EL_DEBUG_CSE
+    HugePageStats stats;
+    stats.explicitFailures = explicitFailures;
+    // The transparent mappings, which are measured below
+    std::map<char*,char*> ranges;
+    {
+        std::lock_guard<std::mutex> lock( MappingMutex() );
+        for( const auto& entry : Mappings() )
+        {
+            stats.mappedBytes += entry.second.bytes;
+            if( entry.second.explicitPages )
+                stats.explicitBytes += entry.second.bytes;
+            else
+                ranges[entry.first] = entry.first + entry.second.bytes;
+        }
+    }
+    if( ranges.empty() )
+        return stats;
+
+    // The kernel may merge adjacent mappings into a single region, so each
+    // region is credited with at most the bytes it shares with our mappings
+    std::ifstream smaps( "/proc/self/smaps" );
+    string line;
+    size_t overlap = 0;
+    while( std::getline( smaps, line ) )
+    {
+        uintptr_t beg, end;
+        char dash;
+        std::istringstream header( line );
+        if( header >> std::hex >> beg >> dash >> end && dash == '-' )
+        {
+            overlap = 0;
+            for( const auto& range : ranges )
+            {
+                const uintptr_t rangeBeg =
+                  reinterpret_cast<uintptr_t>(range.first);
+                const uintptr_t rangeEnd =
+                  reinterpret_cast<uintptr_t>(range.second);
+                if( rangeBeg < end && beg < rangeEnd )
+                    overlap += Min(end,rangeEnd) - Max(beg,rangeBeg);
+            }
+            continue;
+        }
+        const size_t bytes = ReadKilobytes( line, "AnonHugePages:" );
+        if( bytes != size_t(-1) && overlap > 0 )
+            stats.transparentBytes += Min( bytes, overlap );
+    }
+    return stats;
+}
+
+} // namespace hugepages
+} // namespace El
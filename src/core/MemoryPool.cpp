@@ -11,6 +11,8 @@ namespace
 std::unique_ptr<MemoryPool<true>> pinnedHostMemoryPool_;
 #endif  // HYDROGEN_HAVE_GPU
 std::unique_ptr<MemoryPool<false>> hostMemoryPool_;
+std::mutex nodeHostMemoryPoolMutex_;
+std::vector<std::unique_ptr<MemoryPool<false>>> nodeHostMemoryPools_;
 }  // namespace <anon>
 
 #ifdef HYDROGEN_HAVE_GPU
@@ -37,4 +39,45 @@ MemoryPool<false>& HostMemoryPool()
 void DestroyHostMemoryPool()
 { hostMemoryPool_.reset(); }
 
+MemoryPool<false>& HugePageHostMemoryPool()
+{
+    // Initialized exactly once, even if several threads make their first
+    // huge-page allocations at the same time, and never destroyed so that
+    // matrices with static storage may still free into it
+    static auto* pool = new MemoryPool<false>(1.6, 1, 1<<26, -1, true);
+    return *pool;
+}
+
+void DestroyHugePageHostMemoryPool()
+{ HugePageHostMemoryPool().FreeAllUnused(); }
+
+MemoryPool<false>& NodeHostMemoryPool(int node)
+{
+    std::lock_guard<std::mutex> lock(nodeHostMemoryPoolMutex_);
+    if (nodeHostMemoryPools_.empty())
+        nodeHostMemoryPools_.resize(numa::NumNodes());
+    if (node < 0 || node >= int(nodeHostMemoryPools_.size()))
+        LogicError("Invalid NUMA node ",node);
+    auto& pool = nodeHostMemoryPools_[node];
+    if (!pool)
+        pool.reset(new MemoryPool<false>(1.6, 1, 1<<26, node));
+    return *pool;
+}
+
+MemoryPool<false>& OwningNodeHostMemoryPool(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(nodeHostMemoryPoolMutex_);
+    for (auto& pool : nodeHostMemoryPools_)
+        if (pool && pool->Owns(ptr))
+            return *pool;
+    LogicError("Pointer was not allocated from a NUMA-node memory pool");
+    return *nodeHostMemoryPools_.front();
+}
+
+void DestroyNodeHostMemoryPools()
+{
+    std::lock_guard<std::mutex> lock(nodeHostMemoryPoolMutex_);
+    nodeHostMemoryPools_.clear();
+}
+
 }  // namespace El
@@ -0,0 +1,204 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifdef SYS_mbind
+# include <linux/mempolicy.h>
+#endif
+
+namespace El {
+namespace numa {
+
+namespace {
+
+// The lengths of the live mappings, which are required to unmap them. The
+// registry is never destroyed, since the memory pools may return mappings
+// during static destruction.
+std::mutex& MappingMutex()
+{
+    static auto* mutex = new std::mutex;
+    return *mutex;
+}
+
+std::unordered_map<void*,size_t>& Mappings()
+{
+    static auto* mappings = new std::unordered_map<void*,size_t>;
+    return *mappings;
+}
+
+std::atomic<FirstTouchHook> firstTouchHook(nullptr);
+
+// Parse a list of node ranges such as "0-3,6", returning one past the
+// largest node index
+int ParseNodeList( const string& list )
+{
+    int numNodes = 0;
+    std::istringstream stream( list );
+    string range;
+    while( std::getline( stream, range, ',' ) )
+    {
+        const auto dash = range.find('-');
+        const string last =
+          ( dash == string::npos ? range : range.substr(dash+1) );
+        if( !last.empty() )
+            numNodes = Max( numNodes, std::atoi(last.c_str())+1 );
+    }
+    return Max( numNodes, 1 );
+}
+
+void* Map( size_t bytes )
+{
+    void* ptr =
+      mmap
+      ( nullptr, bytes, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS,
+        -1, 0 );
+    if( ptr == MAP_FAILED )
+        RuntimeError("Could not map ",bytes," bytes");
+    std::lock_guard<std::mutex> lock( MappingMutex() );
+    Mappings()[ptr] = bytes;
+    return ptr;
+}
+
+// Apply a memory policy to fresh pages. Failures are ignored, as the policy
+// only affects performance.
+void Bind( void* ptr, size_t bytes, int policy, const vector<int>& nodes )
+{
+#ifdef SYS_mbind
+    const int numNodes = NumNodes();
+    const int bitsPerWord = 8*sizeof(unsigned long);
+    vector<unsigned long> mask( (numNodes+bitsPerWord-1)/bitsPerWord, 0 );
+    for( const int node : nodes )
+        mask[node/bitsPerWord] |= 1UL << (node%bitsPerWord);
+    // The kernel ignores the last bit of the mask length
+    syscall
+    ( SYS_mbind, ptr, bytes, policy, mask.data(),
+      (unsigned long)(mask.size()*bitsPerWord+1), 0 );
+#endif
+}
+
+} // anonymous namespace
+
+int NumNodes()
+{
+    static const int numNodes =
+      []()
+      {
+          std::ifstream file( "/sys/devices/system/node/online" );
+          string list;
+          if( !file || !std::getline( file, list ) )
+              return 1;
+          return ParseNodeList( list );
+      }();
+    return numNodes;
+}
+
+int CurrentNode()
+{
+#ifdef SYS_getcpu
+    unsigned cpu=0, node=0;
+    if( syscall( SYS_getcpu, &cpu, &node, nullptr ) == 0 )
+        return int(node);
+#endif
+    return 0;
+}
+
+void* Allocate( size_t bytes )
+{
+    EL_DEBUG_CSE
+    return Map( Max(bytes,size_t(1)) );
+}
+
+void* AllocateInterleaved( size_t bytes )
+{
+    EL_DEBUG_CSE
+    bytes = Max(bytes,size_t(1));
+    void* ptr = Map( bytes );
+#ifdef SYS_mbind
+    const int numNodes = NumNodes();
+    if( numNodes > 1 )
+    {
+        vector<int> nodes( numNodes );
+        for( int node=0; node<numNodes; ++node )
+            nodes[node] = node;
+        Bind( ptr, bytes, MPOL_INTERLEAVE, nodes );
+    }
+#endif
+    return ptr;
+}
+
+void* AllocateOnNode( size_t bytes, int node )
+{
+    EL_DEBUG_CSE
+    bytes = Max(bytes,size_t(1));
+    void* ptr = Map( bytes );
+#ifdef SYS_mbind
+    if( NumNodes() > 1 && node >= 0 && node < NumNodes() )
+        Bind( ptr, bytes, MPOL_PREFERRED, vector<int>(1,node) );
+#endif
+    return ptr;
+}
+
+void Free( void* ptr )
+{
+    EL_DEBUG_CSE
+    if( ptr == nullptr )
+        return;
+    size_t bytes;
+    {
+        std::lock_guard<std::mutex> lock( MappingMutex() );
+        auto& mappings = Mappings();
+        auto iter = mappings.find( ptr );
+        if( iter == mappings.end() )
+            LogicError("Tried to free an unknown NUMA allocation");
+        bytes = iter->second;
+        mappings.erase( iter );
+    }
+    munmap( ptr, bytes );
+}
+
+void FirstTouch( void* buffer, size_t bytes, int numThreads )
+{
+    EL_DEBUG_CSE
+    unsigned char* data = static_cast<unsigned char*>(buffer);
+#ifdef EL_HYBRID
+    if( numThreads <= 0 )
+        numThreads = omp_get_max_threads();
+    #pragma omp parallel num_threads(numThreads)
+    {
+        const size_t thread = omp_get_thread_num();
+        const size_t team = omp_get_num_threads();
+        const size_t beg = bytes*thread/team;
+        const size_t end = bytes*(thread+1)/team;
+        std::memset( data+beg, 0, end-beg );
+        ReportFirstTouch( data+beg, end-beg, thread );
+    }
+#else
+    std::memset( data, 0, bytes );
+    ReportFirstTouch( data, bytes, 0 );
+#endif
+}
+
+void SetFirstTouchHook( FirstTouchHook hook ) { firstTouchHook = hook; }
+
+void ReportFirstTouch( const void* begin, size_t bytes, int thread )
+{
+    const FirstTouchHook hook = firstTouchHook;
+    if( hook != nullptr )
+        hook( begin, bytes, thread );
+}
+
+} // namespace numa
+} // namespace El
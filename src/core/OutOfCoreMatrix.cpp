@@ -0,0 +1,634 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace El {
+namespace ooc {
+
+namespace {
+
+enum SlotState
+{
+    SLOT_EMPTY,
+    SLOT_READY,
+    SLOT_LOADING, // being read (or zeroed) into the slot
+    SLOT_WRITING  // being written back from the slot
+};
+
+struct Slot
+{
+    Int tile=-1;
+    Int pins=0;
+    Int lastUse=0;
+    bool dirty=false;
+    SlotState state=SLOT_EMPTY;
+    vector<char> buffer;
+};
+
+struct Request
+{
+    Int slot;
+    bool write;
+};
+
+}// namespace <anon>
+
+struct TileCache::Impl
+{
+    Int numTiles;
+    size_t tileBytes;
+    bool async;
+
+    int fd=-1;
+    char* mapping=nullptr;
+    size_t fileBytes=0;
+
+    vector<Slot> slots;
+    vector<Int> slotOfTile;
+    vector<bool> onDisk;
+    Int clock=0;
+    OutOfCoreStats stats;
+
+    // The mutex guards all of the above bookkeeping (but not the contents of
+    // the slot buffers), 'changed' is signaled whenever a slot finishes
+    // loading or writing, and 'requested' whenever work is queued for the
+    // background thread
+    mutable std::mutex mutex;
+    std::condition_variable changed, requested;
+    std::deque<Request> requests;
+    bool shutdown=false;
+    std::thread worker;
+    std::exception_ptr error;
+
+    void ReadTile( Int tile, char* buffer ) const;
+    void WriteTile( Int tile, const char* buffer ) const;
+
+    void RethrowError();
+    Int Victim() const;
+    Int OldestDirty() const;
+    void WriteSlot( Int s, std::unique_lock<std::mutex>& lock );
+    bool MakeRoom( std::unique_lock<std::mutex>& lock );
+    void WriteBehind();
+    void Run();
+};
+
+void TileCache::Impl::ReadTile( Int tile, char* buffer ) const
+{
+    const size_t offset = tile*tileBytes;
+    if( mapping != nullptr )
+    {
+        std::memcpy( buffer, mapping+offset, tileBytes );
+        return;
+    }
+    size_t numRead = 0;
+    while( numRead < tileBytes )
+    {
+        const ssize_t result =
+          pread( fd, buffer+numRead, tileBytes-numRead, offset+numRead );
+        if( result <= 0 )
+            RuntimeError("Could not read tile ",tile," of a scratch file");
+        numRead += result;
+    }
+}
+
+void TileCache::Impl::WriteTile( Int tile, const char* buffer ) const
+{
+    const size_t offset = tile*tileBytes;
+    if( mapping != nullptr )
+    {
+        std::memcpy( mapping+offset, buffer, tileBytes );
+        return;
+    }
+    size_t numWritten = 0;
+    while( numWritten < tileBytes )
+    {
+        const ssize_t result =
+          pwrite
+          ( fd, buffer+numWritten, tileBytes-numWritten, offset+numWritten );
+        if( result <= 0 )
+            RuntimeError("Could not write tile ",tile," to a scratch file");
+        numWritten += result;
+    }
+}
+
+// Rethrow (once) an error raised by the background thread
+void TileCache::Impl::RethrowError()
+{
+    if( error )
+    {
+        auto pending = error;
+        error = nullptr;
+        std::rethrow_exception( pending );
+    }
+}
+
+// The least recently used slot which may be reused without a write
+Int TileCache::Impl::Victim() const
+{
+    Int victim = -1;
+    for( Int s=0; s<Int(slots.size()); ++s )
+    {
+        const Slot& slot = slots[s];
+        if( slot.pins == 0 && !slot.dirty &&
+            (slot.state == SLOT_READY || slot.state == SLOT_EMPTY) &&
+            (victim < 0 || slot.lastUse < slots[victim].lastUse) )
+            victim = s;
+    }
+    return victim;
+}
+
+// The least recently used slot which must be written before it is reused
+Int TileCache::Impl::OldestDirty() const
+{
+    Int oldest = -1;
+    for( Int s=0; s<Int(slots.size()); ++s )
+    {
+        const Slot& slot = slots[s];
+        if( slot.pins == 0 && slot.dirty && slot.state == SLOT_READY &&
+            (oldest < 0 || slot.lastUse < slots[oldest].lastUse) )
+            oldest = s;
+    }
+    return oldest;
+}
+
+// Synchronously write back slot s, whose state must be SLOT_READY
+void TileCache::Impl::WriteSlot( Int s, std::unique_lock<std::mutex>& lock )
+{
+    Slot& slot = slots[s];
+    const Int tile = slot.tile;
+    slot.state = SLOT_WRITING;
+    lock.unlock();
+    std::exception_ptr writeError;
+    try { WriteTile( tile, slot.buffer.data() ); }
+    catch( ... ) { writeError = std::current_exception(); }
+    lock.lock();
+    slot.state = SLOT_READY;
+    if( !writeError )
+    {
+        slot.dirty = false;
+        onDisk[tile] = true;
+        ++stats.writes;
+    }
+    changed.notify_all();
+    if( writeError )
+        std::rethrow_exception( writeError );
+}
+
+// Free a slot when there is no clean victim, returning false if every slot is
+// pinned (or being loaded on behalf of a pin)
+bool TileCache::Impl::MakeRoom( std::unique_lock<std::mutex>& lock )
+{
+    const Int s = OldestDirty();
+    if( s >= 0 )
+    {
+        WriteSlot( s, lock );
+        return true;
+    }
+    for( const auto& slot : slots )
+    {
+        if( slot.state == SLOT_WRITING ||
+            (slot.state == SLOT_LOADING && slot.pins == 0) )
+        {
+            changed.wait( lock );
+            return true;
+        }
+    }
+    return false;
+}
+
+// Keep roughly a quarter of the cache available for eviction without a
+// write by handing the oldest modified tiles to the background thread
+void TileCache::Impl::WriteBehind()
+{
+    if( !async )
+        return;
+    const Int reserve = Max( Int(slots.size())/4, Int(1) );
+    Int numClean = 0;
+    for( const auto& slot : slots )
+        if( slot.pins == 0 &&
+            (slot.state == SLOT_WRITING ||
+             (!slot.dirty &&
+              (slot.state == SLOT_READY || slot.state == SLOT_EMPTY))) )
+            ++numClean;
+    bool queued = false;
+    for( ; numClean<reserve; ++numClean )
+    {
+        const Int s = OldestDirty();
+        if( s < 0 )
+            break;
+        slots[s].state = SLOT_WRITING;
+        requests.push_back( Request{s,true} );
+        queued = true;
+    }
+    if( queued )
+        requested.notify_one();
+}
+
+void TileCache::Impl::Run()
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    while( true )
+    {
+        requested.wait
+        ( lock, [&]() { return shutdown || !requests.empty(); } );
+        if( shutdown )
+            return;
+        const Request request = requests.front();
+        requests.pop_front();
+        Slot& slot = slots[request.slot];
+        const Int tile = slot.tile;
+        lock.unlock();
+        std::exception_ptr ioError;
+        try
+        {
+            if( request.write )
+                WriteTile( tile, slot.buffer.data() );
+            else
+                ReadTile( tile, slot.buffer.data() );
+        }
+        catch( ... ) { ioError = std::current_exception(); }
+        lock.lock();
+        if( ioError )
+        {
+            if( !error )
+                error = ioError;
+            if( request.write )
+                slot.state = SLOT_READY;
+            else
+            {
+                // Forget the partially-read tile
+                slotOfTile[tile] = -1;
+                slot.tile = -1;
+                slot.state = SLOT_EMPTY;
+            }
+        }
+        else
+        {
+            slot.state = SLOT_READY;
+            if( request.write )
+            {
+                slot.dirty = false;
+                onDisk[tile] = true;
+                ++stats.writes;
+            }
+            else
+                ++stats.reads;
+        }
+        changed.notify_all();
+    }
+}
+
+TileCache::TileCache
+( Int numTiles, size_t tileBytes, const OutOfCoreCtrl& ctrl )
+: impl_(new Impl)
+{
+    EL_DEBUG_CSE
+    if( ctrl.cacheTiles < 1 )
+        LogicError("The out-of-core cache must hold at least one tile");
+    auto& impl = *impl_;
+    impl.numTiles = numTiles;
+    impl.tileBytes = tileBytes;
+    impl.async = ctrl.asyncIO;
+    impl.slots.resize( ctrl.cacheTiles );
+    impl.slotOfTile.resize( numTiles, -1 );
+    impl.onDisk.resize( numTiles, false );
+
+    // The file is unlinked immediately so that it is removed along with its
+    // last descriptor, even if the process is killed
+    const string pattern = ctrl.directory + "/El-ooc-XXXXXX";
+    vector<char> filename( pattern.begin(), pattern.end() );
+    filename.push_back( '\0' );
+    impl.fd = mkstemp( filename.data() );
+    if( impl.fd < 0 )
+        RuntimeError("Could not create a scratch file in ",ctrl.directory);
+    unlink( filename.data() );
+
+    impl.fileBytes = numTiles*tileBytes;
+    if( ctrl.memoryMapped && impl.fileBytes > 0 )
+    {
+        void* mapping = MAP_FAILED;
+        if( ftruncate( impl.fd, impl.fileBytes ) == 0 )
+            mapping =
+              mmap
+              ( nullptr, impl.fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                impl.fd, 0 );
+        if( mapping == MAP_FAILED )
+        {
+            close( impl.fd );
+            RuntimeError("Could not map a scratch file of ",impl.fileBytes,
+                         " bytes in ",ctrl.directory);
+        }
+        impl.mapping = static_cast<char*>(mapping);
+    }
+
+    if( impl.async )
+        impl.worker = std::thread( [&impl]() { impl.Run(); } );
+}
+
+TileCache::~TileCache()
+{
+    auto& impl = *impl_;
+    if( impl.worker.joinable() )
+    {
+        {
+            std::lock_guard<std::mutex> guard( impl.mutex );
+            impl.shutdown = true;
+        }
+        impl.requested.notify_one();
+        impl.worker.join();
+    }
+    if( impl.mapping != nullptr )
+        munmap( impl.mapping, impl.fileBytes );
+    close( impl.fd );
+}
+
+char* TileCache::Pin( Int tile, bool load )
+{
+    EL_DEBUG_CSE
+    auto& impl = *impl_;
+    std::unique_lock<std::mutex> lock( impl.mutex );
+    while( true )
+    {
+        impl.RethrowError();
+        Int s = impl.slotOfTile[tile];
+        if( s >= 0 )
+        {
+            Slot& slot = impl.slots[s];
+            if( slot.state == SLOT_LOADING || slot.state == SLOT_WRITING )
+            {
+                impl.changed.wait( lock );
+                continue;
+            }
+            ++slot.pins;
+            slot.lastUse = ++impl.clock;
+            ++impl.stats.hits;
+            return slot.buffer.data();
+        }
+
+        s = impl.Victim();
+        if( s < 0 )
+        {
+            if( !impl.MakeRoom( lock ) )
+                LogicError
+                ("All ",impl.slots.size()," cached tiles are pinned");
+            continue;
+        }
+        Slot& slot = impl.slots[s];
+        if( slot.tile >= 0 )
+            impl.slotOfTile[slot.tile] = -1;
+        slot.tile = tile;
+        slot.pins = 1;
+        slot.dirty = false;
+        slot.lastUse = ++impl.clock;
+        impl.slotOfTile[tile] = s;
+        ++impl.stats.misses;
+        if( slot.buffer.empty() )
+            slot.buffer.resize( impl.tileBytes );
+        if( load )
+        {
+            // Tiles which have never been written are implicitly zero
+            const bool stored = impl.onDisk[tile];
+            slot.state = SLOT_LOADING;
+            lock.unlock();
+            std::exception_ptr readError;
+            try
+            {
+                if( stored )
+                    impl.ReadTile( tile, slot.buffer.data() );
+                else
+                    std::memset( slot.buffer.data(), 0, impl.tileBytes );
+            }
+            catch( ... ) { readError = std::current_exception(); }
+            lock.lock();
+            impl.changed.notify_all();
+            if( readError )
+            {
+                impl.slotOfTile[tile] = -1;
+                slot.tile = -1;
+                slot.pins = 0;
+                slot.state = SLOT_EMPTY;
+                std::rethrow_exception( readError );
+            }
+            if( stored )
+                ++impl.stats.reads;
+        }
+        slot.state = SLOT_READY;
+        impl.WriteBehind();
+        return slot.buffer.data();
+    }
+}
+
+void TileCache::Unpin( Int tile, bool modified )
+{
+    EL_DEBUG_CSE
+    auto& impl = *impl_;
+    std::lock_guard<std::mutex> guard( impl.mutex );
+    const Int s = impl.slotOfTile[tile];
+    if( s < 0 || impl.slots[s].pins == 0 )
+        LogicError("Tile ",tile," is not pinned");
+    Slot& slot = impl.slots[s];
+    --slot.pins;
+    slot.dirty = slot.dirty || modified;
+    impl.WriteBehind();
+}
+
+void TileCache::Prefetch( Int tile )
+{
+    EL_DEBUG_CSE
+    auto& impl = *impl_;
+    std::lock_guard<std::mutex> guard( impl.mutex );
+    if( impl.slotOfTile[tile] >= 0 || !impl.onDisk[tile] )
+        return;
+    if( !impl.async )
+    {
+        // Let the operating system read ahead instead
+        const size_t offset = tile*impl.tileBytes;
+        if( impl.mapping != nullptr )
+        {
+            const size_t pageSize = sysconf( _SC_PAGESIZE );
+            const size_t alignedOffset = offset - offset % pageSize;
+            madvise
+            ( impl.mapping+alignedOffset,
+              impl.tileBytes+(offset-alignedOffset), MADV_WILLNEED );
+        }
+        else
+            posix_fadvise
+            ( impl.fd, offset, impl.tileBytes, POSIX_FADV_WILLNEED );
+        return;
+    }
+    // Prefetching is only a hint, so it never waits for a slot to be freed
+    const Int s = impl.Victim();
+    if( s < 0 )
+        return;
+    Slot& slot = impl.slots[s];
+    if( slot.tile >= 0 )
+        impl.slotOfTile[slot.tile] = -1;
+    slot.tile = tile;
+    slot.dirty = false;
+    slot.lastUse = ++impl.clock;
+    slot.state = SLOT_LOADING;
+    impl.slotOfTile[tile] = s;
+    if( slot.buffer.empty() )
+        slot.buffer.resize( impl.tileBytes );
+    impl.requests.push_back( Request{s,false} );
+    ++impl.stats.prefetches;
+    impl.requested.notify_one();
+}
+
+void TileCache::Flush()
+{
+    EL_DEBUG_CSE
+    auto& impl = *impl_;
+    std::unique_lock<std::mutex> lock( impl.mutex );
+    while( true )
+    {
+        impl.RethrowError();
+        Int dirty = -1;
+        bool writing = false;
+        for( Int s=0; s<Int(impl.slots.size()); ++s )
+        {
+            const Slot& slot = impl.slots[s];
+            // A pinned tile may be in the middle of being modified, so it is
+            // only written back once it has been unpinned
+            if( slot.state == SLOT_WRITING )
+                writing = true;
+            else if( slot.dirty && slot.state == SLOT_READY && slot.pins == 0 )
+                dirty = s;
+        }
+        if( dirty >= 0 )
+            impl.WriteSlot( dirty, lock );
+        else if( writing )
+            impl.changed.wait( lock );
+        else
+            return;
+    }
+}
+
+Int TileCache::Capacity() const EL_NO_EXCEPT
+{ return impl_->slots.size(); }
+
+OutOfCoreStats TileCache::Stats() const
+{
+    std::lock_guard<std::mutex> guard( impl_->mutex );
+    return impl_->stats;
+}
+
+} // namespace ooc
+
+template<typename T>
+OutOfCoreMatrix<T>::OutOfCoreMatrix
+( Int height, Int width, const OutOfCoreCtrl& ctrl )
+: height_(height), width_(width),
+  tileSize_(ctrl.tileSize > 0 ? ctrl.tileSize : Blocksize())
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 )
+        LogicError
+        ("Invalid out-of-core matrix dimensions: ",height," x ",width);
+    tileRows_ = (height+tileSize_-1) / tileSize_;
+    tileCols_ = (width+tileSize_-1) / tileSize_;
+    cache_.reset
+    ( new ooc::TileCache
+      ( tileRows_*tileCols_, size_t(tileSize_)*tileSize_*sizeof(T), ctrl ) );
+}
+
+template<typename T>
+Matrix<T> OutOfCoreMatrix<T>::Pin( Int i, Int j, bool load )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= tileRows_ || j < 0 || j >= tileCols_ )
+          LogicError
+          ("Tile (",i,",",j,") is outside of the ",tileRows_," x ",tileCols_,
+           " grid of tiles");
+    )
+    T* buffer = reinterpret_cast<T*>(cache_->Pin( Index(i,j), load ));
+    return Matrix<T>( TileHeight(i), TileWidth(j), buffer, tileSize_ );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Unpin( Int i, Int j, bool modified )
+{
+    EL_DEBUG_CSE
+    cache_->Unpin( Index(i,j), modified );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Prefetch( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    if( i < tileRows_ && j < tileCols_ )
+        cache_->Prefetch( Index(i,j) );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Flush()
+{
+    EL_DEBUG_CSE
+    cache_->Flush();
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Import( const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != height_ || A.Width() != width_ )
+        LogicError
+        ("Cannot import a ",A.Height()," x ",A.Width()," matrix into a ",
+         height_," x ",width_," out-of-core matrix");
+    for( Int j=0; j<tileCols_; ++j )
+    {
+        for( Int i=0; i<tileRows_; ++i )
+        {
+            auto ATile = Pin( i, j, false );
+            const Range<Int> rows( i*tileSize_, i*tileSize_+TileHeight(i) ),
+                             cols( j*tileSize_, j*tileSize_+TileWidth(j) );
+            Copy( A(rows,cols), ATile );
+            Unpin( i, j, true );
+        }
+    }
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Export( Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    A.Resize( height_, width_ );
+    for( Int j=0; j<tileCols_; ++j )
+    {
+        for( Int i=0; i<tileRows_; ++i )
+        {
+            if( i+1 < tileRows_ )
+                Prefetch( i+1, j );
+            else
+                Prefetch( 0, j+1 );
+            auto ATile = Pin( i, j );
+            const Range<Int> rows( i*tileSize_, i*tileSize_+TileHeight(i) ),
+                             cols( j*tileSize_, j*tileSize_+TileWidth(j) );
+            auto ASub = A( rows, cols );
+            Copy( ATile, ASub );
+            Unpin( i, j, false );
+        }
+    }
+}
+
+#define PROTO(T) template class OutOfCoreMatrix<T>;
+
+#include <El/macros/Instantiate.h>
+
+} // namespace El
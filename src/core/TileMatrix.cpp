@@ -0,0 +1,243 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename T>
+TileMatrix<T>::TileMatrix( Int tileSize )
+: tileSize_(tileSize > 0 ? tileSize : Blocksize())
+{ }
+
+template<typename T>
+TileMatrix<T>::TileMatrix( Int height, Int width, Int tileSize )
+: tileSize_(tileSize > 0 ? tileSize : Blocksize())
+{
+    EL_DEBUG_CSE
+    Resize( height, width );
+}
+
+template<typename T>
+TileMatrix<T>::TileMatrix( const TileMatrix<T>& A )
+: tileSize_(A.tileSize_)
+{
+    EL_DEBUG_CSE
+    *this = A;
+}
+
+template<typename T>
+TileMatrix<T>::TileMatrix( TileMatrix<T>&& A )
+: height_(A.height_), width_(A.width_), tileSize_(A.tileSize_),
+  tileStride_(A.tileStride_), viewing_(A.viewing_), locked_(A.locked_),
+  buffer_(A.buffer_), memory_(std::move(A.memory_))
+{
+    A.height_ = A.width_ = A.tileStride_ = 0;
+    A.viewing_ = A.locked_ = false;
+    A.buffer_ = nullptr;
+}
+
+template<typename T>
+TileMatrix<T>& TileMatrix<T>::operator=( const TileMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( this == &A )
+        return *this;
+    if( viewing_ )
+    {
+        if( locked_ )
+            LogicError("Cannot assign to a locked TileMatrix view");
+        if( tileSize_ != A.tileSize_ )
+            LogicError
+            ("Cannot assign a TileMatrix with tiles of size ",A.tileSize_,
+             " to a view with tiles of size ",tileSize_);
+    }
+    else
+        tileSize_ = A.tileSize_;
+    Resize( A.height_, A.width_ );
+    // The (padded) tiles are contiguous in both matrices
+    const Int tileEntries = tileSize_*tileSize_;
+    const Int tileRows = TileRows();
+    const Int tileCols = TileCols();
+    for( Int j=0; j<tileCols; ++j )
+        for( Int i=0; i<tileRows; ++i )
+            MemCopy
+            ( buffer_+(i+j*tileStride_)*tileEntries,
+              A.buffer_+(i+j*A.tileStride_)*tileEntries, tileEntries );
+    return *this;
+}
+
+template<typename T>
+void TileMatrix<T>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( height < 0 || width < 0 )
+        LogicError("Invalid TileMatrix dimensions: ",height," x ",width);
+    if( viewing_ )
+    {
+        if( height != height_ || width != width_ )
+            LogicError
+            ("Cannot resize a ",height_," x ",width_," TileMatrix view to ",
+             height," x ",width);
+        return;
+    }
+    height_ = height;
+    width_ = width;
+    tileStride_ = TileRows();
+    buffer_ =
+      memory_.Require( size_t(TileRows())*TileCols()*tileSize_*tileSize_ );
+}
+
+template<typename T>
+void TileMatrix<T>::Empty()
+{
+    EL_DEBUG_CSE
+    memory_.Empty();
+    height_ = width_ = tileStride_ = 0;
+    viewing_ = locked_ = false;
+    buffer_ = nullptr;
+}
+
+template<typename T>
+Matrix<T> TileMatrix<T>::Tile( Int i, Int j )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= TileRows() || j < 0 || j >= TileCols() )
+          LogicError
+          ("Tile (",i,",",j,") is outside of the ",TileRows()," x ",
+           TileCols()," grid of tiles");
+    )
+    T* buffer = buffer_ + (i+j*tileStride_)*tileSize_*tileSize_;
+    if( locked_ )
+        return Matrix<T>
+          ( TileHeight(i), TileWidth(j), static_cast<const T*>(buffer),
+            tileSize_ );
+    else
+        return Matrix<T>( TileHeight(i), TileWidth(j), buffer, tileSize_ );
+}
+
+template<typename T>
+const Matrix<T> TileMatrix<T>::LockedTile( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= TileRows() || j < 0 || j >= TileCols() )
+          LogicError
+          ("Tile (",i,",",j,") is outside of the ",TileRows()," x ",
+           TileCols()," grid of tiles");
+    )
+    const T* buffer = buffer_ + (i+j*tileStride_)*tileSize_*tileSize_;
+    return Matrix<T>( TileHeight(i), TileWidth(j), buffer, tileSize_ );
+}
+
+template<typename T>
+TileMatrix<T> TileMatrix<T>::ViewOf
+( Range<Int> I, Range<Int> J, bool locked ) const
+{
+    EL_DEBUG_CSE
+    if( I.end == END )
+        I.end = height_;
+    if( J.end == END )
+        J.end = width_;
+    if( I.beg < 0 || J.beg < 0 || I.end > height_ || J.end > width_ ||
+        I.beg > I.end || J.beg > J.end )
+        LogicError
+        ("Invalid view of [",I.beg,",",I.end,") x [",J.beg,",",J.end,
+         ") of a ",height_," x ",width_," TileMatrix");
+    if( I.beg % tileSize_ != 0 || J.beg % tileSize_ != 0 )
+        LogicError
+        ("TileMatrix views must begin on a tile boundary, but (",I.beg,",",
+         J.beg,") is not a multiple of ",tileSize_);
+    TileMatrix<T> A( tileSize_ );
+    A.height_ = I.end - I.beg;
+    A.width_ = J.end - J.beg;
+    A.tileStride_ = tileStride_;
+    A.viewing_ = true;
+    A.locked_ = locked || locked_;
+    A.buffer_ =
+      buffer_ + (I.beg/tileSize_+(J.beg/tileSize_)*tileStride_)*
+                tileSize_*tileSize_;
+    return A;
+}
+
+template<typename T>
+TileMatrix<T> TileMatrix<T>::operator()( Range<Int> I, Range<Int> J )
+{
+    EL_DEBUG_CSE
+    return ViewOf( I, J, false );
+}
+
+template<typename T>
+const TileMatrix<T>
+TileMatrix<T>::operator()( Range<Int> I, Range<Int> J ) const
+{
+    EL_DEBUG_CSE
+    return ViewOf( I, J, true );
+}
+
+template<typename T>
+void TileMatrix<T>::AssertValidEntry( Int i, Int j ) const
+{
+    if( i < 0 || j < 0 || i >= height_ || j >= width_ )
+        LogicError
+        ("Entry (",i,",",j,") is out of bounds of ",height_," x ",width_,
+         " TileMatrix");
+}
+
+template<typename T>
+void Copy( const Matrix<T>& A, TileMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    const Int b = B.TileSize();
+    const Int tileRows = B.TileRows();
+    const Int tileCols = B.TileCols();
+    // Each thread first touches the tiles which it copies
+    EL_PARALLEL_FOR
+    for( Int j=0; j<tileCols; ++j )
+    {
+        for( Int i=0; i<tileRows; ++i )
+        {
+            auto BTile = B.Tile( i, j );
+            const Range<Int> rows( i*b, i*b+B.TileHeight(i) ),
+                             cols( j*b, j*b+B.TileWidth(j) );
+            Copy( A(rows,cols), BTile );
+        }
+    }
+}
+
+template<typename T>
+void Copy( const TileMatrix<T>& A, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    const Int b = A.TileSize();
+    const Int tileRows = A.TileRows();
+    const Int tileCols = A.TileCols();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<tileCols; ++j )
+    {
+        for( Int i=0; i<tileRows; ++i )
+        {
+            const Range<Int> rows( i*b, i*b+A.TileHeight(i) ),
+                             cols( j*b, j*b+A.TileWidth(j) );
+            auto BSub = B( rows, cols );
+            Copy( A.LockedTile(i,j), BSub );
+        }
+    }
+}
+
+#define PROTO(T) \
+  template class TileMatrix<T>; \
+  template void Copy( const Matrix<T>& A, TileMatrix<T>& B ); \
+  template void Copy( const TileMatrix<T>& A, Matrix<T>& B );
+
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,248 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace El {
+
+namespace {
+
+// Each block is preceded by a header (padded to the alignment) which
+// identifies the arena and the block's position on the stack, so that frees
+// do not require a search
+struct BlockHeader
+{
+    WorkspaceArena* arena;
+    size_t index;
+};
+static_assert
+( sizeof(BlockHeader) <= WorkspaceArena::Alignment,
+  "Workspace block headers must fit within the alignment" );
+
+// The smallest chunk which an arena acquires on its own
+constexpr size_t minChunkSize = size_t(1) << 16;
+
+size_t RoundUp( size_t bytes )
+{
+    const size_t alignment = WorkspaceArena::Alignment;
+    return ((bytes+alignment-1)/alignment)*alignment;
+}
+
+std::atomic<bool> useWorkspace(true);
+
+thread_local Int scopeDepth = 0;
+
+} // anonymous namespace
+
+WorkspaceArena::~WorkspaceArena() { FreeChunks( 0 ); }
+
+void WorkspaceArena::PushChunk( size_t capacity )
+{
+    char* raw = static_cast<char*>( std::malloc( capacity+Alignment ) );
+    if( raw == nullptr )
+        throw std::bad_alloc();
+    const size_t misalignment =
+      reinterpret_cast<std::uintptr_t>(raw) % Alignment;
+    char* data = raw + ( misalignment == 0 ? 0 : Alignment-misalignment );
+    chunks_.push_back( Chunk{raw,data,capacity,0} );
+}
+
+void WorkspaceArena::FreeChunks( size_t first )
+{
+    for( size_t c=first; c<chunks_.size(); ++c )
+        std::free( chunks_[c].raw );
+    chunks_.resize( first );
+}
+
+void* WorkspaceArena::Allocate( size_t bytes )
+{
+    const size_t need = Alignment + RoundUp( bytes );
+    std::lock_guard<std::mutex> lock( mutex_ );
+    if( blocks_.empty() )
+        TrimLocked();
+
+    // The chunks beyond the current one are empty
+    size_t c = current_;
+    while( c < chunks_.size() && chunks_[c].capacity-chunks_[c].top < need )
+        ++c;
+    if( c == chunks_.size() )
+        PushChunk( Max( need, Max( Capacity(), minChunkSize ) ) );
+
+    Chunk& chunk = chunks_[c];
+    const size_t offset = chunk.top;
+    chunk.top += need;
+    current_ = c;
+    used_ += need;
+    highWater_ = Max( highWater_, used_ );
+
+    auto* header = reinterpret_cast<BlockHeader*>( chunk.data+offset );
+    header->arena = this;
+    header->index = blocks_.size();
+    blocks_.push_back( Block{c,offset,need,false} );
+    return chunk.data + offset + Alignment;
+}
+
+void WorkspaceArena::Free( void* ptr )
+{
+    const auto* header =
+      reinterpret_cast<const BlockHeader*>
+      ( static_cast<const char*>(ptr) - Alignment );
+    if( header->arena != this )
+    {
+        FreeBlock( ptr );
+        return;
+    }
+    bool orphanEmptied;
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        const size_t index = header->index;
+        EL_DEBUG_ONLY(
+          if( index >= blocks_.size() || blocks_[index].freed )
+              LogicError("Invalid free of workspace block ",index);
+        )
+        blocks_[index].freed = true;
+        while( !blocks_.empty() && blocks_.back().freed )
+        {
+            const Block& block = blocks_.back();
+            chunks_[block.chunk].top = block.offset;
+            used_ -= block.bytes;
+            blocks_.pop_back();
+        }
+        current_ = ( blocks_.empty() ? 0 : blocks_.back().chunk );
+        orphanEmptied = orphaned_ && blocks_.empty();
+    }
+    if( orphanEmptied )
+        delete this;
+}
+
+void WorkspaceArena::FreeBlock( void* ptr )
+{
+    const auto* header =
+      reinterpret_cast<const BlockHeader*>
+      ( static_cast<const char*>(ptr) - Alignment );
+    header->arena->Free( ptr );
+}
+
+void WorkspaceArena::Reserve( size_t bytes )
+{
+    EL_DEBUG_CSE
+    const size_t need = Alignment + RoundUp( bytes );
+    std::lock_guard<std::mutex> lock( mutex_ );
+    if( blocks_.empty() )
+    {
+        if( Capacity() < need )
+        {
+            FreeChunks( 0 );
+            PushChunk( need );
+        }
+        else
+            TrimLocked();
+        current_ = 0;
+        return;
+    }
+    for( size_t c=current_; c<chunks_.size(); ++c )
+        if( chunks_[c].capacity-chunks_[c].top >= need )
+            return;
+    PushChunk( need );
+}
+
+void WorkspaceArena::Trim()
+{
+    std::lock_guard<std::mutex> lock( mutex_ );
+    TrimLocked();
+}
+
+void WorkspaceArena::TrimLocked()
+{
+    if( !blocks_.empty() || chunks_.size() <= 1 )
+        return;
+    const size_t capacity = Capacity();
+    FreeChunks( 0 );
+    PushChunk( capacity );
+    current_ = 0;
+}
+
+void WorkspaceArena::Release()
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> lock( mutex_ );
+    if( blocks_.empty() )
+    {
+        FreeChunks( 0 );
+        current_ = 0;
+    }
+    else
+        FreeChunks( current_+1 );
+}
+
+size_t WorkspaceArena::Capacity() const EL_NO_EXCEPT
+{
+    size_t capacity = 0;
+    for( const auto& chunk : chunks_ )
+        capacity += chunk.capacity;
+    return capacity;
+}
+
+void WorkspaceArena::Orphan()
+{
+    bool empty;
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        orphaned_ = true;
+        empty = blocks_.empty();
+    }
+    if( empty )
+        delete this;
+}
+
+// The default arenas live on the heap so that the blocks which a thread
+// leaves behind (e.g., in a matrix handed to another thread) remain valid
+// after it exits
+class WorkspaceArenaHolder
+{
+public:
+    WorkspaceArena* arena = new WorkspaceArena;
+    ~WorkspaceArenaHolder() { arena->Orphan(); }
+};
+
+WorkspaceArena& DefaultWorkspaceArena()
+{
+    static thread_local WorkspaceArenaHolder holder;
+    return *holder.arena;
+}
+
+bool UsingWorkspace() { return useWorkspace; }
+void SetUseWorkspace( bool use ) { useWorkspace = use; }
+
+template <>
+unsigned TemporaryMemoryMode<Device::CPU>()
+{
+    return useWorkspace ? WORKSPACE_MEMORY_MODE
+                        : DefaultMemoryMode<Device::CPU>();
+}
+
+WorkspaceScope::WorkspaceScope( size_t hintBytes )
+{
+    ++scopeDepth;
+    if( hintBytes > 0 && useWorkspace )
+        DefaultWorkspaceArena().Reserve( hintBytes );
+}
+
+WorkspaceScope::~WorkspaceScope()
+{
+    if( --scopeDepth == 0 )
+        DefaultWorkspaceArena().Trim();
+}
+
+} // namespace El
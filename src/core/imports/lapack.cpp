@@ -37,6 +37,20 @@ void EL_LAPACK(zlacpy)
 ( const char* uplo, const BlasInt* m, const BlasInt* n,
   const dcomplex* A, const BlasInt* lda, dcomplex* B, const BlasInt* ldb );
 
+// Cholesky factorization
+void EL_LAPACK(spotrf)
+( const char* uplo, const BlasInt* n, float* A, const BlasInt* ldA,
+  BlasInt* info );
+void EL_LAPACK(dpotrf)
+( const char* uplo, const BlasInt* n, double* A, const BlasInt* ldA,
+  BlasInt* info );
+void EL_LAPACK(cpotrf)
+( const char* uplo, const BlasInt* n, scomplex* A, const BlasInt* ldA,
+  BlasInt* info );
+void EL_LAPACK(zpotrf)
+( const char* uplo, const BlasInt* n, dcomplex* A, const BlasInt* ldA,
+  BlasInt* info );
+
 // Symmetric tridiagonal eigensolvers (via MRRR)
 void EL_LAPACK(sstevr)
 ( const char* job, const char* range, const BlasInt* n,
@@ -431,6 +445,52 @@ void Copy
   const dcomplex* A, BlasInt lda, dcomplex* B, BlasInt ldb )
 { EL_LAPACK(zlacpy)( &uplo, &m, &n, A, &lda, B, &ldb ); }
 
+// Compute the Cholesky factorization of a Hermitian positive-definite matrix
+// ==========================================================================
+namespace {
+
+void CheckCholeskyInfo( BlasInt info )
+{
+    if( info < 0 )
+        RuntimeError("Argument ",-info," had an illegal value");
+    else if( info > 0 )
+        throw NonHPDMatrixException("A was not numerically HPD");
+}
+
+} // anonymous namespace
+
+void Cholesky( char uplo, BlasInt n, float* A, BlasInt ldA )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(spotrf)( &uplo, &n, A, &ldA, &info );
+    CheckCholeskyInfo( info );
+}
+
+void Cholesky( char uplo, BlasInt n, double* A, BlasInt ldA )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(dpotrf)( &uplo, &n, A, &ldA, &info );
+    CheckCholeskyInfo( info );
+}
+
+void Cholesky( char uplo, BlasInt n, scomplex* A, BlasInt ldA )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(cpotrf)( &uplo, &n, A, &ldA, &info );
+    CheckCholeskyInfo( info );
+}
+
+void Cholesky( char uplo, BlasInt n, dcomplex* A, BlasInt ldA )
+{
+    EL_DEBUG_CSE
+    BlasInt info;
+    EL_LAPACK(zpotrf)( &uplo, &n, A, &ldA, &info );
+    CheckCholeskyInfo( info );
+}
+
 // Generate a Householder reflector
 // ================================
 // NOTE:
@@ -21,6 +21,9 @@
 
 #include <El/core/imports/mpi.hpp>
 
+#include <mutex>
+#include <set>
+
 typedef unsigned char* UCP;
 
 namespace El
@@ -189,6 +192,17 @@ void Split( Comm const& comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_
     newComm.Control(tmp);
 }
 
+void SplitShared( Comm const& comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE;
+    MPI_Comm tmp;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_split_type(
+            comm.GetMPIComm(), MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL,
+            &tmp ) );
+    newComm.Control(tmp);
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
@@ -224,6 +238,66 @@ bool CongruentToCommWorld( Comm const& comm ) EL_NO_RELEASE_EXCEPT
     return comm.Size() == world_size;// RawCommCongruent(comm.GetMPIcomm, MPI_COMM_WORLD);
 }
 
+namespace /* <anon> */
+{
+// The context ids are attached to the communicators as attributes whose
+// deletion callback (run by MPI_Comm_free or MPI_Finalize) retires the id.
+// The set of live ids is leaked so that it outlives the finalization of
+// COMM_WORLD.
+std::mutex contextIdMutex;
+unsigned long long nextContextId = 1;
+int contextIdKeyval = MPI_KEYVAL_INVALID;
+
+std::set<unsigned long long>& LiveContextIds()
+{
+    static auto* liveIds = new std::set<unsigned long long>;
+    return *liveIds;
+}
+
+int DeleteContextId
+( MPI_Comm, int, void* attributeValue, void* ) EL_NO_EXCEPT
+{
+    auto* contextId = static_cast<unsigned long long*>( attributeValue );
+    {
+        std::lock_guard<std::mutex> lock( contextIdMutex );
+        LiveContextIds().erase( *contextId );
+    }
+    delete contextId;
+    return MPI_SUCCESS;
+}
+}// namespace <anon>
+
+unsigned long long ContextId( Comm const& comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE;
+    const MPI_Comm mpiComm = comm.GetMPIComm();
+    if( mpiComm == MPI_COMM_NULL )
+        return 0;
+    std::lock_guard<std::mutex> lock( contextIdMutex );
+    if( contextIdKeyval == MPI_KEYVAL_INVALID )
+        EL_CHECK_MPI_CALL(
+            MPI_Comm_create_keyval(
+                MPI_COMM_NULL_COPY_FN, DeleteContextId, &contextIdKeyval,
+                nullptr ) );
+    void* attributeValue;
+    int found;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_get_attr( mpiComm, contextIdKeyval, &attributeValue, &found ) );
+    if( found )
+        return *static_cast<unsigned long long*>( attributeValue );
+    auto* contextId = new unsigned long long( nextContextId++ );
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_set_attr( mpiComm, contextIdKeyval, contextId ) );
+    LiveContextIds().insert( *contextId );
+    return *contextId;
+}
+
+bool ContextIdLive( unsigned long long contextId ) EL_NO_EXCEPT
+{
+    std::lock_guard<std::mutex> lock( contextIdMutex );
+    return LiveContextIds().count( contextId ) > 0;
+}
+
 Comm NewWorldComm() EL_NO_RELEASE_EXCEPT
 {
     return Comm{MPI_COMM_WORLD};
@@ -1318,6 +1392,74 @@ void IGather
         &request.backend ) );
 }
 
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request )
+{
+    EL_DEBUG_CSE;
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.GetMPIComm(),
+        &request.backend ) );
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE;
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+#else
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.GetMPIComm(), &request.backend ) );
+#endif
+}
+
+template <typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm const& comm,
+  Request<T>& request )
+{
+    EL_DEBUG_CSE;
+    // The request only owns a single buffer, so the local contribution is
+    // serialized directly into its slot of the packed result
+    const int commSize = mpi::Size(comm);
+    const int commRank = mpi::Rank(comm);
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    std::vector<byte> packedSend;
+    Serialize( sc, sbuf, packedSend );
+    const size_t portionSize = request.buffer.size() / commSize;
+    std::copy
+    ( packedSend.begin(), packedSend.end(),
+      request.buffer.begin()+commRank*portionSize );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( MPI_IN_PLACE, sc, TypeMap<T>(),
+        request.buffer.data(), rc, TypeMap<T>(), comm.GetMPIComm(),
+        &request.backend ) );
+}
+
 template <typename Real, Device D,
           typename/*=EnableIf<IsPacked<Real>>*/>
 void Gather(
@@ -2335,6 +2477,9 @@ EL_NO_RELEASE_EXCEPT
         const T* sbuf, int sc,                                          \
         T* rbuf, int rc,                                                \
         int root, Comm const& comm, Request<T>& request);                      \
+    template void IAllGather(                                           \
+        const T* sbuf, int sc,                                          \
+        T* rbuf, int rc, Comm const& comm, Request<T>& request);        \
     MPI_PROTO_DEVICELESS_COMMON(T)
 
 #define MPI_PROTO_DEVICELESS_COMPLEX(T)                                 \
@@ -2357,6 +2502,10 @@ EL_NO_RELEASE_EXCEPT
         const Complex<T>* sbuf, int sc,                                 \
         Complex<T>* rbuf, int rc,                                       \
         int root, Comm const& comm, Request<Complex<T>>& request);             \
+    template void IAllGather<T>(                                        \
+        const Complex<T>* sbuf, int sc,                                 \
+        Complex<T>* rbuf, int rc, Comm const& comm,                     \
+        Request<Complex<T>>& request);                                  \
     MPI_PROTO_DEVICELESS_COMMON(Complex<T>)
 
 #define MPI_PROTO_COMMON_DEV(T,D)               \
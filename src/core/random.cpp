@@ -13,6 +13,11 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The (rank-independent) seed and the next stream of the counter-based
+// generator used by MakeUniform and MakeGaussian
+unsigned long long counterSeed = 0;
+unsigned long long counterStream = 0;
+
 #ifdef HYDROGEN_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -24,10 +29,14 @@ namespace El {
 void InitializeRandom( bool deterministic )
 {
     const unsigned rank = mpi::Rank( mpi::COMM_WORLD );
-    const long secs = ( deterministic ? 21 : time(NULL) );
-    const long seed = (secs<<16) | (rank & 0xFFFF);
+    // The clocks of the processes need not agree, so the counter-based seed
+    // is taken from the root
+    unsigned long long secs = ( deterministic ? 21 : time(NULL) );
+    mpi::Broadcast( secs, 0, mpi::COMM_WORLD, SyncInfo<Device::CPU>{} );
+    const long seed = (long(secs)<<16) | (rank & 0xFFFF);
 
     ::generator.seed( seed );
+    SetRandomSeed( secs );
 
     srand( seed );
 
@@ -49,6 +58,18 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+void SetRandomSeed( unsigned long long seed )
+{
+    ::counterSeed = seed;
+    ::counterStream = 0;
+}
+
+unsigned long long RandomSeed()
+{ return ::counterSeed; }
+
+unsigned long long NextRandomStream()
+{ return ::counterStream++; }
+
 #ifdef HYDROGEN_HAVE_MPC
 namespace mpfr {
 
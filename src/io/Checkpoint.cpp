@@ -0,0 +1,490 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+namespace El {
+
+namespace {
+
+const char CHECKPOINT_MAGIC[8] = { 'E', 'L', 'C', 'K', 'P', 'T', '0', '1' };
+
+string ProcessFilename( const string& basename, Int step, int rank )
+{
+    return basename + "." + std::to_string(step) + "." +
+           std::to_string(rank) + ".ckpt";
+}
+
+string ManifestFilename( const string& basename, Int step )
+{ return basename + "." + std::to_string(step) + ".manifest"; }
+
+// The distribution of a checkpointed matrix, as recorded in the manifest
+// (the grid and device of the DistData are not)
+struct Layout
+{
+    string name, typeName;
+    Int typeSize=0, height=0, width=0;
+    DistWrap wrap=ELEMENT;
+    El::DistData dist;
+};
+
+// The local portion of a matrix as of its last call to Stage
+struct Snapshot
+{
+    Layout layout;
+    // The global indices of the local rows and columns. Only one member of
+    // each redundant group writes its entries; the rest record none.
+    vector<Int> rows, cols;
+    vector<char> data;
+    bool staged=false;
+};
+
+template<typename S>
+void WriteScalar( std::ofstream& file, const S& value )
+{ file.write( reinterpret_cast<const char*>(&value), sizeof(S) ); }
+
+template<typename S>
+void ReadScalar( std::ifstream& file, S& value, const string& filename )
+{
+    file.read( reinterpret_cast<char*>(&value), sizeof(S) );
+    if( !file )
+        RuntimeError("Truncated checkpoint file ",filename);
+}
+
+template<typename S>
+void ReadArray( std::ifstream& file, vector<S>& values, const string& filename )
+{
+    file.read( reinterpret_cast<char*>(values.data()), values.size()*sizeof(S) );
+    if( !file )
+        RuntimeError("Truncated checkpoint file ",filename);
+}
+
+// Write the staged snapshots to a temporary file which is renamed into place
+// once complete, so that a partially-written checkpoint is never mistaken for
+// a complete one
+void WriteProcessFile
+( const string& filename, Int step, const vector<Snapshot>& snapshots )
+{
+    EL_DEBUG_CSE
+    const string tmpFilename = filename + ".tmp";
+    std::ofstream file( tmpFilename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",tmpFilename);
+
+    Int numStaged = 0;
+    for( const auto& snapshot : snapshots )
+        numStaged += snapshot.staged;
+    file.write( CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC) );
+    WriteScalar( file, step );
+    WriteScalar( file, numStaged );
+    for( const auto& snapshot : snapshots )
+    {
+        if( !snapshot.staged )
+            continue;
+        const string& name = snapshot.layout.name;
+        WriteScalar( file, Int(name.size()) );
+        file.write( name.data(), name.size() );
+        WriteScalar( file, Int(snapshot.rows.size()) );
+        WriteScalar( file, Int(snapshot.cols.size()) );
+        file.write
+        ( reinterpret_cast<const char*>(snapshot.rows.data()),
+          snapshot.rows.size()*sizeof(Int) );
+        file.write
+        ( reinterpret_cast<const char*>(snapshot.cols.data()),
+          snapshot.cols.size()*sizeof(Int) );
+        file.write( snapshot.data.data(), snapshot.data.size() );
+    }
+    file.close();
+    if( !file )
+        RuntimeError("Could not write ",tmpFilename);
+    if( std::rename( tmpFilename.c_str(), filename.c_str() ) != 0 )
+        RuntimeError("Could not rename ",tmpFilename," to ",filename);
+}
+
+void WriteManifest
+( const string& filename, Int step, int numProcesses,
+  const vector<Snapshot>& snapshots )
+{
+    EL_DEBUG_CSE
+    const string tmpFilename = filename + ".tmp";
+    std::ofstream file( tmpFilename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",tmpFilename);
+    file << "step " << step << "\n"
+         << "processes " << numProcesses << "\n"
+         << "# name type typeSize height width colDist rowDist wrap "
+            "blockHeight blockWidth colAlign rowAlign colCut rowCut root\n";
+    for( const auto& snapshot : snapshots )
+    {
+        if( !snapshot.staged )
+            continue;
+        const Layout& l = snapshot.layout;
+        const El::DistData& d = l.dist;
+        file << "matrix " << l.name << " " << l.typeName << " " << l.typeSize
+             << " " << l.height << " " << l.width << " " << int(d.colDist)
+             << " " << int(d.rowDist) << " " << int(l.wrap) << " "
+             << d.blockHeight << " " << d.blockWidth << " " << d.colAlign
+             << " " << d.rowAlign << " " << d.colCut << " " << d.rowCut << " "
+             << d.root << "\n";
+    }
+    file.close();
+    if( !file )
+        RuntimeError("Could not write ",tmpFilename);
+    if( std::rename( tmpFilename.c_str(), filename.c_str() ) != 0 )
+        RuntimeError("Could not rename ",tmpFilename," to ",filename);
+}
+
+// Return the number of processes which wrote the checkpoint and the layout of
+// the named matrix
+int ReadManifest( const string& filename, const string& name, Layout& layout )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    int numProcesses = -1;
+    bool found = false;
+    string line;
+    while( std::getline( file, line ) )
+    {
+        std::istringstream lineStream( line );
+        string key;
+        if( !(lineStream >> key) || key[0] == '#' )
+            continue;
+        if( key == "processes" )
+            lineStream >> numProcesses;
+        else if( key == "matrix" )
+        {
+            Layout& l = layout;
+            El::DistData& d = l.dist;
+            if( !(lineStream >> l.name) || l.name != name )
+                continue;
+            int colDist, rowDist, wrap;
+            if( !(lineStream >> l.typeName >> l.typeSize >> l.height
+                             >> l.width >> colDist >> rowDist >> wrap
+                             >> d.blockHeight >> d.blockWidth >> d.colAlign
+                             >> d.rowAlign >> d.colCut >> d.rowCut >> d.root) )
+                RuntimeError("Malformed entry for ",name," in ",filename);
+            d.colDist = Dist(colDist);
+            d.rowDist = Dist(rowDist);
+            l.wrap = DistWrap(wrap);
+            found = true;
+        }
+    }
+    if( numProcesses <= 0 )
+        RuntimeError("Missing process count in ",filename);
+    if( !found )
+        RuntimeError("No matrix named ",name," in ",filename);
+    return numProcesses;
+}
+
+// Position 'file' at the data of the named matrix after reading the global
+// indices of its local rows and columns
+void FindRecord
+( std::ifstream& file, const string& filename, Int step, const string& name,
+  Int typeSize, vector<Int>& rows, vector<Int>& cols )
+{
+    EL_DEBUG_CSE
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    file.read( magic, sizeof(magic) );
+    if( !file ||
+        std::memcmp( magic, CHECKPOINT_MAGIC, sizeof(magic) ) != 0 )
+        RuntimeError(filename," is not a checkpoint file");
+    Int fileStep, numRecords;
+    ReadScalar( file, fileStep, filename );
+    ReadScalar( file, numRecords, filename );
+    if( fileStep != step )
+        RuntimeError(filename," is from step ",fileStep," rather than ",step);
+    for( Int record=0; record<numRecords; ++record )
+    {
+        Int nameLength, localHeight, localWidth;
+        ReadScalar( file, nameLength, filename );
+        string recordName( nameLength, ' ' );
+        file.read( &recordName[0], nameLength );
+        ReadScalar( file, localHeight, filename );
+        ReadScalar( file, localWidth, filename );
+        if( recordName == name )
+        {
+            rows.resize( localHeight );
+            cols.resize( localWidth );
+            ReadArray( file, rows, filename );
+            ReadArray( file, cols, filename );
+            return;
+        }
+        file.seekg
+        ( (localHeight+localWidth)*sizeof(Int) +
+          localHeight*localWidth*typeSize, std::ios::cur );
+    }
+    RuntimeError("No matrix named ",name," in ",filename);
+}
+
+}// namespace <anon>
+
+struct Checkpointer::Impl
+{
+    const Grid* grid;
+    string basename;
+    vector<Snapshot> staged, inFlight;
+    std::thread writer;
+    std::atomic<bool> writing{false};
+    std::exception_ptr error;
+    // The step whose manifest remains to be written once every process has
+    // written its file
+    bool manifestPending=false;
+    Int pendingStep=-1;
+};
+
+Checkpointer::Checkpointer( const Grid& grid, const string& basename )
+: impl_(new Impl)
+{
+    impl_->grid = &grid;
+    impl_->basename = basename;
+}
+
+Checkpointer::~Checkpointer()
+{
+    // Errors cannot be propagated out of a destructor
+    if( impl_->writer.joinable() )
+        impl_->writer.join();
+}
+
+template<typename T>
+void Checkpointer::Stage( const string& name, const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Grid() != *impl_->grid )
+        LogicError("Matrices must be distributed over the Checkpointer's grid");
+    if( !std::is_trivially_copyable<T>::value )
+        LogicError("Cannot checkpoint ",TypeName<T>()," matrices");
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("Only CPU matrices can be checkpointed");
+    if( name.empty() || name.find_first_of(" \t\n") != string::npos )
+        LogicError("Invalid checkpoint name '",name,"'");
+
+    // Reuse the buffers of the snapshot of the same name from the checkpoint
+    // before last, if there was one
+    auto& snapshots = impl_->staged;
+    auto it =
+      std::find_if
+      ( snapshots.begin(), snapshots.end(),
+        [&]( const Snapshot& s ) { return s.layout.name == name; } );
+    if( it == snapshots.end() )
+    {
+        snapshots.emplace_back();
+        it = snapshots.end()-1;
+    }
+    Snapshot& snapshot = *it;
+
+    Layout& l = snapshot.layout;
+    l.name = name;
+    l.typeName = TypeName<T>();
+    l.typeSize = sizeof(T);
+    l.height = A.Height();
+    l.width = A.Width();
+    l.wrap = A.Wrap();
+    l.dist = A.DistData();
+
+    const bool writes = A.Participating() && A.RedundantRank() == 0;
+    const Int localHeight = ( writes ? A.LocalHeight() : 0 );
+    const Int localWidth = ( writes ? A.LocalWidth() : 0 );
+    snapshot.rows.resize( localHeight );
+    snapshot.cols.resize( localWidth );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        snapshot.rows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        snapshot.cols[jLoc] = A.GlobalCol(jLoc);
+
+    const Int columnBytes = localHeight*sizeof(T);
+    snapshot.data.resize( columnBytes*localWidth );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    if( ALDim == localHeight )
+        MemCopy( snapshot.data.data(),
+                 reinterpret_cast<const char*>(ABuf), columnBytes*localWidth );
+    else
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( &snapshot.data[jLoc*columnBytes],
+              reinterpret_cast<const char*>(&ABuf[jLoc*ALDim]), columnBytes );
+    snapshot.staged = true;
+}
+
+void Checkpointer::Commit( Int step )
+{
+    EL_DEBUG_CSE
+    Wait();
+    // The snapshots of the previous checkpoint become the staging buffers
+    std::swap( impl_->staged, impl_->inFlight );
+    for( auto& snapshot : impl_->staged )
+        snapshot.staged = false;
+
+    const mpi::Comm& comm = impl_->grid->ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const string filename =
+      ProcessFilename( impl_->basename, step, commRank );
+    Impl* impl = impl_.get();
+    impl->writing = true;
+    impl->manifestPending = true;
+    impl->pendingStep = step;
+    impl->writer =
+      std::thread
+      ( [=]()
+        {
+            try { WriteProcessFile( filename, step, impl->inFlight ); }
+            catch( ... ) { impl->error = std::current_exception(); }
+            impl->writing = false;
+        } );
+}
+
+void Checkpointer::Wait()
+{
+    EL_DEBUG_CSE
+    if( impl_->writer.joinable() )
+        impl_->writer.join();
+    if( !impl_->manifestPending )
+        return;
+    impl_->manifestPending = false;
+
+    // The manifest marks the checkpoint as complete, so it may only be
+    // written once every process has renamed its file into place; the
+    // agreement upon errors doubles as the barrier which ensures this
+    const mpi::Comm& comm = impl_->grid->ViewingComm();
+    const int failed = ( impl_->error ? 1 : 0 );
+    if( mpi::AllReduce( failed, mpi::MAX, comm, SyncInfo<Device::CPU>{} ) )
+    {
+        if( impl_->error )
+        {
+            auto error = impl_->error;
+            impl_->error = nullptr;
+            std::rethrow_exception( error );
+        }
+        RuntimeError
+        ("Another process could not write checkpoint ",impl_->pendingStep);
+    }
+    if( mpi::Rank( comm ) == 0 )
+        WriteManifest
+        ( ManifestFilename( impl_->basename, impl_->pendingStep ),
+          impl_->pendingStep, mpi::Size( comm ), impl_->inFlight );
+}
+
+bool Checkpointer::Pending() const { return impl_->writing; }
+
+template<typename T>
+void Restore
+( AbstractDistMatrix<T>& A, const string& basename, Int step,
+  const string& name )
+{
+    EL_DEBUG_CSE
+    if( !std::is_trivially_copyable<T>::value )
+        LogicError("Cannot restore ",TypeName<T>()," matrices");
+    const mpi::Comm& comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    Layout layout;
+    const int numProcesses =
+      ReadManifest( ManifestFilename( basename, step ), name, layout );
+    if( layout.typeName != TypeName<T>() || layout.typeSize != Int(sizeof(T)) )
+        RuntimeError
+        (name," was checkpointed as ",layout.typeName," rather than ",
+         TypeName<T>());
+    A.Resize( layout.height, layout.width );
+
+    // Each process reads the records of its share of the files exactly once.
+    // If the checkpoint was written with the same distribution over the same
+    // number of processes, its share is its own file, whose record can be
+    // copied into place; otherwise the entries are routed to their new
+    // owners. Errors must be agreed upon before any collective communication.
+    struct Record
+    {
+        vector<Int> rows, cols;
+        vector<T> values;
+    };
+    vector<Record> records;
+    string error;
+    bool direct = false;
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    try
+    {
+        for( int rank=commRank; rank<numProcesses; rank+=commSize )
+        {
+            const string filename = ProcessFilename( basename, step, rank );
+            std::ifstream file( filename.c_str(), std::ios::binary );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+            records.emplace_back();
+            Record& record = records.back();
+            FindRecord
+            ( file, filename, step, name, sizeof(T), record.rows,
+              record.cols );
+            record.values.resize( record.rows.size()*record.cols.size() );
+            ReadArray( file, record.values, filename );
+        }
+        if( numProcesses == commSize )
+        {
+            const Record& record = records.front();
+            direct = Int(record.rows.size()) == localHeight &&
+                     Int(record.cols.size()) == localWidth;
+            for( Int iLoc=0; direct && iLoc<localHeight; ++iLoc )
+                direct = ( record.rows[iLoc] == A.GlobalRow(iLoc) );
+            for( Int jLoc=0; direct && jLoc<localWidth; ++jLoc )
+                direct = ( record.cols[jLoc] == A.GlobalCol(jLoc) );
+        }
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    if( mpi::AllReduce( int(!error.empty()), mpi::MAX, comm, syncInfo ) )
+        RuntimeError
+        (error.empty() ? "Another process could not restore "+name : error);
+
+    if( mpi::AllReduce( int(direct), mpi::MIN, comm, syncInfo ) )
+    {
+        const T* values = records.front().values.data();
+        T* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( &ABuf[jLoc*ALDim], &values[jLoc*localHeight], localHeight );
+        return;
+    }
+
+    Zero( A );
+    for( const auto& record : records )
+    {
+        const Int recordHeight = record.rows.size();
+        A.Reserve( record.values.size() );
+        for( Int jLoc=0; jLoc<Int(record.cols.size()); ++jLoc )
+            for( Int iLoc=0; iLoc<recordHeight; ++iLoc )
+                A.QueueUpdate
+                ( record.rows[iLoc], record.cols[jLoc],
+                  record.values[iLoc+jLoc*recordHeight] );
+    }
+    A.ProcessQueues();
+}
+
+#define PROTO(T) \
+  template void Checkpointer::Stage \
+  ( const string& name, const AbstractDistMatrix<T>& A ); \
+  template void Restore \
+  ( AbstractDistMatrix<T>& A, const string& basename, Int step, \
+    const string& name );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#include <El/macros/Instantiate.h>
+
+} // namespace El
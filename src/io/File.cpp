@@ -37,6 +37,7 @@ string FileExtension( FileFormat format )
     case JPG:              return "jpg";  break;
     case JPEG:             return "jpeg"; break;
     case MATRIX_MARKET:    return "mm";   break;
+    case NUMPY:            return "npy";  break;
     case PNG:              return "png";  break;
     case PPM:              return "ppm";  break;
     case XBM:              return "xbm";  break;
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_MPIIO_HPP
+#define EL_IO_MPIIO_HPP
+
+namespace El {
+namespace mpiio {
+
+// The BINARY and BINARY_FLAT formats store a column-major matrix (the former
+// preceded by its height and width), so the local entries of an element-wise
+// distributed matrix occupy a doubly-strided set of file offsets. Each process
+// describes its set with an MPI-IO file view so that all processes can read or
+// write their own entries collectively, without funneling the data through a
+// single process.
+
+// MPI counts are ints, so reject local dimensions which do not fit rather
+// than silently narrowing them
+inline int CheckedCount( Int count, const char* what )
+{
+    if( count < 0 || count > Int(std::numeric_limits<int>::max()) )
+        RuntimeError
+        ("The ",what," of ",count," is too large for an MPI-IO file view");
+    return int(count);
+}
+
+// Whether A can be read or written with a collective file view
+template<typename T>
+bool Supported( const AbstractDistMatrix<T>& A )
+{
+    return A.Wrap() == ELEMENT &&
+           A.GetLocalDevice() == Device::CPU &&
+           std::is_trivially_copyable<T>::value;
+}
+
+// Owns the derived datatypes describing the local entries of a distributed
+// matrix, both in memory and within a column-major file
+class View
+{
+public:
+    // Describe the local entries of A as the submatrix of a file which begins
+    // at global index (iOffset,jOffset) of a column-major matrix with the
+    // given height and whose first entry is 'headerBytes' into the file. If
+    // 'active' is false, this process accesses no entries.
+    template<typename T>
+    View
+    ( const AbstractDistMatrix<T>& A, bool active,
+      Int fileHeight, Int iOffset, Int jOffset, MPI_Offset headerBytes )
+    {
+        EL_CHECK_MPI_CALL
+        ( MPI_Type_contiguous( sizeof(T), MPI_BYTE, &elemType_ ) );
+        EL_CHECK_MPI_CALL( MPI_Type_commit( &elemType_ ) );
+
+        displacement_ = headerBytes;
+        if( !active || A.LocalHeight() == 0 || A.LocalWidth() == 0 )
+            return;
+        const int localHeight = CheckedCount( A.LocalHeight(), "local height" );
+        const int localWidth = CheckedCount( A.LocalWidth(), "local width" );
+
+        // The strides are expressed in bytes (as MPI_Aint) since the column
+        // stride of the file is the full height of the stored matrix
+        const MPI_Offset i0 = MPI_Offset(iOffset) + A.ColShift();
+        const MPI_Offset j0 = MPI_Offset(jOffset) + A.RowShift();
+        displacement_ += (i0 + j0*MPI_Offset(fileHeight))*MPI_Offset(sizeof(T));
+
+        MPI_Datatype colType;
+        const MPI_Aint entryStrideBytes = MPI_Aint(A.ColStride())*sizeof(T);
+        EL_CHECK_MPI_CALL
+        ( MPI_Type_create_hvector
+          ( localHeight, 1, entryStrideBytes, elemType_, &colType ) );
+        const MPI_Aint colStrideBytes =
+          MPI_Aint(A.RowStride())*MPI_Aint(fileHeight)*sizeof(T);
+        EL_CHECK_MPI_CALL
+        ( MPI_Type_create_hvector
+          ( localWidth, 1, colStrideBytes, colType, &fileType_ ) );
+        EL_CHECK_MPI_CALL( MPI_Type_commit( &fileType_ ) );
+        EL_CHECK_MPI_CALL( MPI_Type_free( &colType ) );
+
+        const MPI_Aint ldimBytes = MPI_Aint(A.LDim())*sizeof(T);
+        EL_CHECK_MPI_CALL
+        ( MPI_Type_create_hvector
+          ( localWidth, localHeight, ldimBytes, elemType_, &memType_ ) );
+        EL_CHECK_MPI_CALL( MPI_Type_commit( &memType_ ) );
+        count_ = 1;
+    }
+
+    ~View()
+    {
+        if( count_ > 0 )
+        {
+            MPI_Type_free( &fileType_ );
+            MPI_Type_free( &memType_ );
+        }
+        MPI_Type_free( &elemType_ );
+    }
+
+    View( const View& ) = delete;
+    View& operator=( const View& ) = delete;
+
+    // Collectively set the file view of 'file'
+    void Set( MPI_File file ) const
+    {
+        EL_CHECK_MPI_CALL
+        ( MPI_File_set_view
+          ( file, displacement_, elemType_,
+            count_ > 0 ? fileType_ : elemType_,
+            const_cast<char*>("native"), MPI_INFO_NULL ) );
+    }
+
+    int Count() const { return count_; }
+    MPI_Datatype MemoryType() const
+    { return count_ > 0 ? memType_ : elemType_; }
+
+private:
+    MPI_Datatype elemType_ = MPI_DATATYPE_NULL,
+                 fileType_ = MPI_DATATYPE_NULL,
+                 memType_ = MPI_DATATYPE_NULL;
+    MPI_Offset displacement_ = 0;
+    int count_ = 0;
+};
+
+inline MPI_File Open
+( const mpi::Comm& comm, const string& filename, int mode )
+{
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.GetMPIComm(), const_cast<char*>(filename.c_str()), mode,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    return file;
+}
+
+inline void Close( MPI_File& file )
+{ EL_CHECK_MPI_CALL( MPI_File_close( &file ) ); }
+
+inline MPI_Offset FileSize( MPI_File file )
+{
+    MPI_Offset size;
+    EL_CHECK_MPI_CALL( MPI_File_get_size( file, &size ) );
+    return size;
+}
+
+} // namespace mpiio
+} // namespace El
+
+#endif // ifndef EL_IO_MPIIO_HPP
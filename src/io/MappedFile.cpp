@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace El {
+
+namespace {
+
+int AdviceFlag( MapAdvice advice )
+{
+    switch( advice )
+    {
+    case ADVISE_SEQUENTIAL: return MADV_SEQUENTIAL;
+    case ADVISE_RANDOM:     return MADV_RANDOM;
+    case ADVISE_WILLNEED:   return MADV_WILLNEED;
+    default:                return MADV_NORMAL;
+    }
+}
+
+}// namespace <anon>
+
+MappedFile::MappedFile( const string& filename, MapAdvice advice )
+: filename_(filename)
+{
+    EL_DEBUG_CSE
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileStats;
+    if( fstat( fd, &fileStats ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not determine the size of ",filename);
+    }
+    size_ = fileStats.st_size;
+    if( size_ > 0 )
+    {
+        void* data = mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+        if( data == MAP_FAILED )
+        {
+            close( fd );
+            RuntimeError("Could not map ",filename);
+        }
+        data_ = static_cast<const char*>(data);
+    }
+    // The mapping remains valid after the descriptor is closed
+    close( fd );
+    if( advice != ADVISE_NORMAL )
+        Advise( advice, 0, size_ );
+}
+
+MappedFile::~MappedFile()
+{
+    if( data_ != nullptr )
+        munmap( const_cast<char*>(data_), size_ );
+}
+
+void MappedFile::Advise
+( MapAdvice advice, size_t offset, size_t numBytes ) const
+{
+    EL_DEBUG_CSE
+    if( data_ == nullptr || offset >= size_ )
+        return;
+    numBytes = Min( numBytes, size_-offset );
+    // madvise requires a page-aligned address
+    const size_t pageSize = sysconf( _SC_PAGESIZE );
+    const size_t alignedOffset = offset - offset % pageSize;
+    // Advice is only a hint, so failures are not fatal
+    madvise
+    ( const_cast<char*>(data_)+alignedOffset, numBytes+(offset-alignedOffset),
+      AdviceFlag(advice) );
+}
+
+} // namespace El
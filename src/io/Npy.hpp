@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_NPY_HPP
+#define EL_IO_NPY_HPP
+
+#include <cstdint>
+
+namespace El {
+namespace npy {
+
+// The NumPy .npy format consists of a magic string, a version, the length of
+// a header dictionary (a Python literal describing the element type, the
+// storage order, and the shape), and then the raw array. See
+// https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html
+
+const char MAGIC[6] = { '\x93', 'N', 'U', 'M', 'P', 'Y' };
+
+struct Header
+{
+    string descr;
+    bool fortranOrder=false;
+    Int height=1, width=1;
+    Int dataOffset=0;
+};
+
+inline char ByteOrder()
+{
+    const std::uint16_t probe = 1;
+    return ( *reinterpret_cast<const unsigned char*>(&probe) == 1 ? '<' : '>' );
+}
+
+inline string TypeCode( const float* )  { return "f4"; }
+inline string TypeCode( const double* ) { return "f8"; }
+inline string TypeCode( const Complex<float>* ) { return "c8"; }
+inline string TypeCode( const Complex<double>* ) { return "c16"; }
+inline string TypeCode( const Int* )
+{ return ( sizeof(Int) == 4 ? "i4" : "i8" ); }
+template<typename T>
+inline string TypeCode( const T* )
+{
+    LogicError("The .npy format does not support ",TypeName<T>());
+    return "";
+}
+
+// The descriptor of T in the native byte order, e.g., '<f8'
+template<typename T>
+inline string Descriptor()
+{ return ByteOrder() + TypeCode( static_cast<const T*>(nullptr) ); }
+
+template<typename T>
+inline void CheckDescriptor( const Header& header, const string& filename )
+{
+    const string code = TypeCode( static_cast<const T*>(nullptr) );
+    const string& descr = header.descr;
+    const bool orderMatches =
+      descr.size() == code.size()+1 &&
+      ( descr[0] == ByteOrder() || descr[0] == '=' || descr[0] == '|' );
+    if( !orderMatches || descr.compare(1,string::npos,code) != 0 )
+        RuntimeError
+        (filename," stores '",descr,"' entries rather than '",
+         Descriptor<T>(),"'");
+}
+
+// Return the position following the ':' after the given (quoted) key
+inline string::size_type
+FindValue( const string& dict, const string& key, const string& filename )
+{
+    auto pos = dict.find( "'"+key+"'" );
+    if( pos == string::npos )
+        pos = dict.find( "\""+key+"\"" );
+    if( pos == string::npos )
+        RuntimeError("Missing '",key,"' in header of ",filename);
+    pos = dict.find( ':', pos );
+    if( pos == string::npos )
+        RuntimeError("Malformed header in ",filename);
+    return dict.find_first_not_of( " \t", pos+1 );
+}
+
+inline void
+ParseDictionary( const string& dict, Header& header, const string& filename )
+{
+    auto pos = FindValue( dict, "descr", filename );
+    if( pos == string::npos || (dict[pos] != '\'' && dict[pos] != '"') )
+        RuntimeError("Malformed 'descr' in header of ",filename);
+    auto end = dict.find( dict[pos], pos+1 );
+    if( end == string::npos )
+        RuntimeError("Malformed 'descr' in header of ",filename);
+    header.descr = dict.substr( pos+1, end-pos-1 );
+
+    pos = FindValue( dict, "fortran_order", filename );
+    if( dict.compare( pos, 4, "True" ) == 0 )
+        header.fortranOrder = true;
+    else if( dict.compare( pos, 5, "False" ) == 0 )
+        header.fortranOrder = false;
+    else
+        RuntimeError("Malformed 'fortran_order' in header of ",filename);
+
+    pos = FindValue( dict, "shape", filename );
+    end = dict.find( ')', pos );
+    if( pos == string::npos || dict[pos] != '(' || end == string::npos )
+        RuntimeError("Malformed 'shape' in header of ",filename);
+    vector<Int> shape;
+    std::istringstream shapeStream( dict.substr( pos+1, end-pos-1 ) );
+    string token;
+    while( std::getline( shapeStream, token, ',' ) )
+    {
+        const auto first = token.find_first_of( "0123456789" );
+        if( first != string::npos )
+            shape.push_back( std::stoll( token.substr(first) ) );
+    }
+    if( shape.size() > 2 )
+        RuntimeError
+        (filename," stores a ",shape.size(),"-dimensional array rather than "
+         "a matrix");
+    // One-dimensional arrays are treated as column vectors
+    header.height = ( shape.size() > 0 ? shape[0] : 1 );
+    header.width = ( shape.size() > 1 ? shape[1] : 1 );
+}
+
+// Form the preamble and header dictionary of a (version 1.0) .npy file,
+// padded so that the array begins on a 64-byte boundary
+template<typename T>
+inline string FormatHeader( Int height, Int width, bool fortranOrder=true )
+{
+    ostringstream dict;
+    dict << "{'descr': '" << Descriptor<T>() << "', 'fortran_order': "
+         << ( fortranOrder ? "True" : "False" ) << ", 'shape': ("
+         << height << ", " << width << "), }";
+    string dictString = dict.str();
+    const Int preambleBytes = 10;
+    const Int unpadded = preambleBytes + dictString.size() + 1;
+    dictString.append( (64 - unpadded % 64) % 64, ' ' );
+    dictString.push_back( '\n' );
+    if( dictString.size() > 65535 )
+        LogicError("Header dictionary is too long");
+
+    string header( MAGIC, sizeof(MAGIC) );
+    header.push_back( char(1) );
+    header.push_back( char(0) );
+    header.push_back( char(dictString.size() & 0xFF) );
+    header.push_back( char(dictString.size() >> 8) );
+    return header + dictString;
+}
+
+} // namespace npy
+} // namespace El
+
+#endif // ifndef EL_IO_NPY_HPP
@@ -13,6 +13,8 @@
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
+#include "./Read/MPIIO.hpp"
+#include "./Read/Npy.hpp"
 
 namespace El {
 
@@ -63,11 +65,77 @@ void Read( Matrix<T>& A, const string filename, FileFormat format )
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
+    case NUMPY:
+        read::Npy( A, filename );
+        break;
     default:
         LogicError("Format unsupported for reading a Matrix");
     }
 }
 
+template<typename T>
+shared_ptr<MappedFile> ReadMapped
+( Matrix<T>& A, const string filename, FileFormat format, MapAdvice advice )
+{
+    EL_DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    auto mapping = make_shared<MappedFile>( filename, advice );
+    const char* data = mapping->Data();
+    const Int numBytes = mapping->Size();
+    Int height, width, dataOffset;
+    bool fortranOrder = true;
+    npy::Header header;
+    switch( format )
+    {
+    case BINARY:
+        dataOffset = 2*sizeof(Int);
+        if( numBytes < dataOffset )
+            RuntimeError("Truncated header in ",filename);
+        std::memcpy( &height, data, sizeof(Int) );
+        std::memcpy( &width, data+sizeof(Int), sizeof(Int) );
+        break;
+    case BINARY_FLAT:
+        dataOffset = 0;
+        height = A.Height();
+        width = A.Width();
+        break;
+    case NUMPY:
+        header = read::NpyHeader( data, numBytes, filename );
+        npy::CheckDescriptor<T>( header, filename );
+        dataOffset = header.dataOffset;
+        height = header.height;
+        width = header.width;
+        fortranOrder = header.fortranOrder;
+        break;
+    default:
+        LogicError("Format unsupported for mapped reading");
+    }
+    const Int numBytesExp = dataOffset + height*width*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+    const char* payload = data + dataOffset;
+    const bool aligned =
+      reinterpret_cast<std::uintptr_t>(payload) % alignof(T) == 0;
+    if( fortranOrder && aligned )
+    {
+        A.LockedAttach
+        ( height, width, reinterpret_cast<const T*>(payload),
+          Max(height,Int(1)) );
+    }
+    else
+    {
+        header.height = height;
+        header.width = width;
+        header.fortranOrder = fortranOrder;
+        read::NpyPayload( A, header, payload );
+    }
+    return mapping;
+}
+
 template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, const string filename, FileFormat format,
@@ -81,12 +149,17 @@ void Read
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
-            Read( A.Matrix(), filename, format );
-            A.Resize( A.Matrix().Height(), A.Matrix().Width() );
+            // The local matrix of a DistMatrix cannot be resized directly
+            Matrix<T> ALoc;
+            if( format == BINARY_FLAT )
+                ALoc.Resize( A.Height(), A.Width() );
+            Read( ALoc, filename, format );
+            A.Resize( ALoc.Height(), ALoc.Width() );
+            Copy( ALoc, A.Matrix() );
         }
         A.MakeSizeConsistent();
     }
-    else if( sequential )
+    else if( sequential || format == NUMPY )
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
         if( format == BINARY_FLAT )
@@ -111,10 +184,18 @@ void Read
             read::AsciiMatlab( A, filename );
             break;
         case BINARY:
-            read::Binary( A, filename );
+            if( mpiio::Supported( A ) )
+                read::MPIIO( A, filename, BINARY, ALL, ALL, -1 );
+            else
+                read::Binary( A, filename );
             break;
         case BINARY_FLAT:
-            read::BinaryFlat( A, A.Height(), A.Width(), filename );
+            if( mpiio::Supported( A ) )
+                read::MPIIO
+                ( A, filename, BINARY_FLAT,
+                  IR(0,A.Height()), IR(0,A.Width()), A.Height() );
+            else
+                read::BinaryFlat( A, A.Height(), A.Width(), filename );
             break;
         case MATRIX_MARKET:
             read::MatrixMarket( A, filename );
@@ -125,6 +206,31 @@ void Read
     }
 }
 
+template<typename T>
+void ReadSubmatrix
+( AbstractDistMatrix<T>& A, const string filename,
+  Range<Int> I, Range<Int> J, FileFormat format, Int fileHeight )
+{
+    EL_DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("ReadSubmatrix only supports BINARY and BINARY_FLAT");
+    if( mpiio::Supported( A ) )
+    {
+        read::MPIIO( A, filename, format, I, J, fileHeight );
+    }
+    else
+    {
+        if( !std::is_trivially_copyable<T>::value )
+            LogicError("ReadSubmatrix requires a trivially-copyable type");
+        // Read into an element-wise distribution and then redistribute
+        DistMatrix<T> AElem( A.Grid() );
+        read::MPIIO( AElem, filename, format, I, J, fileHeight );
+        Copy( AElem, A );
+    }
+}
+
 #ifdef HYDROGEN_GPU_USE_FP16
 template <>
 void Read<gpu_half_type>(
@@ -142,9 +248,15 @@ void Read<gpu_half_type>(
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const string filename, FileFormat format ); \
+  template shared_ptr<MappedFile> ReadMapped \
+  ( Matrix<T>& A, const string filename, FileFormat format, \
+    MapAdvice advice ); \
   template void Read \
   ( AbstractDistMatrix<T>& A, const string filename, \
-    FileFormat format, bool sequential );
+    FileFormat format, bool sequential ); \
+  template void ReadSubmatrix \
+  ( AbstractDistMatrix<T>& A, const string filename, \
+    Range<Int> I, Range<Int> J, FileFormat format, Int fileHeight );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
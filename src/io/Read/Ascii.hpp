@@ -9,120 +9,159 @@
 #ifndef EL_READ_ASCII_HPP
 #define EL_READ_ASCII_HPP
 
-#include <fstream>
-#include <iostream>
-#include <sstream>
-#include <string>
+#include "./Text.hpp"
 
 namespace El {
 namespace read {
+namespace ascii {
 
+// The rows stored within a line-aligned piece of an ASCII file
 template<typename T>
-inline void
-Ascii( Matrix<T>& A, string const& filename )
+struct Rows
 {
-    EL_DEBUG_CSE
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
+    vector<T> values;
     Int height=0, width=0;
-    std::string line;
-    for ( ;; )
-    {
-        if (!std::getline( file, line ))
-            break;
+};
 
-        std::stringstream lineStream( line );
-        Int numCols=0;
+// Parse the lines within [beg,end), each of which is a row of the matrix;
+// blank lines are skipped
+template<typename T>
+const char* Parse( const char* beg, const char* end, Rows<T>& rows )
+{
+    const char* p = beg;
+    while( p != end )
+    {
+        if( text::AtLineEnd( p, end ) )
+        {
+            text::NextLine( p, end );
+            continue;
+        }
+        const char* lineStart = p;
+        Int numCols = 0;
         T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
+        while( !text::AtLineEnd( p, end ) )
         {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
+            if( !text::ParseNumber( p, end, value ) )
+                return lineStart;
+            rows.values.push_back( value );
+            ++numCols;
         }
+        if( rows.height != 0 && numCols != rows.width )
+            return lineStart;
+        rows.width = numCols;
+        ++rows.height;
+        text::NextLine( p, end );
     }
-    file.clear();
-    file.seekg(0,file.beg);
+    return nullptr;
+}
 
-    // Resize the matrix and then read it
-    A.Resize( height, width );
-    Int i=0;
-    for ( ;; )
+template<typename T>
+vector<Rows<T>>
+ParseRange( const char* beg, const char* end, const string& filename )
+{
+    return text::ParseChunks<Rows<T>>
+    ( beg, end,
+      []( const char* chunkBeg, const char* chunkEnd, Rows<T>& rows )
+      { return Parse( chunkBeg, chunkEnd, rows ); },
+      filename );
+}
+
+// Return the common width of the (nonempty) pieces, or -1 if they disagree
+template<typename T>
+Int CommonWidth( const vector<Rows<T>>& pieces )
+{
+    Int width = 0;
+    for( const auto& rows : pieces )
     {
-        if (!std::getline(file, line))
-            break;
+        if( rows.height == 0 )
+            continue;
+        if( width != 0 && rows.width != width )
+            return -1;
+        width = rows.width;
+    }
+    return width;
+}
 
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
+} // namespace ascii
+
+template<typename T>
+inline void
+Ascii( Matrix<T>& A, string const& filename )
+{
+    EL_DEBUG_CSE
+    MappedFile file( filename, ADVISE_SEQUENTIAL );
+    const auto pieces =
+      ascii::ParseRange<T>( file.Data(), file.Data()+file.Size(), filename );
+    const Int width = ascii::CommonWidth( pieces );
+    if( width < 0 )
+        LogicError("Inconsistent number of columns");
+
+    const Int numPieces = pieces.size();
+    vector<Int> offsets(numPieces+1,0);
+    for( Int piece=0; piece<numPieces; ++piece )
+        offsets[piece+1] = offsets[piece] + pieces[piece].height;
+
+    // Resize the matrix and then copy each piece into its rows
+    A.Resize( offsets[numPieces], width );
+    EL_PARALLEL_FOR
+    for( Int piece=0; piece<numPieces; ++piece )
+    {
+        const auto& rows = pieces[piece];
+        for( Int iLoc=0; iLoc<rows.height; ++iLoc )
+            for( Int j=0; j<width; ++j )
+                A.Set( offsets[piece]+iLoc, j, rows.values[iLoc*width+j] );
     }
 }
 
+// Each process parses a line-aligned byte range of the file and queues its
+// rows for their owners
 template<typename T>
 inline void
 Ascii( AbstractDistMatrix<T>& A, string const& filename )
 {
     EL_DEBUG_CSE
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    const mpi::Comm& comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    SyncInfo<Device::CPU> syncInfo;
 
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
-    Int height=0, width=0;
-    string line;
-    for ( ;; )
-    {
-        if (!std::getline(file, line))
-            break;
+    MappedFile file( filename );
+    const char* data = file.Data();
+    const auto ranges = text::SplitLines( data, data+file.Size(), commSize );
+    const char* beg = ranges[commRank];
+    const char* end = ranges[commRank+1];
+    file.Advise( ADVISE_SEQUENTIAL, beg-data, end-beg );
 
-        std::stringstream lineStream( line );
-        Int numCols=0;
-        T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
-        {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
-        }
-    }
-    file.clear();
-    file.seekg(0,file.beg);
+    // Errors must be agreed upon before entering the collective redistribution
+    string error;
+    vector<ascii::Rows<T>> pieces;
+    try { pieces = ascii::ParseRange<T>( beg, end, filename ); }
+    catch( std::exception& e ) { error = e.what(); }
+    if( mpi::AllReduce( int(!error.empty()), mpi::MAX, comm, syncInfo ) )
+        RuntimeError
+        (error.empty() ? "Another process could not parse "+filename : error);
 
-    // Resize the matrix and then read in our local portion
-    A.Resize( height, width );
-    Int i=0;
-    for ( ;; )
-    {
-        if (!std::getline(file, line))
-            break;
+    const Int localWidth = ascii::CommonWidth( pieces );
+    const Int width = mpi::AllReduce( localWidth, mpi::MAX, comm, syncInfo );
+    const bool consistent = ( localWidth == width || localWidth == 0 );
+    if( !mpi::AllReduce( int(consistent), mpi::MIN, comm, syncInfo ) )
+        LogicError("Inconsistent number of columns");
 
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
-    }
+    Int localHeight = 0;
+    for( const auto& rows : pieces )
+        localHeight += rows.height;
+    const Int height = mpi::AllReduce( localHeight, mpi::SUM, comm, syncInfo );
+    Int i = mpi::Scan( localHeight, comm ) - localHeight;
+
+    // Resize the matrix and then queue our rows for their owners
+    A.Resize( height, width );
+    Zero( A );
+    A.Reserve( localHeight*width );
+    for( const auto& rows : pieces )
+        for( Int iLoc=0; iLoc<rows.height; ++iLoc, ++i )
+            for( Int j=0; j<width; ++j )
+                A.QueueUpdate( i, j, rows.values[iLoc*width+j] );
+    A.ProcessQueues();
 }
 
 } // namespace read
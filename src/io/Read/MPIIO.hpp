@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_MPIIO_HPP
+#define EL_READ_MPIIO_HPP
+
+#include "../MPIIO.hpp"
+
+namespace El {
+namespace read {
+
+// Collectively read the submatrix (I,J) of a matrix stored in the BINARY or
+// BINARY_FLAT format, with each process reading its own entries directly from
+// their offsets within the file. Since BINARY_FLAT files do not contain their
+// dimensions, the height of the stored matrix must then be provided.
+template<typename T>
+inline void
+MPIIO
+( AbstractDistMatrix<T>& A, const string filename, FileFormat format,
+  Range<Int> I, Range<Int> J, Int fileHeight )
+{
+    EL_DEBUG_CSE
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("MPI-IO is only supported for BINARY and BINARY_FLAT");
+    const mpi::Comm& comm = A.Grid().ViewingComm();
+    MPI_File file = mpiio::Open( comm, filename, MPI_MODE_RDONLY );
+    const MPI_Offset numBytes = mpiio::FileSize( file );
+    const MPI_Offset entryBytes = sizeof(T);
+
+    MPI_Offset headerBytes = 0;
+    Int fileWidth;
+    if( format == BINARY )
+    {
+        Int dims[2];
+        headerBytes = 2*sizeof(Int);
+        if( numBytes < headerBytes )
+        {
+            mpiio::Close( file );
+            RuntimeError
+            ("File of ",numBytes," bytes is too small to hold a header");
+        }
+        EL_CHECK_MPI_CALL
+        ( MPI_File_read_at_all
+          ( file, 0, dims, int(headerBytes), MPI_BYTE, MPI_STATUS_IGNORE ) );
+        fileHeight = dims[0];
+        fileWidth = dims[1];
+        // Compare the dimensions against the size of the file by division so
+        // that a corrupt header cannot overflow the expected size
+        const MPI_Offset numEntries = (numBytes-headerBytes) / entryBytes;
+        const bool consistent =
+          fileHeight >= 0 && fileWidth >= 0 &&
+          (numBytes-headerBytes) % entryBytes == 0 &&
+          ( fileHeight == 0 || fileWidth == 0 ?
+            numEntries == 0 :
+            numEntries % fileHeight == 0 &&
+            numEntries / fileHeight == MPI_Offset(fileWidth) );
+        if( !consistent )
+        {
+            mpiio::Close( file );
+            RuntimeError
+            ("Header of ",filename," describes a ",fileHeight," x ",fileWidth,
+             " matrix, which is inconsistent with the file size of ",
+             numBytes," bytes");
+        }
+    }
+    else
+    {
+        if( fileHeight < 0 )
+        {
+            mpiio::Close( file );
+            LogicError("The height of a BINARY_FLAT matrix must be provided");
+        }
+        const MPI_Offset columnBytes = MPI_Offset(fileHeight)*entryBytes;
+        fileWidth = ( columnBytes == 0 ? 0 : Int(numBytes / columnBytes) );
+        if( MPI_Offset(fileWidth)*columnBytes != numBytes )
+        {
+            mpiio::Close( file );
+            RuntimeError
+            ("File of ",numBytes," bytes is not a multiple of columns of ",
+             "height ",fileHeight);
+        }
+    }
+    if( I.end == END )
+        I.end = fileHeight;
+    if( J.end == END )
+        J.end = fileWidth;
+    if( I.beg < 0 || I.beg > I.end || I.end > fileHeight ||
+        J.beg < 0 || J.beg > J.end || J.end > fileWidth )
+    {
+        mpiio::Close( file );
+        LogicError
+        ("Submatrix [",I.beg,",",I.end,") x [",J.beg,",",J.end,") is not "
+         "contained in the ",fileHeight," x ",fileWidth," stored matrix");
+    }
+
+    // Every member of a redundant set reads its own copy of its entries
+    A.Resize( I.end-I.beg, J.end-J.beg );
+    mpiio::View view( A, A.Participating(), fileHeight, I.beg, J.beg,
+                      headerBytes );
+    view.Set( file );
+    EL_CHECK_MPI_CALL
+    ( MPI_File_read_all
+      ( file, A.Buffer(), view.Count(), view.MemoryType(),
+        MPI_STATUS_IGNORE ) );
+    mpiio::Close( file );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_MPIIO_HPP
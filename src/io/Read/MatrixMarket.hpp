@@ -9,27 +9,41 @@
 #ifndef EL_READ_MATRIXMARKET_HPP
 #define EL_READ_MATRIXMARKET_HPP
 
+#include "./Text.hpp"
+
 namespace El {
 namespace read {
+namespace mm {
+
+struct Header
+{
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isGeneral, isSymmetric, isSkewSymmetric, isHermitian;
+    Int height, width;
+    // The number of data lines (nonzeros or stored array entries)
+    Int numEntries;
+    // The offset of the first data line
+    Int dataOffset;
+};
 
 template<typename T>
-void MatrixMarket( Matrix<T>& A, const string filename )
+Header ParseHeader( const char* data, Int numBytes, const string& filename )
 {
     EL_DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    const char* end = data + numBytes;
+    const char* p = data;
 
-    // Read the header
+    // Read the banner
     // ===============
     // Attempt to pull in the various header components
     // ------------------------------------------------
-    string line, stamp, object, format, field, symmetry;
-    if( !std::getline( file, line ) )
-        RuntimeError("Could not extract header line");
+    const char* lineStart = p;
+    text::NextLine( p, end );
+    if( p == lineStart )
+        RuntimeError("Could not extract header line of ",filename);
+    string stamp, object, format, field, symmetry;
     {
-        std::stringstream lineStream( line );
+        std::istringstream lineStream( string( lineStart, p ) );
         lineStream >> stamp;
         if( stamp != string("%%MatrixMarket") )
             RuntimeError("Invalid Matrix Market stamp: ",stamp);
@@ -44,192 +58,379 @@ void MatrixMarket( Matrix<T>& A, const string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
-    const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    Header header;
+    header.isMatrix = ( object == string("matrix") );
+    header.isArray = ( format == string("array") );
+    header.isComplex = ( field == string("complex") );
+    header.isPattern = ( field == string("pattern") );
+    header.isGeneral = ( symmetry == string("general") );
+    header.isSymmetric = ( symmetry == string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    header.isHermitian = ( symmetry == string("hermitian") );
+    if( !header.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !header.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern &&
+    if( !header.isComplex && !header.isPattern &&
         field != string("real") &&
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !header.isGeneral && !header.isSymmetric &&
+        !header.isSkewSymmetric && !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( header.isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
+    if( header.isComplex && !IsComplex<T>::value )
+        LogicError("Cannot read complex Matrix Market data into a real matrix");
 
     // Skip the comment lines
     // ======================
-    while( file.peek() == '%' )
-        std::getline( file, line );
+    while( p != end && *p == '%' )
+        text::NextLine( p, end );
 
-    int m, n;
-    if( !std::getline( file, line ) )
+    // Read the size line
+    // ==================
+    if( p == end )
         RuntimeError("Could not extract the size line");
-    if( isArray )
+    lineStart = p;
+    text::NextLine( p, end );
     {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-        }
+        const string line( lineStart, p );
+        std::istringstream lineStream( line );
+        if( !(lineStream >> header.height) )
+            RuntimeError("Missing height: ",line);
+        header.width = 1;
+        if( header.isMatrix && !(lineStream >> header.width) )
+            RuntimeError("Missing matrix width: ",line);
+        if( !header.isArray && !(lineStream >> header.numEntries) )
+            RuntimeError("Missing nonzeros entry: ",line);
+    }
+    header.dataOffset = p - data;
+
+    // Only the lower triangle of a symmetric or Hermitian array is stored,
+    // and only the strictly lower triangle of a skew-symmetric one
+    const Int m = header.height;
+    const Int n = header.width;
+    if( !header.isGeneral && m != n )
+        RuntimeError("Symmetric Matrix Market matrices must be square");
+    if( header.isArray )
+    {
+        if( header.isGeneral )
+            header.numEntries = m*n;
+        else if( header.isSkewSymmetric )
+            header.numEntries = (n*(n-1))/2;
         else
+            header.numEntries = (n*(n+1))/2;
+    }
+    return header;
+}
+
+// Extract the (possibly complex) value of an entry
+template<typename T>
+bool ParseValue( const char*& p, const char* end, const Header& header, T& value )
+{
+    if( header.isPattern )
+    {
+        value = T(1);
+        return true;
+    }
+    Base<T> realPart;
+    if( !text::ParseNumber( p, end, realPart ) )
+        return false;
+    value = realPart;
+    if( header.isComplex )
+    {
+        Base<T> imagPart;
+        if( !text::ParseNumber( p, end, imagPart ) )
+            return false;
+        SetImagPart( value, imagPart );
+    }
+    return true;
+}
+
+// Parse the coordinate-format lines within [beg,end)
+template<typename T>
+const char* ParseCoordinate
+( const char* beg, const char* end, const Header& header,
+  vector<Entry<T>>& entries )
+{
+    const char* p = beg;
+    while( p != end )
+    {
+        if( text::AtLineEnd( p, end ) || *p == '%' )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
+            text::NextLine( p, end );
+            continue;
         }
+        const char* lineStart = p;
+        Int i, j=1;
+        T value;
+        if( !text::ParseNumber( p, end, i ) ||
+            (header.isMatrix && !text::ParseNumber( p, end, j )) ||
+            !ParseValue( p, end, header, value ) )
+            return lineStart;
+        // Convert from Fortran to C indexing
+        --i; --j;
+        if( i < 0 || i >= header.height || j < 0 || j >= header.width )
+            return lineStart;
+        entries.push_back( Entry<T>{ i, j, value } );
+        text::NextLine( p, end );
+    }
+    return nullptr;
+}
 
-        // Resize the matrix
-        // =================
-        Zeros( A, m, n );
-
-        // Now read in the data
-        // ====================
-        Real realPart, imagPart;
-        for( Int j=0; j<n; ++j )
+// Parse the array-format lines within [beg,end)
+template<typename T>
+const char* ParseArray
+( const char* beg, const char* end, const Header& header, vector<T>& values )
+{
+    const char* p = beg;
+    while( p != end )
+    {
+        if( text::AtLineEnd( p, end ) || *p == '%' )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                if( !std::getline( file, line ) )
-                    RuntimeError("Could not get entry (",i,",",j,")");
-                std::stringstream lineStream( line );
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.SetRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.SetImagPart( i, j, imagPart );
-                }
-            }
+            text::NextLine( p, end );
+            continue;
         }
+        const char* lineStart = p;
+        T value;
+        if( !ParseValue( p, end, header, value ) )
+            return lineStart;
+        values.push_back( value );
+        text::NextLine( p, end );
     }
-    else
+    return nullptr;
+}
+
+// Walks the (column-major) sequence of entries stored in an array-format file
+class ArrayCursor
+{
+public:
+    // Position the cursor on the k'th stored entry
+    ArrayCursor( const Header& header, Int k )
+    : height_(header.height),
+      offset_(header.isGeneral ? -1 : header.isSkewSymmetric ? 1 : 0)
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
+        if( offset_ < 0 )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
+            j_ = ( height_ == 0 ? 0 : k / height_ );
+            i_ = k - j_*height_;
+            return;
         }
-        else
+        i_ = offset_;
+        while( j_ < header.width && k >= height_-(j_+offset_) )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
+            k -= height_-(j_+offset_);
+            ++j_;
         }
+        i_ = j_+offset_+k;
+    }
 
-        // Create a matrix of zeros
-        // ========================
-        Zeros( A, m, n );
+    Int Row() const EL_NO_EXCEPT { return i_; }
+    Int Col() const EL_NO_EXCEPT { return j_; }
 
-        // Fill in the nonzero entries
-        // ===========================
-        int i, j;
-        Real realPart, imagPart;
-        for( Int k=0; k<numNonzero; ++k )
+    void Next() EL_NO_EXCEPT
+    {
+        if( ++i_ == height_ )
         {
-            if( !std::getline( file, line ) )
-                RuntimeError("Could not get nonzero ",k);
-            std::stringstream lineStream( line );
-            if( !(lineStream >> i) )
-                RuntimeError("Could not extract row coordinate of nonzero ",k);
-            --i; // convert from Fortran to C indexing
-            if( isMatrix )
-            {
-                if( !(lineStream >> j) )
-                    RuntimeError
-                    ("Could not extract col coordinate of nonzero ",k);
-                --j;
-            }
-            else
-                j = 0;
+            ++j_;
+            i_ = ( offset_ < 0 ? 0 : j_+offset_ );
+        }
+    }
 
-            if( isPattern )
-            {
-                A.Set( i, j, T(1) );
-            }
-            else
+private:
+    Int height_, offset_, i_=0, j_=0;
+};
+
+// Apply 'update' to an entry and, for symmetric storage, its mirror image
+template<typename T,class UpdateFunction>
+void Expand( const Header& header, Int i, Int j, T value, UpdateFunction& update )
+{
+    if( i == j )
+    {
+        update( i, j, header.isHermitian ? T(RealPart(value)) : value );
+        return;
+    }
+    update( i, j, value );
+    if( header.isSymmetric )
+        update( j, i, value );
+    else if( header.isHermitian )
+        update( j, i, Conj(value) );
+    else if( header.isSkewSymmetric )
+        // I'm not certain of what the MM standard is for complex
+        // skew-symmetry, so I'll default to assuming no conjugation
+        update( j, i, -value );
+}
+
+} // namespace mm
+
+template<typename T>
+void MatrixMarket( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    MappedFile file( filename, ADVISE_SEQUENTIAL );
+    const char* data = file.Data();
+    const char* end = data + file.Size();
+    const mm::Header header = mm::ParseHeader<T>( data, file.Size(), filename );
+    const char* beg = data + header.dataOffset;
+    Zeros( A, header.height, header.width );
+
+    if( header.isArray )
+    {
+        auto chunks =
+          text::ParseChunks<vector<T>>
+          ( beg, end,
+            [&]( const char* chunkBeg, const char* chunkEnd, vector<T>& values )
+            { return mm::ParseArray( chunkBeg, chunkEnd, header, values ); },
+            filename );
+        const Int numChunks = chunks.size();
+        vector<Int> offsets(numChunks+1,0);
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+            offsets[chunk+1] = offsets[chunk] + chunks[chunk].size();
+        if( offsets[numChunks] != header.numEntries )
+            RuntimeError
+            ("Expected ",header.numEntries," entries but found ",
+             offsets[numChunks]);
+
+        // The chunks (and the mirror images of their entries) are disjoint
+        auto set = [&]( Int i, Int j, const T& value ) { A.Set( i, j, value ); };
+        EL_PARALLEL_FOR
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            mm::ArrayCursor cursor( header, offsets[chunk] );
+            for( const T& value : chunks[chunk] )
             {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.UpdateRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.UpdateImagPart( i, j, imagPart );
-                }
+                mm::Expand( header, cursor.Row(), cursor.Col(), value, set );
+                cursor.Next();
             }
         }
     }
-
-    if( isSymmetric )
-        MakeSymmetric( LOWER, A );
-    if( isHermitian )
-        MakeHermitian( LOWER, A );
-    // I'm not certain of what the MM standard is for complex skew-symmetry,
-    // so I'll default to assuming no conjugation
-    const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    else
     {
-        MakeSymmetric( LOWER, A, conjugateSkew );
-        ScaleTrapezoid( T(-1), UPPER, A, 1 );
+        auto chunks =
+          text::ParseChunks<vector<Entry<T>>>
+          ( beg, end,
+            [&]( const char* chunkBeg, const char* chunkEnd,
+                 vector<Entry<T>>& entries )
+            {
+                return mm::ParseCoordinate
+                ( chunkBeg, chunkEnd, header, entries );
+            },
+            filename );
+        Int numEntries = 0;
+        for( const auto& entries : chunks )
+            numEntries += entries.size();
+        if( numEntries != header.numEntries )
+            RuntimeError
+            ("Expected ",header.numEntries," nonzeros but found ",numEntries);
+
+        // Duplicate entries are summed, so they are applied in file order
+        auto update =
+          [&]( Int i, Int j, const T& value ) { A.Update( i, j, value ); };
+        for( const auto& entries : chunks )
+            for( const auto& entry : entries )
+                mm::Expand( header, entry.i, entry.j, entry.value, update );
     }
 }
 
+// Each process parses a line-aligned byte range of the file and queues its
+// entries for their owners, so that no single process reads the entire file.
 template<typename T>
 void MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
-    // TODO: Use a WriteProxy instead
-    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    const mpi::Comm& comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    MappedFile file( filename );
+    const char* data = file.Data();
+    const char* end = data + file.Size();
+    const mm::Header header = mm::ParseHeader<T>( data, file.Size(), filename );
+    const auto ranges =
+      text::SplitLines( data+header.dataOffset, end, commSize );
+    const char* beg = ranges[commRank];
+    end = ranges[commRank+1];
+    file.Advise( ADVISE_SEQUENTIAL, beg-data, end-beg );
+
+    A.Resize( header.height, header.width );
+    Zero( A );
+
+    // Errors must be agreed upon before entering the collective redistribution
+    string error;
+    vector<vector<T>> arrayChunks;
+    vector<vector<Entry<T>>> coordinateChunks;
+    try
+    {
+        if( header.isArray )
+            arrayChunks =
+              text::ParseChunks<vector<T>>
+              ( beg, end,
+                [&]( const char* chunkBeg, const char* chunkEnd,
+                     vector<T>& values )
+                { return mm::ParseArray( chunkBeg, chunkEnd, header, values ); },
+                filename );
+        else
+            coordinateChunks =
+              text::ParseChunks<vector<Entry<T>>>
+              ( beg, end,
+                [&]( const char* chunkBeg, const char* chunkEnd,
+                     vector<Entry<T>>& entries )
+                {
+                    return mm::ParseCoordinate
+                    ( chunkBeg, chunkEnd, header, entries );
+                },
+                filename );
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    if( mpi::AllReduce( int(!error.empty()), mpi::MAX, comm, syncInfo ) )
+        RuntimeError
+        (error.empty() ? "Another process could not parse "+filename : error);
+
+    Int numLocalEntries = 0;
+    for( const auto& values : arrayChunks )
+        numLocalEntries += values.size();
+    for( const auto& entries : coordinateChunks )
+        numLocalEntries += entries.size();
+    const Int numEntries =
+      mpi::AllReduce( numLocalEntries, mpi::SUM, comm, syncInfo );
+    if( numEntries != header.numEntries )
+        RuntimeError
+        ("Expected ",header.numEntries," entries but found ",numEntries);
+
+    A.Reserve( header.isGeneral ? numLocalEntries : 2*numLocalEntries );
+    auto queue =
+      [&]( Int i, Int j, const T& value ) { A.QueueUpdate( i, j, value ); };
+    if( header.isArray )
+    {
+        const Int offset = mpi::Scan( numLocalEntries, comm ) - numLocalEntries;
+        mm::ArrayCursor cursor( header, offset );
+        for( const auto& values : arrayChunks )
+        {
+            for( const T& value : values )
+            {
+                mm::Expand( header, cursor.Row(), cursor.Col(), value, queue );
+                cursor.Next();
+            }
+        }
+    }
+    else
     {
-        MatrixMarket( A_CIRC_CIRC.Matrix(), filename );
-        A_CIRC_CIRC.Resize
-        ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+        for( const auto& entries : coordinateChunks )
+            for( const auto& entry : entries )
+                mm::Expand( header, entry.i, entry.j, entry.value, queue );
     }
-    A_CIRC_CIRC.MakeSizeConsistent();
-    Copy( A_CIRC_CIRC, A );
+    A.ProcessQueues();
 }
 
 } // namespace read
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_NPY_HPP
+#define EL_READ_NPY_HPP
+
+#include "../Npy.hpp"
+
+namespace El {
+namespace read {
+
+// Return the total length of the preamble and header dictionary of a NumPy
+// .npy file given (at least) its first twelve bytes
+inline Int
+NpyHeaderBytes( const char* data, Int numBytes, const string& filename )
+{
+    const Int preambleBytes = 10;
+    if( numBytes < preambleBytes ||
+        std::memcmp( data, npy::MAGIC, sizeof(npy::MAGIC) ) != 0 )
+        RuntimeError(filename," is not a NumPy .npy file");
+
+    const unsigned char major = data[6];
+    if( major == 1 )
+        return preambleBytes + (Int((unsigned char)data[8]) |
+                                (Int((unsigned char)data[9]) << 8));
+    if( major != 2 && major != 3 )
+        RuntimeError("Unsupported .npy version ",Int(major)," in ",filename);
+    if( numBytes < preambleBytes+2 )
+        RuntimeError("Truncated header in ",filename);
+    Int dictBytes = 0;
+    for( Int k=3; k>=0; --k )
+        dictBytes = (dictBytes << 8) | Int((unsigned char)data[8+k]);
+    return preambleBytes + 2 + dictBytes;
+}
+
+// Parse the header of a NumPy .npy file from its first 'numBytes' bytes
+inline npy::Header
+NpyHeader( const char* data, Int numBytes, const string& filename )
+{
+    EL_DEBUG_CSE
+    const Int headerBytes = NpyHeaderBytes( data, numBytes, filename );
+    if( numBytes < headerBytes )
+        RuntimeError("Truncated header in ",filename);
+    const Int dictOffset = ( data[6] == 1 ? 10 : 12 );
+
+    npy::Header header;
+    header.dataOffset = headerBytes;
+    npy::ParseDictionary
+    ( string( data+dictOffset, headerBytes-dictOffset ), header, filename );
+    return header;
+}
+
+// Copy the payload of a .npy file into A, transposing if it is in C order
+template<typename T>
+inline void
+NpyPayload
+( Matrix<T>& A, const npy::Header& header, const char* payload )
+{
+    EL_DEBUG_CSE
+    const Int height = header.height;
+    const Int width = header.width;
+    A.Resize( height, width );
+    if( header.fortranOrder )
+    {
+        for( Int j=0; j<width; ++j )
+            std::memcpy
+            ( A.Buffer(0,j), payload+j*height*sizeof(T), height*sizeof(T) );
+    }
+    else
+    {
+        T* ABuf = A.Buffer();
+        const Int ALDim = A.LDim();
+        EL_PARALLEL_FOR
+        for( Int i=0; i<height; ++i )
+            for( Int j=0; j<width; ++j )
+                std::memcpy
+                ( &ABuf[i+j*ALDim], payload+(i*width+j)*sizeof(T),
+                  sizeof(T) );
+    }
+}
+
+template<typename T>
+inline void
+Npy( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int numBytes = FileSize( file );
+
+    char preamble[12];
+    const Int preambleBytes = Min(numBytes,Int(sizeof(preamble)));
+    file.read( preamble, preambleBytes );
+    const Int headerBytes = NpyHeaderBytes( preamble, preambleBytes, filename );
+    if( headerBytes > numBytes )
+        RuntimeError("Truncated header in ",filename);
+    vector<char> prefix( headerBytes );
+    file.seekg( 0 );
+    file.read( prefix.data(), headerBytes );
+    const npy::Header header = NpyHeader( prefix.data(), headerBytes, filename );
+    npy::CheckDescriptor<T>( header, filename );
+    const Int numBytesExp =
+      header.dataOffset + header.height*header.width*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+    vector<char> payload( numBytes-header.dataOffset );
+    file.seekg( header.dataOffset );
+    file.read( payload.data(), payload.size() );
+    NpyPayload( A, header, payload.data() );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_NPY_HPP
@@ -0,0 +1,351 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_TEXT_HPP
+#define EL_READ_TEXT_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace El {
+namespace read {
+namespace text {
+
+// Helpers for parsing whitespace-delimited numbers directly out of a (mapped)
+// text file. Rather than streaming one value at a time through a
+// std::stringstream, the file is split into line-aligned chunks which are
+// parsed independently, either by separate threads or by separate processes.
+
+// The target size of each chunk parsed by a single thread
+const Int CHUNK_BYTES = Int(1) << 22;
+
+inline bool IsBlank( char c ) { return c == ' ' || c == '\t' || c == '\r'; }
+inline bool IsDigit( char c ) { return c >= '0' && c <= '9'; }
+
+inline void SkipBlanks( const char*& p, const char* end )
+{
+    while( p != end && IsBlank(*p) )
+        ++p;
+}
+
+// Whether only blanks remain before the end of the current line
+inline bool AtLineEnd( const char*& p, const char* end )
+{
+    SkipBlanks( p, end );
+    return p == end || *p == '\n';
+}
+
+// Advance to the beginning of the next line
+inline void NextLine( const char*& p, const char* end )
+{
+    const void* newline = std::memchr( p, '\n', end-p );
+    p = ( newline == nullptr ? end : static_cast<const char*>(newline)+1 );
+}
+
+// Return the first line beginning at or after 'p' within [beg,end)
+inline const char* AlignToLine( const char* beg, const char* p, const char* end )
+{
+    if( p <= beg )
+        return beg;
+    if( p >= end )
+        return end;
+    p = p-1;
+    NextLine( p, end );
+    return p;
+}
+
+// Split [beg,end) into 'numPieces' line-aligned pieces of (roughly) equal size,
+// returning the numPieces+1 boundaries
+inline vector<const char*>
+SplitLines( const char* beg, const char* end, Int numPieces )
+{
+    const Int numBytes = end-beg;
+    vector<const char*> splits(numPieces+1);
+    for( Int piece=0; piece<=numPieces; ++piece )
+        splits[piece] = AlignToLine( beg, beg+(numBytes*piece)/numPieces, end );
+    return splits;
+}
+
+// The number of chunks to split a buffer of the given size into
+inline Int NumChunks( Int numBytes )
+{
+#ifdef EL_HYBRID
+    const Int numThreads = omp_get_max_threads();
+#else
+    const Int numThreads = 1;
+#endif
+    if( numThreads == 1 )
+        return 1;
+    return Max( Min( numBytes/CHUNK_BYTES, 8*numThreads ), Int(1) );
+}
+
+// A short excerpt of the text at 'p' for error messages
+inline string Excerpt( const char* p, const char* end )
+{
+    const char* q = p;
+    while( q != end && *q != '\n' && q-p < 40 )
+        ++q;
+    return string( p, q );
+}
+
+// Parse the line-aligned chunks of [beg,end) in parallel. The function
+// 'parse' fills a Chunk from the lines of a subrange and returns the start of
+// the first line which it could not parse (or nullptr upon success).
+template<class Chunk,class ParseFunction>
+vector<Chunk> ParseChunks
+( const char* beg, const char* end, ParseFunction parse,
+  const string& filename )
+{
+    EL_DEBUG_CSE
+    const Int numChunks = NumChunks( end-beg );
+    const auto splits = SplitLines( beg, end, numChunks );
+    vector<Chunk> chunks(numChunks);
+    vector<const char*> failures(numChunks,nullptr);
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        failures[chunk] = parse( splits[chunk], splits[chunk+1], chunks[chunk] );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        if( failures[chunk] != nullptr )
+            RuntimeError
+            ("Could not parse \"",Excerpt(failures[chunk],end),"\" in ",
+             filename);
+    return chunks;
+}
+
+// The parameters of the exact fast path for each floating-point type: a
+// decimal significand of at most SignificandBits bits and a power of ten of
+// at most MaxExponent in magnitude are both exactly representable
+template<typename Real> struct FastPath;
+template<> struct FastPath<double>
+{
+    static constexpr int SignificandBits = 53;
+    static constexpr Int MaxExponent = 22;
+    static double PowerOfTen( Int exponent )
+    {
+        static const double powersOfTen[] =
+          { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+            1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+            1e22 };
+        return powersOfTen[exponent];
+    }
+    static double StrTo( const char* str, char** strEnd )
+    { return std::strtod( str, strEnd ); }
+};
+template<> struct FastPath<float>
+{
+    static constexpr int SignificandBits = 24;
+    static constexpr Int MaxExponent = 10;
+    static float PowerOfTen( Int exponent )
+    {
+        static const float powersOfTen[] =
+          { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        return powersOfTen[exponent];
+    }
+    static float StrTo( const char* str, char** strEnd )
+    { return std::strtof( str, strEnd ); }
+};
+
+// Fall back to the C library for anything outside of the fast path (e.g.,
+// more than 19 significant digits, extreme exponents, 'inf', or 'nan')
+template<typename Real>
+bool ParseSlow( const char*& p, const char* end, Real& value )
+{
+    const char* tokenEnd = p;
+    while( tokenEnd != end && !IsBlank(*tokenEnd) && *tokenEnd != '\n' &&
+           *tokenEnd != ',' && *tokenEnd != ')' )
+        ++tokenEnd;
+    const string token( p, tokenEnd );
+    char* parseEnd;
+    value = FastPath<Real>::StrTo( token.c_str(), &parseEnd );
+    if( parseEnd == token.c_str() )
+        return false;
+    p += parseEnd - token.c_str();
+    return true;
+}
+
+// Parse a floating-point number directly into the target precision (so that
+// single-precision values are not rounded twice). When the decimal
+// significand and the power of ten are both exactly representable, a single
+// (correctly-rounded) multiplication or division yields the correctly-rounded
+// result [Clinger, "How to read floating point numbers accurately", PLDI
+// 1990].
+template<typename Real,typename=EnableIf<std::is_floating_point<Real>>>
+bool ParseNumber( const char*& p, const char* end, Real& value )
+{
+    SkipBlanks( p, end );
+    const char* start = p;
+    bool negative = false;
+    if( p != end && (*p == '-' || *p == '+') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+    std::uint64_t significand = 0;
+    Int numDigits = 0, exponent = 0;
+    bool anyDigits = false, truncated = false;
+    for( ; p != end && IsDigit(*p); ++p )
+    {
+        anyDigits = true;
+        if( numDigits < 19 )
+        {
+            significand = 10*significand + (*p-'0');
+            numDigits += ( significand != 0 );
+        }
+        else
+        {
+            truncated = truncated || *p != '0';
+            ++exponent;
+        }
+    }
+    if( p != end && *p == '.' )
+    {
+        for( ++p; p != end && IsDigit(*p); ++p )
+        {
+            anyDigits = true;
+            if( numDigits < 19 )
+            {
+                significand = 10*significand + (*p-'0');
+                numDigits += ( significand != 0 );
+                --exponent;
+            }
+            else
+                truncated = truncated || *p != '0';
+        }
+    }
+    if( !anyDigits )
+    {
+        p = start;
+        return ParseSlow( p, end, value );
+    }
+    if( p != end && (*p == 'e' || *p == 'E') )
+    {
+        const char* exponentStart = p;
+        ++p;
+        bool negativeExponent = false;
+        if( p != end && (*p == '-' || *p == '+') )
+        {
+            negativeExponent = ( *p == '-' );
+            ++p;
+        }
+        if( p == end || !IsDigit(*p) )
+        {
+            p = exponentStart;
+        }
+        else
+        {
+            Int explicitExponent = 0;
+            for( ; p != end && IsDigit(*p); ++p )
+                if( explicitExponent < 100000 )
+                    explicitExponent = 10*explicitExponent + (*p-'0');
+            exponent += ( negativeExponent ? -explicitExponent
+                                           :  explicitExponent );
+        }
+    }
+    typedef FastPath<Real> Fast;
+    if( truncated ||
+        significand > (std::uint64_t(1) << Fast::SignificandBits) ||
+        exponent < -Fast::MaxExponent || exponent > Fast::MaxExponent )
+    {
+        p = start;
+        return ParseSlow( p, end, value );
+    }
+    Real result = Real(significand);
+    if( exponent < 0 )
+        result /= Fast::PowerOfTen(-exponent);
+    else
+        result *= Fast::PowerOfTen(exponent);
+    value = ( negative ? -result : result );
+    return true;
+}
+
+inline bool ParseNumber( const char*& p, const char* end, Int& value )
+{
+    SkipBlanks( p, end );
+    const char* start = p;
+    bool negative = false;
+    if( p != end && (*p == '-' || *p == '+') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+    Int result = 0;
+    for( ; p != end && IsDigit(*p); ++p )
+        result = 10*result + (*p-'0');
+    if( p == start || !IsDigit(p[-1]) )
+    {
+        p = start;
+        return false;
+    }
+    value = ( negative ? -result : result );
+    return true;
+}
+
+// Any other type is extracted from its whitespace-delimited token with
+// operator>>, exactly as the stream-based readers did
+template<typename T,typename=DisableIf<std::is_floating_point<T>>,
+         typename=void>
+bool ParseNumber( const char*& p, const char* end, T& value )
+{
+    SkipBlanks( p, end );
+    const char* tokenEnd = p;
+    while( tokenEnd != end && !IsBlank(*tokenEnd) && *tokenEnd != '\n' )
+        ++tokenEnd;
+    if( tokenEnd == p )
+        return false;
+    std::istringstream tokenStream( string( p, tokenEnd ) );
+    if( !(tokenStream >> value) )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+template<typename Real> struct IsFastParsed : std::false_type {};
+template<> struct IsFastParsed<float> : std::true_type {};
+template<> struct IsFastParsed<double> : std::true_type {};
+
+// Complex numbers are written by operator<< in the form "re+imi"; a bare real
+// number is also accepted
+template<typename Real>
+bool ParseNumber( const char*& p, const char* end, Complex<Real>& value )
+{
+    if( !IsFastParsed<Real>::value )
+    {
+        // Defer to operator>> on the entire token
+        SkipBlanks( p, end );
+        const char* tokenEnd = p;
+        while( tokenEnd != end && !IsBlank(*tokenEnd) && *tokenEnd != '\n' )
+            ++tokenEnd;
+        if( tokenEnd == p )
+            return false;
+        std::istringstream tokenStream( string( p, tokenEnd ) );
+        if( !(tokenStream >> value) )
+            return false;
+        p = tokenEnd;
+        return true;
+    }
+
+    Real realPart, imagPart=0;
+    if( !ParseNumber( p, end, realPart ) )
+        return false;
+    if( p != end && *p == '+' )
+    {
+        ++p;
+        if( !ParseNumber( p, end, imagPart ) || p == end || *p != 'i' )
+            return false;
+        ++p;
+    }
+    value = Complex<Real>( realPart, imagPart );
+    return true;
+}
+
+} // namespace text
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_TEXT_HPP
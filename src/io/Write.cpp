@@ -14,6 +14,8 @@
 #include "./Write/BinaryFlat.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
+#include "./Write/MPIIO.hpp"
+#include "./Write/Npy.hpp"
 
 namespace El {
 
@@ -54,6 +56,7 @@ void Write
     case BINARY:        write::Binary( A, basename );             break;
     case BINARY_FLAT:   write::BinaryFlat( A, basename );         break;
     case MATRIX_MARKET: write::MatrixMarket( A, basename );       break;
+    case NUMPY:         write::Npy( A, basename );                break;
     case BMP:
     case JPG:
     case JPEG:
@@ -78,6 +81,11 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( (format == BINARY || format == BINARY_FLAT) &&
+             mpiio::Supported( A ) )
+    {
+        write::MPIIO( A, basename, format );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
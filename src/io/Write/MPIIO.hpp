@@ -0,0 +1,61 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_MPIIO_HPP
+#define EL_WRITE_MPIIO_HPP
+
+#include "../MPIIO.hpp"
+
+namespace El {
+namespace write {
+
+// Collectively write A in the BINARY or BINARY_FLAT format, with each process
+// writing its own entries directly to their offsets within the file
+template<typename T>
+inline void
+MPIIO( const AbstractDistMatrix<T>& A, string basename, FileFormat format )
+{
+    EL_DEBUG_CSE
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("MPI-IO is only supported for BINARY and BINARY_FLAT");
+    const string filename = basename + "." + FileExtension(format);
+    const mpi::Comm& comm = A.Grid().ViewingComm();
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const MPI_Offset headerBytes = ( format == BINARY ? 2*sizeof(Int) : 0 );
+
+    MPI_File file =
+      mpiio::Open( comm, filename, MPI_MODE_CREATE | MPI_MODE_WRONLY );
+    EL_CHECK_MPI_CALL
+    ( MPI_File_set_size
+      ( file, MPI_Offset(headerBytes)+
+              MPI_Offset(height)*MPI_Offset(width)*sizeof(T) ) );
+    if( format == BINARY && mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { height, width };
+        EL_CHECK_MPI_CALL
+        ( MPI_File_write_at
+          ( file, 0, const_cast<Int*>(dims), int(headerBytes), MPI_BYTE,
+            MPI_STATUS_IGNORE ) );
+    }
+
+    // Only one member of each redundant set writes its entries
+    const bool active = A.Participating() && A.RedundantRank() == 0;
+    mpiio::View view( A, active, height, 0, 0, headerBytes );
+    view.Set( file );
+    EL_CHECK_MPI_CALL
+    ( MPI_File_write_all
+      ( file, const_cast<T*>(A.LockedBuffer()), view.Count(),
+        view.MemoryType(), MPI_STATUS_IGNORE ) );
+    mpiio::Close( file );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_MPIIO_HPP
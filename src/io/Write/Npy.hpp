@@ -0,0 +1,42 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_NPY_HPP
+#define EL_WRITE_NPY_HPP
+
+#include "../Npy.hpp"
+
+namespace El {
+namespace write {
+
+// Write A as a Fortran-ordered NumPy array so that it can be mapped back
+// into a Matrix without any copies
+template<typename T>
+inline void
+Npy( const Matrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    const string header = npy::FormatHeader<T>( A.Height(), A.Width() );
+
+    string filename = basename + "." + FileExtension(NUMPY);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    file.write( header.data(), header.size() );
+    if( A.Height() == A.LDim() )
+        file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
+    else
+        for( Int j=0; j<A.Width(); ++j )
+            file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_NPY_HPP
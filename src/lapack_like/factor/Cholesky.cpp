@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/blas_like/level1/Copy.hpp>
 
 // HACK
 #ifdef HYDROGEN_HAVE_GPU
@@ -27,7 +28,11 @@ void LocalGPUCholesky(hydrogen::FillMode uplo,
 #endif // HYDROGEN_HAVE_GPU
 
 #include "./Cholesky/LowerVariant3.hpp"
+#include "./Cholesky/LowerLookahead.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
+#include "./Cholesky/Tiled.hpp"
+#include "./Cholesky/OutOfCore.hpp"
+#include "./Cholesky/Batched.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
 #include "./Cholesky/ReverseUpperVariant3.hpp"
 #include "./Cholesky/PivotedLowerVariant3.hpp"
@@ -57,6 +62,15 @@ void Cholesky(UpperOrLower uplo, Matrix<F,Device::CPU>& A)
     if (A.Height() != A.Width())
         LogicError("A must be square");
 #endif // EL_RELEASE
+#ifdef EL_HYBRID
+    // With several threads available, schedule the tile operations by their
+    // data dependencies rather than relying upon threaded BLAS calls alone
+    if (omp_get_max_threads() > 1 && A.Height() > Blocksize())
+    {
+        cholesky::Tiled(uplo, A);
+        return;
+    }
+#endif // EL_HYBRID
     if (uplo == LOWER)
         cholesky::LowerVariant3Blocked(A);
     else
@@ -81,7 +95,6 @@ void Cholesky(UpperOrLower uplo, AbstractMatrix<F>& A)
     }
 }
 
-#ifdef HYDROGEN_ENABLE_PIVOTED_CHOLESKY
 template <typename F>
 void Cholesky(UpperOrLower uplo, Matrix<F>& A, Permutation& p)
 {
@@ -95,7 +108,20 @@ void Cholesky(UpperOrLower uplo, Matrix<F>& A, Permutation& p)
     else
         cholesky::PivotedUpperVariant3Blocked(A, p);
 }
-#endif // HYDROGEN_ENABLE_PIVOTED_CHOLESKY
+
+template <typename F>
+void Cholesky(UpperOrLower uplo, OutOfCoreMatrix<F>& A)
+{
+    EL_DEBUG_CSE;
+    cholesky::OutOfCore(uplo, A);
+}
+
+template <typename F>
+void Cholesky(UpperOrLower uplo, TileMatrix<F>& A)
+{
+    EL_DEBUG_CSE;
+    cholesky::Tiled(uplo, A);
+}
 
 #ifdef HYDROGEN_ENABLE_REVERSE_CHOLESKY
 template <typename F>
@@ -140,6 +166,20 @@ void ScaLAPACKHelper(UpperOrLower uplo, AbstractDistMatrix<F>& A)
 
 } // anonymous namespace
 
+namespace {
+Int lookaheadDepth = 1;
+} // anonymous namespace
+
+void SetCholeskyLookahead(Int lookahead)
+{
+    EL_DEBUG_CSE;
+    if (lookahead < 0)
+        LogicError("Lookahead depth must be non-negative");
+    lookaheadDepth = lookahead;
+}
+
+Int CholeskyLookahead() { return lookaheadDepth; }
+
 template <typename F>
 void Cholesky(UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack)
 {
@@ -150,14 +190,15 @@ void Cholesky(UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack)
     }
     else
     {
-        if (uplo == LOWER)
+        if (uplo == LOWER && lookaheadDepth > 0)
+            cholesky::LowerLookahead(A, lookaheadDepth);
+        else if (uplo == LOWER)
             cholesky::LowerVariant3Blocked(A);
         else
             cholesky::UpperVariant3Blocked(A);
     }
 }
 
-#ifdef HYDROGEN_ENABLE_PIVOTED_CHOLESKY
 template <typename F>
 void Cholesky
 (UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p)
@@ -168,7 +209,6 @@ void Cholesky
     else
         cholesky::PivotedUpperVariant3Blocked(A, p);
 }
-#endif // HYDROGEN_ENABLE_PIVOTED_CHOLESKY
 
 template <typename F>
 void Cholesky
@@ -192,7 +232,6 @@ void ReverseCholesky
 { ReverseCholesky(uplo, A.Matrix()); }
 #endif // HYDROGEN_ENABLE_REVERSE_CHOLESKY
 
-#ifdef HYDROGEN_ENABLE_CHOLESKY_MOD
 // Either
 //         L' L'^H := L L^H + alpha V V^H
 // or
@@ -225,6 +264,142 @@ void CholeskyMod
         cholesky::UpperMod(T, alpha, V);
 }
 
+template <typename F>
+CholeskyModQueue<F>::CholeskyModQueue
+(UpperOrLower uplo, Matrix<F>& T, Int maxRank)
+: uplo_(uplo), T_(T), maxRank_(maxRank)
+{
+    EL_DEBUG_CSE;
+    if (maxRank < 1)
+        LogicError("The maximum rank must be positive");
+}
+
+template <typename F>
+void CholeskyModQueue<F>::Push(Base<F> alpha, Matrix<F> const& V)
+{
+    EL_DEBUG_CSE;
+    EL_DEBUG_ONLY(
+        if (V.Height() != T_.Height())
+            LogicError("V is the wrong height");
+    )
+    const Int k = V.Width();
+    if (alpha == Base<F>(0) || k == 0)
+        return;
+    Int& numPending = (alpha > Base<F>(0) ? numUpdates_ : numDowndates_);
+    if (numPending+k > maxRank_)
+        Flush();
+    if (k > maxRank_)
+    {
+        Matrix<F> VCopy(V);
+        CholeskyMod(uplo_, T_, alpha, VCopy);
+        return;
+    }
+
+    Matrix<F>& pending = (alpha > Base<F>(0) ? updates_ : downdates_);
+    if (pending.Height() != T_.Height() || pending.Width() != maxRank_)
+        pending.Resize(T_.Height(), maxRank_);
+    auto pendingNew = pending(ALL, IR(numPending,numPending+k));
+    Copy(V, pendingNew);
+    Scale(Sqrt(Abs(alpha)), pendingNew);
+    numPending += k;
+}
+
+template <typename F>
+void CholeskyModQueue<F>::Flush()
+{
+    EL_DEBUG_CSE;
+    if (numUpdates_ > 0)
+    {
+        auto V = updates_(ALL, IR(0,numUpdates_));
+        numUpdates_ = 0;
+        CholeskyMod(uplo_, T_, Base<F>(1), V);
+    }
+    if (numDowndates_ > 0)
+    {
+        auto V = downdates_(ALL, IR(0,numDowndates_));
+        numDowndates_ = 0;
+        CholeskyMod(uplo_, T_, Base<F>(-1), V);
+    }
+}
+
+template <typename F>
+Int CholeskyModQueue<F>::NumPendingUpdates() const
+{ return numUpdates_; }
+
+template <typename F>
+Int CholeskyModQueue<F>::NumPendingDowndates() const
+{ return numDowndates_; }
+
+template <typename F>
+DistCholeskyModQueue<F>::DistCholeskyModQueue
+(UpperOrLower uplo, AbstractDistMatrix<F>& T, Int maxRank)
+: uplo_(uplo), T_(T), maxRank_(maxRank),
+  updates_(T.Grid()), downdates_(T.Grid())
+{
+    EL_DEBUG_CSE;
+    if (maxRank < 1)
+        LogicError("The maximum rank must be positive");
+}
+
+template <typename F>
+void DistCholeskyModQueue<F>::Push
+(Base<F> alpha, AbstractDistMatrix<F> const& V)
+{
+    EL_DEBUG_CSE;
+    EL_DEBUG_ONLY(
+        if (V.Height() != T_.Height())
+            LogicError("V is the wrong height");
+        AssertSameGrids(T_, V);
+    )
+    const Int k = V.Width();
+    if (alpha == Base<F>(0) || k == 0)
+        return;
+    Int& numPending = (alpha > Base<F>(0) ? numUpdates_ : numDowndates_);
+    if (numPending+k > maxRank_)
+        Flush();
+    if (k > maxRank_)
+    {
+        DistMatrix<F> VCopy(V);
+        CholeskyMod(uplo_, T_, alpha, VCopy);
+        return;
+    }
+
+    DistMatrix<F>& pending = (alpha > Base<F>(0) ? updates_ : downdates_);
+    if (pending.Height() != T_.Height() || pending.Width() != maxRank_)
+        pending.Resize(T_.Height(), maxRank_);
+    auto pendingNew = pending(ALL, IR(numPending,numPending+k));
+    Copy(V, pendingNew);
+    pendingNew *= Sqrt(Abs(alpha));
+    numPending += k;
+}
+
+template <typename F>
+void DistCholeskyModQueue<F>::Flush()
+{
+    EL_DEBUG_CSE;
+    if (numUpdates_ > 0)
+    {
+        auto V = updates_(ALL, IR(0,numUpdates_));
+        numUpdates_ = 0;
+        CholeskyMod(uplo_, T_, Base<F>(1), V);
+    }
+    if (numDowndates_ > 0)
+    {
+        auto V = downdates_(ALL, IR(0,numDowndates_));
+        numDowndates_ = 0;
+        CholeskyMod(uplo_, T_, Base<F>(-1), V);
+    }
+}
+
+template <typename F>
+Int DistCholeskyModQueue<F>::NumPendingUpdates() const
+{ return numUpdates_; }
+
+template <typename F>
+Int DistCholeskyModQueue<F>::NumPendingDowndates() const
+{ return numDowndates_; }
+
+#ifdef HYDROGEN_ENABLE_CHOLESKY_MOD
 template <typename F>
 void HPSDCholesky(UpperOrLower uplo, Matrix<F>& A)
 {
@@ -262,7 +437,45 @@ void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& APre)
     template void Cholesky(                                             \
         UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack);   \
     template void Cholesky(                                             \
-        UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A);
+        UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A);                 \
+    template void Cholesky(                                             \
+        UpperOrLower uplo, Matrix<F>& A, Permutation& p);               \
+    template void Cholesky(                                             \
+        UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p); \
+    template void cholesky::SolveAfter(                                 \
+        UpperOrLower uplo, Orientation orientation,                     \
+        const Matrix<F>& A, Matrix<F>& B);                              \
+    template void cholesky::SolveAfter(                                 \
+        UpperOrLower uplo, Orientation orientation,                     \
+        const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B);    \
+    template void cholesky::SolveAfter(                                 \
+        UpperOrLower uplo, Orientation orientation,                     \
+        const Matrix<F>& A, const Permutation& p, Matrix<F>& B);        \
+    template void cholesky::SolveAfter(                                 \
+        UpperOrLower uplo, Orientation orientation,                     \
+        const AbstractDistMatrix<F>& A, const DistPermutation& p,       \
+        AbstractDistMatrix<F>& B);                                      \
+    template void CholeskyMod(                                          \
+        UpperOrLower uplo, Matrix<F>& T, Base<F> alpha, Matrix<F>& V);  \
+    template void CholeskyMod(                                          \
+        UpperOrLower uplo, AbstractDistMatrix<F>& T,                    \
+        Base<F> alpha, AbstractDistMatrix<F>& V);                       \
+    template class CholeskyModQueue<F>;                                 \
+    template class DistCholeskyModQueue<F>;                             \
+    template void CholeskyStridedBatched(                               \
+        UpperOrLower uplo, Int n,                                       \
+        F* A, Int ALDim, Int strideA, Int batchCount);                  \
+    template void CholeskyBatched(                                      \
+        UpperOrLower uplo, const Int* n,                                \
+        F* const* A, const Int* ALDim, Int batchCount);                 \
+    template void CholeskyBatched(                                      \
+        UpperOrLower uplo, Int n, Matrix<F>& A);                        \
+    template void CholeskyBatched(                                      \
+        UpperOrLower uplo, Int n, AbstractDistMatrix<F>& A);            \
+    template void Cholesky(                                             \
+        UpperOrLower uplo, OutOfCoreMatrix<F>& A);                      \
+    template void Cholesky(                                             \
+        UpperOrLower uplo, TileMatrix<F>& A);
 
 #ifdef HYDROGEN_ENABLE_ALL_CHOLESKY
 #define PROTO_BASE(F) \
@@ -309,7 +522,9 @@ void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& APre)
 #define PROTO(F) \
   PROTO_BASE(F) \
   template void HPSDCholesky(UpperOrLower uplo, Matrix<F>& A); \
-  template void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& A);
+  template void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& A); \
+  template void Cholesky(UpperOrLower uplo, OutOfCoreMatrix<F>& A); \
+  template void Cholesky(UpperOrLower uplo, TileMatrix<F>& A);
 
 #define PROTO_DOUBLEDOUBLE PROTO_BASE(DoubleDouble)
 #define PROTO_QUADDOUBLE PROTO_BASE(QuadDouble)
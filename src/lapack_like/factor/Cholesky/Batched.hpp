@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_BATCHED_HPP
+#define EL_CHOLESKY_BATCHED_HPP
+
+namespace El {
+namespace cholesky {
+
+// Factor each of the batch's matrices, the b'th of which is returned by
+// getBlock(b, ABlock), and return the index of the first matrix which was not
+// numerically HPD (or -1 if they all were)
+template<typename F,typename BlockGetter>
+Int FactorBatch( UpperOrLower uplo, Int batchCount, BlockGetter getBlock )
+{
+    EL_DEBUG_CSE
+    // An exception cannot leave an OpenMP loop, so each failure is recorded
+    vector<char> failed( batchCount, false );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        Matrix<F> ABlock;
+        getBlock( b, ABlock );
+        try
+        {
+            if( uplo == LOWER )
+                LowerDiagonalBlock( ABlock );
+            else
+                UpperDiagonalBlock( ABlock );
+        }
+        catch( NonHPDMatrixException& )
+        {
+            failed[b] = true;
+        }
+    }
+    for( Int b=0; b<batchCount; ++b )
+        if( failed[b] )
+            return b;
+    return -1;
+}
+
+inline void ThrowIfBatchFailed( Int firstFailure )
+{
+    if( firstFailure >= 0 )
+        throw NonHPDMatrixException
+        ( BuildString
+          ("Matrix ",firstFailure," of the batch was not numerically HPD")
+          .c_str() );
+}
+
+template<typename F>
+Int StridedBatched
+( UpperOrLower uplo, Int n, F* A, Int ALDim, Int strideA, Int batchCount )
+{
+    EL_DEBUG_CSE
+    return FactorBatch<F>
+    ( uplo, batchCount,
+      [&]( Int b, Matrix<F>& ABlock )
+      { ABlock.Attach( n, n, &A[b*strideA], ALDim ); } );
+}
+
+} // namespace cholesky
+
+template<typename F>
+void CholeskyStridedBatched
+( UpperOrLower uplo, Int n, F* A, Int ALDim, Int strideA, Int batchCount )
+{
+    EL_DEBUG_CSE
+    cholesky::ThrowIfBatchFailed
+    ( cholesky::StridedBatched( uplo, n, A, ALDim, strideA, batchCount ) );
+}
+
+template<typename F>
+void CholeskyBatched
+( UpperOrLower uplo, const Int* n,
+  F* const* A, const Int* ALDim, Int batchCount )
+{
+    EL_DEBUG_CSE
+    cholesky::ThrowIfBatchFailed
+    ( cholesky::FactorBatch<F>
+      ( uplo, batchCount,
+        [&]( Int b, Matrix<F>& ABlock )
+        { ABlock.Attach( n[b], n[b], A[b], ALDim[b] ); } ) );
+}
+
+template<typename F>
+void CholeskyBatched( UpperOrLower uplo, Int n, Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != n*n )
+          LogicError("Each column of A should hold an ",n," x ",n," matrix");
+    )
+    cholesky::ThrowIfBatchFailed
+    ( cholesky::StridedBatched( uplo, n, A.Buffer(), n, A.LDim(), A.Width() ) );
+}
+
+template<typename F>
+void CholeskyBatched( UpperOrLower uplo, Int n, AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    Int firstFailure;
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> AProx( APre );
+        auto& A = AProx.Get();
+        EL_DEBUG_ONLY(
+          if( A.Height() != n*n )
+              LogicError
+              ("Each column of A should hold an ",n," x ",n," matrix");
+        )
+        const Int localFailure =
+          cholesky::StridedBatched
+          ( uplo, n, A.Buffer(), n, A.LDim(), A.LocalWidth() );
+        // Agree upon the first failure so that every process throws
+        firstFailure =
+          ( localFailure >= 0 ? A.GlobalCol(localFailure) : A.Width() );
+        SyncInfo<Device::CPU> syncInfo;
+        firstFailure =
+          mpi::AllReduce( firstFailure, mpi::MIN, A.Grid().Comm(), syncInfo );
+        if( firstFailure == A.Width() )
+            firstFailure = -1;
+    }
+    cholesky::ThrowIfBatchFailed( firstFailure );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_BATCHED_HPP
@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_LOWER_LOOKAHEAD_HPP
+#define EL_CHOLESKY_LOWER_LOOKAHEAD_HPP
+
+namespace El {
+namespace cholesky {
+
+// A nonblocking version of the [VC,STAR] -> [MC,STAR] and [VR,STAR] ->
+// [MR,STAR] redistributions (see copy::PartialColAllGather): Start packs the
+// local data and begins the AllGather over the partial union column
+// communicator, and Finish waits upon it and unpacks the result
+template<typename F,Dist U>
+class PanelGather
+{
+public:
+    void Start
+    (const DistMatrix<F,U,STAR>& A, DistMatrix<F,Partial<U>(),STAR>& B)
+    {
+        EL_DEBUG_CSE;
+        pending_ = false;
+        B.AlignColsAndResize
+        (Mod(A.ColAlign(),B.ColStride()), A.Height(), A.Width(), false, true);
+        if(!A.Participating())
+            return;
+
+        const Int colStridePart = A.PartialColStride();
+        const Int colDiff = B.ColAlign() - Mod(A.ColAlign(),colStridePart);
+        if(colDiff != 0 || A.PartialUnionColStride() == 1)
+        {
+            copy::PartialColAllGather(A, B);
+            return;
+        }
+
+        B_ = &B;
+        height_ = A.Height();
+        width_ = A.Width();
+        colAlign_ = A.ColAlign();
+        colStride_ = A.ColStride();
+        colStrideUnion_ = A.PartialUnionColStride();
+        colStridePart_ = colStridePart;
+        colRankPart_ = A.PartialColRank();
+        portionSize_ = mpi::Pad(MaxLength(height_,colStride_)*width_);
+        buffer_.resize((colStrideUnion_+1)*portionSize_);
+
+        copy::util::InterleaveMatrix
+        (A.LocalHeight(), width_,
+         A.LockedBuffer(), 1, A.LDim(),
+         buffer_.data(),   1, A.LocalHeight(), syncInfo_);
+        mpi::IAllGather
+        (buffer_.data(),              portionSize_,
+         buffer_.data()+portionSize_, portionSize_,
+         A.PartialUnionColComm(), request_);
+        pending_ = true;
+    }
+
+    void Finish()
+    {
+        EL_DEBUG_CSE;
+        if(!pending_)
+            return;
+        mpi::Wait(request_);
+        copy::util::PartialColStridedUnpack
+        (height_, width_,
+         colAlign_, colStride_,
+         colStrideUnion_, colStridePart_, colRankPart_,
+         B_->ColShift(),
+         buffer_.data()+portionSize_, portionSize_,
+         B_->Buffer(), B_->LDim(), syncInfo_);
+        pending_ = false;
+    }
+
+private:
+    bool pending_=false;
+    DistMatrix<F,Partial<U>(),STAR>* B_=nullptr;
+    Int height_, width_, colAlign_, colStride_;
+    Int colStrideUnion_, colStridePart_, colRankPart_, portionSize_;
+    vector<F> buffer_;
+    mpi::Request<F> request_;
+    SyncInfo<Device::CPU> syncInfo_;
+};
+
+// A column panel which has been factored, along with the redistributions of
+// its subdiagonal block needed to update the trailing matrix
+template<typename F>
+struct LookaheadPanel
+{
+    // The panel's columns, [beg,end), and the columns [end,applied) of the
+    // trailing matrix which it has already updated
+    Int beg, end, applied;
+    DistMatrix<F,VC,STAR> A21_VC_STAR;
+    DistMatrix<F,VR,STAR> A21_VR_STAR;
+    DistMatrix<F,MC,STAR> A21_MC_STAR;
+    DistMatrix<F,MR,STAR> A21_MR_STAR;
+    PanelGather<F,VC> gatherMC;
+    PanelGather<F,VR> gatherMR;
+
+    LookaheadPanel(const Grid& grid)
+    : A21_VC_STAR(grid), A21_VR_STAR(grid),
+      A21_MC_STAR(grid), A21_MR_STAR(grid)
+    { }
+};
+
+// A right-looking variant with a lookahead of depth d: once panel k has been
+// factored and the subdiagonal blocks of panels k-d+1, ..., k-1 have updated
+// the columns of panel k+1, the trailing update of panel k-d+1 is completed
+// while the gathers of panel k are in flight. Each of the (at most d) panels
+// whose trailing updates are outstanding only updates the columns of the
+// next panel before it is factored, so that d panels are factored ahead of
+// the oldest outstanding trailing update. A depth of one updates the next
+// panel, factors it, and then completes the update of the remainder.
+//
+// Since the trailing matrix is updated with A21[MC,* ] A21^H[* ,MR] rather
+// than via the transposed panels, each panel only requires the two partial
+// AllGathers rather than the additional transposes of the non-lookahead
+// variant.
+template<typename F>
+void LowerLookahead(AbstractDistMatrix<F>& APre, Int lookahead)
+{
+    EL_DEBUG_CSE;
+    EL_DEBUG_ONLY(
+      if(APre.Height() != APre.Width())
+          LogicError("Can only compute Cholesky factor of square matrices");
+      if(lookahead < 1)
+          LogicError("Lookahead depth must be positive");
+   )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx(APre);
+    auto& A = AProx.Get();
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if(n == 0)
+        return;
+    const Int numPanels = (n+bsize-1) / bsize;
+
+    // Panel q is held in slot q % (lookahead+1); the panels with outstanding
+    // updates are always among the previous lookahead panels
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    vector<unique_ptr<LookaheadPanel<F>>> slots;
+    for(Int slot=0; slot<=lookahead; ++slot)
+        slots.emplace_back(new LookaheadPanel<F>(grid));
+    auto panel = [&](Int q) -> LookaheadPanel<F>&
+      { return *slots[q % (lookahead+1)]; };
+
+    // Factor the panel beginning at column k, given that all of the updates
+    // from the previous panels have been applied to it
+    auto factor =
+      [&](Int k, LookaheadPanel<F>& panel)
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1(k,    k+nb),
+                           ind2(k+nb, n   );
+
+          auto A11 = A(ind1, ind1);
+          auto A21 = A(ind2, ind1);
+          auto A22 = A(ind2, ind2);
+
+          A11_STAR_STAR = A11;
+          Cholesky(LOWER, A11_STAR_STAR);
+          A11 = A11_STAR_STAR;
+
+          panel.beg = k;
+          panel.end = k+nb;
+          panel.applied = k+nb;
+          panel.A21_VC_STAR.AlignWith(A22);
+          panel.A21_VC_STAR = A21;
+          LocalTrsm
+          (RIGHT, LOWER, ADJOINT, NON_UNIT,
+           F(1), A11_STAR_STAR, panel.A21_VC_STAR);
+
+          panel.A21_VR_STAR.AlignWith(A22);
+          panel.A21_VR_STAR = panel.A21_VC_STAR;
+          panel.A21_MC_STAR.AlignWith(A22);
+          panel.A21_MR_STAR.AlignWith(A22);
+          panel.gatherMC.Start(panel.A21_VC_STAR, panel.A21_MC_STAR);
+          panel.gatherMR.Start(panel.A21_VR_STAR, panel.A21_MR_STAR);
+      };
+
+    // Subtract the contribution of the panel from the lower triangle of the
+    // trailing matrix in the columns from where it left off up to jEnd
+    auto update =
+      [&](LookaheadPanel<F>& panel, Int jEnd)
+      {
+          const Int jBeg = panel.applied;
+          if(jBeg >= jEnd)
+              return;
+          const Range<Int> indJ(jBeg-panel.end, jEnd-panel.end),
+                           indB(jEnd-panel.end, n-panel.end);
+          const Range<Int> colsJ(jBeg, jEnd), rowsB(jEnd, n);
+
+          auto L1_MC_STAR = panel.A21_MC_STAR(indJ, ALL);
+          auto L1_MR_STAR = panel.A21_MR_STAR(indJ, ALL);
+          auto L2_MC_STAR = panel.A21_MC_STAR(indB, ALL);
+          auto AJJ = A(colsJ, colsJ);
+          auto ABJ = A(rowsB, colsJ);
+
+          LocalTrrk
+          (LOWER, ADJOINT,
+           F(-1), L1_MC_STAR, L1_MR_STAR, F(1), AJJ);
+          LocalGemm
+          (NORMAL, ADJOINT,
+           F(-1), L2_MC_STAR, L1_MR_STAR, F(1), ABJ);
+          panel.applied = jEnd;
+      };
+
+    // The oldest panel whose trailing update is incomplete
+    Int oldest = 0;
+    factor(0, panel(0));
+    for(Int q=1; q<=numPanels; ++q)
+    {
+        auto& last = panel(q-1);
+        last.gatherMC.Finish();
+        last.gatherMR.Finish();
+
+        // A21[MC,MR] can be filtered from A21[MC,* ] without communication
+        auto A21 = A(IR(last.end,n), IR(last.beg,last.end));
+        A21 = last.A21_MC_STAR;
+        if(q == numPanels)
+            break;
+
+        // Every other outstanding panel has already updated panel q
+        const Int k = last.end;
+        update(last, Min(k+bsize,n));
+        factor(k, panel(q));
+
+        // While the gathers of panel q are in flight, the outstanding panels
+        // update panel q+1, and the oldest of them completes its update once
+        // it is the lookahead'th behind panel q
+        const Int nextEnd = Min(k+2*bsize,n);
+        for(Int p=oldest; p<q; ++p)
+            update(panel(p), nextEnd);
+        if(q-oldest == lookahead)
+        {
+            update(panel(oldest), n);
+            ++oldest;
+        }
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_LOWER_LOOKAHEAD_HPP
@@ -9,7 +9,6 @@
 #ifndef EL_CHOLESKY_LOWER_MOD_HPP
 #define EL_CHOLESKY_LOWER_MOD_HPP
 
-// TODO: Blocked algorithms
 namespace El {
 namespace cholesky {
 
@@ -227,24 +226,236 @@ void LowerDowndate( AbstractDistMatrix<F>& LPre, AbstractDistMatrix<F>& VPre )
     }
 }
 
+// Modify the b x b diagonal block, L11, and the corresponding b rows, V1, of V
+// with one (hyperbolic) Householder reflector per column and return the
+// upper-triangular factor, T, of the compact-WY representation of their
+// product, i.e.,
+//
+//   | L21 V2 | := | L21 V2 | (I - J W T W^H),   W = | I   |,
+//                                                  | Y^T |
+//
+// where J = diag(I,sigma I), with sigma = +1 for updates and -1 for downdates,
+// and V1 is overwritten with the rows of Y^T.
+//
+// Unlike the unblocked algorithms, the reflectors are not negated, so the
+// diagonal of L11 is left negative and must be corrected by the caller.
+template<typename F>
+void LowerPanel( Matrix<F>& L11, Matrix<F>& V1, bool downdate, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int b = L11.Height();
+    Zeros( T, b, b );
+
+    Matrix<F> z21;
+    for( Int k=0; k<b; ++k )
+    {
+        const IR ind1( k ), ind2( k+1, END );
+
+        F& lambda11 = L11(k,k);
+        auto l21 = L11( ind2, ind1 );
+
+        auto v1 = V1( ind1, ALL );
+        auto V2 = V1( ind2, ALL );
+
+        // | l21 V2 | := | l21 V2 | - s (| l21 V2 | J w) w^H,  w = | 1   |
+        //                                                        | u^T |
+        // where s is tau for updates and 1/tau for downdates
+        F s;
+        z21 = l21;
+        if( downdate )
+        {
+            s = F(1) / RightHyperbolicReflector( lambda11, v1 );
+            Gemv( NORMAL, F(-1), V2, v1, F(1), z21 );
+        }
+        else
+        {
+            s = RightReflector( lambda11, v1 );
+            Gemv( NORMAL, F(1), V2, v1, F(1), z21 );
+        }
+        Axpy( -s, z21, l21 );
+        Ger( -s, z21, v1, V2 );
+        T(k,k) = s;
+    }
+
+    // Since the leading block of W is the identity, the inner products
+    // needed for the off-diagonal of T only involve Y
+    const F sigma = ( downdate ? F(-1) : F(1) );
+    Matrix<F> V1Conj, G;
+    Conjugate( V1, V1Conj );
+    Gemm( NORMAL, TRANSPOSE, F(1), V1Conj, V1, G );
+    for( Int k=1; k<b; ++k )
+    {
+        const IR ind0( 0, k ), ind1( k );
+        auto t01 = T( ind0, ind1 );
+        Gemv( NORMAL, -sigma*T(k,k), T( ind0, ind0 ), G( ind0, ind1 ),
+              F(0), t01 );
+    }
+}
+
+// Apply all k columns of V at once by sweeping over column panels of L and
+// applying the accumulated reflectors of each panel to the trailing rows of
+// | L V | with level 3 operations
+template<typename F>
+void LowerBlocked( Matrix<F>& L, Matrix<F>& V, bool downdate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( L.Height() != L.Width() )
+          LogicError("Cholesky factors must be square");
+      if( V.Height() != L.Height() )
+          LogicError("V is the wrong height");
+    )
+    typedef Base<F> Real;
+    const Int n = L.Height();
+    const Int bsize = Blocksize();
+    const F sigma = ( downdate ? F(-1) : F(1) );
+
+    Matrix<F> T, V1Conj, Z21, Z21T;
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        LowerPanel( L11, V1, downdate, T );
+
+        // | L21 V2 | -= (L21 + sigma V2 Y) T | I Y^H |
+        Conjugate( V1, V1Conj );
+        Z21 = L21;
+        Gemm( NORMAL, TRANSPOSE, sigma, V2, V1, F(1), Z21 );
+        Gemm( NORMAL, NORMAL, F(1), Z21, T, Z21T );
+        Axpy( F(-1), Z21T, L21 );
+        Gemm( NORMAL, NORMAL, F(-1), Z21T, V1Conj, F(1), V2 );
+
+        // Negate the columns with a negative diagonal entry
+        for( Int j=0; j<nb; ++j )
+        {
+            if( RealPart(L(k+j,k+j)) < Real(0) )
+            {
+                auto l = L( IR(k+j,END), IR(k+j) );
+                Scale( F(-1), l );
+            }
+        }
+    }
+}
+
+template<typename F>
+void LowerBlocked
+( AbstractDistMatrix<F>& LPre,
+  AbstractDistMatrix<F>& VPre,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( LPre.Height() != LPre.Width() )
+          LogicError("Cholesky factors must be square");
+      if( VPre.Height() != LPre.Height() )
+          LogicError("V is the wrong height");
+      AssertSameGrids( LPre, VPre );
+    )
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> LProx( LPre ), VProx( VPre );
+    auto& L = LProx.Get();
+    auto& V = VProx.Get();
+
+    typedef Base<F> Real;
+    const Int n = L.Height();
+    const Int bsize = Blocksize();
+    const F sigma = ( downdate ? F(-1) : F(1) );
+    const Grid& grid = L.Grid();
+
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(grid), V1_STAR_STAR(grid),
+                            T_STAR_STAR(grid);
+    DistMatrix<F,STAR,MR> V1_STAR_MR(grid), V1Conj_STAR_MR(grid);
+    DistMatrix<F,MC,STAR> L21_MC_STAR(grid), Z21_MC_STAR(grid),
+                          Z21T_MC_STAR(grid);
+
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        // Every process redundantly factors the (small) panel
+        L11_STAR_STAR = L11;
+        V1_STAR_STAR = V1;
+        Zeros( T_STAR_STAR, nb, nb );
+        LowerPanel
+        ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(), downdate,
+          T_STAR_STAR.Matrix() );
+
+        // | L21 V2 | -= (L21 + sigma V2 Y) T | I Y^H |
+        V1_STAR_MR.AlignWith( V2 );
+        V1Conj_STAR_MR.AlignWith( V2 );
+        V1_STAR_MR = V1_STAR_STAR;
+        Conjugate( V1_STAR_MR, V1Conj_STAR_MR );
+        Z21_MC_STAR.AlignWith( V2 );
+        Zeros( Z21_MC_STAR, V2.Height(), nb );
+        LocalGemm( NORMAL, TRANSPOSE, sigma, V2, V1_STAR_MR, F(0), Z21_MC_STAR );
+        El::AllReduce( Z21_MC_STAR, V2.RowComm() );
+        L21_MC_STAR.AlignWith( V2 );
+        L21_MC_STAR = L21;
+        Z21_MC_STAR += L21_MC_STAR;
+        Z21T_MC_STAR.AlignWith( V2 );
+        Zeros( Z21T_MC_STAR, V2.Height(), nb );
+        LocalGemm
+        ( NORMAL, NORMAL, F(1), Z21_MC_STAR, T_STAR_STAR, F(0), Z21T_MC_STAR );
+        Axpy( F(-1), Z21T_MC_STAR, L21 );
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), Z21T_MC_STAR, V1Conj_STAR_MR, F(1), V2 );
+
+        // Negate the columns with a negative diagonal entry
+        for( Int j=0; j<nb; ++j )
+        {
+            if( RealPart(L11_STAR_STAR.GetLocal(j,j)) < Real(0) )
+            {
+                auto l11 = L11_STAR_STAR( IR(j,END), IR(j) );
+                Scale( F(-1), l11 );
+                auto l21 = L21( ALL, IR(j) );
+                Scale( F(-1), l21 );
+            }
+        }
+        L11 = L11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+    }
+}
+
 } // namespace mod
 
+// Rank-one modifications are applied with a single sweep of the unblocked
+// algorithm, as the compact-WY panels only pay off for several columns
 template<typename F>
 void LowerMod( Matrix<F>& L, Base<F> alpha, Matrix<F>& V )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    if( alpha == Real(0) )
+    if( alpha == Real(0) || V.Width() == 0 )
         return;
     else if( alpha > Real(0) )
     {
         Scale(Sqrt(alpha), V);
-        mod::LowerUpdate( L, V );
+        if( V.Width() == 1 )
+            mod::LowerUpdate( L, V );
+        else
+            mod::LowerBlocked( L, V, false );
     }
     else
     {
         Scale(Sqrt(-alpha), V);
-        mod::LowerDowndate( L, V );
+        if( V.Width() == 1 )
+            mod::LowerDowndate( L, V );
+        else
+            mod::LowerBlocked( L, V, true );
     }
 }
 
@@ -256,17 +467,23 @@ void LowerMod
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    if( alpha == Real(0) )
+    if( alpha == Real(0) || V.Width() == 0 )
         return;
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::LowerUpdate( L, V );
+        if( V.Width() == 1 )
+            mod::LowerUpdate( L, V );
+        else
+            mod::LowerBlocked( L, V, false );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::LowerDowndate( L, V );
+        if( V.Width() == 1 )
+            mod::LowerDowndate( L, V );
+        else
+            mod::LowerBlocked( L, V, true );
     }
 }
 
@@ -48,6 +48,37 @@ void LowerVariant3Unblocked(Matrix<F,Device::CPU>& A)
     }
 }
 
+// Factor a diagonal block using LAPACK's (blocked, and usually recursive)
+// kernel when it is available rather than the unblocked algorithm
+#ifdef HYDROGEN_HAVE_GPU
+template <typename F>
+void LowerDiagonalBlock(Matrix<F, Device::GPU>& A)
+{
+    LowerVariant3Unblocked(A);
+}
+#endif // HYDROGEN_HAVE_GPU
+
+#ifdef HYDROGEN_HAVE_LAPACK
+template <typename F, typename=EnableIf<IsBlasScalar<F>>>
+void LowerDiagonalBlock(Matrix<F,Device::CPU>& A)
+{
+    EL_DEBUG_CSE;
+    lapack::Cholesky('L', A.Height(), A.Buffer(), A.LDim());
+}
+
+template <typename F, typename=DisableIf<IsBlasScalar<F>>, typename=void>
+void LowerDiagonalBlock(Matrix<F,Device::CPU>& A)
+{
+    LowerVariant3Unblocked(A);
+}
+#else
+template <typename F>
+void LowerDiagonalBlock(Matrix<F,Device::CPU>& A)
+{
+    LowerVariant3Unblocked(A);
+}
+#endif // HYDROGEN_HAVE_LAPACK
+
 template <typename F, Device D>
 void LowerVariant3Blocked(Matrix<F,D>& A)
 {
@@ -68,7 +99,7 @@ void LowerVariant3Blocked(Matrix<F,D>& A)
         auto A21 = A(ind2, ind1);
         auto A22 = A(ind2, ind2);
 
-        cholesky::LowerVariant3Unblocked(A11);
+        cholesky::LowerDiagonalBlock(A11);
         Trsm(RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21);
         Herk(LOWER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22);
     }
@@ -87,14 +118,25 @@ void LowerVariant3Blocked(AbstractDistMatrix<F>& APre)
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx(APre);
     auto& A = AProx.Get();
 
+    // The panels are drawn from the workspace, which is sized for the four
+    // panels (and their communication buffers) of the first iteration
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int panelHeight = MaxLength(n, Min(grid.Height(),grid.Width()));
+    WorkspaceScope workspace(2*size_t(4*panelHeight+bsize)*bsize*sizeof(F));
+
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
     DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
     DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
     DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(grid);
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
-    const Int n = A.Height();
-    const Int bsize = Blocksize();
+    UseWorkspace(A11_STAR_STAR);
+    UseWorkspace(A21_VC_STAR);
+    UseWorkspace(A21_VR_STAR);
+    UseWorkspace(A21Trans_STAR_MC);
+    UseWorkspace(A21Adj_STAR_MR);
+
     for(Int k=0; k<n; k+=bsize)
     {
         const Int nb = Min(bsize,n-k);
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_OUTOFCORE_HPP
+#define EL_CHOLESKY_OUTOFCORE_HPP
+
+namespace El {
+namespace cholesky {
+
+// A left-looking tiled Cholesky factorization of an out-of-core matrix, which
+// applies the same tile operations as the Tiled variant. Each tile column k
+// of the stored triangle is processed in chunks of tiles which fit in the
+// cache (alongside the diagonal tile): all of the updates from the previous
+// tile columns are applied while the chunk is held in memory, with each tile
+// (k,j) pinned while tiles (i,j) of the chunk's rows are streamed past it, and
+// the chunk is then solved against the diagonal tile and written back only
+// once. As in the Tiled variant, tiles are addressed by their coordinates in
+// the lower triangle.
+template<typename F>
+void OutOfCore( UpperOrLower uplo, OutOfCoreMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factor of square matrices");
+    if( A.CacheTiles() < 4 )
+        LogicError
+        ("The out-of-core Cholesky factorization requires a cache of at least "
+         "four tiles");
+    const Int numTiles = A.TileRows();
+    auto pin =
+      [&]( Int i, Int j ) { return uplo == LOWER ? A.Pin(i,j) : A.Pin(j,i); };
+    auto unpin =
+      [&]( Int i, Int j, bool modified )
+      {
+          if( uplo == LOWER )
+              A.Unpin( i, j, modified );
+          else
+              A.Unpin( j, i, modified );
+      };
+    auto prefetch =
+      [&]( Int i, Int j )
+      { if( uplo == LOWER ) A.Prefetch(i,j); else A.Prefetch(j,i); };
+
+    // Besides the chunk, the diagonal tile, tile (k,j), and the streamed tile
+    // (i,j) are pinned, and a slot is left free for read-ahead
+    const Int chunkSize = Max( A.CacheTiles()-4, Int(1) );
+    vector<Matrix<F>> chunk;
+    for( Int k=0; k<numTiles; ++k )
+    {
+        auto Akk = pin( k, k );
+        // The first pass (even when there are no tiles below the diagonal)
+        // also updates and factors the diagonal tile
+        bool first = true;
+        for( Int iBeg=k+1; first || iBeg<numTiles; iBeg+=chunkSize )
+        {
+            const Int iEnd = Min(iBeg+chunkSize,numTiles);
+            chunk.clear();
+            for( Int i=iBeg; i<iEnd; ++i )
+                chunk.emplace_back( pin( i, k ) );
+
+            for( Int j=0; j<k; ++j )
+            {
+                auto Akj = pin( k, j );
+                if( iBeg < iEnd )
+                    prefetch( iBeg, j );
+                if( first )
+                    tiled::HermitianUpdate( uplo, Akj, Akk );
+                for( Int i=iBeg; i<iEnd; ++i )
+                {
+                    auto Aij = pin( i, j );
+                    if( i+1 < iEnd )
+                        prefetch( i+1, j );
+                    else if( j+1 < k )
+                        prefetch( k, j+1 );
+                    tiled::GeneralUpdate( uplo, Aij, Akj, chunk[i-iBeg] );
+                    unpin( i, j, false );
+                }
+                unpin( k, j, false );
+            }
+
+            if( first )
+            {
+                if( uplo == LOWER )
+                    LowerDiagonalBlock( Akk );
+                else
+                    UpperDiagonalBlock( Akk );
+                first = false;
+            }
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                tiled::Solve( uplo, Akk, chunk[i-iBeg] );
+                unpin( i, k, true );
+            }
+        }
+        unpin( k, k, true );
+        if( k+1 < numTiles )
+            prefetch( k+1, 0 );
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_OUTOFCORE_HPP
@@ -0,0 +1,203 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_TILED_HPP
+#define EL_CHOLESKY_TILED_HPP
+
+#include <atomic>
+
+namespace El {
+namespace cholesky {
+
+// A tiled Cholesky factorization whose tile operations (the factorization of
+// a diagonal tile, triangular solves against it, and the Hermitian and
+// general rank-k updates of the trailing tiles) are scheduled as OpenMP tasks
+// ordered only by their data dependencies. Unlike the right-looking blocked
+// algorithms, the factorization of the next diagonal tile may then begin as
+// soon as its own updates have finished, rather than after the entire
+// trailing matrix has been updated.
+//
+// The tiles are addressed by their block coordinates within the stored
+// triangle, so that, for the upper-triangular factorization, tile (i,j), with
+// i >= j, is the transpose position of the tile within block row j and block
+// column i. Without OpenMP, the tasks simply execute in their (valid)
+// creation order.
+
+namespace tiled {
+
+template<typename F>
+void Solve( UpperOrLower uplo, const Matrix<F>& D, Matrix<F>& B )
+{
+    if( uplo == LOWER )
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), D, B );
+    else
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), D, B );
+}
+
+template<typename F>
+void HermitianUpdate( UpperOrLower uplo, const Matrix<F>& P, Matrix<F>& C )
+{
+    if( uplo == LOWER )
+        Herk( LOWER, NORMAL, Base<F>(-1), P, Base<F>(1), C );
+    else
+        Herk( UPPER, ADJOINT, Base<F>(-1), P, Base<F>(1), C );
+}
+
+// Update tile (i,j) using tiles (i,k) and (j,k)
+template<typename F>
+void GeneralUpdate
+( UpperOrLower uplo, const Matrix<F>& P, const Matrix<F>& Q, Matrix<F>& C )
+{
+    if( uplo == LOWER )
+        Gemm( NORMAL, ADJOINT, F(-1), P, Q, F(1), C );
+    else
+        Gemm( ADJOINT, NORMAL, F(-1), Q, P, F(1), C );
+}
+
+} // namespace tiled
+
+// Schedules the factorization of the numTiles x numTiles grid of tiles
+// returned (as views) by tile(i,j)
+template<typename F,typename TileView>
+void TileTasks( UpperOrLower uplo, Int numTiles, TileView tile )
+{
+    EL_DEBUG_CSE
+    // The addresses of these (otherwise unused) entries name the tiles
+    // within the task dependencies
+    vector<char> tokens( numTiles*numTiles );
+    char* token = tokens.data();
+
+    // An exception cannot leave a task, so the first one is recorded and
+    // the remaining tasks are skipped
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    auto run =
+      [&]( std::function<void()> operation )
+      {
+          if( failed )
+              return;
+          try { operation(); }
+          catch( ... )
+          {
+#ifdef EL_HYBRID
+              #pragma omp critical
+#endif
+              if( !failed.exchange(true) )
+                  error = std::current_exception();
+          }
+      };
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( Int k=0; k<numTiles; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task firstprivate(k) \
+          depend(inout:token[k+k*numTiles])
+#endif
+        run( [&,k]()
+        {
+            auto Akk = tile(k,k);
+            if( uplo == LOWER )
+                LowerDiagonalBlock( Akk );
+            else
+                UpperDiagonalBlock( Akk );
+        } );
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task firstprivate(i,k) \
+              depend(in:token[k+k*numTiles]) \
+              depend(inout:token[i+k*numTiles])
+#endif
+            run( [&,i,k]()
+            {
+                auto Akk = tile(k,k);
+                auto Aik = tile(i,k);
+                tiled::Solve( uplo, Akk, Aik );
+            } );
+        }
+
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task firstprivate(j,k) \
+              depend(in:token[j+k*numTiles]) \
+              depend(inout:token[j+j*numTiles])
+#endif
+            run( [&,j,k]()
+            {
+                auto Ajk = tile(j,k);
+                auto Ajj = tile(j,j);
+                tiled::HermitianUpdate( uplo, Ajk, Ajj );
+            } );
+
+            for( Int i=j+1; i<numTiles; ++i )
+            {
+#ifdef EL_HYBRID
+                #pragma omp task firstprivate(i,j,k) \
+                  depend(in:token[i+k*numTiles],token[j+k*numTiles]) \
+                  depend(inout:token[i+j*numTiles])
+#endif
+                run( [&,i,j,k]()
+                {
+                    auto Aik = tile(i,k);
+                    auto Ajk = tile(j,k);
+                    auto Aij = tile(i,j);
+                    tiled::GeneralUpdate( uplo, Aik, Ajk, Aij );
+                } );
+            }
+        }
+    }
+
+    if( error )
+        std::rethrow_exception( error );
+}
+
+template<typename F>
+void Tiled( UpperOrLower uplo, Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numTiles = (n+bsize-1) / bsize;
+    TileTasks<F>
+    ( uplo, numTiles,
+      [&]( Int i, Int j )
+      {
+          const Range<Int> rows( i*bsize, Min((i+1)*bsize,n) ),
+                           cols( j*bsize, Min((j+1)*bsize,n) );
+          return ( uplo == LOWER ? A(rows,cols) : A(cols,rows) );
+      } );
+}
+
+// The tiles of a tile-major matrix are already contiguous, so they are
+// handed to the tile operations without any copies
+template<typename F>
+void Tiled( UpperOrLower uplo, TileMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factor of square matrices");
+    TileTasks<F>
+    ( uplo, A.TileRows(),
+      [&]( Int i, Int j )
+      { return ( uplo == LOWER ? A.Tile(i,j) : A.Tile(j,i) ); } );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_TILED_HPP
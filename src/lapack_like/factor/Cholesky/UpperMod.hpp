@@ -9,8 +9,6 @@
 #ifndef EL_CHOLESKY_UPPER_MOD_HPP
 #define EL_CHOLESKY_UPPER_MOD_HPP
 
-// TODO: Blocked algorithms
-
 namespace El {
 namespace cholesky {
 
@@ -265,24 +263,178 @@ void UpperDowndate
     }
 }
 
+// Since U^H is a lower Cholesky factor, each diagonal block is modified by
+// the lower panel algorithm applied to U11^H, and the trailing update is the
+// adjoint of that of the lower blocked algorithm:
+//
+//   | U12  | -= | I | T^H (U12 + sigma Y^H V2^H)
+//   | V2^H |    | Y |
+//
+template<typename F>
+void UpperBlocked( Matrix<F>& U, Matrix<F>& V, bool downdate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( U.Height() != U.Width() )
+          LogicError("Cholesky factors must be square");
+      if( V.Height() != U.Height() )
+          LogicError("V is the wrong height");
+    )
+    typedef Base<F> Real;
+    const Int n = U.Height();
+    const Int bsize = Blocksize();
+    const F sigma = ( downdate ? F(-1) : F(1) );
+
+    Matrix<F> L11, T, V1Conj, Z12, W12;
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        Adjoint( U11, L11 );
+        LowerPanel( L11, V1, downdate, T );
+        for( Int j=0; j<nb; ++j )
+            for( Int i=0; i<=j; ++i )
+                U11(i,j) = Conj(L11(j,i));
+
+        Conjugate( V1, V1Conj );
+        Z12 = U12;
+        Gemm( NORMAL, ADJOINT, sigma, V1Conj, V2, F(1), Z12 );
+        Gemm( ADJOINT, NORMAL, F(1), T, Z12, W12 );
+        Axpy( F(-1), W12, U12 );
+        Gemm( ADJOINT, NORMAL, F(-1), W12, V1Conj, F(1), V2 );
+
+        // Negate the rows with a negative diagonal entry
+        for( Int j=0; j<nb; ++j )
+        {
+            if( RealPart(U(k+j,k+j)) < Real(0) )
+            {
+                auto u = U( IR(k+j), IR(k+j,END) );
+                Scale( F(-1), u );
+            }
+        }
+    }
+}
+
+template<typename F>
+void UpperBlocked
+( AbstractDistMatrix<F>& UPre,
+  AbstractDistMatrix<F>& VPre,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( UPre.Height() != UPre.Width() )
+          LogicError("Cholesky factors must be square");
+      if( VPre.Height() != UPre.Height() )
+          LogicError("V is the wrong height");
+      AssertSameGrids( UPre, VPre );
+    )
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> UProx( UPre ), VProx( VPre );
+    auto& U = UProx.Get();
+    auto& V = VProx.Get();
+
+    typedef Base<F> Real;
+    const Int n = U.Height();
+    const Int bsize = Blocksize();
+    const F sigma = ( downdate ? F(-1) : F(1) );
+    const Grid& g = U.Grid();
+
+    Matrix<F> L11;
+    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), V1_STAR_STAR(g), T_STAR_STAR(g);
+    DistMatrix<F,STAR,MR> V1Conj_STAR_MR(g);
+    DistMatrix<F,STAR,MC> U12_STAR_MC(g), Z12_STAR_MC(g), W12_STAR_MC(g);
+
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto U11 = U( ind1, ind1 );
+        auto U12 = U( ind1, ind2 );
+
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        // Every process redundantly factors the (small) panel
+        U11_STAR_STAR = U11;
+        V1_STAR_STAR = V1;
+        Zeros( T_STAR_STAR, nb, nb );
+        Adjoint( U11_STAR_STAR.Matrix(), L11 );
+        LowerPanel
+        ( L11, V1_STAR_STAR.Matrix(), downdate, T_STAR_STAR.Matrix() );
+        for( Int j=0; j<nb; ++j )
+            for( Int i=0; i<=j; ++i )
+                U11_STAR_STAR.SetLocal( i, j, Conj(L11(j,i)) );
+
+        V1Conj_STAR_MR.AlignWith( V2 );
+        V1Conj_STAR_MR = V1_STAR_STAR;
+        Conjugate( V1Conj_STAR_MR );
+        Z12_STAR_MC.AlignWith( V2 );
+        Zeros( Z12_STAR_MC, nb, V2.Height() );
+        LocalGemm
+        ( NORMAL, ADJOINT, sigma, V1Conj_STAR_MR, V2, F(0), Z12_STAR_MC );
+        El::AllReduce( Z12_STAR_MC, V2.RowComm() );
+        U12_STAR_MC.AlignWith( V2 );
+        U12_STAR_MC = U12;
+        Z12_STAR_MC += U12_STAR_MC;
+        W12_STAR_MC.AlignWith( V2 );
+        Zeros( W12_STAR_MC, nb, V2.Height() );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(1), T_STAR_STAR, Z12_STAR_MC, F(0), W12_STAR_MC );
+        Axpy( F(-1), W12_STAR_MC, U12 );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(-1), W12_STAR_MC, V1Conj_STAR_MR, F(1), V2 );
+
+        // Negate the rows with a negative diagonal entry
+        for( Int j=0; j<nb; ++j )
+        {
+            if( RealPart(U11_STAR_STAR.GetLocal(j,j)) < Real(0) )
+            {
+                auto u11 = U11_STAR_STAR( IR(j), IR(j,END) );
+                Scale( F(-1), u11 );
+                auto u12 = U12( IR(j), ALL );
+                Scale( F(-1), u12 );
+            }
+        }
+        U11 = U11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+    }
+}
+
 } // namespace mod
 
+// Rank-one modifications are applied with a single sweep of the unblocked
+// algorithm, as the compact-WY panels only pay off for several columns
 template<typename F>
 void UpperMod( Matrix<F>& U, Base<F> alpha, Matrix<F>& V )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    if( alpha == Real(0) )
+    if( alpha == Real(0) || V.Width() == 0 )
         return;
     else if( alpha > Real(0) )
     {
         Scale(Sqrt(alpha), V);
-        mod::UpperUpdate( U, V );
+        if( V.Width() == 1 )
+            mod::UpperUpdate( U, V );
+        else
+            mod::UpperBlocked( U, V, false );
     }
     else
     {
         Scale(Sqrt(-alpha), V);
-        mod::UpperDowndate( U, V );
+        if( V.Width() == 1 )
+            mod::UpperDowndate( U, V );
+        else
+            mod::UpperBlocked( U, V, true );
     }
 }
 
@@ -294,17 +446,23 @@ void UpperMod
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    if( alpha == Real(0) )
+    if( alpha == Real(0) || V.Width() == 0 )
         return;
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::UpperUpdate( U, V );
+        if( V.Width() == 1 )
+            mod::UpperUpdate( U, V );
+        else
+            mod::UpperBlocked( U, V, false );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::UpperDowndate( U, V );
+        if( V.Width() == 1 )
+            mod::UpperDowndate( U, V );
+        else
+            mod::UpperBlocked( U, V, true );
     }
 }
 
@@ -53,6 +53,37 @@ void UpperVariant3Unblocked(Matrix<F>& A)
     }
 }
 
+// Factor a diagonal block using LAPACK's (blocked, and usually recursive)
+// kernel when it is available rather than the unblocked algorithm
+#ifdef HYDROGEN_HAVE_GPU
+template<typename F>
+void UpperDiagonalBlock(Matrix<F, Device::GPU>& A)
+{
+    UpperVariant3Unblocked(A);
+}
+#endif // HYDROGEN_HAVE_GPU
+
+#ifdef HYDROGEN_HAVE_LAPACK
+template<typename F, typename=EnableIf<IsBlasScalar<F>>>
+void UpperDiagonalBlock(Matrix<F,Device::CPU>& A)
+{
+    EL_DEBUG_CSE
+    lapack::Cholesky('U', A.Height(), A.Buffer(), A.LDim());
+}
+
+template<typename F, typename=DisableIf<IsBlasScalar<F>>, typename=void>
+void UpperDiagonalBlock(Matrix<F,Device::CPU>& A)
+{
+    UpperVariant3Unblocked(A);
+}
+#else
+template<typename F>
+void UpperDiagonalBlock(Matrix<F,Device::CPU>& A)
+{
+    UpperVariant3Unblocked(A);
+}
+#endif // HYDROGEN_HAVE_LAPACK
+
 template<typename F, Device D>
 void UpperVariant3Blocked(Matrix<F, D>& A)
 {
@@ -74,7 +105,7 @@ void UpperVariant3Blocked(Matrix<F, D>& A)
         auto A12 = A(ind1, ind2);
         auto A22 = A(ind2, ind2);
 
-        cholesky::UpperVariant3Unblocked(A11);
+        cholesky::UpperDiagonalBlock(A11);
         Trsm(LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12);
         Herk(UPPER, ADJOINT, Base<F>(-1), A12, Base<F>(1), A22);
     }
@@ -93,13 +124,23 @@ void UpperVariant3Blocked(AbstractDistMatrix<F>& APre)
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx(APre);
     auto& A = AProx.Get();
 
+    // The panels are drawn from the workspace, which is sized for the four
+    // panels (and their communication buffers) of the first iteration
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int panelHeight = MaxLength(n, Min(grid.Height(),grid.Width()));
+    WorkspaceScope workspace(2*size_t(4*panelHeight+bsize)*bsize*sizeof(F));
+
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
     DistMatrix<F,STAR,MC  > A12_STAR_MC(grid);
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
-    const Int n = A.Height();
-    const Int bsize = Blocksize();
+    UseWorkspace(A11_STAR_STAR);
+    UseWorkspace(A12_STAR_VR);
+    UseWorkspace(A12_STAR_MC);
+    UseWorkspace(A12_STAR_MR);
+
     for(Int k=0; k<n; k+=bsize)
     {
         const Int nb = Min(bsize,n-k);
@@ -0,0 +1,41 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Unlike the remainder of the QR factorizations, the Cholesky-based variants
+// only depend upon Herk, Cholesky, and Trsm and can therefore be built
+// independently of QR.cpp
+#include "./QR/Cholesky.hpp"
+
+namespace El {
+
+#define PROTO(F) \
+  template void qr::Cholesky \
+  ( Matrix<F>& A, \
+    Matrix<F>& R ); \
+  template void qr::Cholesky \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R ); \
+  template void qr::CholeskyQR2 \
+  ( Matrix<F>& A, \
+    Matrix<F>& R, \
+    const CholeskyQRCtrl<Base<F>>& ctrl ); \
+  template void qr::CholeskyQR2 \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R, \
+    const CholeskyQRCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
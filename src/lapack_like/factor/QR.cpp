@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/blas_like/level1/Copy.hpp>
 
 #include "./QR/ApplyQ.hpp"
 #include "./QR/BusingerGolub.hpp"
@@ -189,16 +190,12 @@ void QR
     const AbstractDistMatrix<Base<F>>& signature, \
     const AbstractDistMatrix<F>& B, \
           AbstractDistMatrix<F>& X ); \
-  template void qr::Cholesky \
-  ( Matrix<F>& A, \
-    Matrix<F>& R ); \
-  template void qr::Cholesky \
-  ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
-  template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
+  template qr::TreeData<F> qr::TS \
+  ( const AbstractDistMatrix<F>& A, TSQRTree tree ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
-    AbstractDistMatrix<F>& R ); \
+    AbstractDistMatrix<F>& R, \
+    TSQRTree tree ); \
   template Matrix<F>& qr::ts::RootQR \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template const Matrix<F>& qr::ts::RootQR \
@@ -206,7 +203,22 @@ void QR
   template void qr::ts::Reduce \
   ( const AbstractDistMatrix<F>& A, TreeData<F>& treeData ); \
   template void qr::ts::Scatter \
-  ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData );
+  ( AbstractDistMatrix<F>& A, const TreeData<F>& treeData ); \
+  template void qr::ts::ApplyQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+    const Matrix<F>& C, \
+          AbstractDistMatrix<F>& B ); \
+  template void qr::ts::ApplyQAdjoint \
+  ( const AbstractDistMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+    const AbstractDistMatrix<F>& B, \
+          Matrix<F>& C ); \
+  template void qr::ts::SolveAfter \
+  ( const AbstractDistMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+    const AbstractDistMatrix<F>& B, \
+          Matrix<F>& X );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
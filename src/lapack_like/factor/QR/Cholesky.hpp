@@ -51,6 +51,162 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
 }
 
+namespace cholesky_qr {
+
+// Overwrite G with the upper triangle of A^H A, where A is the local portion
+// of a matrix whose rows are distributed over the communicator (if any)
+template<typename F>
+void Gram( const Matrix<F>& A, Matrix<F>& G, const mpi::Comm* comm )
+{
+    EL_DEBUG_CSE
+    Zeros( G, A.Width(), A.Width() );
+    Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), G );
+    if( comm != nullptr )
+        El::AllReduce( G, *comm );
+}
+
+// Attempt to overwrite R with the upper Cholesky factor of A^H A + shift I.
+// False is returned if the shifted Gram matrix was not numerically HPD or if
+// the ratio of the largest and smallest diagonal entries of R exceeds maxCond
+// (a lower bound on the condition number of A).
+template<typename F>
+bool GramCholesky
+( const Matrix<F>& A, Matrix<F>& R, Base<F> shift, Base<F> maxCond,
+  const mpi::Comm* comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    Gram( A, R, comm );
+    if( shift != Real(0) )
+        ShiftDiagonal( R, shift );
+    try { El::Cholesky( UPPER, R ); }
+    catch( NonHPDMatrixException& e ) { return false; }
+    MakeTrapezoidal( UPPER, R );
+
+    Real minDiag=limits::Max<Real>(), maxDiag=0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Real rho = RealPart(R(j,j));
+        minDiag = Min( minDiag, rho );
+        maxDiag = Max( maxDiag, rho );
+    }
+    return n == 0 || maxDiag <= maxCond*minDiag;
+}
+
+// The shift of Fukaya et al., "Shifted Cholesky QR for computing the QR
+// factorization of ill-conditioned matrices", with the squared two-norm of A
+// replaced by its upper bound, the trace of A^H A
+template<typename F>
+Base<F> Shift( const Matrix<F>& A, const mpi::Comm* comm, Int m )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    Real frobSquared = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            frobSquared += Abs(A(i,j))*Abs(A(i,j));
+    if( comm != nullptr )
+        frobSquared =
+          mpi::AllReduce( frobSquared, *comm, SyncInfo<Device::CPU>() );
+    return Real(11)*Real(m*n+n*(n+1))*limits::Epsilon<Real>()*frobSquared;
+}
+
+// Run the passes of (shifted) Cholesky QR upon the local rows of A, which
+// are distributed over the given communicator (if any), accumulating the
+// triangular factors into R
+template<typename F>
+void Passes
+( Matrix<F>& A, Matrix<F>& R, Int m, const mpi::Comm* comm,
+  const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real maxCond =
+      ( ctrl.maxCond > Real(0) ? ctrl.maxCond : Real(1)/Sqrt(eps) );
+    if( ctrl.numPasses < 1 )
+        LogicError("Cholesky QR requires at least one pass");
+
+    Matrix<F> RPass, RProd;
+    Int numPasses = ctrl.numPasses;
+    bool succeeded = false;
+    if( !ctrl.forceShift )
+    {
+        succeeded = GramCholesky( A, RPass, Real(0), maxCond, comm );
+        if( !succeeded && !ctrl.allowShift )
+            throw NonHPDMatrixException("A^H A was not numerically HPD");
+    }
+    if( !succeeded )
+    {
+        // The shifted pass only yields a well-conditioned A inv(R), so an
+        // additional unshifted pass is required to preserve the accuracy
+        const Real shift = Shift( A, comm, m );
+        if( !GramCholesky( A, RPass, shift, Real(1)/eps, comm ) )
+            throw NonHPDMatrixException
+            ("A^H A + shift I was not numerically HPD");
+        ++numPasses;
+    }
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), RPass, A );
+    R = RPass;
+
+    for( Int pass=1; pass<numPasses; ++pass )
+    {
+        if( !GramCholesky( A, RPass, Real(0), Real(1)/eps, comm ) )
+            throw NonHPDMatrixException("A inv(R)^H A inv(R) was not HPD");
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), RPass, A );
+        // R is small, so the product of the triangular factors is simply
+        // formed with a Gemm
+        Gemm( NORMAL, NORMAL, F(1), RPass, R, RProd );
+        R = RProd;
+    }
+}
+
+} // namespace cholesky_qr
+
+// Repeated Cholesky QR, which, with two passes, yields a Q which is
+// orthonormal to working precision whenever the condition number of A is
+// less than roughly 1/sqrt(eps). When the first Gram matrix is not
+// numerically HPD, or its Cholesky factor is too ill-conditioned, a shifted
+// first pass is performed instead, which extends the applicability of the
+// algorithm to condition numbers of roughly 1/eps at the cost of one more
+// pass.
+//
+// A is overwritten with Q and R is returned with a positive diagonal.
+
+template<typename F>
+void CholeskyQR2
+( Matrix<F>& A, Matrix<F>& R, const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A^H A will be singular");
+    cholesky_qr::Passes( A, R, A.Height(), nullptr, ctrl );
+}
+
+template<typename F>
+void CholeskyQR2
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre,
+  const CholeskyQRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+        LogicError("A^H A will be singular");
+
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& A = AProx.Get();
+    auto& R = RProx.Get();
+
+    // Each pass requires a single AllReduce of the Gram matrix, after which
+    // the Cholesky factorization is redundantly computed by every process
+    R.Resize( n, n );
+    cholesky_qr::Passes( A.Matrix(), R.Matrix(), m, &A.ColComm(), ctrl );
+}
+
 } // namespace qr
 } // namespace El
 
@@ -13,6 +13,174 @@ namespace El {
 namespace qr {
 namespace ts {
 
+namespace tree {
+
+// Append the steps of a binary reduction over the given members (specified
+// by their ranks in the column communicator) to the first member. This
+// process, the index'th member, records each partner whose triangular factor
+// it receives and the parent which it sends its own factor to.
+inline void BinarySteps
+( const vector<int>& members, Int index, vector<int>& partners, int& parent )
+{
+    EL_DEBUG_CSE
+    const Int numMembers = members.size();
+    for( Int stride=1; stride<numMembers; stride*=2 )
+    {
+        if( index % (2*stride) != 0 )
+        {
+            parent = members[index-stride];
+            return;
+        }
+        if( index+stride < numMembers )
+            partners.push_back( members[index+stride] );
+    }
+}
+
+// Determine the steps of the requested reduction tree for this process.
+// Every tree is rooted at process zero of the column communicator.
+inline void Schedule
+( TSQRTree treeType, mpi::Comm const& colComm,
+  vector<int>& partners, int& parent )
+{
+    EL_DEBUG_CSE
+    const int p = mpi::Size( colComm );
+    const int rank = mpi::Rank( colComm );
+    partners.resize( 0 );
+    parent = -1;
+    if( treeType == TSQR_BUTTERFLY )
+    {
+        if( !PowerOfTwo(p) )
+            LogicError
+            ("The butterfly TSQR tree requires a power-of-two number of "
+             "processes");
+        for( int stride=1; stride<p; stride*=2 )
+            partners.push_back( rank ^ stride );
+    }
+    else if( treeType == TSQR_HIERARCHICAL )
+    {
+        SyncInfo<Device::CPU> syncInfo;
+
+        // Reduce within each node to its lowest rank...
+        mpi::Comm nodeComm;
+        mpi::SplitShared( colComm, rank, nodeComm );
+        const int nodeSize = mpi::Size( nodeComm );
+        const int nodeRank = mpi::Rank( nodeComm );
+        vector<int> nodeMembers( nodeSize );
+        mpi::AllGather( &rank, 1, nodeMembers.data(), 1, nodeComm, syncInfo );
+        BinarySteps( nodeMembers, nodeRank, partners, parent );
+
+        // ...and then over the roots of the nodes
+        const int isRoot = ( nodeRank == 0 );
+        vector<int> isRoots( p );
+        mpi::AllGather( &isRoot, 1, isRoots.data(), 1, colComm, syncInfo );
+        if( isRoot )
+        {
+            vector<int> roots;
+            Int index = 0;
+            for( int q=0; q<p; ++q )
+            {
+                if( !isRoots[q] )
+                    continue;
+                if( q == rank )
+                    index = roots.size();
+                roots.push_back( q );
+            }
+            BinarySteps( roots, index, partners, parent );
+        }
+    }
+    else
+    {
+        vector<int> members( p );
+        for( int q=0; q<p; ++q )
+            members[q] = q;
+        BinarySteps( members, rank, partners, parent );
+    }
+}
+
+} // namespace tree
+
+// The local portion of a distributed matrix, which must reside on the CPU
+template<typename F>
+Matrix<F>& LocalMatrix( AbstractDistMatrix<F>& A )
+{
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("TSQR is only supported on the CPU");
+    return static_cast<Matrix<F>&>( A.Matrix() );
+}
+
+template<typename F>
+const Matrix<F>& LockedLocalMatrix( const AbstractDistMatrix<F>& A )
+{
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("TSQR is only supported on the CPU");
+    return static_cast<const Matrix<F>&>( A.LockedMatrix() );
+}
+
+// Return the n x n upper-triangular factor from a QR factorization of a
+// matrix with possibly fewer than n rows, padded with zeros
+template<typename F>
+Matrix<F> PaddedTriangle( const Matrix<F>& QR, Int n )
+{
+    EL_DEBUG_CSE
+    const Int k = Min(QR.Height(),n);
+    Matrix<F> R;
+    Zeros( R, n, n );
+    auto RTop = R( IR(0,k), ALL );
+    Copy( QR( IR(0,k), ALL ), RTop );
+    MakeTrapezoidal( UPPER, R );
+    return R;
+}
+
+// Stack the n x k matrices of this process and its partner, with the one
+// from the lower rank on top
+template<typename F>
+void Stack
+( const Matrix<F>& mine, const Matrix<F>& theirs, bool top, Matrix<F>& Z )
+{
+    EL_DEBUG_CSE
+    const Int n = mine.Height();
+    Z.Resize( 2*n, mine.Width() );
+    auto ZTop = Z( IR(0,n),   ALL );
+    auto ZBot = Z( IR(n,2*n), ALL );
+    Copy( top ? mine : theirs, ZTop );
+    Copy( top ? theirs : mine, ZBot );
+}
+
+// Exchange (or just send or receive) contiguous n x k matrices
+template<typename F>
+void Send( const Matrix<F>& Z, int to, mpi::Comm const& comm )
+{
+    Matrix<F> ZCopy( Z );
+    mpi::Send
+    ( ZCopy.LockedBuffer(), ZCopy.Height()*ZCopy.Width(), to, comm,
+      SyncInfo<Device::CPU>{} );
+}
+
+template<typename F>
+void Recv( Matrix<F>& Z, Int n, Int k, int from, mpi::Comm const& comm )
+{
+    Z.Resize( n, k, Max(n,1) );
+    mpi::Recv( Z.Buffer(), n*k, from, comm, SyncInfo<Device::CPU>{} );
+}
+
+template<typename F>
+void SendRecv
+( const Matrix<F>& Z, Matrix<F>& ZPartner, int partner,
+  mpi::Comm const& comm )
+{
+    Matrix<F> ZCopy( Z );
+    const Int n = Z.Height();
+    const Int k = Z.Width();
+    ZPartner.Resize( n, k, Max(n,1) );
+    mpi::SendRecv
+    ( ZCopy.LockedBuffer(), n*k, partner,
+      ZPartner.Buffer(),    n*k, partner, comm, SyncInfo<Device::CPU>{} );
+}
+
+// Combine the triangular factors along the steps of the tree. Note that the
+// last step on the root (on every process for the butterfly tree) is not
+// factored by this routine, as many higher-level routines, such as TS-SVT,
+// are simplified if the final small matrix is left alone.
 template<typename F>
 void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -21,68 +189,43 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
       if( A.RowDist() != STAR )
           LogicError("Invalid row distribution for TSQR");
     )
-    const Int m =  A.Height();
     const Int n = A.Width();
-    const mpi::Comm colComm = A.ColComm();
-    const Int p = mpi::Size( colComm );
-    if( p == 1 )
+    mpi::Comm const& colComm = A.ColComm();
+    const int rank = mpi::Rank( colComm );
+    if( mpi::Size(colComm) == 1 )
         return;
-    const Int rank = mpi::Rank( colComm );
-    if( m < p*n )
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    Matrix<F> lastZ;
-    lastZ = treeData.QR0( IR(0,n), IR(0,n) );
-
-    treeData.QRList.resize( logp );
-    treeData.householderScalarsList.resize( logp );
-    treeData.signatureList.resize( logp );
-
-    // Run the binary tree reduction
-    Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+
+    auto& partners = treeData.partners;
+    tree::Schedule( treeData.tree, colComm, partners, treeData.parent );
+    const Int numSteps = partners.size();
+    const bool butterfly = ( treeData.tree == TSQR_BUTTERFLY );
+    treeData.QRList.resize( numSteps );
+    treeData.householderScalarsList.resize( numSteps );
+    treeData.signatureList.resize( numSteps );
+
+    Matrix<F> lastR = PaddedTriangle( treeData.QR0, n ), partnerR;
+    for( Int step=0; step<numSteps; ++step )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
+        const int partner = partners[step];
+        if( butterfly )
+            SendRecv( lastR, partnerR, partner, colComm );
         else
-        {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
-            break;
-        }
+            Recv( partnerR, n, n, partner, colComm );
 
-        auto& QRFact = treeData.QRList[stage];
-        auto& householderScalars = treeData.householderScalarsList[stage];
-        auto& signature = treeData.signatureList[stage];
-        QRFact.Resize( 2*n, n, 2*n );
-        householderScalars.Resize( n, 1 );
-        signature.Resize( n, 1 );
-        auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
-        auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
-        QRFactBot = ZBot;
-
-        // Note that the last QR is not performed by this routine, as many
-        // higher-level routines, such as TS-SVT, are simplified if the final
-        // small matrix is left alone.
-        if( stage < logp-1 )
+        auto& QRFact = treeData.QRList[step];
+        Stack( lastR, partnerR, rank < partner, QRFact );
+        if( step < numSteps-1 || treeData.parent != -1 )
         {
             // TODO: Exploit double-triangular structure
-            QR( QRFact, householderScalars, signature );
-            lastZ = QRFact( IR(0,n), IR(0,n) );
+            QR
+            ( QRFact,
+              treeData.householderScalarsList[step],
+              treeData.signatureList[step] );
+            lastR = PaddedTriangle( QRFact, n );
         }
     }
+    if( treeData.parent != -1 )
+        Send( lastR, treeData.parent, colComm );
 }
 
 template<typename F>
@@ -91,14 +234,11 @@ RootQR( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    const Int rank = mpi::Rank( A.ColComm() );
-    if( rank != 0 )
-        LogicError("This process does not have access to the root QR");
-    if( p == 1 )
+    if( mpi::Size(A.ColComm()) == 1 )
         return treeData.QR0;
-    else
-        return treeData.QRList.back();
+    if( treeData.parent != -1 || treeData.QRList.empty() )
+        LogicError("This process does not have access to the root QR");
+    return treeData.QRList.back();
 }
 
 template<typename F>
@@ -107,14 +247,11 @@ RootQR( const AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    const Int rank = mpi::Rank( A.ColComm() );
-    if( rank != 0 )
-        LogicError("This process does not have access to the root QR");
-    if( p == 1 )
+    if( mpi::Size(A.ColComm()) == 1 )
         return treeData.QR0;
-    else
-        return treeData.QRList.back();
+    if( treeData.parent != -1 || treeData.QRList.empty() )
+        LogicError("This process does not have access to the root QR");
+    return treeData.QRList.back();
 }
 
 template<typename F>
@@ -123,15 +260,12 @@ RootHouseholderScalars( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    const Int rank = mpi::Rank( A.ColComm() );
-    if( rank != 0 )
+    if( mpi::Size(A.ColComm()) == 1 )
+        return treeData.householderScalars0;
+    if( treeData.parent != -1 || treeData.QRList.empty() )
         LogicError
         ("This process does not have access to the root Householder scalars");
-    if( p == 1 )
-        return treeData.householderScalars0;
-    else
-        return treeData.householderScalarsList.back();
+    return treeData.householderScalarsList.back();
 }
 
 template<typename F>
@@ -141,15 +275,12 @@ RootHouseholderScalars
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    const Int rank = mpi::Rank( A.ColComm() );
-    if( rank != 0 )
+    if( mpi::Size(A.ColComm()) == 1 )
+        return treeData.householderScalars0;
+    if( treeData.parent != -1 || treeData.QRList.empty() )
         LogicError
         ("This process does not have access to the root Householder scalars");
-    if( p == 1 )
-        return treeData.householderScalars0;
-    else
-        return treeData.householderScalarsList.back();
+    return treeData.householderScalarsList.back();
 }
 
 template<typename F>
@@ -158,14 +289,11 @@ RootSignature( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    const Int rank = mpi::Rank( A.ColComm() );
-    if( rank != 0 )
-        LogicError("This process does not have access to the root signature");
-    if( p == 1 )
+    if( mpi::Size(A.ColComm()) == 1 )
         return treeData.signature0;
-    else
-        return treeData.signatureList.back();
+    if( treeData.parent != -1 || treeData.QRList.empty() )
+        LogicError("This process does not have access to the root signature");
+    return treeData.signatureList.back();
 }
 
 template<typename F>
@@ -174,90 +302,96 @@ RootSignature( const AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    const Int p = mpi::Size( A.ColComm() );
-    const Int rank = mpi::Rank( A.ColComm() );
-    if( rank != 0 )
-        LogicError("This process does not have access to the root signature");
-    if( p == 1 )
+    if( mpi::Size(A.ColComm()) == 1 )
         return treeData.signature0;
-    else
-        return treeData.signatureList.back();
+    if( treeData.parent != -1 || treeData.QRList.empty() )
+        LogicError("This process does not have access to the root signature");
+    return treeData.signatureList.back();
 }
 
+// Given the 2n x k result, W, of applying the root's last step to a matrix
+// (only referenced on the root, or on every process for the butterfly tree),
+// apply the remaining steps in reverse order and then the local Q, so that
+// BLoc is overwritten with this process's rows of the result
 template<typename F>
-void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
+void Descend
+( const AbstractDistMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const Matrix<F>& WRoot,
+        Matrix<F>& BLoc )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( A.RowDist() != STAR )
-          LogicError("Invalid row distribution for TSQR");
-    )
-    const Int m = A.Height();
     const Int n = A.Width();
-    const mpi::Comm colComm = A.ColComm();
-    const Int p = mpi::Size( colComm );
-    if( p == 1 )
-        return;
-    const Int rank = mpi::Rank( colComm );
-    if( m < p*n )
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    // Run the binary tree scatter
-    Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
-    if( rank == 0 )
-        Z = RootQR( A, treeData );
-    auto ZTop = Z( IR(0,n),   IR(0,n) );
-    auto ZBot = Z( IR(n,2*n), IR(0,n) );
-    for( Int revStage=0; revStage<logp; ++revStage )
+    const Int k = WRoot.Width();
+    mpi::Comm const& colComm = A.ColComm();
+    const int rank = mpi::Rank( colComm );
+    const auto& partners = treeData.partners;
+    const Int numSteps = partners.size();
+    const bool butterfly = ( treeData.tree == TSQR_BUTTERFLY );
+    const bool root = ( treeData.parent == -1 );
+
+    Matrix<F> Z, W;
+    if( !root )
+        Recv( Z, n, k, treeData.parent, colComm );
+    for( Int step=numSteps-1; step>=0; --step )
     {
-        const Int stage = (logp-1)-revStage;
-        // Skip this stage if the first stage bits of our rank are not zero
-        if( stage>0 && (Unsigned(rank) & ((Unsigned(1)<<stage)-1)) )
-            continue;
-
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
+        if( root && step == numSteps-1 )
         {
-            if( stage < logp-1 )
-            {
-                // Multiply by the current Q
-                ZTop = ZHalf;
-                Zero( ZBot );
-
-                // TODO: Exploit sparsity?
-                ApplyQ
-                ( LEFT, NORMAL,
-                  treeData.QRList[stage],
-                  treeData.householderScalarsList[stage],
-                  treeData.signatureList[stage],
-                  Z );
-            }
-            // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
-            ZHalf = ZTop;
+            Copy( WRoot, W );
         }
         else
         {
-            // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            // TODO: Exploit sparsity?
+            Zeros( W, 2*n, k );
+            auto WTop = W( IR(0,n), ALL );
+            Copy( Z, WTop );
+            qr::ApplyQ
+            ( LEFT, NORMAL,
+              treeData.QRList[step],
+              treeData.householderScalarsList[step],
+              treeData.signatureList[step],
+              W );
         }
+        // The butterfly tree keeps whichever half corresponds to this process
+        // rather than sending the bottom half to the partner
+        const bool top = ( rank < partners[step] );
+        if( !butterfly )
+            Send( W(IR(n,2*n),ALL), partners[step], colComm );
+        Copy( W( top ? IR(0,n) : IR(n,2*n), ALL ), Z );
     }
 
     // Apply the initial Q
-    Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
-    ATop = ZHalf;
+    const Int mLoc = treeData.QR0.Height();
+    const Int kLoc = Min(mLoc,n);
+    Zeros( BLoc, mLoc, k );
+    auto BLocTop = BLoc( IR(0,kLoc), ALL );
+    Copy( Z( IR(0,kLoc), ALL ), BLocTop );
 
     // TODO: Exploit sparsity
-    ApplyQ
+    qr::ApplyQ
     ( LEFT, NORMAL,
-      treeData.QR0, treeData.householderScalars0, treeData.signature0,
-      A.Matrix() );
+      treeData.QR0, treeData.householderScalars0, treeData.signature0, BLoc );
+}
+
+template<typename F>
+void Scatter( AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.RowDist() != STAR )
+          LogicError("Invalid row distribution for TSQR");
+    )
+    if( mpi::Size(A.ColComm()) == 1 )
+        return;
+
+    // The explicit Q of the root's last step is stored in place of its
+    // factorization
+    Matrix<F> WRoot;
+    if( treeData.parent == -1 )
+        WRoot = RootQR( A, treeData );
+    else
+        WRoot.Resize( 0, A.Width() );
+    Descend( A, treeData, WRoot, LocalMatrix(A) );
 }
 
 template<typename F>
@@ -267,18 +401,24 @@ FormR( const AbstractDistMatrix<F>& A, const TreeData<F>& treeData )
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
     const Grid& g = A.Grid();
+    const Int n = A.Width();
+    DistMatrix<F,STAR,STAR> R(g);
+    if( treeData.tree == TSQR_BUTTERFLY || mpi::Size(A.ColComm()) == 1 )
+    {
+        // Every process already has a copy of R
+        R.Resize( n, n );
+        R.Matrix() = PaddedTriangle( RootQR(A,treeData), n );
+        return R;
+    }
     DistMatrix<F,CIRC,CIRC> RRoot(g);
     if( A.ColRank() == 0 )
     {
-        const Int n = A.Width();
-        auto R = RootQR(A,treeData);
-        auto RTop = R( IR(0,n), IR(0,n) );
-        CopyFromRoot( RTop, RRoot );
+        auto RTop = RootQR(A,treeData)( IR(0,n), IR(0,n) );
+        CopyFromRoot( RTop, RRoot, false );
         MakeTrapezoidal( UPPER, RRoot );
     }
     else
-        CopyFromNonRoot( RRoot );
-    DistMatrix<F,STAR,STAR> R(g);
+        CopyFromNonRoot( RRoot, false );
     R = RRoot;
     return R;
 }
@@ -293,15 +433,16 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     const Int p = mpi::Size( A.ColComm() );
     if( p == 1 )
     {
-        A.Matrix() = treeData.QR0;
+        Matrix<F>& ALoc = LocalMatrix( A );
+        Copy( treeData.QR0, ALoc );
         ExpandPackedReflectors
         ( LOWER, VERTICAL, CONJUGATED, 0,
-          A.Matrix(), RootHouseholderScalars(A,treeData) );
-        DiagonalScale( RIGHT, NORMAL, RootSignature(A,treeData), A.Matrix() );
+          ALoc, RootHouseholderScalars(A,treeData) );
+        DiagonalScale( RIGHT, NORMAL, RootSignature(A,treeData), ALoc );
     }
     else
     {
-        if( A.ColRank() == 0 )
+        if( treeData.parent == -1 )
         {
             ExpandPackedReflectors
             ( LOWER, VERTICAL, CONJUGATED, 0,
@@ -313,22 +454,143 @@ FormQ( AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     }
 }
 
+template<typename F>
+void ApplyQ
+( const AbstractDistMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const Matrix<F>& C,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    if( C.Height() != n )
+        LogicError("C must have the same number of rows as A has columns");
+    if( B.ColDist() != A.ColDist() || B.RowDist() != STAR )
+        LogicError("B must be distributed like A");
+    B.AlignWith( A );
+    B.Resize( A.Height(), C.Width() );
+    if( mpi::Size(A.ColComm()) == 1 )
+    {
+        Matrix<F>& BLoc = LocalMatrix( B );
+        Zeros( BLoc, A.Height(), C.Width() );
+        auto BTop = BLoc( IR(0,n), ALL );
+        Copy( C, BTop );
+        qr::ApplyQ
+        ( LEFT, NORMAL,
+          treeData.QR0, treeData.householderScalars0, treeData.signature0,
+          BLoc );
+        return;
+    }
+
+    Matrix<F> WRoot;
+    if( treeData.parent == -1 )
+    {
+        Zeros( WRoot, 2*n, C.Width() );
+        auto WTop = WRoot( IR(0,n), ALL );
+        Copy( C, WTop );
+        qr::ApplyQ
+        ( LEFT, NORMAL,
+          RootQR(A,treeData),
+          RootHouseholderScalars(A,treeData),
+          RootSignature(A,treeData),
+          WRoot );
+    }
+    else
+        WRoot.Resize( 0, C.Width() );
+    Descend( A, treeData, WRoot, LocalMatrix(B) );
+}
+
+template<typename F>
+void ApplyQAdjoint
+( const AbstractDistMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const AbstractDistMatrix<F>& B,
+        Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int k = B.Width();
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    if( B.ColDist() != A.ColDist() || B.RowDist() != STAR ||
+        B.ColAlign() != A.ColAlign() || B.Height() != A.Height() )
+        LogicError("B must be distributed like A");
+    mpi::Comm const& colComm = A.ColComm();
+    const int rank = mpi::Rank( colComm );
+
+    // Apply the local Q^H and keep the (padded) top n rows
+    Matrix<F> BLoc( LockedLocalMatrix(B) );
+    qr::ApplyQ
+    ( LEFT, ADJOINT,
+      treeData.QR0, treeData.householderScalars0, treeData.signature0, BLoc );
+    const Int kLoc = Min(BLoc.Height(),n);
+    Zeros( C, n, k );
+    auto CTop = C( IR(0,kLoc), ALL );
+    Copy( BLoc( IR(0,kLoc), ALL ), CTop );
+    if( mpi::Size(colComm) == 1 )
+        return;
+
+    // Combine the contributions along the same tree as the factorization
+    const auto& partners = treeData.partners;
+    const Int numSteps = partners.size();
+    const bool butterfly = ( treeData.tree == TSQR_BUTTERFLY );
+    Matrix<F> CPartner, W;
+    for( Int step=0; step<numSteps; ++step )
+    {
+        const int partner = partners[step];
+        if( butterfly )
+            SendRecv( C, CPartner, partner, colComm );
+        else
+            Recv( CPartner, n, k, partner, colComm );
+        Stack( C, CPartner, rank < partner, W );
+        qr::ApplyQ
+        ( LEFT, ADJOINT,
+          treeData.QRList[step],
+          treeData.householderScalarsList[step],
+          treeData.signatureList[step],
+          W );
+        Copy( W( IR(0,n), ALL ), C );
+    }
+    if( butterfly )
+        return;
+    if( treeData.parent != -1 )
+        Send( C, treeData.parent, colComm );
+
+    C.Resize( n, k, Max(n,1) );
+    mpi::Broadcast( C.Buffer(), n*k, 0, colComm, SyncInfo<Device::CPU>{} );
+}
+
+template<typename F>
+void SolveAfter
+( const AbstractDistMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const AbstractDistMatrix<F>& B,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    ApplyQAdjoint( A, treeData, B, X );
+    auto R = FormR( A, treeData );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), X );
+}
+
 } // namespace ts
 
 template<typename F>
-TreeData<F> TS( const AbstractDistMatrix<F>& A )
+TreeData<F> TS( const AbstractDistMatrix<F>& A, TSQRTree tree )
 {
     if( A.RowDist() != STAR )
         LogicError("Invalid row distribution for TSQR");
-    TreeData<F> treeData;
-    treeData.QR0 = A.LockedMatrix();
+    TreeData<F> treeData( 0, tree );
+    treeData.QR0 = ts::LockedLocalMatrix( A );
     QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
 
     const Int p = mpi::Size( A.ColComm() );
     if( p != 1 )
     {
         ts::Reduce( A, treeData );
-        if( A.ColRank() == 0 )
+        if( treeData.parent == -1 )
             QR
             ( ts::RootQR(A,treeData),
               ts::RootHouseholderScalars(A,treeData),
@@ -338,9 +600,10 @@ TreeData<F> TS( const AbstractDistMatrix<F>& A )
 }
 
 template<typename F>
-void ExplicitTS( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R )
+void ExplicitTS
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& R, TSQRTree tree )
 {
-    auto treeData = TS( A );
+    auto treeData = TS( A, tree );
     Copy( ts::FormR( A, treeData ), R );
     ts::FormQ( A, treeData );
 }
@@ -16,126 +16,147 @@ namespace El {
 
 namespace sign {
 
+// Form XNew := inv(X) from the QR decomposition X = Q R as (Q R^{-H})^H,
+// which only requires the (already compiled) Householder QR and Trsm. The
+// returned value is log |det(X)| / n, which is needed for determinantal
+// scaling.
 template<typename Field>
-void
-NewtonStep
+Base<Field>
+QRInverse
 ( const Matrix<Field>& X,
         Matrix<Field>& XNew,
-  SignScaling scaling=SIGN_SCALE_FROB )
+        Matrix<Field>& XTmp,
+        Matrix<Field>& R )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-
-    // Calculate mu while forming XNew := inv(X)
-    Real mu=1;
-    Permutation P;
-    XNew = X;
-    LU( XNew, P );
-    if( scaling == SIGN_SCALE_DET )
+    const Int n = X.Height();
+    Copy( X, XTmp );
+    qr::Explicit( XTmp, R );
+    Real logAbsDet = 0;
+    for( Int j=0; j<n; ++j )
     {
-        SafeProduct<Field> det = det::AfterLUPartialPiv( XNew, P );
-        mu = Real(1)/Exp(det.kappa);
+        if( R(j,j) == Field(0) )
+            throw SingularMatrixException();
+        logAbsDet += Log( Abs(R(j,j)) );
     }
-    inverse::AfterLUPartialPiv( XNew, P );
-    if( scaling == SIGN_SCALE_FROB )
-        mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
-
-    // Overwrite XNew with the new iterate
-    const Real halfMu = mu/Real(2);
-    const Real halfMuInv = Real(1)/(2*mu);
-    XNew *= halfMuInv;
-    Axpy( halfMu, X, XNew );
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), R, XTmp );
+    Adjoint( XTmp, XNew );
+    return logAbsDet / Real(n);
 }
 
 template<typename Field>
-void
-NewtonStep
+Base<Field>
+QRInverse
 ( const DistMatrix<Field>& X,
         DistMatrix<Field>& XNew,
+        DistMatrix<Field>& XTmp,
+        DistMatrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = X.Height();
+    Copy( X, XTmp );
+    qr::Explicit( XTmp, R );
+    DistMatrix<Field,STAR,STAR> d( X.Grid() );
+    GetDiagonal( R, d );
+    Real logAbsDet = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        if( d.GetLocal(j,0) == Field(0) )
+            throw SingularMatrixException();
+        logAbsDet += Log( Abs(d.GetLocal(j,0)) );
+    }
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), R, XTmp );
+    Adjoint( XTmp, XNew );
+    return logAbsDet / Real(n);
+}
+
+template<typename Field,class Mat>
+void
+NewtonStep
+( const Mat& X,
+        Mat& XNew,
+        Mat& XTmp,
+        Mat& R,
   SignScaling scaling=SIGN_SCALE_FROB )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
 
-    // Calculate mu while forming B := inv(X)
+    // Calculate mu while forming XNew := inv(X)
     Real mu=1;
-    DistPermutation P( X.Grid() );
-    XNew = X;
-    LU( XNew, P );
+    const Real kappa = QRInverse( X, XNew, XTmp, R );
     if( scaling == SIGN_SCALE_DET )
-    {
-        SafeProduct<Field> det = det::AfterLUPartialPiv( XNew, P );
-        mu = Real(1)/Exp(det.kappa);
-    }
-    inverse::AfterLUPartialPiv( XNew, P );
-    if( scaling == SIGN_SCALE_FROB )
+        mu = Real(1)/Exp(kappa);
+    else if( scaling == SIGN_SCALE_FROB )
         mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
 
     // Overwrite XNew with the new iterate
     const Real halfMu = mu/Real(2);
     const Real halfMuInv = Real(1)/(2*mu);
-    XNew *= halfMuInv;
+    Scale( halfMuInv, XNew );
     Axpy( halfMu, X, XNew );
 }
 
-template<typename Field>
-void
-NewtonSchulzStep
-( const Matrix<Field>& X,
-        Matrix<Field>& XTmp,
-        Matrix<Field>& XNew )
+// Overwrite XTmp with 3I - X^2 and return || I - X^2 ||_1; the Newton-Schulz
+// iteration is guaranteed to converge if the latter is less than one
+template<typename Field,class Mat>
+Base<Field>
+NewtonSchulzResidual( const Mat& X, Mat& XTmp )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = X.Height();
-
-    // XTmp := 3I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(1), XTmp );
+    const Base<Field> oneRes = OneNorm( XTmp );
+    ShiftDiagonal( XTmp, Field(2) );
+    return oneRes;
 }
 
-template<typename Field>
+// XNew := 1/2 X (3I - X^2), where XTmp must already hold 3I - X^2
+template<typename Field,class Mat>
 void
-NewtonSchulzStep
-( const DistMatrix<Field>& X,
-        DistMatrix<Field>& XTmp,
-        DistMatrix<Field>& XNew )
+NewtonSchulzStep( const Mat& X, const Mat& XTmp, Mat& XNew )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    const Int n = X.Height();
-
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, Field(Real(1)/Real(2)), X, XTmp, XNew );
 }
 
 // Please see Chapter 5 of Higham's
 // "Functions of Matrices: Theory and Computation" for motivation behind
 // the different choices of p, which are usually in {0,1,2}
-template<typename Field>
-Int
-Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+//
+// Once the iterates are close enough to sign(A) that || I - X^2 ||_1 < 1/2,
+// the inverse-free Newton-Schulz iteration, which consists only of Gemm
+// calls, replaces the Newton iteration (if ctrl.newtonSchulz is true). The
+// residual is only checked once an iterate has changed by less than a quarter
+// of its norm, and, after the switch, doubles as the first half of the next
+// Newton-Schulz step.
+template<typename Field,class Mat>
+SignInfo
+NewtonLoop( Mat& A, const SignCtrl<Base<Field>>& ctrl, bool progress )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     Real tol = ctrl.tol;
     if( tol == Real(0) )
         tol = A.Height()*limits::Epsilon<Real>();
-
-    Int numIts=0;
-    Matrix<Field> B;
-    Matrix<Field> *X=&A, *XNew=&B;
-    while( numIts < ctrl.maxIts )
+    const Real schulzTol = Real(1)/Real(2);
+
+    // The workspace is shared by every iteration
+    SignInfo info;
+    Mat B( A ), XTmp( A ), R( A );
+    Mat *X=&A, *XNew=&B;
+    bool schulz = false;
+    while( info.numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        if( schulz )
+            NewtonSchulzStep<Field>( *X, XTmp, *XNew );
+        else
+            NewtonStep<Field>( *X, *XNew, XTmp, R, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -143,94 +164,80 @@ Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
         const Real oneNew = OneNorm( *XNew );
 
         // Ensure that X holds the current iterate and break if possible
-        ++numIts;
+        ++info.numIts;
+        if( schulz )
+            ++info.numNewtonSchulzIts;
         std::swap( X, XNew );
-        if( ctrl.progress )
-            cout << "after " << numIts << " Newton iter's: "
+        if( progress )
+            cout << "after " << info.numIts
+                 << (schulz ? " Newton-Schulz" : " Newton") << " iter's: "
                  << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
                  << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
                  << tol << endl;
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
+
+        if( ctrl.newtonSchulz && (schulz || 4*oneDiff <= oneNew) )
+        {
+            const Real oneRes = NewtonSchulzResidual<Field>( *X, XTmp );
+            schulz = ( oneRes < schulzTol );
+        }
     }
     if( X != &A )
-        A = *X;
-    return numIts;
+        Copy( *X, A );
+    return info;
 }
 
 template<typename Field>
-Int
-Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+SignInfo
+Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    Real tol = ctrl.tol;
-    if( tol == Real(0) )
-        tol = A.Height()*limits::Epsilon<Real>();
-
-    Int numIts=0;
-    DistMatrix<Field> B( A.Grid() );
-    DistMatrix<Field> *X=&A, *XNew=&B;
-    while( numIts < ctrl.maxIts )
-    {
-        // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
-
-        // Use the difference in the iterates to test for convergence
-        Axpy( Real(-1), *XNew, *X );
-        const Real oneDiff = OneNorm( *X );
-        const Real oneNew = OneNorm( *XNew );
-
-        // Ensure that X holds the current iterate and break if possible
-        ++numIts;
-        std::swap( X, XNew );
-        if( ctrl.progress && A.Grid().Rank() == 0 )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
-                 << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
-            break;
-    }
-    if( X != &A )
-        A = *X;
-    return numIts;
+    return NewtonLoop<Field>( A, ctrl, ctrl.progress );
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+template<typename Field>
+SignInfo
+Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return NewtonLoop<Field>( A, ctrl, ctrl.progress && A.Grid().Rank() == 0 );
+}
 
 } // namespace sign
 
 template<typename Field>
-void Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
+SignInfo Sign( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
-    sign::Newton( A, ctrl );
+    return sign::Newton( A, ctrl );
 }
 
 template<typename Field>
-void Sign
+SignInfo Sign
 ( Matrix<Field>& A, Matrix<Field>& N, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
     Matrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    auto info = sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
+    return info;
 }
 
 template<typename Field>
-void Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
+SignInfo
+Sign( AbstractDistMatrix<Field>& APre, const SignCtrl<Base<Field>> ctrl )
 {
     EL_DEBUG_CSE
 
     DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    sign::Newton( A, ctrl );
+    return sign::Newton( A, ctrl );
 }
 
 template<typename Field>
-void Sign
+SignInfo Sign
 ( AbstractDistMatrix<Field>& APre,
   AbstractDistMatrix<Field>& NPre,
   const SignCtrl<Base<Field>> ctrl )
@@ -243,8 +250,9 @@ void Sign
     auto& N = NProx.Get();
 
     DistMatrix<Field> ACopy( A );
-    sign::Newton( A, ctrl );
+    auto info = sign::Newton( A, ctrl );
     Gemm( NORMAL, NORMAL, Field(1), A, ACopy, N );
+    return info;
 }
 
 // The Hermitian sign decomposition is equivalent to the Hermitian polar
@@ -407,13 +415,13 @@ void HermitianSign
 }
 
 #define PROTO(Field) \
-  template void Sign \
+  template SignInfo Sign \
   ( Matrix<Field>& A, const SignCtrl<Base<Field>> ctrl ); \
-  template void Sign \
+  template SignInfo Sign \
   ( AbstractDistMatrix<Field>& A, const SignCtrl<Base<Field>> ctrl ); \
-  template void Sign \
+  template SignInfo Sign \
   ( Matrix<Field>& A, Matrix<Field>& N, const SignCtrl<Base<Field>> ctrl ); \
-  template void Sign \
+  template SignInfo Sign \
   ( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& N, \
     const SignCtrl<Base<Field>> ctrl ); \
   template void HermitianSign \
@@ -431,11 +439,6 @@ void HermitianSign
     const HermitianEigCtrl<Field>& ctrl );
 
 #define EL_NO_INT_PROTO
-#define EL_ENABLE_DOUBLEDOUBLE
-#define EL_ENABLE_QUADDOUBLE
-#define EL_ENABLE_QUAD
-#define EL_ENABLE_BIGFLOAT
-#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
@@ -19,25 +19,28 @@ namespace El {
 
 namespace square_root {
 
+// XNew := inv(X) A, computed from the QR decomposition X = Q R as
+// R^{-1} (Q^H A) so that only Householder QR, Gemm, and Trsm are required
 template<typename Field>
 void
 NewtonStep
 ( const Matrix<Field>& A,
   const Matrix<Field>& X,
         Matrix<Field>& XNew,
-        Matrix<Field>& XTmp )
+        Matrix<Field>& XTmp,
+        Matrix<Field>& R )
 {
     EL_DEBUG_CSE
     // XNew := inv(X) A
-    XTmp = X;
-    Permutation P;
-    LU( XTmp, P );
-    XNew = A;
-    lu::SolveAfter( NORMAL, XTmp, P, XNew );
+    Copy( X, XTmp );
+    qr::Explicit( XTmp, R );
+    Gemm( ADJOINT, NORMAL, Field(1), XTmp, A, XNew );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R, XNew );
 
     // XNew := 1/2 ( X + XNew )
     typedef Base<Field> Real;
-    Axpy( Real(1)/Real(2), X, XNew );
+    Axpy( Real(1), X, XNew );
+    Scale( Real(1)/Real(2), XNew );
 }
 
 template<typename Field>
@@ -46,19 +49,20 @@ NewtonStep
 ( const DistMatrix<Field>& A,
   const DistMatrix<Field>& X,
         DistMatrix<Field>& XNew,
-        DistMatrix<Field>& XTmp )
+        DistMatrix<Field>& XTmp,
+        DistMatrix<Field>& R )
 {
     EL_DEBUG_CSE
     // XNew := inv(X) A
-    XTmp = X;
-    DistPermutation P(X.Grid());
-    LU( XTmp, P );
-    XNew = A;
-    lu::SolveAfter( NORMAL, XTmp, P, XNew );
+    Copy( X, XTmp );
+    qr::Explicit( XTmp, R );
+    Gemm( ADJOINT, NORMAL, Field(1), XTmp, A, XNew );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R, XNew );
 
     // XNew := 1/2 ( X + XNew )
     typedef Base<Field> Real;
-    Axpy( Real(1)/Real(2), X, XNew );
+    Axpy( Real(1), X, XNew );
+    Scale( Real(1)/Real(2), XNew );
 }
 
 template<typename Field>
@@ -67,7 +71,7 @@ Newton( Matrix<Field>& A, const SquareRootCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    Matrix<Field> B(A), C, XTmp;
+    Matrix<Field> B(A), C, XTmp, R;
     Matrix<Field> *X=&B, *XNew=&C;
 
     Real tol = ctrl.tol;
@@ -78,7 +82,7 @@ Newton( Matrix<Field>& A, const SquareRootCtrl<Base<Field>>& ctrl )
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( A, *X, *XNew, XTmp );
+        NewtonStep( A, *X, *XNew, XTmp, R );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -96,8 +100,7 @@ Newton( Matrix<Field>& A, const SquareRootCtrl<Base<Field>>& ctrl )
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
     }
-    if( X != &A )
-        A = *X;
+    Copy( *X, A );
     return numIts;
 }
 
@@ -113,7 +116,7 @@ Newton
 
     typedef Base<Field> Real;
     const Grid& g = A.Grid();
-    DistMatrix<Field> B(A), C(g), XTmp(g);
+    DistMatrix<Field> B(A), C(g), XTmp(g), R(g);
     DistMatrix<Field> *X=&B, *XNew=&C;
 
     Real tol = ctrl.tol;
@@ -124,7 +127,7 @@ Newton
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( A, *X, *XNew, XTmp );
+        NewtonStep( A, *X, *XNew, XTmp, R );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -142,8 +145,7 @@ Newton
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
     }
-    if( X != &A )
-        A = *X;
+    Copy( *X, A );
     return numIts;
 }
 
@@ -250,7 +252,9 @@ void HPSDSquareRoot
         const Real omega = w.GetLocal(iLoc,0);
         minLocalEig = Min(minLocalEig,omega);
     }
-    const Real minEig = mpi::AllReduce( minLocalEig, mpi::MIN, g.VCComm() );
+    const Real minEig =
+      mpi::AllReduce
+      ( minLocalEig, mpi::MIN, g.VCComm(), SyncInfo<Device::CPU>{} );
 
     // Set the tolerance equal to n ||A||_2 eps
     const Int n = A.Height();
@@ -288,11 +292,6 @@ void HPSDSquareRoot
     const HermitianEigCtrl<Field>& ctrl );
 
 #define EL_NO_INT_PROTO
-#define EL_ENABLE_DOUBLEDOUBLE
-#define EL_ENABLE_QUADDOUBLE
-#define EL_ENABLE_QUAD
-#define EL_ENABLE_BIGFLOAT
-#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
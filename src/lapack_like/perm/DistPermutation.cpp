@@ -12,204 +12,114 @@ namespace El {
 
 namespace {
 
+// Exchange the local rows (or columns) listed in the metadata using a single
+// AllToAll over its communicator. The inverse permutation simply reverses the
+// roles of the sends and receives.
+template<typename T>
+void ExchangeLocal
+(       AbstractDistMatrix<T>& A,
+  const PermutationMeta& meta,
+        bool permuteRows,
+        bool inverse )
+{
+    EL_DEBUG_CSE
+    if( A.GetLocalDevice() != Device::CPU )
+        LogicError("Distributed permutations are only supported on the CPU");
+    const Int ALDim = A.LDim();
+    T* ABuf = A.Buffer();
+
+    // Each index moves a full local row (or column)
+    const Int length = ( permuteRows ? A.LocalWidth() : A.LocalHeight() );
+    const Int entryStride = ( permuteRows ? ALDim : 1 );
+    const Int indexStride = ( permuteRows ? 1 : ALDim );
+
+    const auto& sendIdx = ( inverse ? meta.recvIdx : meta.sendIdx );
+    const auto& sendRanks = ( inverse ? meta.recvRanks : meta.sendRanks );
+    const auto& recvIdx = ( inverse ? meta.sendIdx : meta.recvIdx );
+    const auto& recvRanks = ( inverse ? meta.sendRanks : meta.recvRanks );
+    const auto& sendCountsBase = ( inverse ? meta.recvCounts : meta.sendCounts );
+    const auto& recvCountsBase = ( inverse ? meta.sendCounts : meta.recvCounts );
+
+    const int commSize = sendCountsBase.size();
+    vector<int> sendCounts(commSize), recvCounts(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendCounts[q] = sendCountsBase[q]*length;
+        recvCounts[q] = recvCountsBase[q]*length;
+    }
+    vector<int> sendDispls, recvDispls;
+    const int totalSend = Scan( sendCounts, sendDispls );
+    const int totalRecv = Scan( recvCounts, recvDispls );
+
+    // Pack the send data
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    auto offsets = sendDispls;
+    const int numSends = sendIdx.size();
+    for( int send=0; send<numSends; ++send )
+    {
+        const int rank = sendRanks[send];
+        StridedMemCopy
+        ( &sendData[offsets[rank]], 1,
+          &ABuf[sendIdx[send]*indexStride], entryStride, length );
+        offsets[rank] += length;
+    }
+
+    // Communicate all of the moved rows (or columns) at once
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(),
+      *meta.comm, SyncInfo<Device::CPU>() );
+
+    // Unpack the recv data
+    offsets = recvDispls;
+    const int numRecvs = recvIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int rank = recvRanks[recv];
+        StridedMemCopy
+        ( &ABuf[recvIdx[recv]*indexStride], entryStride,
+          &recvData[offsets[rank]], 1, length );
+        offsets[rank] += length;
+    }
+}
+
 template<typename T>
 void PermuteCols
 (       AbstractDistMatrix<T>& A,
-  const PermutationMeta& oldMeta,
+  const PermutationMeta& meta,
   bool inverse=false )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.RowComm() != oldMeta.comm )
+      if( &A.RowComm() != meta.comm )
           LogicError("Invalid communicator in metadata");
-      if( A.RowAlign() != oldMeta.align )
+      if( A.RowAlign() != meta.align )
           LogicError("Invalid alignment in metadata");
     )
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
-
-    T* ABuf = A.Buffer();
-    const Int ALDim = A.LDim();
-
-    const Int localHeight = A.LocalHeight();
-    PermutationMeta meta = oldMeta;
-    meta.ScaleUp( localHeight );
-
-    if( inverse )
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
-        }
-    }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
-        }
-    }
+    ExchangeLocal( A, meta, false, inverse );
 }
 
 template<typename T>
 void PermuteRows
 (       AbstractDistMatrix<T>& A,
-  const PermutationMeta& oldMeta,
+  const PermutationMeta& meta,
   bool inverse=false )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.ColComm() != oldMeta.comm )
+      if( &A.ColComm() != meta.comm )
           LogicError("Invalid communicator in metadata");
-      if( A.ColAlign() != oldMeta.align )
+      if( A.ColAlign() != meta.align )
           LogicError("Invalid alignment in metadata");
     )
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
-
-    T* ABuf = A.Buffer();
-    const Int ALDim = A.LDim();
-
-    const Int localWidth = A.LocalWidth();
-    PermutationMeta meta = oldMeta;
-    meta.ScaleUp( localWidth );
-
-    if( inverse )
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
-        }
-    }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
-        }
-    }
+    ExchangeLocal( A, meta, true, inverse );
 }
 
 void InvertPermutation
@@ -243,7 +153,8 @@ void InvertPermutation
     )
 
     // Compute the send counts
-    const mpi::Comm colComm = p.ColComm();
+    mpi::Comm const& colComm = p.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
     const Int commSize = mpi::Size( colComm );
     vector<int> sendSizes(commSize,0), recvSizes(commSize,0);
     for( Int iLoc=0; iLoc<p.LocalHeight(); ++iLoc )
@@ -253,7 +164,8 @@ void InvertPermutation
         sendSizes[owner] += 2; // we'll send the global index and the value
     }
     // Perform a small AllToAll to get the receive counts
-    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, colComm );
+    mpi::AllToAll
+    ( sendSizes.data(), 1, recvSizes.data(), 1, colComm, syncInfo );
     vector<int> sendOffs, recvOffs;
     const int sendTotal = Scan( sendSizes, sendOffs );
     const int recvTotal = Scan( recvSizes, recvOffs );
@@ -274,7 +186,7 @@ void InvertPermutation
     vector<Int> recvBuf(recvTotal);
     mpi::AllToAll
     ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
-      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm );
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm, syncInfo );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
@@ -336,8 +248,7 @@ void DistPermutation::Empty()
     invPerm_.Empty();
     staleInverse_ = false;
 
-    rowMeta_.clear();
-    colMeta_.clear();
+    meta_.clear();
     staleMeta_ = false;
 }
 
@@ -356,6 +267,7 @@ void DistPermutation::MakeIdentity( Int size )
     // if the permutation is still in swap mode
 
     size_ = size;
+    staleMeta_ = true;
 
     parity_ = false;
     staleParity_ = false;
@@ -391,13 +303,13 @@ void DistPermutation::Swap( Int origin, Int dest )
 
     if( origin != dest )
         parity_ = !parity_;
+    staleMeta_ = true;
     if( swapSequence_ && numSwaps_ == swapDests_.Height() )
         MakeArbitrary();
     if( !swapSequence_ )
     {
         El::RowSwap( perm_, origin, dest );
         staleInverse_ = true;
-        staleMeta_ = true;
         return;
     }
 
@@ -639,8 +551,7 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
 
-    colMeta_ = P.colMeta_;
-    rowMeta_ = P.rowMeta_;
+    meta_ = P.meta_;
     staleMeta_ = P.staleMeta_;
 
     return *this;
@@ -720,88 +631,100 @@ const DistMatrix<Int,VC,STAR> DistPermutation::SwapDestinations() const
     return swapDests_(IR(0,numSwaps_),ALL);
 }
 
-template<typename T>
-void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+const PermutationMeta& DistPermutation::Meta
+( Int align, const mpi::Comm& comm, Int offset ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( staleMeta_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
+        meta_.clear();
+        staleMeta_ = false;
+    }
+    for( auto it=meta_.begin(); it!=meta_.end(); )
+    {
+        if( mpi::ContextIdLive( std::get<1>(it->first) ) )
+            ++it;
+        else
+            it = meta_.erase( it );
+    }
+    const keyType_ key( align, mpi::ContextId(comm), offset );
+    auto data = meta_.find( key );
+    if( data != meta_.end() )
+    {
+        data->second.comm = &comm;
+        return data->second;
+    }
 
+    // Form the list of moves, index sources[k] -> index dests[k]
+    vector<Int> sources, dests;
+    if( swapSequence_ )
+    {
+        // Compose the swaps while only tracking the preimages of the indices
+        // which they touch, so that the entire sequence can be applied with a
+        // single exchange rather than one exchange per swap
         auto activeInd = IR(0,numSwaps_);
-
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
-
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+        if( !implicitSwapOrigins_ )
+            origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+        auto& destsLoc = dests_STAR_STAR.LockedMatrix();
+        auto& originsLoc = origins_STAR_STAR.LockedMatrix();
+
+        std::map<Int,Int> preimages;
+        auto preimage =
+          [&]( Int i )
+          {
+              auto it = preimages.find( i );
+              return it == preimages.end() ? i : it->second;
+          };
+        for( Int j=0; j<numSwaps_; ++j )
+        {
+            const Int origin = ( implicitSwapOrigins_ ? j : originsLoc(j) );
+            const Int dest = destsLoc(j);
+            const Int originPreimage = preimage( origin );
+            preimages[origin] = preimage( dest );
+            preimages[dest] = originPreimage;
+        }
+        sources.reserve( preimages.size() );
+        dests.reserve( preimages.size() );
+        for( const auto& entry : preimages )
+        {
+            if( entry.first != entry.second )
             {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
+                sources.push_back( entry.second+offset );
+                dests.push_back( entry.first+offset );
             }
         }
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
+        DistMatrix<Int,STAR,STAR> perm_STAR_STAR( perm_ );
+        auto& permLoc = perm_STAR_STAR.LockedMatrix();
+        for( Int i=0; i<size_; ++i )
         {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
+            if( permLoc(i) != i )
+            {
+                sources.push_back( permLoc(i)+offset );
+                dests.push_back( i+offset );
+            }
         }
+    }
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+    data = meta_.emplace
+      ( std::piecewise_construct,
+        std::forward_as_tuple(key),
+        std::forward_as_tuple(sources,dests,align,comm) ).first;
+    return data->second;
+}
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            colMeta_.emplace
-                ( std::piecewise_construct,
-                  std::forward_as_tuple(key),
-                  std::forward_as_tuple(perm_,invPerm_,align,comm) );
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second );
-    }
+template<typename T>
+void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    // TODO(poulson): Use an (MC,MR) proxy for A?
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    El::PermuteCols( A, Meta( A.RowAlign(), A.RowComm(), offset ) );
 }
 
 template<typename T>
@@ -810,77 +733,9 @@ void DistPermutation::InversePermuteCols
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-    }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            colMeta_.emplace
-                ( std::piecewise_construct,
-                  std::forward_as_tuple(key),
-                  std::forward_as_tuple(perm_,invPerm_,align,comm) );
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second, true );
-    }
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    El::PermuteCols( A, Meta( A.RowAlign(), A.RowComm(), offset ), true );
 }
 
 template<typename T>
@@ -888,78 +743,9 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-    }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            rowMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second );
-    }
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    El::PermuteRows( A, Meta( A.ColAlign(), A.ColComm(), offset ) );
 }
 
 template<typename T>
@@ -968,77 +754,9 @@ void DistPermutation::InversePermuteRows
 {
     EL_DEBUG_CSE
     // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-    }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            rowMeta_.emplace
-                ( std::piecewise_construct,
-                  std::forward_as_tuple(key),
-                  std::forward_as_tuple(perm_,invPerm_,align,comm) );
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second, true );
-    }
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    El::PermuteRows( A, Meta( A.ColAlign(), A.ColComm(), offset ), true );
 }
 
 template<typename T>
@@ -1089,13 +807,6 @@ void DistPermutation::PermuteSymmetrically
             LogicError
             ("General permutations are not supported with nonzero offsets");
 
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
         // TODO(poulson): Move El::InversePermutation into this class
         if( staleInverse_ )
         {
@@ -1154,13 +865,6 @@ void DistPermutation::InversePermuteSymmetrically
             LogicError
             ("General permutations are not supported with nonzero offsets");
 
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
         // TODO(poulson): Move El::InversePermutation into this class
         if( staleInverse_ )
         {
@@ -1181,7 +885,7 @@ void DistPermutation::ExplicitVector( AbstractDistMatrix<Int>& p ) const
         auto& pLoc = p.Matrix();
         const Int localHeight = p.LocalHeight();
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            pLoc(iLoc) = p.GlobalRow(iLoc);
+            pLoc.Set( iLoc, 0, p.GlobalRow(iLoc) );
         PermuteRows( p );
     }
     else
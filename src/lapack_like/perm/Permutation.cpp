@@ -12,100 +12,101 @@ namespace El {
 
 namespace {
 
-template<typename T>
-void PermuteCols
-(       Matrix<T>& A,
-  const Matrix<Int>& perm,
-  const Matrix<Int>& invPerm )
+// Decompose the permutation into its nontrivial cycles, each of which is
+// stored as the sequence i, perm(i), perm(perm(i)), ..., so that the permuted
+// matrix can be formed in place by pulling each preimage forward along the
+// cycles with only a single row (or column) of workspace
+void PermutationCycles
+( const Matrix<Int>& perm,
+        vector<Int>& cycles,
+        vector<Int>& cycleOffsets )
 {
     EL_DEBUG_CSE
     const Int b = perm.Height();
+    vector<byte> visited( b, 0 );
+    cycles.resize( 0 );
+    cycleOffsets.resize( 1 );
+    cycleOffsets[0] = 0;
+    for( Int start=0; start<b; ++start )
+    {
+        if( visited[start] || perm(start) == start )
+            continue;
+        Int i = start;
+        do
+        {
+            EL_DEBUG_ONLY(
+              if( perm(i) < 0 || perm(i) >= b )
+                  LogicError("Invalid permutation entry ",perm(i));
+            )
+            visited[i] = 1;
+            cycles.push_back( i );
+            i = perm(i);
+        } while( i != start );
+        cycleOffsets.push_back( cycles.size() );
+    }
+}
+
+// Form A(:,j) := A(:,perm(j)) for each j in [0,b)
+template<typename T>
+void PermuteCols( Matrix<T>& A, const Matrix<Int>& perm )
+{
+    EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.Width() < b || b != invPerm.Height() )
-          LogicError
-          ("perm and invPerm must be vectors of equal length that are not "
-           "wider than A.");
+      if( A.Width() < perm.Height() )
+          LogicError("perm must not be longer than the width of A");
     )
     const Int m = A.Height();
     const Int n = A.Width();
     if( m == 0 || n == 0 )
         return;
 
-    // Make a copy of the first b columns
-    auto AColPanView = A( IR(0,m), IR(0,b) );
-    auto AColPanCopy( AColPanView );
-
-    // Make a copy of the preimage columns
-    Matrix<T> APreimageCopy( m, b );
-
-    for( Int j=0; j<b; ++j )
-    {
-        const Int jPre = perm(j);
-        if( jPre >= b )
-            MemCopy( &APreimageCopy(0,j), &A(0,jPre), m );
-    }
+    vector<Int> cycles, cycleOffsets;
+    PermutationCycles( perm, cycles, cycleOffsets );
 
-    // Apply the permutations
-    for( Int j=0; j<b; ++j )
+    vector<T> column;
+    FastResize( column, m );
+    const Int numCycles = cycleOffsets.size()-1;
+    for( Int c=0; c<numCycles; ++c )
     {
-        const Int jPre = perm(j);
-        const Int jPost = invPerm(j);
-        // Move row[j] into row[jPost]
-        MemCopy( &A(0,jPost), &AColPanCopy(0,j), m );
-        // Move row[jPre] into row[j]
-        if( jPre >= b )
-            MemCopy( &A(0,j), &APreimageCopy(0,j), m );
+        const Int first = cycles[cycleOffsets[c]];
+        const Int last = cycles[cycleOffsets[c+1]-1];
+        MemCopy( column.data(), A.LockedBuffer(0,first), m );
+        for( Int k=cycleOffsets[c]; k<cycleOffsets[c+1]-1; ++k )
+            MemCopy( A.Buffer(0,cycles[k]), A.LockedBuffer(0,cycles[k+1]), m );
+        MemCopy( A.Buffer(0,last), column.data(), m );
     }
 }
 
+// Form A(i,:) := A(perm(i),:) for each i in [0,b)
 template<typename T>
-void PermuteRows
-(       Matrix<T>& A,
-  const Matrix<Int>& perm,
-  const Matrix<Int>& invPerm )
+void PermuteRows( Matrix<T>& A, const Matrix<Int>& perm )
 {
     EL_DEBUG_CSE
-    const Int b = perm.Height();
     EL_DEBUG_ONLY(
-      if( A.Height() < b || b != invPerm.Height() )
-          LogicError
-          ("perm and invPerm must be vectors of equal length that are not "
-           "taller than A.");
+      if( A.Height() < perm.Height() )
+          LogicError("perm must not be longer than the height of A");
     )
     const Int m = A.Height();
     const Int n = A.Width();
     if( m == 0 || n == 0 )
         return;
 
-    // Make a copy of the first b rows
-    auto ARowPanView = A( IR(0,b), IR(0,n) );
-    Matrix<T> ARowPanTrans;
-    Transpose( ARowPanView, ARowPanTrans );
+    vector<Int> cycles, cycleOffsets;
+    PermutationCycles( perm, cycles, cycleOffsets );
 
-    // Make a copy of the preimage rows
-    Matrix<T> APreimageTrans( n, b );
-
-    for( Int i=0; i<b; ++i )
-    {
-        const Int iPre = perm(i);
-        if( iPre >= b )
-            for( Int j=0; j<n; ++j )
-                APreimageTrans(j,i) = A(iPre,j);
-    }
-
-    // Apply the permutations
-    for( Int i=0; i<b; ++i )
+    // Traverse the cycles within each column so that the accesses remain
+    // within a single column of the column-major matrix
+    const Int numCycles = cycleOffsets.size()-1;
+    for( Int j=0; j<n; ++j )
     {
-        const Int iPre = perm(i);
-        const Int iPost = invPerm(i);
-        // Move row[i] into row[image[i]]
-        for( Int j=0; j<n; ++j )
-            A(iPost,j) = ARowPanTrans(j,i);
-        if( iPre >= b )
+        T* aCol = A.Buffer(0,j);
+        for( Int c=0; c<numCycles; ++c )
         {
-            // Move row[preimage[i]] into row[i]
-            for( Int j=0; j<n; ++j )
-                A(i,j) = APreimageTrans(j,i);
+            const Int cycleEnd = cycleOffsets[c+1]-1;
+            const T firstValue = aCol[cycles[cycleOffsets[c]]];
+            for( Int k=cycleOffsets[c]; k<cycleEnd; ++k )
+                aCol[cycles[k]] = aCol[cycles[k+1]];
+            aCol[cycles[cycleEnd]] = firstValue;
         }
     }
 }
@@ -481,17 +482,9 @@ void Permutation::PermuteCols( Matrix<T>& A, Int offset ) const
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-        // TODO: Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            El::InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
         // TODO: Move El::PermuteCols into this class
-        El::PermuteCols( A, perm_, invPerm_ );
+        auto AActive = A( ALL, IR(offset,offset+size_) );
+        El::PermuteCols( AActive, perm_ );
     }
 }
 
@@ -527,9 +520,6 @@ void Permutation::InversePermuteCols( Matrix<T>& A, Int offset ) const
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
         // TODO: Move El::InversePermutation into this class
         if( staleInverse_ )
         {
@@ -537,7 +527,8 @@ void Permutation::InversePermuteCols( Matrix<T>& A, Int offset ) const
             staleInverse_ = false;
         }
         // TODO: Move El::PermuteCols into this class
-        El::PermuteCols( A, invPerm_, perm_ );
+        auto AActive = A( ALL, IR(offset,offset+size_) );
+        El::PermuteCols( AActive, invPerm_ );
     }
 }
 
@@ -573,14 +564,9 @@ void Permutation::PermuteRows( Matrix<T>& A, Int offset ) const
     }
     else
     {
-        // TODO: Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            El::InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
         // TODO: Move El::PermuteRows into this class
-        El::PermuteRows( A, perm_, invPerm_ );
+        auto AActive = A( IR(offset,offset+size_), ALL );
+        El::PermuteRows( AActive, perm_ );
     }
 }
 
@@ -616,9 +602,6 @@ void Permutation::InversePermuteRows( Matrix<T>& A, Int offset ) const
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
         // TODO: Move El::InversePermutation into this class
         if( staleInverse_ )
         {
@@ -626,7 +609,8 @@ void Permutation::InversePermuteRows( Matrix<T>& A, Int offset ) const
             staleInverse_ = false;
         }
         // TODO: Move El::PermuteRows into this class
-        El::PermuteRows( A, invPerm_, perm_ );
+        auto AActive = A( IR(offset,offset+size_), ALL );
+        El::PermuteRows( AActive, invPerm_ );
     }
 }
 
@@ -666,9 +650,6 @@ void Permutation::PermuteSymmetrically
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
         // TODO: Move El::InversePermutation into this class
         if( staleInverse_ )
         {
@@ -715,9 +696,6 @@ void Permutation::InversePermuteSymmetrically
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
         // TODO: Move El::InversePermutation into this class
         if( staleInverse_ )
         {
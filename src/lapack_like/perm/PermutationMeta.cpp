@@ -11,82 +11,50 @@
 namespace El {
 
 PermutationMeta::PermutationMeta
-( const DistMatrix<Int,STAR,STAR>& perm,
-  const DistMatrix<Int,STAR,STAR>& invPerm,
+( const vector<Int>& sources,
+  const vector<Int>& dests,
         Int permAlign,
-        mpi::Comm permComm )
+  const mpi::Comm& permComm )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(AssertSameGrids( perm, invPerm ))
-    comm = permComm;
+    EL_DEBUG_ONLY(
+      if( sources.size() != dests.size() )
+          LogicError("sources and dests must be of the same length");
+    )
+    comm = &permComm;
     align = permAlign;
     const Int permStride = mpi::Size( permComm );
     const Int permShift = Shift( mpi::Rank(permComm), permAlign, permStride );
-    const Int b = perm.Height();
-    const Int* permBuf = perm.LockedBuffer();
-    const Int* invPermBuf = invPerm.LockedBuffer();
-
-    // Form the metadata
-    //
-    // Extract the send and recv counts from the image and preimage.
-    // There are three different types of exchanges:
-    //   1. [0,b) -> [0,b)
-    //   2. [0,b) -> [b,n)
-    //   3. [b,n) -> [0,b)
-    // The fourth possibility, [b,n) -> [b,n), is impossible due to the
-    // fact that indices pulled in from [b,n) are stuck in [0,b) due to the
-    // fact that the i'th pivot exchanges index i with some index k >= i.
-    //
-    sendCounts.resize( permStride, 0 );
-    recvCounts.resize( permStride, 0 );
-    FastResize( sendIdx, b );
-    FastResize( recvIdx, b );
-    FastResize( sendRanks, b );
-    FastResize( recvRanks, b );
 
+    // Since every process traverses the moves in the same order, the k'th
+    // index sent from process q to process r is the k'th index which process
+    // r expects to receive from process q
+    sendCounts.assign( permStride, 0 );
+    recvCounts.assign( permStride, 0 );
     sendIdx.resize( 0 );
     recvIdx.resize( 0 );
     sendRanks.resize( 0 );
     recvRanks.resize( 0 );
-    for( Int i=0; i<b; ++i )
+    const Int numMoves = sources.size();
+    for( Int k=0; k<numMoves; ++k )
     {
-        const Int preVal = permBuf[i];
-        const Int postVal = invPermBuf[i];
-
-        // Handle sends
-        if( Mod(i,permStride) == permShift )
+        const Int source = sources[k];
+        const Int dest = dests[k];
+        if( source == dest )
+            continue;
+        const int sourceOwner = Mod(source+permAlign,permStride);
+        const int destOwner = Mod(dest+permAlign,permStride);
+        if( Mod(source,permStride) == permShift )
         {
-            const Int iLoc = (i-permShift) / permStride;
-            const Int sendTo = Mod(postVal+permAlign,permStride);
-            sendIdx.push_back( iLoc );
-            sendRanks.push_back( sendTo );
-            ++sendCounts[sendTo];
+            sendIdx.push_back( (source-permShift) / permStride );
+            sendRanks.push_back( destOwner );
+            ++sendCounts[destOwner];
         }
-        if( preVal >= b && Mod(preVal,permStride) == permShift )
+        if( Mod(dest,permStride) == permShift )
         {
-            const Int iLoc = (preVal-permShift) / permStride;
-            const Int sendTo = Mod(i+permAlign,permStride);
-            sendIdx.push_back( iLoc );
-            sendRanks.push_back( sendTo );
-            ++sendCounts[sendTo];
-        }
-
-        // Handle recvs
-        if( Mod(postVal,permStride) == permShift )
-        {
-            const Int iLoc = (postVal-permShift) / permStride;
-            const Int recvFrom = Mod(i+permAlign,permStride);
-            recvIdx.push_back( iLoc );
-            recvRanks.push_back( recvFrom );
-            ++recvCounts[recvFrom];
-        }
-        if( preVal >= b && Mod(i,permStride) == permShift )
-        {
-            const Int iLoc = (i-permShift) / permStride;
-            const Int recvFrom = Mod(preVal+permAlign,permStride);
-            recvIdx.push_back( iLoc );
-            recvRanks.push_back( recvFrom );
-            ++recvCounts[recvFrom];
+            recvIdx.push_back( (dest-permShift) / permStride );
+            recvRanks.push_back( sourceOwner );
+            ++recvCounts[sourceOwner];
         }
     }
 
@@ -97,10 +65,70 @@ PermutationMeta::PermutationMeta
     // Construct the send and recv displacements from the counts
     const Int totalSend = Scan( sendCounts, sendDispls );
     const Int totalRecv = Scan( recvCounts, recvDispls );
-    if( totalSend != totalRecv )
-        LogicError
-            ("Send and recv counts do not match: send=",totalSend,", recv=",
-             totalRecv);
+    EL_UNUSED( totalSend );
+    EL_UNUSED( totalRecv );
+    EL_DEBUG_ONLY(
+      SyncInfo<Device::CPU> syncInfo;
+      const Int globalSend = mpi::AllReduce( totalSend, permComm, syncInfo );
+      const Int globalRecv = mpi::AllReduce( totalRecv, permComm, syncInfo );
+      if( globalSend != globalRecv )
+          LogicError
+          ("Send and recv counts do not match: send=",globalSend,", recv=",
+           globalRecv);
+    )
+}
+
+namespace {
+
+// Extract the moves from a partial permutation over the first b indices.
+// There are three different types of exchanges:
+//   1. [0,b) -> [0,b)
+//   2. [0,b) -> [b,n)
+//   3. [b,n) -> [0,b)
+// The fourth possibility, [b,n) -> [b,n), is impossible due to the
+// fact that indices pulled in from [b,n) are stuck in [0,b) due to the
+// fact that the i'th pivot exchanges index i with some index k >= i.
+void PartialPermutationMoves
+( const DistMatrix<Int,STAR,STAR>& perm,
+  const DistMatrix<Int,STAR,STAR>& invPerm,
+  vector<Int>& sources,
+  vector<Int>& dests )
+{
+    EL_DEBUG_CSE
+    const Int b = perm.Height();
+    const Int* permBuf = perm.LockedBuffer();
+    const Int* invPermBuf = invPerm.LockedBuffer();
+    sources.resize( 0 );
+    dests.resize( 0 );
+    sources.reserve( 2*b );
+    dests.reserve( 2*b );
+    for( Int i=0; i<b; ++i )
+    {
+        const Int preVal = permBuf[i];
+        const Int postVal = invPermBuf[i];
+        sources.push_back( i );
+        dests.push_back( postVal );
+        if( preVal >= b )
+        {
+            sources.push_back( preVal );
+            dests.push_back( i );
+        }
+    }
+}
+
+} // anonymous namespace
+
+PermutationMeta::PermutationMeta
+( const DistMatrix<Int,STAR,STAR>& perm,
+  const DistMatrix<Int,STAR,STAR>& invPerm,
+        Int permAlign,
+  const mpi::Comm& permComm )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( perm, invPerm ))
+    vector<Int> sources, dests;
+    PartialPermutationMoves( perm, invPerm, sources, dests );
+    *this = PermutationMeta( sources, dests, permAlign, permComm );
 }
 
 } // namespace El
@@ -0,0 +1,245 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../Norm/TwoEstimate.hpp"
+
+namespace El {
+
+namespace hpd_cond {
+
+// Estimate || A^{-1} ||_1 for Hermitian A through Hager's method with the
+// refinements of Higham,
+//
+//   N.J. Higham, "FORTRAN codes for estimating the one-norm of a real or
+//   complex matrix, with applications to condition estimation",
+//   ACM Trans. Math. Software, 14(4), 1988.
+//
+// where applyInv( x ) overwrites x with A^{-1} x. Since A^{-1} is Hermitian,
+// the solves against A^{-H} required by the method are also with A^{-1}. The
+// matrix x passed in only determines the grid.
+template<typename Field,class Mat,class ApplyInvType>
+Base<Field> InverseOneNorm
+( Int n, const ApplyInvType& applyInv, Mat& x, Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( n == 0 )
+        return 0;
+    auto sign =
+      []( const Field& alpha ) -> Field
+      {
+          const Real alphaAbs = Abs(alpha);
+          return alphaAbs == Real(0) ? Field(1) : alpha/alphaAbs;
+      };
+
+    Zeros( x, n, 1 );
+    Fill( x, Field(1)/Field(n) );
+    Mat y( x ), xi( x ), xiLast( x ), z( x );
+    y = x;
+    applyInv( y );
+    if( n == 1 )
+        return Abs(y.Get(0,0));
+    Real estimate = OneNorm( y );
+    EntrywiseMap( y, xi, function<Field(const Field&)>(sign) );
+    z = xi;
+    applyInv( z );
+    Int j = VectorMaxAbsLoc( z ).index;
+
+    for( Int it=1; it<maxIts; ++it )
+    {
+        // Try the unit vector in the direction of the largest gradient entry
+        Zero( x );
+        x.Set( j, 0, Field(1) );
+        y = x;
+        applyInv( y );
+        const Real newEstimate = OneNorm( y );
+        if( newEstimate <= estimate )
+            break;
+        estimate = newEstimate;
+
+        xiLast = xi;
+        EntrywiseMap( y, xi, function<Field(const Field&)>(sign) );
+        if( !IsComplex<Field>::value )
+        {
+            // A repeated sign vector implies that we have converged
+            Axpy( Field(-1), xi, xiLast );
+            if( MaxNorm( xiLast ) == Real(0) )
+                break;
+        }
+        z = xi;
+        applyInv( z );
+        const Int jLast = j;
+        j = VectorMaxAbsLoc( z ).index;
+        if( Abs(z.Get(jLast,0)) == Abs(z.Get(j,0)) )
+            break;
+    }
+
+    // Higham's alternative estimate guards against the matrices for which
+    // Hager's method performs poorly
+    auto altSign =
+      [&]( Int i, Int ) -> Field
+      {
+          const Real magnitude = Real(1) + Real(i)/Real(n-1);
+          return ( i % 2 == 0 ? magnitude : -magnitude );
+      };
+    IndexDependentFill( x, function<Field(Int,Int)>(altSign) );
+    applyInv( x );
+    const Real altEstimate = 2*OneNorm(x) / (3*n);
+    return Max( estimate, altEstimate );
+}
+
+template<typename Field>
+Base<Field> OneAfterCholesky
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  Base<Field> oneNormA,
+  Int maxIts )
+{
+    EL_DEBUG_CSE
+    auto applyInv =
+      [&]( Matrix<Field>& x )
+      { cholesky::SolveAfter( uplo, NORMAL, A, x ); };
+    Matrix<Field> x;
+    return oneNormA*InverseOneNorm<Field>( A.Height(), applyInv, x, maxIts );
+}
+
+template<typename Field>
+Base<Field> OneAfterCholesky
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  Base<Field> oneNormA,
+  Int maxIts )
+{
+    EL_DEBUG_CSE
+    auto applyInv =
+      [&]( DistMatrix<Field>& x )
+      { cholesky::SolveAfter( uplo, NORMAL, A, x ); };
+    DistMatrix<Field> x( A.Grid() );
+    return oneNormA*InverseOneNorm<Field>( A.Height(), applyInv, x, maxIts );
+}
+
+template<typename Field>
+Base<Field> TwoAfterCholesky
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  Base<Field> twoNormA,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    auto applyInv =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Y = X;
+          cholesky::SolveAfter( uplo, NORMAL, A, Y );
+      };
+    Matrix<Field> X;
+    return twoNormA*
+      two_norm_est::Estimate<Field>( n, n, applyInv, applyInv, X, ctrl );
+}
+
+template<typename Field>
+Base<Field> TwoAfterCholesky
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  Base<Field> twoNormA,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    auto applyInv =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      {
+          Y = X;
+          cholesky::SolveAfter( uplo, NORMAL, A, Y );
+      };
+    DistMatrix<Field> X( A.Grid() );
+    return twoNormA*
+      two_norm_est::Estimate<Field>( n, n, applyInv, applyInv, X, ctrl );
+}
+
+} // namespace hpd_cond
+
+template<typename Field>
+Base<Field> HPDOneConditionEstimate
+( UpperOrLower uplo, const Matrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    const Base<Field> oneNormA = HermitianOneNorm( uplo, A );
+    Matrix<Field> AChol( A );
+    Cholesky( uplo, AChol );
+    return hpd_cond::OneAfterCholesky( uplo, AChol, oneNormA, maxIts );
+}
+
+template<typename Field>
+Base<Field> HPDOneConditionEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, Int maxIts )
+{
+    EL_DEBUG_CSE
+    const Base<Field> oneNormA = HermitianOneNorm( uplo, A );
+    DistMatrix<Field> AChol( A );
+    Cholesky( uplo, AChol );
+    return hpd_cond::OneAfterCholesky( uplo, AChol, oneNormA, maxIts );
+}
+
+template<typename Field>
+Base<Field> HPDTwoConditionEstimate
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Base<Field> twoNormA = HermitianTwoNormEstimate( uplo, A, ctrl );
+    Matrix<Field> AChol( A );
+    Cholesky( uplo, AChol );
+    return hpd_cond::TwoAfterCholesky( uplo, AChol, twoNormA, ctrl );
+}
+
+template<typename Field>
+Base<Field> HPDTwoConditionEstimate
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Base<Field> twoNormA = HermitianTwoNormEstimate( uplo, A, ctrl );
+    DistMatrix<Field> AChol( A );
+    Cholesky( uplo, AChol );
+    return hpd_cond::TwoAfterCholesky( uplo, AChol, twoNormA, ctrl );
+}
+
+#define PROTO(Field) \
+  template Base<Field> HPDOneConditionEstimate \
+  ( UpperOrLower uplo, const Matrix<Field>& A, Int maxIts ); \
+  template Base<Field> HPDOneConditionEstimate \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, Int maxIts ); \
+  template Base<Field> HPDTwoConditionEstimate \
+  ( UpperOrLower uplo, const Matrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> HPDTwoConditionEstimate \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> hpd_cond::OneAfterCholesky \
+  ( UpperOrLower uplo, const Matrix<Field>& A, Base<Field> oneNormA, \
+    Int maxIts ); \
+  template Base<Field> hpd_cond::OneAfterCholesky \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, \
+    Base<Field> oneNormA, Int maxIts ); \
+  template Base<Field> hpd_cond::TwoAfterCholesky \
+  ( UpperOrLower uplo, const Matrix<Field>& A, Base<Field> twoNormA, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> hpd_cond::TwoAfterCholesky \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, \
+    Base<Field> twoNormA, const TwoNormEstimateCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
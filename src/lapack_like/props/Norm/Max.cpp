@@ -67,10 +67,12 @@ Base<Ring> MaxNorm( const AbstractDistMatrix<Ring>& A )
     Base<Ring> norm=0;
     if( A.Participating() )
     {
-        Base<Ring> localMaxAbs = MaxNorm( A.LockedMatrix() );
-        norm = mpi::AllReduce( localMaxAbs, mpi::MAX, A.DistComm() );
+        Base<Ring> localMaxAbs =
+          MaxNorm( static_cast<const Matrix<Ring>&>(A.LockedMatrix()) );
+        norm = mpi::AllReduce
+          ( localMaxAbs, mpi::MAX, A.DistComm(), SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{} );
     return norm;
 }
 
@@ -83,12 +85,13 @@ HermitianMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
         LogicError("Hermitian matrices must be square.");
     typedef Base<Ring> Real;
 
-    Real norm;
+    Real norm=0;
     if( A.Participating() )
     {
         const Int localWidth = A.LocalWidth();
         const Int localHeight = A.LocalHeight();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        const Matrix<Ring>& ALoc =
+          static_cast<const Matrix<Ring>&>(A.LockedMatrix());
 
         Real localMaxAbs = 0;
         if( uplo == UPPER )
@@ -111,9 +114,10 @@ HermitianMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
                     localMaxAbs = Max(localMaxAbs,Abs(ALoc(iLoc,jLoc)));
             }
         }
-        norm = mpi::AllReduce( localMaxAbs, mpi::MAX, A.DistComm() );
+        norm = mpi::AllReduce
+          ( localMaxAbs, mpi::MAX, A.DistComm(), SyncInfo<Device::CPU>{} );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{} );
     return norm;
 }
 
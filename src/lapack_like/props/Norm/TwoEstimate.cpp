@@ -8,248 +8,291 @@
 */
 #include <El.hpp>
 
+#include "./TwoEstimate.hpp"
+
 namespace El {
 
 template<typename Field>
-Base<Field>
-TwoNormEstimate( const Matrix<Field>& A, Base<Field> tol, Int maxIts )
+Base<Field> TwoNormEstimate
+( const Matrix<Field>& A, const TwoNormEstimateCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
-
-    Matrix<Field> x, y;
-    Gaussian( y, n, 1 );
-
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Gemv( NORMAL, Field(1), A, y, x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, m, 1 );
-            xNorm = FrobeniusNorm( x );
-        }
-        x *= Real(1)/xNorm;
-        Gemv( ADJOINT, Field(1), A, x, y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*Max(m,n) );
-
-    if( Abs(estimate-lastEst) > tol*Max(m,n) )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          if( X.Width() == 1 )
+              Gemv( NORMAL, Field(1), A, X, Y );
+          else
+              Gemm( NORMAL, NORMAL, Field(1), A, X, Y );
+      };
+    auto applyAAdj =
+      [&]( const Matrix<Field>& Y, Matrix<Field>& X )
+      {
+          if( Y.Width() == 1 )
+              Gemv( ADJOINT, Field(1), A, Y, X );
+          else
+              Gemm( ADJOINT, NORMAL, Field(1), A, Y, X );
+      };
+    Matrix<Field> X;
+    return two_norm_est::Estimate<Field>( m, n, applyA, applyAAdj, X, ctrl );
 }
 
 template<typename Field>
 Base<Field> TwoNormEstimate
-( const AbstractDistMatrix<Field>& APre, Base<Field> tol, Int maxIts )
+( const AbstractDistMatrix<Field>& APre,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-
     DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.GetLocked();
-
     const Int m = A.Height();
     const Int n = A.Width();
-
-    const Grid& g = APre.Grid();
-    DistMatrix<Field> x(g), y(g);
-    Gaussian( y, n, 1 );
-
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Gemv( NORMAL, Field(1), A, y, x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, m, 1 );
-            xNorm = FrobeniusNorm( x );
-        }
-        x *= Real(1)/xNorm;
-        Gemv( ADJOINT, Field(1), A, x, y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*Max(m,n) );
-
-    if( Abs(estimate-lastEst) > tol*Max(m,n) )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      {
+          if( X.Width() == 1 )
+          {
+              Zeros( Y, m, 1 );
+              Gemv( NORMAL, Field(1), A, X, Field(0), Y );
+          }
+          else
+              Gemm( NORMAL, NORMAL, Field(1), A, X, Y );
+      };
+    auto applyAAdj =
+      [&]( const DistMatrix<Field>& Y, DistMatrix<Field>& X )
+      {
+          if( Y.Width() == 1 )
+          {
+              Zeros( X, n, 1 );
+              Gemv( ADJOINT, Field(1), A, Y, Field(0), X );
+          }
+          else
+              Gemm( ADJOINT, NORMAL, Field(1), A, Y, X );
+      };
+    DistMatrix<Field> X( A.Grid() );
+    return two_norm_est::Estimate<Field>( m, n, applyA, applyAAdj, X, ctrl );
 }
 
 template<typename Field>
 Base<Field> HermitianTwoNormEstimate
 ( UpperOrLower uplo,
   const Matrix<Field>& A,
-  Base<Field> tol,
-  Int maxIts )
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = A.Height();
-
-    Matrix<Field> x, y;
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Hemv( uplo, Field(1), A, y, Field(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );
-            xNorm = FrobeniusNorm( x );
-        }
-        x *= Real(1)/xNorm;
-        Hemv( uplo, Field(1), A, x, Field(0), y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          for( Int j=0; j<X.Width(); ++j )
+          {
+              auto y = Y( ALL, IR(j) );
+              Hemv( uplo, Field(1), A, X(ALL,IR(j)), Field(0), y );
+          }
+      };
+    Matrix<Field> X;
+    return two_norm_est::Estimate<Field>( n, n, applyA, applyA, X, ctrl );
 }
 
 template<typename Field>
 Base<Field> HermitianTwoNormEstimate
 ( UpperOrLower uplo,
   const AbstractDistMatrix<Field>& APre,
-  Base<Field> tol,
-  Int maxIts )
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-
     DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.GetLocked();
-
     const Int n = A.Height();
-
-    const Grid& g = APre.Grid();
-    DistMatrix<Field> x(g), y(g);
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Hemv( uplo, Field(1), A, y, Field(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );
-            xNorm = FrobeniusNorm( x );
-        }
-        x *= Real(1)/xNorm;
-        Hemv( uplo, Field(1), A, x, Field(0), y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          for( Int j=0; j<X.Width(); ++j )
+          {
+              auto y = Y( ALL, IR(j) );
+              Hemv( uplo, Field(1), A, X(ALL,IR(j)), Field(0), y );
+          }
+      };
+    DistMatrix<Field> X( A.Grid() );
+    return two_norm_est::Estimate<Field>( n, n, applyA, applyA, X, ctrl );
 }
 
+// Since A^H = conj(A) for complex symmetric A, A^H x = conj(A conj(x))
+
 template<typename Field>
 Base<Field> SymmetricTwoNormEstimate
-( UpperOrLower uplo, const Matrix<Field>& A, Base<Field> tol, Int maxIts )
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int n = A.Height();
-
-    Matrix<Field> x, y;
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Symv( uplo, Field(1), A, y, Field(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );
-            xNorm = FrobeniusNorm( x );
-        }
-        x *= Real(1)/xNorm;
-        Conjugate( x );
-        Symv( uplo, Field(1), A, x, Field(0), y );
-        Conjugate( y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    Matrix<Field> Z;
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          for( Int j=0; j<X.Width(); ++j )
+          {
+              auto y = Y( ALL, IR(j) );
+              Symv( uplo, Field(1), A, X(ALL,IR(j)), Field(0), y );
+          }
+      };
+    auto applyAAdj =
+      [&]( const Matrix<Field>& Y, Matrix<Field>& X )
+      {
+          Z = Y;
+          Conjugate( Z );
+          applyA( Z, X );
+          Conjugate( X );
+      };
+    Matrix<Field> X;
+    return two_norm_est::Estimate<Field>( n, n, applyA, applyAAdj, X, ctrl );
 }
 
 template<typename Field>
 Base<Field> SymmetricTwoNormEstimate
 ( UpperOrLower uplo,
   const AbstractDistMatrix<Field>& APre,
-  Base<Field> tol,
-  Int maxIts )
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-
     DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
     auto& A = AProx.GetLocked();
-
     const Int n = A.Height();
+    DistMatrix<Field> Z( A.Grid() );
+    auto applyA =
+      [&]( const DistMatrix<Field>& X, DistMatrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          for( Int j=0; j<X.Width(); ++j )
+          {
+              auto y = Y( ALL, IR(j) );
+              Symv( uplo, Field(1), A, X(ALL,IR(j)), Field(0), y );
+          }
+      };
+    auto applyAAdj =
+      [&]( const DistMatrix<Field>& Y, DistMatrix<Field>& X )
+      {
+          Z = Y;
+          Conjugate( Z );
+          applyA( Z, X );
+          Conjugate( X );
+      };
+    DistMatrix<Field> X( A.Grid() );
+    return two_norm_est::Estimate<Field>( n, n, applyA, applyAAdj, X, ctrl );
+}
+
+template<typename Field>
+Base<Field>
+TwoNormEstimate( const Matrix<Field>& A, Base<Field> tol, Int maxIts )
+{
+    EL_DEBUG_CSE
+    TwoNormEstimateCtrl<Base<Field>> ctrl;
+    ctrl.alg = TWO_NORM_EST_POWER;
+    ctrl.tol = 0;
+    ctrl.absTol = tol;
+    ctrl.maxIts = maxIts;
+    return TwoNormEstimate( A, ctrl );
+}
 
-    const Grid& g = APre.Grid();
-    DistMatrix<Field> x(g), y(g);
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
+template<typename Field>
+Base<Field> TwoNormEstimate
+( const AbstractDistMatrix<Field>& A, Base<Field> tol, Int maxIts )
+{
+    EL_DEBUG_CSE
+    TwoNormEstimateCtrl<Base<Field>> ctrl;
+    ctrl.alg = TWO_NORM_EST_POWER;
+    ctrl.tol = 0;
+    ctrl.absTol = tol;
+    ctrl.maxIts = maxIts;
+    return TwoNormEstimate( A, ctrl );
+}
 
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Symv( uplo, Field(1), A, y, Field(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );
-            xNorm = FrobeniusNorm( x );
-        }
-        x *= Real(1)/xNorm;
-        Conjugate( x );
-        Symv( uplo, Field(1), A, x, Field(0), y );
-        Conjugate( y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
+template<typename Field>
+Base<Field> HermitianTwoNormEstimate
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  Base<Field> tol,
+  Int maxIts )
+{
+    EL_DEBUG_CSE
+    TwoNormEstimateCtrl<Base<Field>> ctrl;
+    ctrl.alg = TWO_NORM_EST_POWER;
+    ctrl.tol = 0;
+    ctrl.absTol = tol;
+    ctrl.maxIts = maxIts;
+    return HermitianTwoNormEstimate( uplo, A, ctrl );
+}
 
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
+template<typename Field>
+Base<Field> HermitianTwoNormEstimate
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  Base<Field> tol,
+  Int maxIts )
+{
+    EL_DEBUG_CSE
+    TwoNormEstimateCtrl<Base<Field>> ctrl;
+    ctrl.alg = TWO_NORM_EST_POWER;
+    ctrl.tol = 0;
+    ctrl.absTol = tol;
+    ctrl.maxIts = maxIts;
+    return HermitianTwoNormEstimate( uplo, A, ctrl );
+}
 
-    return estimate;
+template<typename Field>
+Base<Field> SymmetricTwoNormEstimate
+( UpperOrLower uplo, const Matrix<Field>& A, Base<Field> tol, Int maxIts )
+{
+    EL_DEBUG_CSE
+    TwoNormEstimateCtrl<Base<Field>> ctrl;
+    ctrl.alg = TWO_NORM_EST_POWER;
+    ctrl.tol = 0;
+    ctrl.absTol = tol;
+    ctrl.maxIts = maxIts;
+    return SymmetricTwoNormEstimate( uplo, A, ctrl );
+}
+
+template<typename Field>
+Base<Field> SymmetricTwoNormEstimate
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  Base<Field> tol,
+  Int maxIts )
+{
+    EL_DEBUG_CSE
+    TwoNormEstimateCtrl<Base<Field>> ctrl;
+    ctrl.alg = TWO_NORM_EST_POWER;
+    ctrl.tol = 0;
+    ctrl.absTol = tol;
+    ctrl.maxIts = maxIts;
+    return SymmetricTwoNormEstimate( uplo, A, ctrl );
 }
 
 #define PROTO(Field) \
   template Base<Field> TwoNormEstimate \
+  ( const Matrix<Field>& A, const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoNormEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> HermitianTwoNormEstimate \
+  ( UpperOrLower uplo, const Matrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> HermitianTwoNormEstimate \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> SymmetricTwoNormEstimate \
+  ( UpperOrLower uplo, const Matrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> SymmetricTwoNormEstimate \
+  ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, \
+    const TwoNormEstimateCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoNormEstimate \
   ( const Matrix<Field>& A, Base<Field> tol, Int maxIts ); \
   template Base<Field> TwoNormEstimate \
   ( const AbstractDistMatrix<Field>& A, Base<Field> tol, Int maxIts ); \
@@ -265,11 +308,6 @@ Base<Field> SymmetricTwoNormEstimate
     Int maxIts );
 
 #define EL_NO_INT_PROTO
-#define EL_ENABLE_DOUBLEDOUBLE
-#define EL_ENABLE_QUADDOUBLE
-#define EL_ENABLE_QUAD
-#define EL_ENABLE_BIGFLOAT
-#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
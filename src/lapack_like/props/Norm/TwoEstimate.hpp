@@ -0,0 +1,220 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROPS_NORM_TWOESTIMATE_HPP
+#define EL_PROPS_NORM_TWOESTIMATE_HPP
+
+namespace El {
+namespace two_norm_est {
+
+// The following drivers only access the operator through
+//
+//   applyA( X, Y ),    which sets Y := A X, and
+//   applyAAdj( Y, X ), which sets X := A^H Y,
+//
+// where X and Y are either of type Matrix<Field> or DistMatrix<Field>. The
+// (empty) matrix X passed into each driver only determines the grid.
+
+// Orthonormalize the columns of X, returning the triangular factor in R.
+// A single column is simply normalized (and left alone if it is zero).
+template<typename Field>
+void Orthonormalize( Matrix<Field>& X, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    if( X.Width() == 1 )
+    {
+        const Base<Field> norm = FrobeniusNorm( X );
+        Zeros( R, 1, 1 );
+        R(0,0) = norm;
+        if( norm != Base<Field>(0) )
+            Scale( Field(1)/norm, X );
+    }
+    else
+        qr::Explicit( X, R );
+}
+
+template<typename Field>
+void Orthonormalize( DistMatrix<Field>& X, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    if( X.Width() == 1 )
+    {
+        const Base<Field> norm = FrobeniusNorm( X );
+        Zeros( R, 1, 1 );
+        R(0,0) = norm;
+        if( norm != Base<Field>(0) )
+            Scale( Field(1)/norm, X );
+    }
+    else
+    {
+        DistMatrix<Field,VC,STAR> X_VC_STAR( X );
+        DistMatrix<Field,STAR,STAR> R_STAR_STAR( X.Grid() );
+        qr::ExplicitTS( X_VC_STAR, R_STAR_STAR );
+        X = X_VC_STAR;
+        Copy( R_STAR_STAR.LockedMatrix(), R );
+    }
+}
+
+template<typename Field>
+Base<Field> MaxSingularValue( const Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = R.Height();
+    if( n == 1 )
+        return Abs(R(0,0));
+    Matrix<Field> RCopy( R );
+    Matrix<Real> s( n, 1 );
+    lapack::SVD( n, n, RCopy.Buffer(), RCopy.LDim(), s.Buffer() );
+    return s(0);
+}
+
+// The largest singular value of the upper bidiagonal matrix with diagonal d
+// and superdiagonal e
+template<typename Real>
+Real MaxBidiagSingularValue( const vector<Real>& d, const vector<Real>& e )
+{
+    EL_DEBUG_CSE
+    const Int n = d.size();
+    vector<Real> dCopy( d ), eCopy( n );
+    for( Int j=0; j<n-1; ++j )
+        eCopy[j] = e[j];
+    lapack::BidiagDQDS( n, dCopy.data(), eCopy.data() );
+    return dCopy[0];
+}
+
+// Whether successive estimates of the two-norm of an m x n matrix agree to
+// within either the relative or the absolute tolerance
+template<typename Real>
+bool Converged
+( Real estimate, Real lastEst, Int m, Int n,
+  const TwoNormEstimateCtrl<Real>& ctrl )
+{
+    const Real diff = Abs(estimate-lastEst);
+    return diff <= ctrl.tol*estimate || diff <= ctrl.absTol*Max(m,n);
+}
+
+template<typename Field,class Mat,class ApplyAType,class ApplyAAdjType>
+Base<Field> Power
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        Mat& X,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.blockSize <= 0 )
+        LogicError("The block size must be positive");
+    Gaussian( X, n, Min(ctrl.blockSize,n) );
+    Mat Y( X );
+    Matrix<Field> R;
+    Orthonormalize( X, R );
+
+    Real estimate=0, lastEst;
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // The largest singular value of A^H Y, with Y orthonormal, is a lower
+        // bound on || A ||_2
+        applyA( X, Y );
+        Orthonormalize( Y, R );
+        applyAAdj( Y, X );
+        Orthonormalize( X, R );
+        lastEst = estimate;
+        estimate = MaxSingularValue( R );
+        if( Converged( estimate, lastEst, m, n, ctrl ) )
+            return estimate;
+    }
+    if( ctrl.demandConverged )
+        RuntimeError("Two-norm estimate did not converge in time");
+    return estimate;
+}
+
+template<typename Field,class Mat,class ApplyAType,class ApplyAAdjType>
+Base<Field> Lanczos
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        Mat& v,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    // Build the upper bidiagonal B_k satisfying A V_k = U_k B_k without
+    // reorthogonalization; the loss of orthogonality only introduces spurious
+    // copies of converged singular values, which does not harm an estimate of
+    // the largest one
+    Gaussian( v, n, 1 );
+    Matrix<Field> R;
+    Orthonormalize( v, R );
+    Mat u( v ), w( v );
+    applyA( v, u );
+    Orthonormalize( u, R );
+    Real alpha = RealPart(R(0,0));
+    vector<Real> d(1,alpha), e;
+    if( alpha == Real(0) )
+        return alpha;
+
+    Real estimate=alpha, lastEst;
+    for( Int it=0; it<ctrl.maxIts; ++it )
+    {
+        // w := A^H u - alpha v
+        applyAAdj( u, w );
+        Axpy( Field(-alpha), v, w );
+        Orthonormalize( w, R );
+        const Real beta = RealPart(R(0,0));
+        if( beta <= eps*estimate )
+            return estimate;
+        v = w;
+        e.push_back( beta );
+
+        // w := A v - beta u
+        applyA( v, w );
+        Axpy( Field(-beta), u, w );
+        Orthonormalize( w, R );
+        alpha = RealPart(R(0,0));
+        d.push_back( alpha );
+        u = w;
+
+        lastEst = estimate;
+        estimate = MaxBidiagSingularValue( d, e );
+        if( alpha <= eps*estimate ||
+            Converged( estimate, lastEst, m, n, ctrl ) )
+            return estimate;
+    }
+    if( ctrl.demandConverged )
+        RuntimeError("Two-norm estimate did not converge in time");
+    return estimate;
+}
+
+template<typename Field,class Mat,class ApplyAType,class ApplyAAdjType>
+Base<Field> Estimate
+(       Int m,
+        Int n,
+  const ApplyAType& applyA,
+  const ApplyAAdjType& applyAAdj,
+        Mat& X,
+  const TwoNormEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( m == 0 || n == 0 )
+        return 0;
+    if( ctrl.alg == TWO_NORM_EST_POWER )
+        return Power<Field>( m, n, applyA, applyAAdj, X, ctrl );
+    else
+        return Lanczos<Field>( m, n, applyA, applyAAdj, X, ctrl );
+}
+
+} // namespace two_norm_est
+} // namespace El
+
+#endif // ifndef EL_PROPS_NORM_TWOESTIMATE_HPP
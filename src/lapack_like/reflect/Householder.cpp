@@ -76,13 +76,14 @@ F LeftReflector( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
           LogicError("Roots must be the same");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast( tau, x.RowAlign(), x.RowComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -95,13 +96,14 @@ F LeftReflector( F& chi, AbstractDistMatrix<F>& x )
           LogicError("x must be a column vector");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast( tau, x.RowAlign(), x.RowComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -157,13 +159,14 @@ F RightReflector( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
           LogicError("Roots must be the same");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast( tau, x.ColAlign(), x.ColComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -176,13 +179,14 @@ F RightReflector( F& chi, AbstractDistMatrix<F>& x )
           LogicError("x must be a row vector");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast( tau, x.ColAlign(), x.ColComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -28,12 +28,14 @@ F Row( F& chi, AbstractDistMatrix<F>& x )
           LogicError("Reflecting from incorrect process");
     )
     typedef Base<F> Real;
-    mpi::Comm rowComm = x.RowComm();
+    mpi::Comm const& rowComm = x.RowComm();
+    SyncInfo<Device::CPU> syncInfo;
     const Int rowStride = x.RowStride();
 
+    auto& xLoc = static_cast<const Matrix<F>&>( x.LockedMatrix() );
     vector<Real> localNorms(rowStride);
-    Real localNorm = Nrm2( x.LockedMatrix() ); 
-    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, rowComm );
+    Real localNorm = Nrm2( xLoc );
+    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, rowComm, syncInfo );
     Real norm = blas::Nrm2( rowStride, localNorms.data(), 1 );
 
     F alpha = chi;
@@ -65,8 +67,8 @@ F Row( F& chi, AbstractDistMatrix<F>& x )
             beta *= invOfSafeInv;
         } while( Abs(beta) < safeInv );
 
-        localNorm = Nrm2( x.LockedMatrix() );
-        mpi::AllGather( &localNorm, 1, localNorms.data(), 1, rowComm );
+        localNorm = Nrm2( xLoc );
+        mpi::AllGather( &localNorm, 1, localNorms.data(), 1, rowComm, syncInfo );
         norm = blas::Nrm2( rowStride, localNorms.data(), 1 );
         if( RealPart(alpha) <= 0 )
             beta = SafeNorm( alpha, norm );
@@ -102,7 +104,8 @@ F Row( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
     F alpha;
     if( chi.IsLocal(0,0) )
         alpha = chi.GetLocal(0,0);
-    mpi::Broadcast( alpha, chi.RowAlign(), chi.RowComm() );
+    mpi::Broadcast( alpha, chi.RowAlign(), chi.RowComm(),
+      SyncInfo<Device::CPU>{} );
 
     const F tau = reflector::Row( alpha, x );
     chi.Set( 0, 0, alpha );
@@ -74,7 +74,7 @@ F LeftHyperbolicReflector( F& chi, Matrix<F>& x )
     }
     else
     {
-        x *= 1/kappa;
+        Scale( Real(1)/kappa, x );
         return (delta+alpha*lambda)/(kappa*kappa);
     }
 }
@@ -94,13 +94,14 @@ F LeftHyperbolicReflector
           LogicError("Roots must be the same");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = hyp_reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast( tau, x.RowAlign(), x.RowComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -113,13 +114,14 @@ F LeftHyperbolicReflector( F& chi, AbstractDistMatrix<F>& x )
           LogicError("x must be a column vector");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = hyp_reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast( tau, x.RowAlign(), x.RowComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -161,13 +163,14 @@ F RightHyperbolicReflector
           LogicError("Roots must be the same");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = hyp_reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast( tau, x.ColAlign(), x.ColComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -180,13 +183,14 @@ F RightHyperbolicReflector( F& chi, AbstractDistMatrix<F>& x )
           LogicError("x must be a row vector");
     )
     F tau;
+    SyncInfo<Device::CPU> syncInfo;
     if( x.CrossRank() == x.Root() )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = hyp_reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast( tau, x.ColAlign(), x.ColComm(), syncInfo );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), syncInfo );
     return tau;
 }
 
@@ -0,0 +1,437 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The GMRES-based refinement follows
+//
+//   Erin Carson and Nicholas J. Higham,
+//   "Accelerating the solution of linear systems by iterative refinement in
+//    three precisions", SIAM J. Sci. Comput., Vol. 40, No. 2, 2018.
+//
+// but with a single working precision for the residuals and the Krylov
+// vectors, and with the preconditioner applied in the factorization precision.
+
+namespace El {
+namespace mixed_hpd {
+
+// The precision in which the Cholesky factorization is computed
+template<typename Field> struct LowerPrecision { };
+template<> struct LowerPrecision<double> { typedef float type; };
+template<> struct LowerPrecision<Complex<double>>
+{ typedef Complex<float> type; };
+
+template<typename Field>
+using Low = typename LowerPrecision<Field>::type;
+
+// Allow the following routines to be written once for both sequential and
+// [MC,MR] matrices
+template<typename T,typename S>
+Matrix<T> Like( const Matrix<S>& A ) { return Matrix<T>(); }
+template<typename T,typename S>
+DistMatrix<T> Like( const DistMatrix<S>& A )
+{ return DistMatrix<T>(A.Grid()); }
+
+// Constrain the distribution of B to match that of A
+template<typename T>
+void AlignLike( Matrix<T>& B, const Matrix<T>& A ) { }
+template<typename T>
+void AlignLike( DistMatrix<T>& B, const DistMatrix<T>& A )
+{ B.AlignWith( A.DistData() ); }
+
+template<typename S,typename... Args>
+void Progress( const Matrix<S>& A, const Args&... args )
+{ Output( args... ); }
+template<typename S,typename... Args>
+void Progress( const DistMatrix<S>& A, const Args&... args )
+{ OutputFromRoot( A.Grid().Comm(), args... ); }
+
+template<typename Field>
+void ColumnNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
+{ ColumnTwoNorms( X, norms ); }
+
+template<typename Field>
+void ColumnNorms( const DistMatrix<Field>& X, Matrix<Base<Field>>& norms )
+{
+    DistMatrix<Base<Field>,MR,STAR> normsDist( X.Grid() );
+    ColumnTwoNorms( X, normsDist );
+    DistMatrix<Base<Field>,STAR,STAR> normsRep( normsDist );
+    norms = normsRep.Matrix();
+}
+
+// Overwrite X with inv(L L^H) X using the low-precision factorization
+template<typename Field,class LowMatType,class MatType>
+void LowSolve( UpperOrLower uplo, const LowMatType& ALow, MatType& X )
+{
+    EL_DEBUG_CSE
+    auto XLow = Like<Low<Field>>( X );
+    Copy( X, XLow );
+    cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+    Copy( XLow, X );
+}
+
+// Overwrite R with B - A X and return the backward error of each column
+template<typename Field,class MatType>
+void BackwardErrors
+( const MatType& A,
+        Base<Field> frobA,
+  const MatType& B,
+  const Matrix<Base<Field>>& bNorms,
+  const MatType& X,
+        MatType& R,
+        Matrix<Base<Field>>& errors )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Copy( B, R );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+
+    Matrix<Real> rNorms, xNorms;
+    ColumnNorms( R, rNorms );
+    ColumnNorms( X, xNorms );
+    const Int k = B.Width();
+    errors.Resize( k, 1 );
+    for( Int j=0; j<k; ++j )
+    {
+        const Real denom = frobA*xNorms(j) + bNorms(j);
+        errors(j) = ( denom == Real(0) ? rNorms(j) : rNorms(j)/denom );
+    }
+}
+
+template<typename Real>
+Real MaxError( const Matrix<Real>& errors )
+{
+    Real maxError = 0;
+    for( Int j=0; j<errors.Height(); ++j )
+    {
+        if( !limits::IsFinite(errors(j)) )
+            return limits::Infinity<Real>();
+        maxError = Max( maxError, errors(j) );
+    }
+    return maxError;
+}
+
+// Run a single cycle of GMRES(restart) on the left-preconditioned system
+//
+//   inv(L L^H) A d = inv(L L^H) r,
+//
+// starting from d = 0, and return the number of iterations. The Krylov
+// vectors are distributed like d.
+template<typename Field,class MatType,class LowMatType>
+Int GMRES
+( UpperOrLower uplo,
+  const MatType& A,
+  const LowMatType& ALow,
+  const MatType& r,
+        MatType& d,
+        Base<Field> relTol,
+        Int restart )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = r.Height();
+    Zeros( d, n, 1 );
+
+    auto w = Like<Field>( d );
+    AlignLike( w, d );
+    Copy( r, w );
+    LowSolve<Field>( uplo, ALow, w );
+    const Real beta = FrobeniusNorm( w );
+    if( beta == Real(0) )
+        return 0;
+
+    vector<MatType> V;
+    V.reserve( restart );
+    auto pushBack =
+      [&]( Real scale )
+      {
+          V.emplace_back( Like<Field>( d ) );
+          AlignLike( V.back(), d );
+          Copy( w, V.back() );
+          Scale( Field(1)/scale, V.back() );
+      };
+    pushBack( beta );
+
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    Zeros( cs, restart, 1 );
+    Zeros( sn, restart, 1 );
+    Zeros( H, restart, restart );
+    Zeros( t, restart+1, 1 );
+    t(0) = beta;
+
+    Int numIts = 0;
+    for( Int j=0; j<restart; ++j )
+    {
+        // w := inv(L L^H) A v_j
+        Gemm( NORMAL, NORMAL, Field(1), A, V[j], Field(0), w );
+        LowSolve<Field>( uplo, ALow, w );
+
+        // Modified Gram-Schmidt
+        for( Int i=0; i<=j; ++i )
+        {
+            H(i,j) = Dot( V[i], w );
+            Axpy( -H(i,j), V[i], w );
+        }
+        const Real delta = FrobeniusNorm( w );
+        if( !limits::IsFinite(delta) )
+            RuntimeError("Arnoldi step produced a non-finite number");
+        if( delta > Real(0) && j+1 < restart )
+            pushBack( delta );
+
+        // Apply the existing rotations to the new column of H, then generate
+        // and apply a new rotation to both H and the rotated beta e_0
+        for( Int i=0; i<j; ++i )
+        {
+            const Real c = cs(i);
+            const Field s = sn(i);
+            const Field eta_i_j = H(i,j);
+            const Field eta_ip1_j = H(i+1,j);
+            H(i,  j) =  c*eta_i_j       + s*eta_ip1_j;
+            H(i+1,j) = -Conj(s)*eta_i_j + c*eta_ip1_j;
+        }
+        Real c;
+        Field s;
+        H(j,j) = Givens( H(j,j), Field(delta), c, s );
+        cs(j) = c;
+        sn(j) = s;
+        const Field tau_j = t(j);
+        t(j)   =  c*tau_j;
+        t(j+1) = -Conj(s)*tau_j;
+
+        ++numIts;
+        if( Abs(t(j+1)) <= relTol*beta || delta == Real(0) )
+            break;
+    }
+
+    // d := V inv(H) t
+    Matrix<Field> y;
+    Copy( t( IR(0,numIts), ALL ), y );
+    auto HTL = H( IR(0,numIts), IR(0,numIts) );
+    Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+    for( Int i=0; i<numIts; ++i )
+        Axpy( y(i), V[i], d );
+    return numIts;
+}
+
+template<typename Field,class MatType>
+MixedPrecisionHPDSolveInfo<Base<Field>>
+Solve
+( UpperOrLower uplo,
+  const MatType& A,
+        MatType& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    MixedPrecisionHPDSolveInfo<Real> info;
+    const Int k = B.Width();
+    const Real relTol =
+      ( ctrl.relTol > Real(0) ? ctrl.relTol :
+        Max(A.Height(),Int(1))*limits::Epsilon<Real>() );
+
+    // Only the 'uplo' triangle of A is referenced by Cholesky, but the
+    // residuals are computed with Gemm
+    auto AFull = Like<Field>( A );
+    Copy( A, AFull );
+    MakeHermitian( uplo, AFull );
+    const Real frobA = FrobeniusNorm( AFull );
+    Matrix<Real> bNorms;
+    ColumnNorms( B, bNorms );
+
+    auto X = Like<Field>( B );
+    auto XBest = Like<Field>( B );
+    auto R = Like<Field>( B );
+    auto D = Like<Field>( B );
+    AlignLike( X, B );
+    AlignLike( XBest, B );
+    AlignLike( R, B );
+    AlignLike( D, B );
+    Matrix<Real> errors;
+    Real maxError = limits::Infinity<Real>();
+    auto record =
+      [&]( const char* label )
+      {
+          BackwardErrors<Field>( AFull, frobA, B, bNorms, X, R, errors );
+          const Real newMaxError = MaxError( errors );
+          info.backwardErrors.push_back( newMaxError );
+          if( ctrl.progress )
+              Progress( A, label," backward error: ",newMaxError );
+          if( newMaxError <= maxError )
+          {
+              Copy( X, XBest );
+              maxError = newMaxError;
+          }
+          else
+          {
+              // Keep the residuals consistent with the retained solution
+              Copy( XBest, X );
+              BackwardErrors<Field>( AFull, frobA, B, bNorms, X, R, errors );
+          }
+          info.converged = ( maxError <= relTol );
+          return newMaxError;
+      };
+
+    auto ALow = Like<Low<Field>>( A );
+    Copy( A, ALow );
+    try
+    {
+        Cholesky( uplo, ALow );
+        info.lowPrecisionFactored = true;
+    }
+    catch( const NonHPDMatrixException& )
+    {
+        if( ctrl.progress )
+            Progress( A, "Low-precision Cholesky factorization failed" );
+    }
+
+    if( info.lowPrecisionFactored )
+    {
+        Copy( B, X );
+        LowSolve<Field>( uplo, ALow, X );
+        record( "initial" );
+
+        // Classical iterative refinement
+        // ==============================
+        while( !info.converged && info.refineIts < ctrl.maxRefineIts &&
+               limits::IsFinite(maxError) )
+        {
+            Copy( R, D );
+            LowSolve<Field>( uplo, ALow, D );
+            Axpy( Field(1), D, X );
+            ++info.refineIts;
+            const Real lastMaxError = maxError;
+            const Real newMaxError = record( "refined" );
+            if( !(newMaxError <= ctrl.stallRatio*lastMaxError) )
+                break;
+        }
+
+        // GMRES-based iterative refinement
+        // ================================
+        auto d = Like<Field>( B );
+        while( !info.converged && ctrl.tryGMRES &&
+               info.gmresRefineIts < ctrl.maxGMRESRefineIts &&
+               limits::IsFinite(maxError) )
+        {
+            Zeros( D, B.Height(), k );
+            for( Int j=0; j<k; ++j )
+            {
+                if( errors(j) <= relTol )
+                    continue;
+                auto r = R( ALL, IR(j) );
+                info.gmresIts +=
+                  GMRES<Field>
+                  ( uplo, AFull, ALow, r, d, ctrl.gmresRelTol, ctrl.restart );
+                auto dj = D( ALL, IR(j) );
+                Copy( d, dj );
+            }
+            Axpy( Field(1), D, X );
+            ++info.gmresRefineIts;
+            const Real lastMaxError = maxError;
+            const Real newMaxError = record( "GMRES-refined" );
+            if( !(newMaxError < lastMaxError) )
+                break;
+        }
+    }
+
+    // Fall back to a full-precision factorization
+    // ===========================================
+    if( !info.converged && ctrl.fallback )
+    {
+        if( ctrl.progress )
+            Progress( A, "Falling back to a full-precision factorization" );
+        info.fellBack = true;
+        ALow.Empty();
+        auto AHigh = Like<Field>( A );
+        Copy( A, AHigh );
+        Cholesky( uplo, AHigh );
+        Copy( B, X );
+        cholesky::SolveAfter( uplo, NORMAL, AHigh, X );
+        maxError = limits::Infinity<Real>();
+        record( "full-precision" );
+    }
+
+    info.backwardError = maxError;
+    Copy( XBest, B );
+    return info;
+}
+
+} // namespace mixed_hpd
+
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>>
+MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same height");
+    )
+    // Since A is Hermitian, A^T X = B is equivalent to A conj(X) = conj(B)
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    auto info = mixed_hpd::Solve<Field>( uplo, A, B, ctrl );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return info;
+}
+
+template<typename Field>
+MixedPrecisionHPDSolveInfo<Base<Field>>
+MixedPrecisionHPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    auto info = mixed_hpd::Solve<Field>( uplo, A, B, ctrl );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return info;
+}
+
+#define PROTO(Field) \
+  template MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<Field>& A, Matrix<Field>& B, \
+    const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionHPDSolveInfo<Base<Field>> MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionHPDSolveCtrl<Base<Field>>& ctrl );
+
+// Only the precisions with a lower-precision counterpart are instantiated
+#define PROTO_FLOAT
+#define PROTO_COMPLEX_FLOAT
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,520 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERM_EIG_TWO_STAGE_HPP
+#define EL_HERM_EIG_TWO_STAGE_HPP
+
+// The two-stage approach to Hermitian tridiagonalization first reduces the
+// (full) Hermitian matrix to a band matrix of bandwidth b using blocked
+// Householder transformations, which can be applied almost entirely with
+// level-3 BLAS, and then reduces the band matrix to tridiagonal form by
+// chasing bulges with a sequence of short reflectors. Cf.
+//
+//   Christian H. Bischof, Bruno Lang, and Xiaobai Sun,
+//   "A framework for symmetric band reduction",
+//   ACM Trans. Math. Software, 26(4), 581--601, 2000.
+//
+// and
+//
+//   Azzam Haidar, Hatem Ltaief, and Jack Dongarra,
+//   "Parallel reduction to condensed forms for symmetric eigenvalue problems
+//    using aggregated fine-grained and memory-aware kernels",
+//   Proc. SC'11, 2011.
+
+namespace El {
+namespace herm_eig {
+
+// The number of Householder reflectors generated while reducing an n x n
+// Hermitian matrix to bandwidth b
+inline Int NumBandReflectors( Int n, Int b )
+{
+    Int numReflectors = 0;
+    for( Int k=0; k+b+1<n; k+=b )
+        numReflectors += Min(b,n-b-k);
+    return numReflectors;
+}
+
+// Reduce the (fully-populated) Hermitian matrix A to Hermitian band form,
+//
+//   A := Q' A Q,
+//
+// where Q is the product of the Householder reflectors which are stored
+// (with an implicit unit diagonal) in the columns of A below its b'th
+// subdiagonal, and the corresponding scalars are returned in
+// householderScalars. Only the lower band of A is meaningful on exit.
+//
+// Each panel of b columns is factored with a QR decomposition and the
+// trailing matrix is updated from both sides using the compact-WY form of
+// ApplyPackedReflectors.
+//
+template<typename F>
+void ReduceToBand( Int b, Matrix<F>& A, Matrix<F>& householderScalars )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( householderScalars, NumBandReflectors(n,b), 1 );
+
+    Matrix<F> panelScalars;
+    Matrix<Base<F>> signature;
+    for( Int k=0; k+b+1<n; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        auto APan = A( IR(k+b,n), IR(k,k+nb) );
+        QR( APan, panelScalars, signature );
+        // Fold the signature into R so that the panel is transformed by the
+        // reflectors alone
+        auto RPan = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RPan );
+
+        auto ARight = A( IR(k+b,n), IR(k+nb,n) );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          APan, panelScalars, ARight );
+        auto A22 = A( IR(k+b,n), IR(k+b,n) );
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0,
+          APan, panelScalars, A22 );
+
+        for( Int j=0; j<nb; ++j )
+            householderScalars(k+j) = panelScalars(j);
+    }
+}
+
+template<typename F>
+void ReduceToBand
+( Int b, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& householderScalars )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+    Zeros( householderScalars, NumBandReflectors(n,b), 1 );
+
+    DistMatrix<F,STAR,STAR> panelScalars(g);
+    DistMatrix<Base<F>,STAR,STAR> signature(g);
+    for( Int k=0; k+b+1<n; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        auto APan = A( IR(k+b,n), IR(k,k+nb) );
+        QR( APan, panelScalars, signature );
+        // Fold the signature into R so that the panel is transformed by the
+        // reflectors alone
+        auto RPan = APan( IR(0,nb), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, RPan );
+
+        auto ARight = A( IR(k+b,n), IR(k+nb,n) );
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0,
+          APan, panelScalars, ARight );
+        auto A22 = A( IR(k+b,n), IR(k+b,n) );
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0,
+          APan, panelScalars, A22 );
+
+        for( Int j=0; j<nb; ++j )
+            householderScalars.SetLocal( k+j, 0, panelScalars.GetLocal(j,0) );
+    }
+}
+
+// Pack the lower band of A into W, with A(i,j) stored in W(i-j,j). Since the
+// bulge chasing temporarily fills in up to the (2b-1)'th subdiagonal, W is
+// given 2b rows.
+template<typename F>
+void GetBand( Int b, const Matrix<F>& A, Matrix<F>& W )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( W, 2*b, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+b+1,n); ++i )
+            W(i-j,j) = A(i,j);
+}
+
+template<typename F>
+void GetBand( Int b, const DistMatrix<F>& A, Matrix<F>& W )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( W, 2*b, n );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=A.LocalRowOffset(j); iLoc<localHeight; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i > j+b )
+                break;
+            W(i-j,j) = A.GetLocal(iLoc,jLoc);
+        }
+    }
+    AllReduce( W, A.Grid().Comm() );
+}
+
+// The number of reflectors generated by sweep s of the bulge chasing of an
+// n x n band matrix of bandwidth b
+inline Int NumSweepReflectors( Int n, Int b, Int s )
+{ return ( s+1 <= n-2 ? (n-3-s)/b+1 : 0 ); }
+
+// The reflectors generated while chasing the bulges out of a band matrix.
+//
+// The i'th reflector of sweep s, I - tau [1; v] [1; v]', acts upon the rows
+// [r0,r0+h), where r0 = s+1+i b and h = Min(b,n-r0). The reflectors are
+// grouped by blocks of groupSize consecutive sweeps: the i'th reflectors of
+// the sweeps of a group act upon the rows [s0+1+i b,s0+groupSize+(i+1) b-1),
+// where s0 is the first sweep of the group, and are stored in the columns
+// [i groupSize,(i+1) groupSize) of V[group] (with explicit unit diagonals),
+// with their scalars in the corresponding entries of tau[group]. Reflectors
+// beyond the end of the matrix are left zero. Each block can then be applied
+// in compact-WY form.
+//
+// When the bulges are chased redundantly over a grid, each process only
+// stores the groups which it owns (see BulgeGroupOwner), so that the O(n^2)
+// reflectors are spread over the grid; the remaining V[group] are empty.
+//
+// The tridiagonal matrix was made real by the diagonal unitary matrix stored
+// in phase.
+template<typename F>
+struct BulgeReflectors
+{
+    Int height=0, bandwidth=0, groupSize=0;
+    vector<Matrix<F>> V;
+    vector<Matrix<F>> tau;
+    Matrix<F> phase;
+
+    Int NumGroups() const
+    { return groupSize == 0 ? 0 : (Max(height-2,0)+groupSize-1)/groupSize; }
+    Int NumBlocks( Int group ) const
+    { return NumSweepReflectors( height, bandwidth, group*groupSize ); }
+};
+
+inline Int BulgeGroupOwner( Int group, Int commSize )
+{ return group % commSize; }
+
+// Annihilate column c below row r0 with a reflector acting upon the rows
+// R=[r0,r1), apply it from the left to the columns (c,r0), from both sides
+// to the diagonal block, and from the right to the rows K=[r1,Min(r1+b,n)).
+// This last update creates the bulge to be chased by the next step.
+template<typename F>
+void ChaseBulge
+( Int b, Int c, Int r0, Int r1, Matrix<F>& W, F* u, F& tau )
+{
+    typedef Base<F> Real;
+    const Int n = W.Width();
+    const Int h = r1 - r0;
+    auto A = [&]( Int i, Int j ) -> F& { return W(i-j,j); };
+
+    auto chi = W( IR(r0-c), IR(c) );
+    auto x = W( IR(r0-c+1,r1-c), IR(c) );
+    tau = LeftReflector( chi, x );
+    u[0] = 1;
+    for( Int i=1; i<h; ++i )
+    {
+        u[i] = x(i-1);
+        x(i-1) = 0;
+    }
+
+    // A(R,J) := H A(R,J) for the columns J to the right of c
+    for( Int j=c+1; j<r0; ++j )
+    {
+        F gamma = 0;
+        for( Int i=0; i<h; ++i )
+            gamma += Conj(u[i])*A(r0+i,j);
+        gamma *= tau;
+        for( Int i=0; i<h; ++i )
+            A(r0+i,j) -= gamma*u[i];
+    }
+
+    // A(R,R) := H A(R,R) H' = A(R,R) - (w u' + u w'), where
+    //   p = A(R,R) u, gamma = u' p, and w = conj(tau) p - |tau|^2 gamma u / 2
+    vector<F> p(h,F(0));
+    for( Int j=0; j<h; ++j )
+    {
+        p[j] += A(r0+j,r0+j)*u[j];
+        for( Int i=j+1; i<h; ++i )
+        {
+            const F alpha = A(r0+i,r0+j);
+            p[i] += alpha*u[j];
+            p[j] += Conj(alpha)*u[i];
+        }
+    }
+    F gamma = 0;
+    for( Int i=0; i<h; ++i )
+        gamma += Conj(u[i])*p[i];
+    const Real tauAbs = Abs(tau);
+    for( Int i=0; i<h; ++i )
+        p[i] = Conj(tau)*p[i] - (tauAbs*tauAbs*RealPart(gamma)/Real(2))*u[i];
+    for( Int j=0; j<h; ++j )
+        for( Int i=j; i<h; ++i )
+            A(r0+i,r0+j) -= p[i]*Conj(u[j]) + u[i]*Conj(p[j]);
+
+    // A(K,R) := A(K,R) H'
+    const Int kEnd = Min(r1+b,n);
+    for( Int i=r1; i<kEnd; ++i )
+    {
+        F alpha = 0;
+        for( Int j=0; j<h; ++j )
+            alpha += A(i,r0+j)*u[j];
+        alpha *= Conj(tau);
+        for( Int j=0; j<h; ++j )
+            A(i,r0+j) -= alpha*Conj(u[j]);
+    }
+}
+
+// Reduce the Hermitian band matrix stored in W (see GetBand) to real
+// symmetric tridiagonal form, with main diagonal d and (sub/super)diagonal e.
+// Only the groups of reflectors owned by commRank (out of commSize) are
+// stored.
+//
+// The sweeps which annihilate each column run sequentially, but, when
+// Elemental is built with OpenMP support, the step of sweep s+1 which chases
+// a bulge through a window of rows/columns may begin as soon as the previous
+// sweep has moved beyond that window. The windows are named by the blocks of
+// b rows that they touch.
+template<typename F>
+void BandToTridiag
+( Int b,
+  Matrix<F>& W,
+  Matrix<Base<F>>& d,
+  Matrix<Base<F>>& e,
+  BulgeReflectors<F>& reflectors,
+  Int commRank=0,
+  Int commSize=1 )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = W.Width();
+
+    reflectors.height = n;
+    reflectors.bandwidth = b;
+    reflectors.groupSize = b;
+    const Int groupSize = reflectors.groupSize;
+    const Int numGroups = reflectors.NumGroups();
+    reflectors.V.clear();
+    reflectors.tau.clear();
+    reflectors.V.resize( numGroups );
+    reflectors.tau.resize( numGroups );
+    for( Int group=0; group<numGroups; ++group )
+    {
+        if( BulgeGroupOwner(group,commSize) != commRank )
+            continue;
+        const Int width = reflectors.NumBlocks(group)*groupSize;
+        Zeros( reflectors.V[group], groupSize+b-1, width );
+        Zeros( reflectors.tau[group], width, 1 );
+    }
+
+    const Int numBlocks = (n+b-1)/b;
+    // The addresses of these (otherwise unused) entries name the windows
+    // within the task dependencies; the padding allows each step to name
+    // four consecutive blocks
+    vector<char> tokens( numBlocks+4 );
+    char* token = tokens.data();
+    EL_UNUSED( token );
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( Int s=0; s<n-2; ++s )
+    {
+        const Int group = s / groupSize;
+        const Int jGroup = s - group*groupSize;
+        const bool store = ( BulgeGroupOwner(group,commSize) == commRank );
+        for( Int i=0; s+1+i*b<=n-2; ++i )
+        {
+            const Int r0 = s+1+i*b;
+            const Int r1 = Min(r0+b,n);
+            const Int c = ( i==0 ? s : r0-b );
+            const Int k = i*groupSize + jGroup;
+#ifdef EL_HYBRID
+            const Int t = c / b;
+            #pragma omp task firstprivate(r0,r1,c,k) \
+              depend(inout:token[t],token[t+1],token[t+2],token[t+3])
+#endif
+            {
+                if( store )
+                {
+                    ChaseBulge
+                    ( b, c, r0, r1, W,
+                      reflectors.V[group].Buffer(jGroup,k),
+                      reflectors.tau[group](k) );
+                }
+                else
+                {
+                    vector<F> u( r1-r0 );
+                    F tau;
+                    ChaseBulge( b, c, r0, r1, W, u.data(), tau );
+                }
+            }
+        }
+    }
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,0), 1 );
+    Zeros( reflectors.phase, n, 1 );
+    if( n > 0 )
+        reflectors.phase(0) = 1;
+    for( Int j=0; j<n; ++j )
+    {
+        d(j) = RealPart(W(0,j));
+        if( j < n-1 )
+        {
+            const F beta = W(1,j);
+            const Real betaAbs = Abs(beta);
+            e(j) = betaAbs;
+            reflectors.phase(j+1) = reflectors.phase(j);
+            if( betaAbs != Real(0) )
+                reflectors.phase(j+1) *= beta / betaAbs;
+        }
+    }
+}
+
+// X := (I - U T U') X = (I - gamma_0 u_0 u_0') ... (I - gamma_{k-1} u_{k-1}
+// u_{k-1}') X, where gamma_j = conj(tau_j) and the upper-triangular T is
+// formed column by column as in LAPACK's larft,
+//
+//   T(0:j-1,j) = -gamma_j T(0:j-1,0:j-1) U(:,0:j-1)' u_j,  T(j,j) = gamma_j.
+//
+// Since T is built from the scalars rather than from their inverses (as in
+// ApplyPackedReflectors), the zero scalars of trivial reflectors are allowed.
+template<typename F>
+void ApplyBulgeBlock
+( const Matrix<F>& U, const Matrix<F>& tau, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int k = U.Width();
+    Matrix<F> G, T, Z, TZ;
+    Gemm( ADJOINT, NORMAL, F(1), U, U, G );
+    Zeros( T, k, k );
+    for( Int j=0; j<k; ++j )
+    {
+        const F gamma = Conj(tau(j));
+        T(j,j) = gamma;
+        for( Int i=0; i<j; ++i )
+        {
+            F alpha = 0;
+            for( Int l=i; l<j; ++l )
+                alpha += T(i,l)*G(l,j);
+            T(i,j) = -gamma*alpha;
+        }
+    }
+    Gemm( ADJOINT, NORMAL, F(1), U, X, Z );
+    Gemm( NORMAL, NORMAL, F(1), T, Z, TZ );
+    Gemm( NORMAL, NORMAL, F(-1), U, TZ, F(1), X );
+}
+
+// X := G' X, where G' is the product of the adjoints of the reflectors of
+// one group (in the order they were generated). The i'th reflectors of the
+// sweeps commute with the later reflectors of any larger index, so that G'
+// is the product of the blocks with decreasing i, and the blocks are applied
+// to X with increasing i.
+template<typename F>
+void ApplyBulgeGroup
+( const BulgeReflectors<F>& reflectors, Int group,
+  const Matrix<F>& V, const Matrix<F>& tau, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = reflectors.height;
+    const Int b = reflectors.bandwidth;
+    const Int groupSize = reflectors.groupSize;
+    const Int s0 = group*groupSize;
+    const Int numBlocks = reflectors.NumBlocks( group );
+    for( Int i=0; i<numBlocks; ++i )
+    {
+        const Int rowBeg = s0+1+i*b;
+        const Int rowEnd = Min(rowBeg+groupSize+b-1,n);
+        const Range<Int> blockInd( i*groupSize, (i+1)*groupSize );
+        auto U = V( IR(0,rowEnd-rowBeg), blockInd );
+        auto XBlock = X( IR(rowBeg,rowEnd), ALL );
+        ApplyBulgeBlock( U, tau(blockInd,ALL), XBlock );
+    }
+}
+
+// X := G' D X, where G is the product of the bulge-chasing reflectors (in the
+// order they were generated) and D is the diagonal phase matrix, so that the
+// eigenvectors of the real tridiagonal matrix are mapped to those of the band
+// matrix. The groups are applied from last to first, each in compact-WY form.
+template<typename F>
+void ApplyBulgeReflectors( const BulgeReflectors<F>& reflectors, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    DiagonalScale( LEFT, NORMAL, reflectors.phase, X );
+    for( Int group=reflectors.NumGroups()-1; group>=0; --group )
+        ApplyBulgeGroup
+        ( reflectors, group, reflectors.V[group], reflectors.tau[group], X );
+}
+
+// As above, but each process holds a subset of the columns of X and only the
+// groups of reflectors which it owns; each group is broadcast by its owner
+// just before it is applied.
+template<typename F>
+void ApplyBulgeReflectors
+( const BulgeReflectors<F>& reflectors, DistMatrix<F,STAR,VR>& X )
+{
+    EL_DEBUG_CSE
+    const Grid& g = X.Grid();
+    const Int commRank = g.Rank();
+    const Int commSize = g.Size();
+    const Int groupSize = reflectors.groupSize;
+    const Int b = reflectors.bandwidth;
+    auto& XLoc = X.Matrix();
+    DiagonalScale( LEFT, NORMAL, reflectors.phase, XLoc );
+
+    Matrix<F> V, tau;
+    for( Int group=reflectors.NumGroups()-1; group>=0; --group )
+    {
+        const Int owner = BulgeGroupOwner( group, commSize );
+        if( owner == commRank )
+        {
+            V = reflectors.V[group];
+            tau = reflectors.tau[group];
+        }
+        else
+        {
+            const Int width = reflectors.NumBlocks(group)*groupSize;
+            V.Resize( groupSize+b-1, width );
+            tau.Resize( width, 1 );
+        }
+        Broadcast( V, g.Comm(), owner );
+        Broadcast( tau, g.Comm(), owner );
+        ApplyBulgeGroup( reflectors, group, V, tau, XLoc );
+    }
+}
+
+// Return the indices of the eigenvalues in w which were requested by the
+// subset, in the requested order
+template<typename Real>
+vector<Int> SelectEigenvalues
+( const Matrix<Real>& w, const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = w.Height();
+    const auto& subset = ctrl.subset;
+    auto sortPairs = TaggedSort( w, ASCENDING );
+
+    vector<Int> indices;
+    for( Int j=0; j<n; ++j )
+    {
+        if( subset.indexSubset &&
+            (j < subset.lowerIndex || j > subset.upperIndex) )
+            continue;
+        if( subset.rangeSubset &&
+            (sortPairs[j].value <= subset.lowerBound ||
+             sortPairs[j].value > subset.upperBound) )
+            continue;
+        indices.push_back( sortPairs[j].index );
+    }
+    if( ctrl.sort == DESCENDING )
+        std::reverse( indices.begin(), indices.end() );
+    return indices;
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERM_EIG_TWO_STAGE_HPP
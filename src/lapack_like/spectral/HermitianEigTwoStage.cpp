@@ -0,0 +1,486 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./HermitianTridiagEig/DivideAndConquer.hpp"
+#include "./HermitianEig/TwoStage.hpp"
+
+// HermitianEig via a two-stage tridiagonalization (dense to band to
+// tridiagonal) followed by the divide-and-conquer tridiagonal eigensolver.
+// Subsets are computed by filtering the tridiagonal eigenvalues so that only
+// the requested eigenvectors are backtransformed.
+
+namespace El {
+namespace herm_eig {
+
+template<typename F>
+Int TwoStageBandwidth( Int n, const HermitianEigCtrl<F>& ctrl )
+{
+    const Int b = ( ctrl.bandwidth > 0 ? ctrl.bandwidth : Blocksize() );
+    return Max( Min(b,n-1), Int(1) );
+}
+
+// Return true if the requested subset is trivially empty
+template<typename Real>
+bool EmptySubset( const HermitianEigSubset<Real>& subset )
+{
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+    return (subset.rangeSubset && (subset.lowerBound >= subset.upperBound)) ||
+           (subset.indexSubset && (subset.lowerIndex > subset.upperIndex));
+}
+
+// The number of eigenvalues of the n x n zero matrix within the subset
+template<typename Real>
+Int NumZeroEigenvalues( Int n, const HermitianEigSubset<Real>& subset )
+{
+    if( subset.indexSubset )
+        return Min(subset.upperIndex,n-1)-subset.lowerIndex+1;
+    else if( subset.rangeSubset &&
+             (subset.lowerBound >= Real(0) || subset.upperBound < Real(0)) )
+        return 0;
+    else
+        return n;
+}
+
+template<typename F>
+HermitianTridiagEigCtrl<Base<F>>
+TridiagCtrl( bool wantEigVecs, const HermitianEigCtrl<F>& ctrl )
+{
+    // The subset is applied after the full tridiagonal solve
+    auto tridiagCtrl( ctrl.tridiagEigCtrl );
+    tridiagCtrl.subset = HermitianEigSubset<Base<F>>();
+    tridiagCtrl.wantEigVecs = wantEigVecs;
+    tridiagCtrl.accumulateEigVecs = false;
+    return tridiagCtrl;
+}
+
+// As in LAPACK's {s,d}stedc, the eigenvalues alone are computed using the
+// tridiagonal QR algorithm rather than divide and conquer
+template<typename Real>
+herm_tridiag_eig::QRInfo
+TridiagEigenvalues
+( const Matrix<Real>& d,
+  const Matrix<Real>& e,
+        Matrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    w = d;
+    auto eCopy( e );
+    return herm_tridiag_eig::QRAlg( w, eCopy, ctrl );
+}
+
+template<typename F>
+HermitianEigInfo
+TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  bool wantEigVecs,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, ctrl );
+    HermitianEigInfo info;
+
+    MakeHermitian( uplo, A );
+    Matrix<F> householderScalars;
+    ReduceToBand( b, A, householderScalars );
+
+    Matrix<F> W;
+    GetBand( b, A, W );
+    Matrix<Real> d, e;
+    BulgeReflectors<F> reflectors;
+    BandToTridiag( b, W, d, e, reflectors );
+
+    Matrix<Real> wUnsorted, Z;
+    if( wantEigVecs )
+        info.tridiagEigInfo.dcInfo =
+          herm_tridiag_eig::DivideAndConquer
+          ( d, e, wUnsorted, Z, TridiagCtrl(wantEigVecs,ctrl) );
+    else
+        info.tridiagEigInfo.qrInfo =
+          TridiagEigenvalues( d, e, wUnsorted, TridiagCtrl(wantEigVecs,ctrl) );
+
+    const auto indices = SelectEigenvalues( wUnsorted, ctrl.tridiagEigCtrl );
+    const Int k = indices.size();
+    w.Resize( k, 1 );
+    for( Int j=0; j<k; ++j )
+        w(j) = wUnsorted(indices[j]);
+    if( !wantEigVecs )
+        return info;
+
+    Matrix<Real> ZSub;
+    GetSubmatrix( Z, IR(0,n), indices, ZSub );
+    Q.Resize( n, k );
+    for( Int j=0; j<k; ++j )
+        for( Int i=0; i<n; ++i )
+            Q(i,j) = ZSub(i,j);
+    ApplyBulgeReflectors( reflectors, Q );
+
+    auto H = A( ALL, IR(0,householderScalars.Height()) );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, -b,
+      H, householderScalars, Q );
+
+    return info;
+}
+
+template<typename F>
+HermitianEigInfo
+TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& wPre,
+  AbstractDistMatrix<F>& QPre,
+  bool wantEigVecs,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    const Int b = TwoStageBandwidth( n, ctrl );
+    const Grid& g = APre.Grid();
+    HermitianEigInfo info;
+    Timer timer;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    // Reduce A to band form
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+            timer.Start();
+    }
+    MakeHermitian( uplo, A );
+    DistMatrix<F,STAR,STAR> householderScalars(g);
+    ReduceToBand( b, A, householderScalars );
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+        {
+            Output("  Band reduction: ",timer.Stop()," secs");
+            timer.Start();
+        }
+    }
+
+    // Redundantly reduce the band matrix to tridiagonal form, with each
+    // process keeping only its share of the reflectors
+    Matrix<F> W;
+    GetBand( b, A, W );
+    Matrix<Real> d, e;
+    BulgeReflectors<F> reflectors;
+    BandToTridiag( b, W, d, e, reflectors, g.Rank(), g.Size() );
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+        {
+            Output("  Bulge chasing:  ",timer.Stop()," secs");
+            timer.Start();
+        }
+    }
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    if( !wantEigVecs )
+    {
+        Matrix<Real> wUnsorted;
+        info.tridiagEigInfo.qrInfo =
+          TridiagEigenvalues( d, e, wUnsorted, TridiagCtrl(wantEigVecs,ctrl) );
+
+        const auto indices =
+          SelectEigenvalues( wUnsorted, ctrl.tridiagEigCtrl );
+        const Int k = indices.size();
+        w.Resize( k, 1 );
+        for( Int j=0; j<k; ++j )
+            w.SetLocal( j, 0, wUnsorted(indices[j]) );
+        if( ctrl.timeStages )
+        {
+            mpi::Barrier( A.DistComm() );
+            if( g.Rank() == 0 )
+                Output("  TridiagEig:     ",timer.Stop()," secs");
+        }
+        return info;
+    }
+
+    DistMatrix<Real,STAR,STAR> wUnsorted(g);
+    DistMatrix<Real> Z(g);
+    info.tridiagEigInfo.dcInfo =
+      herm_tridiag_eig::DivideAndConquer
+      ( d, e, wUnsorted, Z, TridiagCtrl(wantEigVecs,ctrl) );
+
+    const auto indices =
+      SelectEigenvalues
+      ( static_cast<const Matrix<Real>&>(wUnsorted.LockedMatrix()),
+        ctrl.tridiagEigCtrl );
+    const Int k = indices.size();
+    w.Resize( k, 1 );
+    for( Int j=0; j<k; ++j )
+        w.SetLocal( j, 0, wUnsorted.GetLocal(indices[j],0) );
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+        {
+            Output("  TridiagEig:     ",timer.Stop()," secs");
+            timer.Start();
+        }
+    }
+
+    // Backtransform the selected eigenvectors, whose columns are local in the
+    // [* ,VR] distribution, through the bulge-chasing reflectors
+    DistMatrix<Real,STAR,VR> ZSub(g);
+    GetSubmatrix( Z, IR(0,n), indices, ZSub );
+    DistMatrix<F,STAR,VR> X(g);
+    X.AlignWith( ZSub );
+    X.Resize( n, k );
+    const Int localWidth = X.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int i=0; i<n; ++i )
+            X.SetLocal( i, jLoc, ZSub.GetLocal(i,jLoc) );
+    ApplyBulgeReflectors( reflectors, X );
+
+    // and then through the band reduction
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& Q = QProx.Get();
+    Copy( X, Q );
+    auto H = A( ALL, IR(0,householderScalars.Height()) );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, -b,
+      H, householderScalars, Q );
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+            Output("  Backtransform:  ",timer.Stop()," secs");
+    }
+
+    return info;
+}
+
+template<typename F>
+HermitianEigInfo
+Driver
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  bool wantEigVecs,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    HermitianEigInfo info;
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( ctrl.useSDC )
+        LogicError("Spectral divide and conquer is not currently supported");
+    if( EmptySubset(subset) )
+    {
+        w.Resize(0,1);
+        Q.Resize(n,0);
+        return info;
+    }
+
+    // Check if we need to rescale the matrix, and do so if necessary
+    const Real maxNormA = HermitianMaxNorm( uplo, A );
+    const Real normMax = limits::Max<Real>();
+    const Real normMin = limits::Min<Real>();
+    if( maxNormA == Real(0) )
+    {
+        const Int numValid = NumZeroEigenvalues( n, subset );
+        Zeros( w, numValid, 1 );
+        Zeros( Q, n, numValid );
+        FillDiagonal( Q, F(1) );
+        return info;
+    }
+    bool scaledDown=false, scaledUp=false;
+    if( maxNormA > normMax )
+    {
+        scaledDown = true;
+        SafeScaleTrapezoid( maxNormA, normMax, uplo, A );
+    }
+    else if( maxNormA < normMin )
+    {
+        scaledUp = true;
+        SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
+    }
+
+    info = TwoStage( uplo, A, w, Q, wantEigVecs, ctrl );
+
+    // Rescale the eigenvalues if necessary
+    if( scaledDown )
+        SafeScale( normMax, maxNormA, w );
+    else if( scaledUp )
+        SafeScale( normMin, maxNormA, w );
+
+    return info;
+}
+
+template<typename F>
+HermitianEigInfo
+Driver
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& Q,
+  bool wantEigVecs,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    HermitianEigInfo info;
+    if( A.Height() != A.Width() )
+        LogicError("Hermitian matrices must be square");
+    if( ctrl.useSDC )
+        LogicError("Spectral divide and conquer is not currently supported");
+    w.SetGrid( A.Grid() );
+    Q.SetGrid( A.Grid() );
+    if( EmptySubset(subset) )
+    {
+        w.Resize(0,1);
+        Q.Resize(n,0);
+        return info;
+    }
+
+    // Check if we need to rescale the matrix, and do so if necessary
+    const Real maxNormA = HermitianMaxNorm( uplo, A );
+    const Real normMax = limits::Max<Real>();
+    const Real normMin = limits::Min<Real>();
+    if( maxNormA == Real(0) )
+    {
+        const Int numValid = NumZeroEigenvalues( n, subset );
+        Zeros( w, numValid, 1 );
+        Zeros( Q, n, numValid );
+        FillDiagonal( Q, F(1) );
+        return info;
+    }
+    bool scaledDown=false, scaledUp=false;
+    if( maxNormA > normMax )
+    {
+        scaledDown = true;
+        SafeScaleTrapezoid( maxNormA, normMax, uplo, A );
+    }
+    else if( maxNormA < normMin )
+    {
+        scaledUp = true;
+        SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
+    }
+
+    info = TwoStage( uplo, A, w, Q, wantEigVecs, ctrl );
+
+    // Rescale the eigenvalues if necessary
+    if( scaledDown )
+        SafeScale( normMax, maxNormA, w );
+    else if( scaledUp )
+        SafeScale( normMin, maxNormA, w );
+
+    return info;
+}
+
+} // namespace herm_eig
+
+template<typename F>
+HermitianEigInfo
+HermitianEig
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Q;
+    return herm_eig::Driver( uplo, A, w, Q, false, ctrl );
+}
+
+template<typename F>
+HermitianEigInfo
+HermitianEig
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<Base<F>>& w,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> Q(A.Grid());
+    return herm_eig::Driver( uplo, A, w, Q, false, ctrl );
+}
+
+template<typename F>
+HermitianEigInfo
+HermitianEig
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& w,
+  Matrix<F>& Q,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    return herm_eig::Driver( uplo, A, w, Q, true, ctrl );
+}
+
+template<typename F>
+HermitianEigInfo
+HermitianEig
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& Q,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    return herm_eig::Driver( uplo, A, w, Q, true, ctrl );
+}
+
+#define EIGVAL_PROTO(F) \
+  template HermitianEigInfo HermitianEig\
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<Base<F>>& w, \
+    const HermitianEigCtrl<F>& ctrl ); \
+  template HermitianEigInfo HermitianEig\
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<Base<F>>& w, \
+    const HermitianEigCtrl<F>& ctrl );
+
+#define EIGPAIR_PROTO(F) \
+  template HermitianEigInfo HermitianEig\
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<Base<F>>& w, \
+    Matrix<F>& Q,\
+    const HermitianEigCtrl<F>& ctrl ); \
+  template HermitianEigInfo HermitianEig\
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<Base<F>>& w, \
+    AbstractDistMatrix<F>& Q, \
+    const HermitianEigCtrl<F>& ctrl );
+
+#define PROTO(F) \
+  EIGVAL_PROTO(F) \
+  EIGPAIR_PROTO(F)
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
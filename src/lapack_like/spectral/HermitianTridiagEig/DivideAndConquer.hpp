@@ -9,6 +9,7 @@
 #ifndef EL_HERM_TRIDIAG_EIG_DC_HPP
 #define EL_HERM_TRIDIAG_EIG_DC_HPP
 
+#include "./QR.hpp"
 // TODO(poulson): Move said routine into a utility function
 #include "../Schur/SDC.hpp"
 using El::schur::SplitGrid;
@@ -16,6 +17,123 @@ using El::schur::SplitGrid;
 namespace El {
 namespace herm_tridiag_eig {
 
+// Solve a leaf of the recursion with the tridiagonal QR algorithm. If
+// ctrl.accumulateEigVecs is true, then the rotations are applied to the
+// incoming Q, which allows for only computing a subset of its rows.
+template<typename Real>
+QRInfo
+LeafEig
+( const Matrix<Real>& mainDiag,
+  const Matrix<Real>& superDiag,
+        Matrix<Real>& w,
+        Matrix<Real>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    w = mainDiag;
+    auto superDiagCopy( superDiag );
+    return QRAlg( w, superDiagCopy, Q, ctrl );
+}
+
+// A Givens rotation of columns j and k of Q which was found during deflation
+template<typename Real>
+struct DeflationRotation
+{
+    Int j;
+    Int k;
+    Real c;
+    Real s;
+};
+
+// Since the deflation rotations only mix columns, their in-order application
+// to each block of rows is independent of that of the other blocks.
+template<typename Real>
+void ApplyDeflationRotations
+( const vector<DeflationRotation<Real>>& rotations, Matrix<Real>& Q )
+{
+    EL_DEBUG_CSE
+    if( rotations.empty() )
+        return;
+    const Int m = Q.Height();
+    const Int bsize = Blocksize();
+    const Int numBlocks = (m+bsize-1) / bsize;
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int i = block*bsize;
+        const Int nb = Min(bsize,m-i);
+        for( const auto& rotation : rotations )
+            blas::Rot
+            ( nb, &Q(i,rotation.j), 1, &Q(i,rotation.k), 1,
+              rotation.c, rotation.s );
+    }
+}
+
+// Pack the columns which are nonzero in only the first block row, then the
+// dense columns, then the columns which are nonzero in only the second block
+// row, and finally the deflated columns, so that each block row of the
+// eigenvector update involves a contiguous range of packed columns.
+inline std::vector<Int>
+PackingOffsets( const std::vector<Int>& packingCounts )
+{
+    const Int packingOrder[NUM_DC_COMBINED_COLUMN_TYPES] =
+      {COLUMN_NONZERO_IN_FIRST_BLOCK,
+       DENSE_COLUMN,
+       COLUMN_NONZERO_IN_SECOND_BLOCK,
+       DEFLATED_COLUMN};
+    std::vector<Int> packingOffsets( NUM_DC_COMBINED_COLUMN_TYPES, 0 );
+    Int totalPacked = 0;
+    for( Int k=0; k<NUM_DC_COMBINED_COLUMN_TYPES; ++k )
+    {
+        packingOffsets[packingOrder[k]] = totalPacked;
+        totalPacked += packingCounts[packingOrder[k]];
+    }
+    return packingOffsets;
+}
+
+// Solve the two independent subproblems of a divide-and-conquer step, as
+// OpenMP tasks if EL_HYBRID is defined. The outermost call opens the parallel
+// region so that the merges of the nested subtrees are also overlapped, while
+// the final merge is left to the thread-parallel loops and BLAS calls. An
+// exception cannot leave a task, so any failure is rethrown after the join.
+template<typename Solve0,typename Solve1>
+void SolveSubtrees( Solve0 solve0, Solve1 solve1 )
+{
+#ifdef EL_HYBRID
+    std::exception_ptr failure0, failure1;
+    auto solveBoth = [&]()
+      {
+          #pragma omp task shared(failure0)
+          {
+              try { solve0(); }
+              catch( ... ) { failure0 = std::current_exception(); }
+          }
+          try { solve1(); }
+          catch( ... ) { failure1 = std::current_exception(); }
+          #pragma omp taskwait
+      };
+    if( omp_in_parallel() )
+    {
+        solveBoth();
+    }
+    else
+    {
+        #pragma omp parallel
+        {
+            #pragma omp single
+            solveBoth();
+        }
+    }
+    if( failure0 )
+        std::rethrow_exception( failure0 );
+    if( failure1 )
+        std::rethrow_exception( failure1 );
+#else
+    solve0();
+    solve1();
+#endif
+}
+
 // The following is analogous to LAPACK's {s,d}laed{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for w0 and w1, nor does it enforce
 // any ordering on the resulting eigenvalues.
@@ -173,6 +291,7 @@ Merge
     // diagonal entries if another undeflatable column is not encountered
     // first).
     Int revivalCandidate = n;
+    vector<DeflationRotation<Real>> rotations;
     for( Int j=0; j<n; ++j )
     {
         if( Abs(2*beta*z(j)) <= deflationTol )
@@ -254,17 +373,10 @@ Merge
             // Apply | c -s | from the right to Q
             //       | s  c |
             //
-            const Int revivalOrig = combinedToOrig( revivalCandidate );
-            const Int jOrig = combinedToOrig( j );
-            if( ctrl.wantEigVecs )
-            {
-                // TODO(poulson): Exploit the nonzero structure of Q?
-                blas::Rot( n, &Q(0,jOrig), 1, &Q(0,revivalOrig), 1, c, s );
-            }
-            else
-            {
-                blas::Rot( 2, &Q(0,jOrig), 1, &Q(0,revivalOrig), 1, c, s );
-            }
+            // (the rotations are applied to Q after the deflation search)
+            rotations.push_back
+            ( DeflationRotation<Real>
+              {combinedToOrig(j),combinedToOrig(revivalCandidate),c,s} );
 
             const Int deflationDest = (n-1) - numDeflated;
             deflationPerm.SetImage( revivalCandidate, deflationDest );
@@ -313,6 +425,8 @@ Merge
         ++numUndeflated;
     }
 
+    ApplyDeflationRotations( rotations, Q );
+
     // Now shrink dUndeflated and zUndeflated down to their proper size
     dUndeflated.Resize( numUndeflated, 1 );
     zUndeflated.Resize( numUndeflated, 1 );
@@ -330,21 +444,21 @@ Merge
     )
 
     // Compute offsets for packing them
-    std::vector<Int> packingOffsets( NUM_DC_COMBINED_COLUMN_TYPES, 0 );
-    Int totalPacked = 0;
-    for( Int columnType=0; columnType<NUM_DC_COMBINED_COLUMN_TYPES;
-         ++columnType )
-    {
-        packingOffsets[columnType] = totalPacked;
-        totalPacked += packingCounts[columnType];
-        if( ctrl.progress )
+    std::vector<Int> packingOffsets = PackingOffsets( packingCounts );
+    if( ctrl.progress )
+        for( Int columnType=0; columnType<NUM_DC_COMBINED_COLUMN_TYPES;
+             ++columnType )
             Output("packingCounts[",columnType,"]=",packingCounts[columnType]);
-    }
 
-    // Set up the index ranges of the three packed column subsets
-    const Range<Int> packingInd0(packingOffsets[0],packingOffsets[1]),
-                     packingInd1(packingOffsets[1],packingOffsets[2]),
-                     packingInd2(packingOffsets[2],packingOffsets[3]);
+    // Set up the index ranges of the packed columns which are nonzero in the
+    // first and second block rows
+    const Range<Int>
+      packingInd0
+      (packingOffsets[COLUMN_NONZERO_IN_FIRST_BLOCK],
+       packingOffsets[COLUMN_NONZERO_IN_SECOND_BLOCK]),
+      packingInd1
+      (packingOffsets[DENSE_COLUMN],
+       packingOffsets[DEFLATED_COLUMN]);
 
     Matrix<Real> dPacked;
     Matrix<Real> QPacked;
@@ -355,6 +469,7 @@ Merge
         QPacked.Resize( 2, n );
     Permutation packingPerm;
     packingPerm.MakeIdentity( n );
+    vector<Int> packingOrigs( n );
     for( Int j=0; j<n; ++j )
     {
         // Recall that columnTypes maps the indices in the *undeflated* ordering
@@ -367,24 +482,19 @@ Merge
         const Int packingDest = packingOffsets[columnTypes(j)]++;
         packingPerm.SetImage( packingSource, packingDest );
 
-        const Int jOrig = combinedToOrig( j );
-
+        packingOrigs[packingDest] = combinedToOrig( j );
         dPacked(packingDest) = d(j);
-        if( ctrl.wantEigVecs )
-        {
-            // TODO(poulson): Exploit the nonzero structure of Q?
-            blas::Copy( n, &Q(0,jOrig), 1, &QPacked(0,packingDest), 1 );
-        }
-        else
-        {
-            blas::Copy( 2, &Q(0,jOrig), 1, &QPacked(0,packingDest), 1 );
-        }
     }
+    // The columns are copied in full, since the deflated columns are returned
+    // to Q whole and the unstructured update reads all of QPacked
+    const Int QPackedHeight = QPacked.Height();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+        blas::Copy
+        ( QPackedHeight, &Q(0,packingOrigs[j]), 1, &QPacked(0,j), 1 );
 
     // Put the deflated columns in their final destination and shrink QPacked
     // down to its final size
-    //
-    // TODO(poulson): Exploit the nonzero structure of Q?
     if( numDeflated > 0 )
     {
         blas::Copy
@@ -413,14 +523,9 @@ Merge
     // ==================================================
     auto undeflatedInd = IR(0,numUndeflated);
     const Real zUndeflatedNorm = FrobeniusNorm( zUndeflated );
-    zUndeflated *= Real(1) / zUndeflatedNorm;
+    Scale( Real(1) / zUndeflatedNorm, zUndeflated );
     const Real rho = 2*Abs(beta)*zUndeflatedNorm*zUndeflatedNorm;
 
-    if( ctrl.progress )
-        Output("Solving secular equation and correcting update vector");
-    Matrix<Real> rCorrected;
-    Ones( rCorrected, numUndeflated, 1 );
-
     // Ensure that there is sufficient space for storing the needed
     // eigenvectors from the undeflated secular equation. Notice that we
     // *always* need to compute the eigenvectors of the undeflated secular
@@ -431,128 +536,74 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto minusShift = QSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular eigenvalue ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
-    }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
-
-    // Compute the unnormalized eigenvectors.
+    // Solve the secular equation for each of the undeflated eigenvalues (in
+    // parallel) and form the normalized eigenvectors from the corrected
+    // update vector.
     if( ctrl.progress )
-        Output("Computing unnormalized eigenvectors");
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto q = QSecular(ALL,IR(j));
-        for( Int i=0; i<numUndeflated; ++i )
-            q(i) = rCorrected(i) / q(i);
-    }
+        Output("Solving secular equation and forming its eigenvectors");
+    auto dSecular = d( undeflatedInd, ALL );
+    auto valueInfo =
+      SecularEVD
+      ( dUndeflated, rho, zUndeflated, dSecular, QSecular,
+        dcCtrl.secularCtrl );
+    secularInfo.numIterations += valueInfo.numIterations;
+    secularInfo.numAlternations += valueInfo.numAlternations;
+    secularInfo.numCubicIterations += valueInfo.numCubicIterations;
+    secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+    if( ctrl.progress )
+        Print( dSecular, "Secular eigenvalues" );
 
-    // Form the normalized right singular vectors with the rows permuted by
-    // the inverse of the packing permutation in U. This allows the product
-    // of QPacked with U to be equal to the unpacked Q times the eigenvectors
-    // from the secular equation.
+    // Form the eigenvectors with the rows permuted by the inverse of the
+    // packing permutation in U. This allows the product of QPacked with U to
+    // be equal to the unpacked Q times the eigenvectors from the secular
+    // equation.
     Matrix<Real> U;
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
+    EL_PARALLEL_FOR
     for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto q = QSecular(ALL,IR(j));
-        auto u = U(ALL,IR(j));
-        const Real qFrob = FrobeniusNorm( q );
         for( Int i=0; i<numUndeflated; ++i )
-            u(i) = q(packingPerm.Preimage(i)) / qFrob;
-    }
+            U(i,j) = QSecular(packingPerm.Preimage(i),j);
+
     // Overwrite the first 'numUndeflated' columns of Q with the updated
     // eigenvectors by exploiting the partitioning of Z = QPacked as
     //
-    //   Z = | Z_{0,0} |    0    | Z_{0,2} |,
+    //   Z = | Z_{0,0} | Z_{0,1} |    0    |,
     //       |---------|---------|---------|
     //       |    0    | Z_{1,1} | Z_{1,2} |
     //
-    // where the first and second block rows have heights n0 and n1. The block
-    // columns respectively have widths packingCounts[0], packingCounts[1], and
-    // packingCounts[2].
+    // where the first and second block rows have heights n0 and n1 and the
+    // block columns respectively hold the columns which are nonzero in only
+    // the first block row, the dense columns, and the columns which are
+    // nonzero in only the second block row (Cf. LAPACK's {s,d}laed3).
     //
     // Conformally partitioning U, we have
     //
-    //   Z U = Z_{:,2} U2 + | Z_{0,0} U_0 |.
-    //                      |-------------|
-    //                      | Z_{1,1} U_1 |
+    //   Z U = | Z_{0,0} Z_{0,1} | | U_0 | and | Z_{1,1} Z_{1,2} | | U_1 |,
+    //                             | U_1 |                         | U_2 |
+    //
+    // for the two block rows, which only requires two Gemm's.
     //
     if( ctrl.progress )
         Output("Overwriting eigenvectors");
     auto QUndeflated = Q( ALL, undeflatedInd );
-    if( ctrl.wantEigVecs )
+    if( dcCtrl.exploitStructure )
     {
-        if( dcCtrl.exploitStructure )
-        {
-            auto Z2 = QPacked( ALL, packingInd2 );
-            auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
-
-            // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0,n0), ALL );
-            auto Z00 = QPacked( IR(0,n0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
-
-            // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(n0,n), ALL );
-            auto Z11 = QPacked( IR(n0,n), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
-        }
-        else
-        {
-            Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
-        }
+        const Int QHeight0 = ( ctrl.wantEigVecs ? n0 : 1 );
+        auto Q0Undeflated = QUndeflated( IR(0,QHeight0), ALL );
+        auto Z0 = QPacked( IR(0,QHeight0), packingInd0 );
+        auto U0 = U( packingInd0, ALL );
+        Gemm( NORMAL, NORMAL, Real(1), Z0, U0, Real(0), Q0Undeflated );
+
+        auto Q1Undeflated = QUndeflated( IR(QHeight0,END), ALL );
+        auto Z1 = QPacked( IR(QHeight0,END), packingInd1 );
+        auto U1 = U( packingInd1, ALL );
+        Gemm( NORMAL, NORMAL, Real(1), Z1, U1, Real(0), Q1Undeflated );
     }
     else
     {
-        if( dcCtrl.exploitStructure )
-        {
-            auto Z2 = QPacked( ALL, packingInd2 );
-            auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
-
-            // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0), ALL );
-            auto Z00 = QPacked( IR(0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
-
-            // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(1), ALL );
-            auto Z11 = QPacked( IR(1), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
-        }
-        else
-        {
-            Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
-        }
+        Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
     }
 
     // Rescale the eigenvalues
@@ -733,6 +784,7 @@ Merge
     // diagonal entries if another undeflatable column is not encountered
     // first).
     Int revivalCandidate = n;
+    vector<DeflationRotation<Real>> rotations;
     for( Int j=0; j<n; ++j )
     {
         if( Abs(2*beta*z(j)) <= deflationTol )
@@ -819,12 +871,10 @@ Merge
             // Apply | c -s | from the right to Q
             //       | s  c |
             //
-            const Int revivalOrig = combinedToOrig( revivalCandidate );
-            const Int jOrig = combinedToOrig( j );
-            // TODO(poulson): Exploit the nonzero structure of Q?
-            blas::Rot
-            ( Q_VC_STAR_Loc.Height(), Q_VC_STAR_Loc.Buffer(0,jOrig), 1,
-              Q_VC_STAR_Loc.Buffer(0,revivalOrig), 1, c, s );
+            // (the rotations are applied to Q after the deflation search)
+            rotations.push_back
+            ( DeflationRotation<Real>
+              {combinedToOrig(j),combinedToOrig(revivalCandidate),c,s} );
 
             const Int deflationDest = (n-1) - numDeflated;
             deflationPerm.SetImage( revivalCandidate, deflationDest );
@@ -871,6 +921,8 @@ Merge
             ("Final iteration, so p(",revivalCandidate,")=",numUndeflated);
         ++numUndeflated;
     }
+    ApplyDeflationRotations( rotations, Q_VC_STAR_Loc );
+
     // Now shrink dUndeflated and zUndeflated down to their proper size
     dUndeflated.Resize( numUndeflated, 1 );
     zUndeflated.Resize( numUndeflated, 1 );
@@ -888,21 +940,21 @@ Merge
     )
 
     // Compute offsets for packing them
-    std::vector<Int> packingOffsets( NUM_DC_COMBINED_COLUMN_TYPES, 0 );
-    Int totalPacked = 0;
-    for( Int columnType=0; columnType<NUM_DC_COMBINED_COLUMN_TYPES;
-         ++columnType )
-    {
-        packingOffsets[columnType] = totalPacked;
-        totalPacked += packingCounts[columnType];
-        if( ctrl.progress && amRoot )
+    std::vector<Int> packingOffsets = PackingOffsets( packingCounts );
+    if( ctrl.progress && amRoot )
+        for( Int columnType=0; columnType<NUM_DC_COMBINED_COLUMN_TYPES;
+             ++columnType )
             Output("packingCounts[",columnType,"]=",packingCounts[columnType]);
-    }
 
-    // Set up the index ranges of the three packed column subsets
-    const Range<Int> packingInd0(packingOffsets[0],packingOffsets[1]),
-                     packingInd1(packingOffsets[1],packingOffsets[2]),
-                     packingInd2(packingOffsets[2],packingOffsets[3]);
+    // Set up the index ranges of the packed columns which are nonzero in the
+    // first and second block rows
+    const Range<Int>
+      packingInd0
+      (packingOffsets[COLUMN_NONZERO_IN_FIRST_BLOCK],
+       packingOffsets[COLUMN_NONZERO_IN_SECOND_BLOCK]),
+      packingInd1
+      (packingOffsets[DENSE_COLUMN],
+       packingOffsets[DEFLATED_COLUMN]);
 
     Matrix<Real> dPacked;
     DistMatrix<Real,VC,STAR> QPacked(g);
@@ -914,6 +966,7 @@ Merge
     auto& QPackedLoc = QPacked.Matrix();
     Permutation packingPerm;
     packingPerm.MakeIdentity( n );
+    vector<Int> packingOrigs( n );
     for( Int j=0; j<n; ++j )
     {
         // Recall that columnTypes maps the indices in the *undeflated* ordering
@@ -926,19 +979,20 @@ Merge
         const Int packingDest = packingOffsets[columnTypes(j)]++;
         packingPerm.SetImage( packingSource, packingDest );
 
-        const Int jOrig = combinedToOrig( j );
-
+        packingOrigs[packingDest] = combinedToOrig( j );
         dPacked(packingDest) = dLoc(j);
-        // TODO(poulson): Exploit the nonzero structure of Q?
-        blas::Copy
-        ( Q_VC_STAR_Loc.Height(), Q_VC_STAR_Loc.Buffer(0,jOrig), 1,
-          QPackedLoc.Buffer(0,packingDest), 1 );
     }
+    // The columns are copied in full, since the deflated columns are returned
+    // to Q whole and the unstructured update reads all of QPacked
+    const Int QLocHeight = Q_VC_STAR_Loc.Height();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+        blas::Copy
+        ( QLocHeight, Q_VC_STAR_Loc.Buffer(0,packingOrigs[j]), 1,
+          QPackedLoc.Buffer(0,j), 1 );
 
     // Put the deflated columns in their final destination and shrink QPacked
     // down to its final size.
-    //
-    // TODO(poulson): Exploit the nonzero structure of Q?
     if( numDeflated > 0 )
     {
         blas::Copy
@@ -956,13 +1010,11 @@ Merge
     // ==================================================
     auto undeflatedInd = IR(0,numUndeflated);
     const Real zUndeflatedNorm = FrobeniusNorm( zUndeflated );
-    zUndeflated *= Real(1) / zUndeflatedNorm;
+    Scale( Real(1) / zUndeflatedNorm, zUndeflated );
     const Real rho = 2*Abs(beta)*zUndeflatedNorm*zUndeflatedNorm;
 
     if( ctrl.progress && amRoot )
         Output("Solving secular equation and correcting update vector");
-    Matrix<Real> rCorrected;
-    Ones( rCorrected, numUndeflated, 1 );
 
     // Ensure that there is sufficient space for storing the needed eigenvectors
     // from the undeflated secular equation. Notice that we *always* need to
@@ -973,32 +1025,60 @@ Merge
     auto& dSecularLoc = dSecular.Matrix();
     auto& QSecularLoc = QSecular.Matrix();
 
+    // Each process solves for its local eigenvalues in parallel. An exception
+    // cannot leave an OpenMP loop, so any failure is rethrown afterwards.
     const Int numUndeflatedLoc = QSecularLoc.Width();
+    vector<SecularEVDInfo> valueInfos( numUndeflatedLoc );
+    vector<std::exception_ptr> failures( numUndeflatedLoc );
+    EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
         const Int j = QSecular.GlobalCol(jLoc);
         auto minusShift = QSecularLoc( ALL, IR(jLoc) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
-            minusShift, dcCtrl.secularCtrl );
+        try
+        {
+            valueInfos[jLoc] =
+              SecularEigenvalue
+              ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
+                minusShift, dcCtrl.secularCtrl );
+        }
+        catch( ... )
+        {
+            failures[jLoc] = std::current_exception();
+        }
+    }
+    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+    {
+        if( failures[jLoc] )
+            std::rethrow_exception( failures[jLoc] );
         if( ctrl.progress && amRoot )
-            Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
+            Output
+            ("Secular eigenvalue ",QSecular.GlobalCol(jLoc)," is ",
+             dSecularLoc(jLoc));
 
         // We will sum these across all of the processors at the top-level
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
+        secularInfo.numIterations += valueInfos[jLoc].numIterations;
+        secularInfo.numAlternations += valueInfos[jLoc].numAlternations;
+        secularInfo.numCubicIterations += valueInfos[jLoc].numCubicIterations;
+        secularInfo.numCubicFailures += valueInfos[jLoc].numCubicFailures;
+    }
 
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+    // Form the local contributions to the products defining the corrected
+    // update vector (see SecularEVD) one row at a time
+    Matrix<Real> rCorrected( numUndeflated, 1 );
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        Real rProd = 1;
+        for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            const Int j = QSecular.GlobalCol(jLoc);
+            if( j == k )
+                rProd *= QSecularLoc(k,jLoc);
+            else
+                rProd *= QSecularLoc(k,jLoc) / (dUndeflated(j)-dUndeflated(k));
         }
+        rCorrected(k) = rProd;
     }
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
@@ -1009,17 +1089,6 @@ Merge
         wUndeflated = dSecular;
     }
 
-    // Compute the unnormalized eigenvectors.
-    if( ctrl.progress && amRoot )
-        Output("Computing unnormalized eigenvectors");
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
-    {
-        auto q = QSecularLoc(ALL,IR(jLoc));
-        for( Int i=0; i<numUndeflated; ++i )
-            q(i) = rCorrected(i) / q(i);
-    }
-
-
     // Form the normalized eigenvectors with the rows permuted by
     // the inverse of the packing permutation in U. This allows the product
     // of QPacked with U to be equal to the unpacked Q times the eigenvectors
@@ -1029,83 +1098,40 @@ Merge
     DistMatrix<Real,STAR,VR> U(g);
     U.Resize( numUndeflated, numUndeflated );
     auto& ULoc = U.Matrix();
+    EL_PARALLEL_FOR
     for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
         auto q = QSecularLoc(ALL,IR(jLoc));
         auto u = ULoc(ALL,IR(jLoc));
+        for( Int i=0; i<numUndeflated; ++i )
+            q(i) = rCorrected(i) / q(i);
         const Real qFrob = FrobeniusNorm( q );
         for( Int i=0; i<numUndeflated; ++i )
             u(i) = q(packingPerm.Preimage(i)) / qFrob;
     }
+
     // Overwrite the first 'numUndeflated' columns of Q with the updated
-    // eigenvectors by exploiting the partitioning of Z = QPacked as
-    //
-    //   Z = | Z_{0,0} |    0    | Z_{0,2} |,
-    //       |---------|---------|---------|
-    //       |    0    | Z_{1,1} | Z_{1,2} |
-    //
-    // where the first and second block rows have heights n0 and n1. The block
-    // columns respectively have widths packingCounts[0], packingCounts[1], and
-    // packingCounts[2].
-    //
-    // Conformally partitioning U, we have
-    //
-    //   Z U = Z_{:,2} U2 + | Z_{0,0} U_0 |,
-    //                      |-------------|
-    //                      | Z_{1,1} U_1 |
-    //
+    // eigenvectors using the same two block-row Gemm's as in the sequential
+    // implementation.
     if( ctrl.progress && amRoot )
         Output("Overwriting eigenvectors");
     auto QUndeflated = Q( ALL, undeflatedInd );
-    if( ctrl.wantEigVecs )
+    if( dcCtrl.exploitStructure )
     {
-        if( dcCtrl.exploitStructure )
-        {
-            auto Z2 = QPacked( ALL, packingInd2 );
-            auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
-
-            // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0,n0), ALL );
-            auto Z00 = QPacked( IR(0,n0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
-
-            // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(n0,n), ALL );
-            auto Z11 = QPacked( IR(n0,n), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
-        }
-        else
-        {
-            Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
-        }
+        const Int QHeight0 = ( ctrl.wantEigVecs ? n0 : 1 );
+        auto Q0Undeflated = QUndeflated( IR(0,QHeight0), ALL );
+        auto Z0 = QPacked( IR(0,QHeight0), packingInd0 );
+        auto U0 = U( packingInd0, ALL );
+        Gemm( NORMAL, NORMAL, Real(1), Z0, U0, Real(0), Q0Undeflated );
+
+        auto Q1Undeflated = QUndeflated( IR(QHeight0,END), ALL );
+        auto Z1 = QPacked( IR(QHeight0,END), packingInd1 );
+        auto U1 = U( packingInd1, ALL );
+        Gemm( NORMAL, NORMAL, Real(1), Z1, U1, Real(0), Q1Undeflated );
     }
     else
     {
-        if( dcCtrl.exploitStructure )
-        {
-            auto Z2 = QPacked( ALL, packingInd2 );
-            auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
-
-            // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0), ALL );
-            auto Z00 = QPacked( IR(0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
-
-            // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(1), ALL );
-            auto Z11 = QPacked( IR(1), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
-        }
-        else
-        {
-            Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
-        }
+        Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
     }
 
     // Rescale the eigenvalues
@@ -1140,7 +1166,7 @@ DivideAndConquer
         if( ctrl.wantEigVecs )
         {
             ctrlMod.accumulateEigVecs = false;
-            HermitianTridiagEig( mainDiag, superDiag, w, Q, ctrlMod );
+            LeafEig( mainDiag, superDiag, w, Q, ctrlMod );
         }
         else
         {
@@ -1149,7 +1175,7 @@ DivideAndConquer
             Zeros( Q, 2, n );
             Q(0,0) = 1;
             Q(1,n-1) = 1;
-            HermitianTridiagEig( mainDiag, superDiag, w, Q, ctrlMod );
+            LeafEig( mainDiag, superDiag, w, Q, ctrlMod );
         }
         return info;
     }
@@ -1179,11 +1205,13 @@ DivideAndConquer
         Zeros( Q1, 2, n-split );
     }
 
-    Matrix<Real> w0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
-
-    Matrix<Real> w1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+    Matrix<Real> w0, w1;
+    DCInfo info0, info1;
+    SolveSubtrees
+    ( [&]()
+      { info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl ); },
+      [&]()
+      { info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl ); } );
 
     if( !ctrl.wantEigVecs )
     {
@@ -1191,8 +1219,8 @@ DivideAndConquer
         Zeros( Q, 2, n );
         auto Q0Last = Q( IR(0), IR(0,split) );
         auto Q1First = Q( IR(1), IR(split,n) );
-        Q0Last = Q0( IR(1), ALL );
-        Q1First = Q1( IR(0), ALL );
+        Copy( Q0( IR(1), ALL ), Q0Last );
+        Copy( Q1( IR(0), ALL ), Q1First );
     }
     info = Merge( beta, w0, w1, w, Q, ctrl );
 
@@ -1219,6 +1247,40 @@ DivideAndConquer
     return info;
 }
 
+// Form redundant copies of the eigenvalues and (packed) eigenvectors of a
+// subtree over the parent grid. Since the subtree grid is a subset of the
+// parent grid, each owner contributes its local entries to a zero-initialized
+// buffer which is then summed over the parent grid.
+template<typename Real>
+void GatherSubtree
+( const DistMatrix<Real,STAR,STAR>& wSub,
+  const DistMatrix<Real>& QSub,
+        Int n,
+        Int QHeight,
+        Matrix<Real>& wLoc,
+        Matrix<Real>& QLoc,
+  const Grid& grid )
+{
+    EL_DEBUG_CSE
+    Zeros( wLoc, n, 1 );
+    Zeros( QLoc, QHeight, n );
+    if( QSub.Participating() )
+    {
+        if( QSub.Grid().VCRank() == 0 )
+            Copy( wSub.LockedMatrix(), wLoc );
+        const Int QSubLocHeight = QSub.LocalHeight();
+        const Int QSubLocWidth = QSub.LocalWidth();
+        for( Int jLoc=0; jLoc<QSubLocWidth; ++jLoc )
+        {
+            const Int j = QSub.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<QSubLocHeight; ++iLoc )
+                QLoc(QSub.GlobalRow(iLoc),j) = QSub.GetLocal(iLoc,jLoc);
+        }
+    }
+    AllReduce( wLoc, grid.Comm() );
+    AllReduce( QLoc, grid.Comm() );
+}
+
 // We pass in mainDiag and superDiag in sequential form to avoid potential
 // confusion from avoiding unnecessarily creating separate copies distributed
 // (trivially) over subtrees.
@@ -1255,8 +1317,7 @@ DivideAndConquer
             {
                 if( grid.Rank() == 0 )
                 {
-                    HermitianTridiagEig
-                    ( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
+                    LeafEig( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
                 }
                 wLoc.Resize( n, 1 );
                 El::Broadcast( wLoc, grid.VCComm(), 0 );
@@ -1266,7 +1327,7 @@ DivideAndConquer
             else
             {
                 // Let's cross our fingers and ignore the forward instability
-                HermitianTridiagEig( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
+                LeafEig( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
             }
         }
         else
@@ -1280,8 +1341,7 @@ DivideAndConquer
             {
                 if( grid.Rank() == 0 )
                 {
-                    HermitianTridiagEig
-                    ( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
+                    LeafEig( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
                 }
                 wLoc.Resize( n, 1 );
                 El::Broadcast( wLoc, grid.VCComm(), 0 );
@@ -1290,7 +1350,7 @@ DivideAndConquer
             else
             {
                 // Let's cross our fingers and ignore the forward instability
-                HermitianTridiagEig( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
+                LeafEig( mainDiag, superDiag, wLoc, QLoc, ctrlMod );
             }
         }
 
@@ -1371,31 +1431,44 @@ DivideAndConquer
           DivideAndConquer( mainDiag1, superDiag1, w1Sub, Q1Sub, ctrl, false );
     }
 
-    const bool includeViewers = true;
-    w0Sub.MakeConsistent( includeViewers );
-    Q0Sub.MakeConsistent( includeViewers );
-    w1Sub.MakeConsistent( includeViewers );
-    Q1Sub.MakeConsistent( includeViewers );
-
+    // The subgrids cannot be directly redistributed onto the parent grid, so
+    // we form redundant copies of the subtree results and then pack them.
+    const Int QHeight0 = ( ctrl.wantEigVecs ? split : 2 );
+    const Int QHeight1 = ( ctrl.wantEigVecs ? n-split : 2 );
     DistMatrix<Real,STAR,STAR> w0(grid), w1(grid);
-    w0 = w0Sub;
-    w1 = w1Sub;
+    w0.Resize( split, 1 );
+    w1.Resize( n-split, 1 );
+    Matrix<Real> Q0Loc, Q1Loc;
+    GatherSubtree( w0Sub, Q0Sub, split, QHeight0, w0.Matrix(), Q0Loc, grid );
+    GatherSubtree( w1Sub, Q1Sub, n-split, QHeight1, w1.Matrix(), Q1Loc, grid );
     if( ctrl.wantEigVecs )
-    {
         Zeros( Q, n, n );
-        auto Q0 = Q(IR(0,split),IR(0,split));
-        auto Q1 = Q(IR(split,n),IR(split,n));
-        Q0 = Q0Sub;
-        Q1 = Q1Sub;
-    }
     else
-    {
         // We must manually pack the last row of Q0 and the first row of Q1
         Zeros( Q, 2, n );
-        auto Q0Last = Q( IR(0), IR(0,split) );
-        auto Q1First = Q( IR(1), IR(split,n) );
-        Q0Last = Q0Sub( IR(1), ALL );
-        Q1First = Q1Sub( IR(0), ALL );
+    const Int QLocHeight = Q.LocalHeight();
+    const Int QLocWidth = Q.LocalWidth();
+    for( Int jLoc=0; jLoc<QLocWidth; ++jLoc )
+    {
+        const Int j = Q.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<QLocHeight; ++iLoc )
+        {
+            const Int i = Q.GlobalRow(iLoc);
+            if( ctrl.wantEigVecs )
+            {
+                if( i < split && j < split )
+                    Q.SetLocal( iLoc, jLoc, Q0Loc(i,j) );
+                else if( i >= split && j >= split )
+                    Q.SetLocal( iLoc, jLoc, Q1Loc(i-split,j-split) );
+            }
+            else
+            {
+                if( i == 0 && j < split )
+                    Q.SetLocal( iLoc, jLoc, Q0Loc(1,j) );
+                else if( i == 1 && j >= split )
+                    Q.SetLocal( iLoc, jLoc, Q1Loc(0,j-split) );
+            }
+        }
     }
     info = Merge( beta, w0, w1, w, Q, ctrl );
 
@@ -580,7 +580,8 @@ QRAlg
         }
         El::Broadcast( mainDiag.Matrix(), grid.VCComm(), 0 );
         mpi::Broadcast
-        ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm() );
+        ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm(),
+          SyncInfo<Device::CPU>{} );
         UnpackQRInfo( packedQRInfo, info );
     }
     else
@@ -15,6 +15,9 @@ namespace El {
 
 // Compute the polar decomposition of A, A = Q P, where Q is unitary and P is
 // Hermitian positive semi-definite. On exit, A is overwritten with Q.
+//
+// Distributed matrices default to QDWH, as the SVD-based alternative gathers
+// A onto a single process (see PolarCtrl).
 
 template<typename Field>
 PolarInfo Polar( Matrix<Field>& A, const PolarCtrl& ctrl )
@@ -33,7 +36,7 @@ PolarInfo Polar( AbstractDistMatrix<Field>& A, const PolarCtrl& ctrl )
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.qdwh || !ctrl.gatherSVD )
         info.qdwhInfo = polar::QDWH( A, ctrl.qdwhCtrl );
     else
         polar::SVD( A );
@@ -60,7 +63,7 @@ PolarInfo Polar
 {
     EL_DEBUG_CSE
     PolarInfo info;
-    if( ctrl.qdwh )
+    if( ctrl.qdwh || !ctrl.gatherSVD )
         info.qdwhInfo = polar::QDWH( A, P, ctrl.qdwhCtrl );
     else
         polar::SVD( A, P );
@@ -161,11 +164,6 @@ PolarInfo HermitianPolar
     const PolarCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
-#define EL_ENABLE_DOUBLEDOUBLE
-#define EL_ENABLE_QUADDOUBLE
-#define EL_ENABLE_QUAD
-#define EL_ENABLE_BIGFLOAT
-#define EL_ENABLE_HALF
 #include <El/macros/Instantiate.h>
 
 } // namespace El
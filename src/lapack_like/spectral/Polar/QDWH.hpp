@@ -9,6 +9,8 @@
 #ifndef EL_POLAR_QDWH_HPP
 #define EL_POLAR_QDWH_HPP
 
+#include "../../props/Norm/TwoEstimate.hpp"
+
 namespace El {
 
 // Based on Yuji Nakatsukasa's implementation of a QR-based dynamically
@@ -21,15 +23,172 @@ namespace El {
 //
 // The careful calculation of the coefficients is due to a suggestion from
 // Gregorio Quintana Orti.
+//
+// Once the weight c drops below ctrl.cholThreshold (100 by default), the
+// iterate is well-conditioned enough for the QR factorization of
+// [sqrt(c) A; I] to be replaced by a Cholesky factorization of I + c A^H A,
+// as suggested in
+//
+//   Y. Nakatsukasa and N.J. Higham, "Stable and efficient spectral divide and
+//   conquer algorithms for the symmetric eigenvalue decomposition and the
+//   SVD", SIAM J. Sci. Comput., 35(3), 2013.
+//
+// The Cholesky-based steps consist only of Herk, Cholesky, and Trsm and
+// therefore communicate far less than Householder QR.
 
 namespace polar {
 
+// Update the lower bound L on the smallest singular value of the iterate and
+// return the weights of the iteration
+//
+//   A := A (a I + b A^H A) (I + c A^H A)^{-1}
+//      = beta A + alpha A (I + c A^H A)^{-1},
+//
+// where alpha = a - b/c and beta = b/c.
+template<typename Real>
+void QDWHWeights( Real& L, Real& alpha, Real& beta, Real& c, Real tol )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Cpx;
+    const Real oneThird = Real(1)/Real(3);
+    Real L2;
+    Cpx dd, sqd;
+    if( Abs(1-L) < tol )
+    {
+        L2 = 1;
+        dd = 0;
+        sqd = 1;
+    }
+    else
+    {
+        L2 = L*L;
+        dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
+        sqd = Sqrt( Real(1)+dd );
+    }
+    const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
+    const Real a = (sqd + Sqrt(arg)/Real(2)).real();
+    const Real b = (a-1)*(a-1)/4;
+    c = a+b-1;
+    alpha = a-b/c;
+    beta = b/c;
+
+    L = L*(a+b*L2)/(1+c*L2);
+}
+
+// Estimate the smallest singular value of A from a two-norm estimate of
+// R^{-1}, where R is the triangular factor from the QR decomposition of A.
+// Each application of R^{-1} is a triangular solve, so this is far cheaper
+// than explicitly inverting R (or A).
+template<typename F>
+Base<F> SMinEstimate( const Matrix<F>& A, const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    if( n == 0 )
+        return Real(1);
+
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = ctrl.colPiv;
+    Matrix<F> R( A );
+    qr::ExplicitTriang( R, qrCtrl );
+    for( Int j=0; j<n; ++j )
+        if( R(j,j) == F(0) )
+            return Real(0);
+
+    auto applyInv =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Y = X;
+          Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, Y );
+      };
+    auto applyInvAdj =
+      [&]( const Matrix<F>& Y, Matrix<F>& X )
+      {
+          X = Y;
+          Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), R, X );
+      };
+    TwoNormEstimateCtrl<Real> normCtrl;
+    normCtrl.tol = Real(ctrl.normEstTol);
+    normCtrl.demandConverged = false;
+    Matrix<F> X;
+    const Real twoNormInv =
+      two_norm_est::Estimate<F>( n, n, applyInv, applyInvAdj, X, normCtrl );
+    return Real(1) / twoNormInv;
+}
+
+template<typename F>
+Base<F> SMinEstimate( const DistMatrix<F>& A, const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    if( n == 0 )
+        return Real(1);
+
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.colPiv = ctrl.colPiv;
+    DistMatrix<F> R( A );
+    qr::ExplicitTriang( R, qrCtrl );
+    DistMatrix<F,STAR,STAR> d( A.Grid() );
+    GetDiagonal( R, d );
+    for( Int j=0; j<n; ++j )
+        if( d.GetLocal(j,0) == F(0) )
+            return Real(0);
+
+    auto applyInv =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& Y )
+      {
+          Y = X;
+          Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, Y );
+      };
+    auto applyInvAdj =
+      [&]( const DistMatrix<F>& Y, DistMatrix<F>& X )
+      {
+          X = Y;
+          Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), R, X );
+      };
+    TwoNormEstimateCtrl<Real> normCtrl;
+    normCtrl.tol = Real(ctrl.normEstTol);
+    normCtrl.demandConverged = false;
+    DistMatrix<F> X( A.Grid() );
+    const Real twoNormInv =
+      two_norm_est::Estimate<F>( n, n, applyInv, applyInvAdj, X, normCtrl );
+    return Real(1) / twoNormInv;
+}
+
+// Scale A so that its largest singular value is approximately one
+template<typename F>
+void NormalizeTwoNorm( Matrix<F>& A, const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    TwoNormEstimateCtrl<Real> normCtrl;
+    normCtrl.tol = Real(ctrl.normEstTol);
+    normCtrl.demandConverged = false;
+    const Real twoEst = TwoNormEstimate( A, normCtrl );
+    if( twoEst != Real(0) )
+        Scale( Real(1)/twoEst, A );
+}
+
+template<typename F>
+void NormalizeTwoNorm( DistMatrix<F>& A, const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    TwoNormEstimateCtrl<Real> normCtrl;
+    normCtrl.tol = Real(ctrl.normEstTol);
+    normCtrl.demandConverged = false;
+    const Real twoEst = TwoNormEstimate( A, normCtrl );
+    if( twoEst != Real(0) )
+        Scale( Real(1)/twoEst, A );
+}
+
 template<typename F>
 QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int m = A.Height();
     const Int n = A.Width();
     const Real oneThird = Real(1)/Real(3);
@@ -44,47 +203,32 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
+    // The workspace is allocated once and reused by every iteration; the
+    // stacked matrix for the QR-based steps is only formed if one is needed
     Real frobNormADiff;
-    Matrix<F> ALast, ATemp, C;
-    Matrix<F> Q( m+n, n );
-    auto QT = Q( IR(0,m  ), ALL );
-    auto QB = Q( IR(m,END), ALL );
+    Matrix<F> ALast( m, n ), C( n, n ), Q;
+    Matrix<F> QT, QB;
+    Real alpha, beta, c;
     while( info.numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        Copy( A, ALast );
+        QDWHWeights( L, alpha, beta, c, tol );
 
-        if( c > 100 )
+        if( c > Real(ctrl.cholThreshold) )
         {
             //
             // The standard QR-based algorithm
             //
-            QT = A;
-            QT *= Sqrt(c);
+            if( Q.Height() != m+n )
+            {
+                Q.Resize( m+n, n );
+                View( QT, Q, IR(0,m), ALL );
+                View( QB, Q, IR(m,END), ALL );
+            }
+            Copy( A, QT );
+            Scale( Sqrt(c), QT );
             MakeIdentity( QB );
             qr::ExplicitUnitary( Q, true, qrCtrl );
             Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
@@ -98,16 +242,15 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, A );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, A );
+            Scale( alpha, A );
+            Axpy( beta, ALast, A );
             ++info.numCholIts;
         }
 
         ++info.numIts;
-        ALast -= A;
+        Axpy( F(-1), A, ALast );
         frobNormADiff = FrobeniusNorm( ALast );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
@@ -119,34 +262,10 @@ template<typename F>
 QDWHInfo QDWH( Matrix<F>& A, const QDWHCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    const Real twoEst = TwoNormEstimate( A );
-    A *= 1/twoEst;
-
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
-    Matrix<F> Y( A );
-    if( A.Height() > A.Width() )
-    {
-        qr::ExplicitTriang( Y );
-        try
-        {
-            TriangularInverse( UPPER, NON_UNIT, Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-    else
-    {
-        try
-        {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-
+    if( A.Height() < A.Width() )
+        LogicError("Height cannot be less than width");
+    NormalizeTwoNorm( A, ctrl );
+    const Base<F> sMinUpper = SMinEstimate( A, ctrl );
     return QDWHInner( A, sMinUpper, ctrl );
 }
 
@@ -156,8 +275,8 @@ QDWHInfo QDWH( Matrix<F>& A, Matrix<F>& P, const QDWHCtrl& ctrl )
     EL_DEBUG_CSE
     Matrix<F> ACopy( A );
     auto info = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return info;
 }
@@ -173,7 +292,6 @@ QDWHInner
     auto& A = AProx.Get();
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int m = A.Height();
     const Int n = A.Width();
     const Real oneThird = Real(1)/Real(3);
@@ -188,49 +306,34 @@ QDWHInner
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     const Grid& g = A.Grid();
-    DistMatrix<F> ALast(g), ATemp(g), C(g);
-    DistMatrix<F> Q( m+n, n, g );
-    auto QT = Q( IR(0,m  ), ALL );
-    auto QB = Q( IR(m,END), ALL );
+    DistMatrix<F> ALast(g), C(g), Q(g), QT(g), QB(g);
+    ALast.AlignWith( A );
+    ALast.Resize( m, n );
+    C.Resize( n, n );
 
     Real frobNormADiff;
+    Real alpha, beta, c;
     while( info.numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        Copy( A, ALast );
+        QDWHWeights( L, alpha, beta, c, tol );
 
-        if( c > 100 )
+        if( c > Real(ctrl.cholThreshold) )
         {
             //
             // The standard QR-based algorithm
             //
-            QT = A;
-            QT *= Sqrt(c);
+            if( Q.Height() != m+n )
+            {
+                Q.Resize( m+n, n );
+                View( QT, Q, IR(0,m), ALL );
+                View( QB, Q, IR(m,END), ALL );
+            }
+            Copy( A, QT );
+            Scale( Sqrt(c), QT );
             MakeIdentity( QB );
             qr::ExplicitUnitary( Q, true, qrCtrl );
             Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
@@ -244,16 +347,15 @@ QDWHInner
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, A );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, A );
+            Scale( alpha, A );
+            Axpy( beta, ALast, A );
             ++info.numCholIts;
         }
 
         ++info.numIts;
-        ALast -= A;
+        Axpy( F(-1), A, ALast );
         frobNormADiff = FrobeniusNorm( ALast );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
@@ -266,38 +368,14 @@ QDWHInfo
 QDWH( AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( APre.Height() < APre.Width() )
+        LogicError("Height cannot be less than width");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    typedef Base<F> Real;
-    const Real twoEst = TwoNormEstimate( A );
-    A *= 1/twoEst;
-
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
-    DistMatrix<F> Y( A );
-    if( A.Height() > A.Width() )
-    {
-        qr::ExplicitTriang( Y );
-        try
-        {
-            TriangularInverse( UPPER, NON_UNIT, Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-    else
-    {
-        try
-        {
-            Inverse( Y );
-            sMinUpper = Real(1) / OneNorm( Y );
-        } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-    }
-
+    NormalizeTwoNorm( A, ctrl );
+    const Base<F> sMinUpper = SMinEstimate( A, ctrl );
     return QDWHInner( A, sMinUpper, ctrl );
 }
 
@@ -317,8 +395,8 @@ QDWH
 
     DistMatrix<F> ACopy( A );
     auto info = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return info;
 }
@@ -340,7 +418,6 @@ QDWHInner
         LogicError("Height must be same as width");
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int n = A.Height();
     const Real oneThird = Real(1)/Real(3);
 
@@ -352,49 +429,31 @@ QDWHInner
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     Real frobNormADiff;
-    Matrix<F> ALast, ATemp, C;
-    Matrix<F> Q( 2*n, n );
-    auto QT = Q( IR(0,n  ), ALL );
-    auto QB = Q( IR(n,END), ALL );
-
+    Matrix<F> ALast( n, n ), C( n, n ), Q;
+    Matrix<F> QT, QB;
+    Real alpha, beta, c;
     while( info.numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
+        MakeHermitian( uplo, A );
+        Copy( A, ALast );
+        polar::QDWHWeights( L, alpha, beta, c, tol );
 
-        L = L*(a+b*L2)/(1+c*L2);
-
-        if( c > 100 )
+        if( c > Real(ctrl.cholThreshold) )
         {
             //
             // The standard QR-based algorithm
             //
-            MakeHermitian( uplo, A );
-            QT = A;
-            QT *= Sqrt(c);
+            if( Q.Height() != 2*n )
+            {
+                Q.Resize( 2*n, n );
+                View( QT, Q, IR(0,n), ALL );
+                View( QB, Q, IR(n,END), ALL );
+            }
+            Copy( A, QT );
+            Scale( Sqrt(c), QT );
             MakeIdentity( QB );
             qr::ExplicitUnitary( Q, true, qrCtrl );
             Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
@@ -408,19 +467,17 @@ QDWHInner
             // TODO(poulson): Think of how to better exploit the symmetry of A,
             // e.g., by halving the work in the first Herk through
             // a custom routine for forming L^2, where L is strictly lower
-            MakeHermitian( uplo, A );
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, A );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, A );
+            Scale( alpha, A );
+            Axpy( beta, ALast, A );
             ++info.numCholIts;
         }
 
-        ALast -= A;
+        Axpy( F(-1), A, ALast );
         frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
 
         ++info.numIts;
@@ -437,23 +494,11 @@ QDWHInfo
 QDWH( UpperOrLower uplo, Matrix<F>& A, const QDWHCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
+    if( A.Height() != A.Width() )
+        LogicError("Height must be same as width");
     MakeHermitian( uplo, A );
-    const Real twoEst = TwoNormEstimate( A );
-    A *= 1/twoEst;
-
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
-    Matrix<F> Y( A );
-    try
-    {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
-    } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-
+    polar::NormalizeTwoNorm( A, ctrl );
+    const Base<F> sMinUpper = polar::SMinEstimate( A, ctrl );
     return QDWHInner( uplo, A, sMinUpper, ctrl );
 }
 
@@ -491,7 +536,6 @@ QDWHInner
     auto& A = AProx.Get();
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Grid& g = A.Grid();
     const Int n = A.Height();
     const Real oneThird = Real(1)/Real(3);
@@ -504,49 +548,34 @@ QDWHInner
     const Real eps = limits::Epsilon<Real>();
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
-    Real L = sMinUpper / Sqrt(Real(n));
+    Real L = Max( sMinUpper / Sqrt(Real(n)), eps );
 
     Real frobNormADiff;
-    DistMatrix<F> ALast(g), ATemp(g), C(g);
-    DistMatrix<F> Q( 2*n, n, g );
-    auto QT = Q( IR(0,n  ), ALL );
-    auto QB = Q( IR(n,END), ALL );
+    DistMatrix<F> ALast(g), C(g), Q(g), QT(g), QB(g);
+    ALast.AlignWith( A );
+    ALast.Resize( n, n );
+    C.Resize( n, n );
 
+    Real alpha, beta, c;
     while( info.numIts < ctrl.maxIts )
     {
-        ALast = A;
-
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        MakeHermitian( uplo, A );
+        Copy( A, ALast );
+        polar::QDWHWeights( L, alpha, beta, c, tol );
 
-        if( c > 100 )
+        if( c > Real(ctrl.cholThreshold) )
         {
             //
             // The standard QR-based algorithm
             //
-            MakeHermitian( uplo, A );
-            QT = A;
-            QT *= Sqrt(c);
+            if( Q.Height() != 2*n )
+            {
+                Q.Resize( 2*n, n );
+                View( QT, Q, IR(0,n), ALL );
+                View( QB, Q, IR(n,END), ALL );
+            }
+            Copy( A, QT );
+            Scale( Sqrt(c), QT );
             MakeIdentity( QB );
             qr::ExplicitUnitary( Q, true, qrCtrl );
             Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
@@ -560,20 +589,18 @@ QDWHInner
             // TODO(poulson): Think of how to better exploit the symmetry of A,
             // e.g., by halving the work in the first Herk through
             // a custom routine for forming L^2, where L is strictly lower
-            MakeHermitian( uplo, A );
             Identity( C, n, n );
             Herk( LOWER, ADJOINT, c, A, Real(1), C );
             Cholesky( LOWER, C );
-            ATemp = A;
-            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, ATemp );
-            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, ATemp );
-            A *= beta;
-            Axpy( alpha, ATemp, A );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, A );
+            Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, A );
+            Scale( alpha, A );
+            Axpy( beta, ALast, A );
             ++info.numCholIts;
         }
 
         ++info.numIts;
-        ALast -= A;
+        Axpy( F(-1), A, ALast );
         frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
             break;
@@ -587,27 +614,15 @@ QDWHInfo
 QDWH( UpperOrLower uplo, AbstractDistMatrix<F>& APre, const QDWHCtrl& ctrl )
 {
     EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("Height must be same as width");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
-    typedef Base<F> Real;
     MakeHermitian( uplo, A );
-    const Real twoEst = TwoNormEstimate( A );
-    A *= 1/twoEst;
-
-    // The one-norm of the inverse can be replaced with an estimate which is
-    // a few times cheaper, e.g., via Higham and Tisseur's block algorithm
-    // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
-    // to 1-Norm Pseudospectra".
-    Real sMinUpper;
-    DistMatrix<F> Y( A );
-    try
-    {
-        Inverse( Y );
-        sMinUpper = Real(1) / OneNorm( Y );
-    } catch( SingularMatrixException& e ) { sMinUpper = 0; }
-
+    polar::NormalizeTwoNorm( A, ctrl );
+    const Base<F> sMinUpper = polar::SMinEstimate( A, ctrl );
     return QDWHInner( uplo, A, sMinUpper, ctrl );
 }
 
@@ -14,89 +14,75 @@ namespace polar {
 
 // Compute the polar decomposition of A, A = Q P, where Q is unitary and P is
 // Hermitian positive semi-definite. On exit, A is overwritten with Q.
+//
+// The SVD is computed with LAPACK's divide and conquer algorithm; distributed
+// matrices are gathered onto a single process, which is only sensible for
+// small matrices, and so must be requested through PolarCtrl::gatherSVD.
 
 template<typename Field>
-void SVD( Matrix<Field>& A )
+void SVD( Matrix<Field>& A, Matrix<Field>& V, Matrix<Base<Field>>& s )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("Height cannot be less than width");
 
     // Get the SVD of A
-    Matrix<Real> s;
-    Matrix<Field> U, V;
-    SVDCtrl<Real> ctrl;
-    ctrl.overwrite = true;
-    El::SVD( A, U, s, V, ctrl );
+    Matrix<Field> U( m, n ), VAdj( n, n );
+    s.Resize( n, 1 );
+    lapack::DivideAndConquerSVD
+    ( m, n, A.Buffer(), A.LDim(), s.Buffer(),
+      U.Buffer(), U.LDim(), VAdj.Buffer(), VAdj.LDim() );
 
     // Form Q := U V^H in A
-    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+    Gemm( NORMAL, NORMAL, Field(1), U, VAdj, A );
+    Adjoint( VAdj, V );
 }
 
 template<typename Field>
-void SVD( Matrix<Field>& A, Matrix<Field>& P )
+void SVD( Matrix<Field>& A )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-
-    // Get the SVD of A
-    Matrix<Real> s;
-    Matrix<Field> U, V;
-    SVDCtrl<Real> ctrl;
-    ctrl.overwrite = true;
-    El::SVD( A, U, s, V, ctrl );
+    Matrix<Field> V;
+    Matrix<Base<Field>> s;
+    SVD( A, V, s );
+}
 
-    // Form Q := U V^H in A
-    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+template<typename Field>
+void SVD( Matrix<Field>& A, Matrix<Field>& P )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> V;
+    Matrix<Base<Field>> s;
+    SVD( A, V, s );
 
     // Form P := V Sigma V^H in P
     HermitianFromEVD( LOWER, P, s, V );
+    MakeHermitian( LOWER, P );
 }
 
 template<typename Field>
-void SVD( AbstractDistMatrix<Field>& APre )
+void SVD( AbstractDistMatrix<Field>& A )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-
-    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
-    auto& A = AProx.Get();
-    const Grid& g = A.Grid();
-
-    // Get the SVD of A
-    DistMatrix<Real,VR,STAR> s(g);
-    DistMatrix<Field> U(g), V(g);
-    SVDCtrl<Real> ctrl;
-    ctrl.overwrite = true;
-    El::SVD( A, U, s, V, ctrl );
-
-    // Form Q := U V^H in A
-    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+    DistMatrix<Field,CIRC,CIRC> A_CIRC_CIRC( A );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+        SVD( A_CIRC_CIRC.Matrix() );
+    Copy( A_CIRC_CIRC, A );
 }
 
 template<typename Field>
-void SVD( AbstractDistMatrix<Field>& APre, AbstractDistMatrix<Field>& PPre )
+void SVD( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& P )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-
-    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
-    DistMatrixWriteProxy<Field,Field,MC,MR> PProx( PPre );
-    auto& A = AProx.Get();
-    auto& P = PProx.Get();
     const Grid& g = A.Grid();
-
-    // Get the SVD of A
-    DistMatrix<Real,VR,STAR> s(g);
-    DistMatrix<Field> U(g), V(g);
-    SVDCtrl<Real> ctrl;
-    ctrl.overwrite = true;
-    El::SVD( A, U, s, V, ctrl );
-
-    // Form Q := U V^H in A
-    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
-
-    // Form P := V Sigma V^H in P
-    HermitianFromEVD( LOWER, P, s, V );
+    DistMatrix<Field,CIRC,CIRC> A_CIRC_CIRC( A ), P_CIRC_CIRC( g );
+    P_CIRC_CIRC.Resize( A.Width(), A.Width() );
+    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+        SVD( A_CIRC_CIRC.Matrix(), P_CIRC_CIRC.Matrix() );
+    Copy( A_CIRC_CIRC, A );
+    Copy( P_CIRC_CIRC, P );
 }
 
 } // namespace polar
@@ -0,0 +1,498 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The following implements the randomized range finder with power iterations
+// (Algorithms 4.3 and 4.4), its adaptive counterpart (Algorithm 4.2), and the
+// direct SVD (Algorithm 5.1) from
+//
+//   N. Halko, P.G. Martinsson, and J.A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//   constructing approximate matrix decompositions", SIAM Review, 53(2), 2011.
+//
+// The only operations involving the full matrix are Gemm's with tall-skinny
+// matrices, and each tall-skinny matrix is orthonormalized with a Householder
+// TSQR. Rather than computing the SVD of the short and wide B = Q^H A, we
+// factor B^H = A^H Q = Q_B R_B with another TSQR so that the only dense SVD is
+// that of the small triangular factor (computed redundantly).
+
+namespace El {
+
+namespace randomized_svd {
+
+template<typename Real>
+Real Tolerance( const RandomizedSVDCtrl<Real>& ctrl )
+{
+    return ctrl.tol == Real(0) ? Sqrt(limits::Epsilon<Real>()) : ctrl.tol;
+}
+
+// Cf. Eq. (4.3) of Halko et al.
+template<typename Real>
+Real ErrorEstimateScale()
+{
+    return 10*Sqrt(2/Pi<Real>());
+}
+
+// Sequential
+// ==========
+
+template<typename F>
+void Orthonormalize( Matrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    Matrix<F> R;
+    qr::Explicit( Y, R );
+}
+
+// Y := (I - Q Q^H) Y, with a second pass of classical Gram-Schmidt so that
+// the result is numerically orthogonal to Q
+template<typename F>
+void Project( const Matrix<F>& Q, Matrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    if( Q.Width() == 0 )
+        return;
+    Matrix<F> C;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), Q, Y, C );
+        Gemm( NORMAL, NORMAL, F(-1), Q, C, F(1), Y );
+    }
+}
+
+// Y := ((I - Q Q^H) A A^H)^q Y, with the intermediate results orthonormalized
+// so that the smaller singular values are not lost to roundoff. Projecting
+// after each application prevents the iteration from reamplifying the
+// directions already captured by Q (which may be empty).
+template<typename F>
+void PowerIterations
+( const Matrix<F>& A,
+  const Matrix<F>& Q,
+        Matrix<F>& Y,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Z;
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Orthonormalize( Y );
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+        Orthonormalize( Z );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Y );
+        Project( Q, Y );
+    }
+}
+
+template<typename F>
+void RangeFinder
+( const Matrix<F>& A,
+        Matrix<F>& Q,
+        Int maxWidth,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<F> Omega;
+    if( !ctrl.adaptive )
+    {
+        Gaussian( Omega, n, maxWidth );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        PowerIterations( A, Matrix<F>(), Q, ctrl );
+        Orthonormalize( Q );
+        return;
+    }
+    if( ctrl.blockSize <= 0 )
+        LogicError("The block size must be positive");
+
+    const Real tol = Tolerance( ctrl );
+    Real errorTol = -1;
+    Matrix<F> QFull( m, maxWidth ), Y;
+    Matrix<Real> norms;
+    Int width = 0;
+    while( width < maxWidth )
+    {
+        const Int bsize = Min( ctrl.blockSize, maxWidth-width );
+        auto QActive = QFull( ALL, IR(0,width) );
+        Gaussian( Omega, n, bsize );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+        if( errorTol < Real(0) )
+        {
+            ColumnTwoNorms( Y, norms );
+            errorTol = tol*MaxNorm( norms );
+        }
+        Project( QActive, Y );
+        ColumnTwoNorms( Y, norms );
+        const Real errorEst = ErrorEstimateScale<Real>()*MaxNorm( norms );
+        if( ctrl.progress )
+            Output("rank ",width," has error estimate ",errorEst);
+        if( errorEst <= errorTol )
+            break;
+
+        PowerIterations( A, QActive, Y, ctrl );
+        Orthonormalize( Y );
+        auto QNew = QFull( ALL, IR(width,width+bsize) );
+        Copy( Y, QNew );
+        width += bsize;
+    }
+    Copy( QFull( ALL, IR(0,width) ), Q );
+}
+
+// Given the orthonormal basis Q for the approximate range, form the SVD of
+// B = Q^H A = R_B^H Q_B^H
+template<typename F>
+void Factor
+( const Matrix<F>& A,
+  const Matrix<F>& Q,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+        Int rank,
+        bool vectors,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int l = Q.Width();
+    Matrix<F> QB, RB;
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, QB );
+    qr::Explicit( QB, RB );
+
+    // Compute the SVD R_B^H = U_R diag(s) V_R^H
+    Matrix<F> C, UR, VRAdj;
+    Adjoint( RB, C );
+    s.Resize( l, 1 );
+    if( vectors )
+    {
+        UR.Resize( l, l );
+        VRAdj.Resize( l, l );
+        lapack::DivideAndConquerSVD
+        ( l, l, C.Buffer(), C.LDim(), s.Buffer(),
+          UR.Buffer(), UR.LDim(), VRAdj.Buffer(), VRAdj.LDim() );
+    }
+    else
+    {
+        lapack::SVD( l, l, C.Buffer(), C.LDim(), s.Buffer() );
+    }
+
+    Int k = Min( rank, l );
+    if( ctrl.adaptive )
+    {
+        const Real tol = Tolerance( ctrl );
+        Int numKept = 0;
+        while( numKept < k && s(numKept) > tol*s(0) )
+            ++numKept;
+        k = numKept;
+    }
+    s.Resize( k, 1 );
+    if( vectors )
+    {
+        Gemm( NORMAL, NORMAL, F(1), Q, UR(ALL,IR(0,k)), U );
+        Gemm( NORMAL, ADJOINT, F(1), QB, VRAdj(IR(0,k),ALL), V );
+    }
+}
+
+template<typename F>
+void Driver
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+        Int rank,
+        bool vectors,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( rank < 0 || ctrl.oversampling < 0 || ctrl.numPowerIts < 0 )
+        LogicError("Invalid randomized SVD parameters");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int maxWidth =
+      Min( ctrl.adaptive ? rank : rank+ctrl.oversampling, Min(m,n) );
+    Matrix<F> Q;
+    RangeFinder( A, Q, maxWidth, ctrl );
+    Factor( A, Q, U, s, V, rank, vectors, ctrl );
+}
+
+// Distributed
+// ===========
+
+template<typename F>
+void Orthonormalize( DistMatrix<F,VC,STAR>& Y, qr::TSQRTree tree )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> R( Y.Grid() );
+    qr::ExplicitTS( Y, R, tree );
+}
+
+template<typename F>
+void Project( const DistMatrix<F,VC,STAR>& Q, DistMatrix<F,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    if( Q.Width() == 0 )
+        return;
+    DistMatrix<F,STAR,STAR> C( Q.Grid() );
+    C.Resize( Q.Width(), Y.Width() );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), Q.LockedMatrix(), Y.LockedMatrix(), F(0), C.Matrix() );
+        El::AllReduce( C, Q.ColComm() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1), Q.LockedMatrix(), C.LockedMatrix(), F(1), Y.Matrix() );
+    }
+}
+
+template<typename F>
+void PowerIterations
+( const DistMatrix<F>& A,
+  const DistMatrix<F,VC,STAR>& Q,
+        DistMatrix<F,VC,STAR>& Y,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,VC,STAR> Z( A.Grid() );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Orthonormalize( Y, ctrl.tree );
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+        Orthonormalize( Z, ctrl.tree );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Y );
+        Project( Q, Y );
+    }
+}
+
+template<typename F>
+void RangeFinder
+( const DistMatrix<F>& A,
+        DistMatrix<F,VC,STAR>& Q,
+        Int maxWidth,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    // Each process draws its local portion of the sketch independently
+    DistMatrix<F> Omega( g );
+    if( !ctrl.adaptive )
+    {
+        Gaussian( Omega, n, maxWidth );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        PowerIterations( A, DistMatrix<F,VC,STAR>(g), Q, ctrl );
+        Orthonormalize( Q, ctrl.tree );
+        return;
+    }
+    if( ctrl.blockSize <= 0 )
+        LogicError("The block size must be positive");
+
+    const Real tol = Tolerance( ctrl );
+    Real errorTol = -1;
+    DistMatrix<F,VC,STAR> QFull( m, maxWidth, g ), Y( g );
+    DistMatrix<Real,STAR,STAR> norms( g );
+    Int width = 0;
+    while( width < maxWidth )
+    {
+        const Int bsize = Min( ctrl.blockSize, maxWidth-width );
+        auto QActive = QFull( ALL, IR(0,width) );
+        Gaussian( Omega, n, bsize );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+        if( errorTol < Real(0) )
+        {
+            ColumnTwoNorms( Y, norms );
+            errorTol = tol*MaxNorm( norms.LockedMatrix() );
+        }
+        Project( QActive, Y );
+        ColumnTwoNorms( Y, norms );
+        const Real errorEst =
+          ErrorEstimateScale<Real>()*MaxNorm( norms.LockedMatrix() );
+        if( ctrl.progress && g.Rank() == 0 )
+            Output("rank ",width," has error estimate ",errorEst);
+        if( errorEst <= errorTol )
+            break;
+
+        PowerIterations( A, QActive, Y, ctrl );
+        Orthonormalize( Y, ctrl.tree );
+        auto QNew = QFull( ALL, IR(width,width+bsize) );
+        Copy( Y, QNew );
+        width += bsize;
+    }
+    Copy( QFull( ALL, IR(0,width) ), Q );
+}
+
+template<typename F>
+void Factor
+( const DistMatrix<F>& A,
+  const DistMatrix<F,VC,STAR>& Q,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& sPre,
+        AbstractDistMatrix<F>& V,
+        Int rank,
+        bool vectors,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int l = Q.Width();
+    DistMatrix<F,VC,STAR> QB( g );
+    DistMatrix<F,STAR,STAR> RB( g );
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, QB );
+    qr::ExplicitTS( QB, RB, ctrl.tree );
+
+    // Redundantly compute the SVD R_B^H = U_R diag(s) V_R^H
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx( sPre );
+    auto& s = sProx.Get();
+    DistMatrix<F,STAR,STAR> UR( g ), VRAdj( g );
+    Matrix<F> C;
+    Adjoint( RB.LockedMatrix(), C );
+    s.Resize( l, 1 );
+    if( vectors )
+    {
+        UR.Resize( l, l );
+        VRAdj.Resize( l, l );
+        lapack::DivideAndConquerSVD
+        ( l, l, C.Buffer(), C.LDim(), s.Buffer(),
+          UR.Buffer(), UR.LDim(), VRAdj.Buffer(), VRAdj.LDim() );
+    }
+    else
+    {
+        lapack::SVD( l, l, C.Buffer(), C.LDim(), s.Buffer() );
+    }
+
+    Int k = Min( rank, l );
+    if( ctrl.adaptive )
+    {
+        const Real tol = Tolerance( ctrl );
+        Int numKept = 0;
+        while( numKept < k && s.GetLocal(numKept,0) > tol*s.GetLocal(0,0) )
+            ++numKept;
+        k = numKept;
+    }
+    s.Resize( k, 1 );
+    if( vectors )
+    {
+        DistMatrix<F,VC,STAR> UHat( g ), VHat( g );
+        LocalGemm( NORMAL, NORMAL, F(1), Q, UR(ALL,IR(0,k)), UHat );
+        LocalGemm( NORMAL, ADJOINT, F(1), QB, VRAdj(IR(0,k),ALL), VHat );
+        Copy( UHat, U );
+        Copy( VHat, V );
+    }
+}
+
+template<typename F>
+void Driver
+( const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+        Int rank,
+        bool vectors,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( rank < 0 || ctrl.oversampling < 0 || ctrl.numPowerIts < 0 )
+        LogicError("Invalid randomized SVD parameters");
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int maxWidth =
+      Min( ctrl.adaptive ? rank : rank+ctrl.oversampling, Min(m,n) );
+    DistMatrix<F,VC,STAR> Q( A.Grid() );
+    RangeFinder( A, Q, maxWidth, ctrl );
+    Factor( A, Q, U, s, V, rank, vectors, ctrl );
+}
+
+} // namespace randomized_svd
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+        Int rank,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    randomized_svd::Driver( A, U, s, V, rank, true, ctrl );
+}
+
+template<typename F>
+void RandomizedSVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+        Int rank,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    randomized_svd::Driver( A, U, s, V, rank, true, ctrl );
+}
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<Base<F>>& s,
+        Int rank,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> U, V;
+    randomized_svd::Driver( A, U, s, V, rank, false, ctrl );
+}
+
+template<typename F>
+void RandomizedSVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<Base<F>>& s,
+        Int rank,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> U( A.Grid() ), V( A.Grid() );
+    randomized_svd::Driver( A, U, s, V, rank, false, ctrl );
+}
+
+#define PROTO(F) \
+  template void RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+          Int rank, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<Base<F>>& s, \
+          AbstractDistMatrix<F>& V, \
+          Int rank, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<Base<F>>& s, \
+          Int rank, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<Base<F>>& s, \
+          Int rank, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -1075,8 +1075,11 @@ inline bool SplitGrid
                  << ", so split " << p << " processes into "
                  << rLeft << " x " << pLeft/rLeft << " and "
                  << rRight << " x " << pRight/rRight << " grids" << endl;
-        leftGrid = new Grid( grid.VCComm(), leftGroup, rLeft );
-        rightGrid = new Grid( grid.VCComm(), rightGroup, rRight );
+        mpi::Comm leftViewers, rightViewers;
+        mpi::Dup( grid.VCComm(), leftViewers );
+        mpi::Dup( grid.VCComm(), rightViewers );
+        leftGrid = new Grid( std::move(leftViewers), leftGroup, rLeft );
+        rightGrid = new Grid( std::move(rightViewers), rightGroup, rRight );
         mpi::Free( leftGroup );
         mpi::Free( rightGroup );
         return true;
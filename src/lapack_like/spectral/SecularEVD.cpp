@@ -1226,14 +1226,14 @@ SecularEigenvalue
         secular_evd::State<Real> state;
         info = secular_evd::SecularInner( k, d, rho, z, state, ctrl );
         eigenvalue = state.rootEst;
-        dMinusShift = state.dMinusShift;
+        Copy( state.dMinusShift, dMinusShift );
     }
     else
     {
         secular_evd::LastState<Real> state;
         info = secular_evd::SecularLast( k, d, rho, z, state, ctrl );
         eigenvalue = state.rootEst;
-        dMinusShift = state.dMinusShift;
+        Copy( state.dMinusShift, dMinusShift );
     }
 
     return info;
@@ -1267,20 +1267,16 @@ SecularEVD
     const Real globalDeflateTol = globalDeflateFudge * limits::Epsilon<Real>();
     if( relativeUpdateTwoNorm <= globalDeflateTol )
     {
-        w = d;
+        Copy( d, w );
         Identity( Q, n, n );
         return info;
     }
 
-    // TODO(poulson): Batch secular equation solvers?
-    //
     // Compute all of the eigenvalues and the vector r ~= sqrt(rho) z which
     // would produce the given eigenvalues to high relative accuracy.
     //
-    // We accumulate the products involved in computing r in an online manner
-    // and take the square-root of the absolute value (and the correct sign)
-    // at the end. The key is to recognize that the only term left out of entry
-    // i of the corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
+    // The key is to recognize that the only term left out of entry i of the
+    // corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
     //
     //    prod_{k=0}^{n-1} (lambda_k - d(i)) / (d(k) - d(i))
     //
@@ -1297,35 +1293,54 @@ SecularEVD
     //      prod_{k=0  }^{i-1} (lambda_k - d(i)) / (d(k) - d(i)) *
     //      prod_{k=i+1}^{n-1} (lambda_k - d(i)) / (d(k) - d(i)).
     //
-    // Given that we have available only one lambda_j at a time, we greedily
-    // update all r(i) products given each lambda_j
-    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
+    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach). Since each root
+    // of the secular equation can be found independently, we first solve for
+    // all of them in parallel, temporarily storing d - lambda_j in the j'th
+    // column of Q, and then form each r(i) from the i'th row of Q.
     //
+    // An exception cannot leave an OpenMP loop, so any failure is rethrown
+    // after the roots have been found.
     Q.Resize( n, n );
-    Matrix<Real> r;
-    Ones( r, n, 1 );
+    vector<SecularEVDInfo> valueInfos( n );
+    vector<std::exception_ptr> failures( n );
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
-        // While we will temporarily store dMinusShift in the j'th column of Q.
         auto q = Q(ALL,IR(j));
-        auto valueInfo = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
-
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
+        try
+        {
+            valueInfos[j] = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
+        }
+        catch( ... )
+        {
+            failures[j] = std::current_exception();
+        }
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        if( failures[j] )
+            std::rethrow_exception( failures[j] );
+        info.numIterations += valueInfos[j].numIterations;
+        info.numAlternations += valueInfos[j].numAlternations;
+        info.numCubicIterations += valueInfos[j].numCubicIterations;
+        info.numCubicFailures += valueInfos[j].numCubicFailures;
+    }
 
-        r(j) *= q(j);
+    Matrix<Real> r( n, 1 );
+    EL_PARALLEL_FOR
+    for( Int i=0; i<n; ++i )
+    {
+        Real rProd = Q(i,i);
         for( Int k=0; k<n; ++k )
         {
-            if( k == j )
+            if( k == i )
                 continue;
-            r(k) *= q(k) / (d(j)-d(k));
+            rProd *= Q(i,k) / (d(k)-d(i));
         }
+        r(i) = Sgn(z(i),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_PARALLEL_FOR
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th eigenvectors via Eqs. (3.4) and (3.3), respectively.
@@ -1334,7 +1349,7 @@ SecularEVD
         {
             q(i) = r(i) / q(i);
         }
-        q *= Real(1) / FrobeniusNorm( q );
+        Scale( Real(1) / FrobeniusNorm( q ), q );
     }
 
     return info;
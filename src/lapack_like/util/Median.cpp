@@ -42,7 +42,7 @@ ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
     EL_DEBUG_CSE
     if( x.ColDist() == STAR && x.RowDist() == STAR )
     {
-        return Median( x.LockedMatrix() );
+        return Median( static_cast<const Matrix<Real>&>( x.LockedMatrix() ) );
     }
     else
     {
@@ -55,7 +55,7 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
         (X.ColDist()==CIRC && X.RowDist()==CIRC) )
     {
         if( X.Participating() )
-            Sort( X.Matrix(), sort, stable );
+            Sort( static_cast<Matrix<Real>&>( X.Matrix() ), sort, stable );
     }
     else
     {
@@ -123,7 +123,8 @@ TaggedSort( const AbstractDistMatrix<Real>& x, SortType sort, bool stable )
     EL_DEBUG_CSE
     if( x.ColDist()==STAR && x.RowDist()==STAR )
     {
-        return TaggedSort( x.LockedMatrix(), sort, stable );
+        return TaggedSort
+        ( static_cast<const Matrix<Real>&>( x.LockedMatrix() ), sort, stable );
     }
     else
     {
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_RANDOM_COUNTERBASED_HPP
+#define EL_MATRICES_RANDOM_COUNTERBASED_HPP
+
+#include <cstdint>
+
+namespace El {
+namespace philox {
+
+// A counter-based generator in the style of Philox4x32-10 from
+//
+//   J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw,
+//   "Parallel random numbers: As easy as 1, 2, 3", SC11.
+//
+// Each entry (i,j) of a matrix is generated from the 128-bit counter
+// (i,j) under a 64-bit key derived from the (seed,stream) pair, so that the
+// value of an entry depends only upon its global index. Every process (and
+// every thread) can therefore fill its own entries independently, and the
+// result is bitwise identical for any grid, distribution, or thread count.
+
+// Types for which the counter-based fills are used; all other types fall back
+// to the serial generator.
+template<typename T> struct IsCounterType : std::false_type {};
+template<> struct IsCounterType<float> : std::true_type {};
+template<> struct IsCounterType<double> : std::true_type {};
+template<> struct IsCounterType<Complex<float>> : std::true_type {};
+template<> struct IsCounterType<Complex<double>> : std::true_type {};
+
+struct Key { std::uint32_t k0, k1; };
+
+inline std::uint64_t SplitMix64( std::uint64_t z )
+{
+    z += 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+inline Key MakeKey( std::uint64_t seed, std::uint64_t stream )
+{
+    const std::uint64_t k = SplitMix64( seed ^ SplitMix64(stream) );
+    return Key{ std::uint32_t(k), std::uint32_t(k >> 32) };
+}
+
+// Ten rounds of the Philox4x32 bijection applied to the counter (i,j)
+inline void Generate
+( std::uint64_t i, std::uint64_t j, Key key, std::uint32_t out[4] )
+{
+    std::uint32_t c0 = std::uint32_t(i), c1 = std::uint32_t(i >> 32),
+                  c2 = std::uint32_t(j), c3 = std::uint32_t(j >> 32);
+    std::uint32_t k0 = key.k0, k1 = key.k1;
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t p0 = std::uint64_t(0xD2511F53u)*c0;
+        const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u)*c2;
+        const std::uint32_t n0 = std::uint32_t(p1 >> 32) ^ c1 ^ k0;
+        const std::uint32_t n1 = std::uint32_t(p1);
+        const std::uint32_t n2 = std::uint32_t(p0 >> 32) ^ c3 ^ k1;
+        const std::uint32_t n3 = std::uint32_t(p0);
+        c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+        k0 += 0x9E3779B9u;
+        k1 += 0xBB67AE85u;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+// Map random bits to the half-open interval (0,1]
+inline double ToUnit( std::uint32_t hi, std::uint32_t lo, double* )
+{
+    const std::uint64_t bits = ((std::uint64_t(hi) << 32) | lo) >> 11;
+    return double(bits+1)*(1./9007199254740992.);
+}
+inline float ToUnit( std::uint32_t hi, std::uint32_t, float* )
+{ return float((hi >> 8)+1)*(1.f/16777216.f); }
+
+// Apply the fill to a strip of entries of a single column, first generating
+// all of the uniform deviates and then transforming them, so that the
+// transcendental functions run over contiguous, vectorizable loops.
+const Int STRIP_SIZE = 64;
+
+template<typename Real>
+void UniformPairs
+( const Int* rows, Int numRows, std::uint64_t j, Key key,
+  Real* u0, Real* u1 )
+{
+    EL_SIMD
+    for( Int k=0; k<numRows; ++k )
+    {
+        std::uint32_t bits[4];
+        Generate( std::uint64_t(rows[k]), j, key, bits );
+        u0[k] = ToUnit( bits[0], bits[1], static_cast<Real*>(nullptr) );
+        u1[k] = ToUnit( bits[2], bits[3], static_cast<Real*>(nullptr) );
+    }
+}
+
+template<typename Real>
+void StoreNormal
+( Real* A, Int numRows, const Real* u0, const Real* u1,
+  Real mean, Real stddev )
+{
+    const Real twoPi = 2*Pi<Real>();
+    EL_SIMD
+    for( Int k=0; k<numRows; ++k )
+    {
+        const Real r = std::sqrt(Real(-2)*std::log(u0[k]));
+        A[k] = mean + stddev*(r*std::cos(twoPi*u1[k]));
+    }
+}
+
+template<typename Real>
+void StoreNormal
+( Complex<Real>* A, Int numRows, const Real* u0, const Real* u1,
+  Complex<Real> mean, Real stddev )
+{
+    // Match SampleNormal by splitting the variance between the two components
+    const Real stddevAdj = stddev/std::sqrt(Real(2));
+    const Real twoPi = 2*Pi<Real>();
+    EL_SIMD
+    for( Int k=0; k<numRows; ++k )
+    {
+        const Real r = std::sqrt(Real(-2)*std::log(u0[k]));
+        const Real theta = twoPi*u1[k];
+        A[k] = Complex<Real>
+          ( mean.real()+stddevAdj*(r*std::cos(theta)),
+            mean.imag()+stddevAdj*(r*std::sin(theta)) );
+    }
+}
+
+template<typename Real>
+void StoreBall
+( Real* A, Int numRows, const Real* u0, const Real*,
+  Real center, Real radius )
+{
+    EL_SIMD
+    for( Int k=0; k<numRows; ++k )
+        A[k] = center + radius*(2*u0[k]-1);
+}
+
+template<typename Real>
+void StoreBall
+( Complex<Real>* A, Int numRows, const Real* u0, const Real* u1,
+  Complex<Real> center, Real radius )
+{
+    // Match SampleBall, which samples the radius and angle uniformly
+    const Real twoPi = 2*Pi<Real>();
+    EL_SIMD
+    for( Int k=0; k<numRows; ++k )
+    {
+        const Real r = radius*(1-u0[k]);
+        const Real theta = twoPi*u1[k];
+        A[k] = Complex<Real>
+          ( center.real()+r*std::cos(theta), center.imag()+r*std::sin(theta) );
+    }
+}
+
+// Fill the local entries of A, whose global row and column indices are given
+// by 'rows' and 'cols', with the transformation 'store' of the deviates
+// assigned to each global index.
+template<typename T,class StoreFunctor>
+void Fill
+( T* ABuf, Int ALDim, const vector<Int>& rows, const vector<Int>& cols,
+  Key key, StoreFunctor store )
+{
+    typedef Base<T> Real;
+    const Int mLoc = rows.size();
+    const Int nLoc = cols.size();
+    const Int numStrips = (mLoc+STRIP_SIZE-1)/STRIP_SIZE;
+    const Int numTasks = numStrips*nLoc;
+    EL_PARALLEL_FOR
+    for( Int task=0; task<numTasks; ++task )
+    {
+        const Int jLoc = task / numStrips;
+        const Int iStart = (task % numStrips)*STRIP_SIZE;
+        const Int numRows = Min(STRIP_SIZE,mLoc-iStart);
+        Real u0[STRIP_SIZE], u1[STRIP_SIZE];
+        UniformPairs
+        ( &rows[iStart], numRows, std::uint64_t(cols[jLoc]), key, u0, u1 );
+        store( &ABuf[iStart+jLoc*ALDim], numRows, u0, u1 );
+    }
+}
+
+template<typename T,class StoreFunctor>
+void Fill( Matrix<T>& A, StoreFunctor store )
+{
+    const Key key = MakeKey( RandomSeed(), NextRandomStream() );
+    vector<Int> rows(A.Height()), cols(A.Width());
+    for( Int i=0; i<A.Height(); ++i )
+        rows[i] = i;
+    for( Int j=0; j<A.Width(); ++j )
+        cols[j] = j;
+    Fill( A.Buffer(), A.LDim(), rows, cols, key, store );
+}
+
+// NOTE: The stream is advanced on every process, whether or not it owns any
+// entries of A, so that later calls remain consistent across the grid. The
+// (seed,stream) pair is taken from the root of the redundant communicator so
+// that the copies of a redundantly-distributed matrix (e.g., [STAR,STAR] or
+// [CIRC,CIRC]) agree even if the processes were seeded differently.
+template<typename T,class StoreFunctor>
+void Fill( AbstractDistMatrix<T>& A, StoreFunctor store )
+{
+    unsigned long long seedAndStream[2] = { RandomSeed(), NextRandomStream() };
+    if( A.RedundantSize() > 1 )
+        mpi::Broadcast
+        ( seedAndStream, 2, 0, A.RedundantComm(), SyncInfo<Device::CPU>{} );
+    const Key key = MakeKey( seedAndStream[0], seedAndStream[1] );
+    const Int mLoc = A.LocalHeight();
+    const Int nLoc = A.LocalWidth();
+    vector<Int> rows(mLoc), cols(nLoc);
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        rows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        cols[jLoc] = A.GlobalCol(jLoc);
+    Fill( A.Buffer(), A.LDim(), rows, cols, key, store );
+}
+
+template<typename T>
+struct NormalFunctor
+{
+    T mean;
+    Base<T> stddev;
+    void operator()
+    ( T* A, Int numRows, const Base<T>* u0, const Base<T>* u1 ) const
+    { StoreNormal( A, numRows, u0, u1, mean, stddev ); }
+};
+
+template<typename T>
+struct BallFunctor
+{
+    T center;
+    Base<T> radius;
+    void operator()
+    ( T* A, Int numRows, const Base<T>* u0, const Base<T>* u1 ) const
+    { StoreBall( A, numRows, u0, u1, center, radius ); }
+};
+
+} // namespace philox
+} // namespace El
+
+#endif // ifndef EL_MATRICES_RANDOM_COUNTERBASED_HPP
@@ -10,16 +10,48 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
+namespace {
+
+template<typename F,typename=EnableIf<philox::IsCounterType<F>>>
+void MakeGaussianImpl
+( Matrix<F,Device::CPU>& A, F mean, Base<F> stddev )
+{ philox::Fill( A, philox::NormalFunctor<F>{mean,stddev} ); }
+
+template<typename F,Device D>
+void MakeGaussianImpl( Matrix<F,D>& A, F mean, Base<F> stddev )
+{
+    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
+    EntrywiseFill( A, function<F()>(sampleNormal) );
+}
+
+template<typename F,typename=EnableIf<philox::IsCounterType<F>>>
+bool TryCounterBasedGaussian
+( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    if( A.GetLocalDevice() != Device::CPU )
+        return false;
+    philox::Fill( A, philox::NormalFunctor<F>{mean,stddev} );
+    return true;
+}
+
+template<typename F,typename=DisableIf<philox::IsCounterType<F>>,
+         typename=void>
+bool TryCounterBasedGaussian
+( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{ return false; }
+
+}// namespace <anon>
 
 // Draw each entry from a normal PDF
 template<typename F,Device D,typename>
 void MakeGaussian( Matrix<F,D>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
-    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
-    EntrywiseFill( A, function<F()>(sampleNormal) );
+    MakeGaussianImpl( A, mean, stddev );
 }
 
 template<typename F, Device D, typename, typename>
@@ -51,6 +83,9 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    // Each process generates its own entries from their global indices
+    if( TryCounterBasedGaussian( A, mean, stddev ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -10,8 +10,42 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
+namespace {
+
+template<typename T,typename=EnableIf<philox::IsCounterType<T>>>
+void MakeUniformImpl
+( Matrix<T,Device::CPU>& A, T center, Base<T> radius )
+{ philox::Fill( A, philox::BallFunctor<T>{center,radius} ); }
+
+template<typename T,Device D>
+void MakeUniformImpl( Matrix<T,D>& A, T center, Base<T> radius )
+{
+    auto sampleBall = [=]() { return SampleBall(center,radius); };
+    EntrywiseFill( A, function<T()>(sampleBall) );
+}
+
+template<typename T,typename=EnableIf<philox::IsCounterType<T>>>
+bool TryCounterBasedUniform
+( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    if( A.GetLocalDevice() != Device::CPU )
+        return false;
+    philox::Fill( A, philox::BallFunctor<T>{center,radius} );
+    return true;
+}
+
+template<typename T,typename=DisableIf<philox::IsCounterType<T>>,
+         typename=void>
+bool TryCounterBasedUniform
+( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{ return false; }
+
+}// namespace <anon>
+
 // Draw each entry from a uniform PDF over a closed ball.
 
 template<typename T>
@@ -37,8 +71,7 @@ template<typename T, Device D>
 void MakeUniform( Matrix<T,D>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
-    auto sampleBall = [=]() { return SampleBall(center,radius); };
-    EntrywiseFill( A, function<T()>(sampleBall) );
+    MakeUniformImpl( A, center, radius );
 }
 
 template<typename T>
@@ -53,6 +86,9 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    // Each process generates its own entries from their global indices
+    if( TryCounterBasedUniform( A, center, radius ) )
+        return;
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -60,7 +60,8 @@ void HermitianUniformSpectrum
     if( grid.Rank() == 0 )
         for( Int j=0; j<n; ++j )
             d[j] = SampleUniform<Real>( lower, upper );
-    mpi::Broadcast( d.data(), n, 0, grid.Comm() );
+    SyncInfo<Device::CPU> syncInfo;
+    mpi::Broadcast( d.data(), n, 0, grid.Comm(), syncInfo );
     Diagonal( A, d );
 
     // Apply a Haar matrix from both sides
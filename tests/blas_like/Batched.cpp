@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The b'th matrix of a batch stored one matrix per column
+template<typename T>
+Matrix<T> Unpack( const Matrix<T>& A, Int height, Int width, Int b )
+{
+    Matrix<T> AB;
+    LockedView( AB, A, IR(0,height*width), IR(b,b+1) );
+    Matrix<T> ABlock( height, width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            ABlock(i,j) = AB(i+j*height,0);
+    return ABlock;
+}
+
+template<typename T>
+void CheckBlock
+( const Matrix<T>& Batch, Int height, Int width, Int b,
+  const Matrix<T>& Expected, Base<T> tol, string name )
+{
+    auto Computed = Unpack( Batch, height, width, b );
+    Axpy( T(-1), Expected, Computed );
+    const Base<T> error = FrobeniusNorm( Computed );
+    const Base<T> scale = Max( FrobeniusNorm( Expected ), Base<T>(1) );
+    if( error > tol*scale )
+        LogicError
+        (name," of matrix ",b," had relative error ",error/scale);
+}
+
+template<typename F>
+void TestBatched( Int batchCount, bool print )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*limits::Epsilon<Real>();
+    Output("Testing with ",TypeName<F>());
+
+    for( const Int n : { 2, 4, 8, 13 } )
+    {
+        const Int k = ( n == 13 ? 5 : n );
+
+        // C := alpha op(A) op(B) + beta C
+        for( auto orientA : { NORMAL, TRANSPOSE, ADJOINT } )
+        for( auto orientB : { NORMAL, ADJOINT } )
+        {
+            const F alpha = F(2), beta = F(-1);
+            Matrix<F> A, B, C;
+            Uniform( A, n*k, batchCount );
+            Uniform( B, k*n, batchCount );
+            Uniform( C, n*n, batchCount );
+            auto CBatch( C );
+            GemmBatched
+            ( orientA, orientB, n, n, k, alpha, A, B, beta, CBatch );
+            for( Int b=0; b<batchCount; ++b )
+            {
+                auto AB = Unpack( A, orientA==NORMAL ? n : k,
+                                     orientA==NORMAL ? k : n, b );
+                auto BB = Unpack( B, orientB==NORMAL ? k : n,
+                                     orientB==NORMAL ? n : k, b );
+                auto CB = Unpack( C, n, n, b );
+                Gemm( orientA, orientB, alpha, AB, BB, beta, CB );
+                CheckBlock( CBatch, n, n, b, CB, tol, "Gemm" );
+            }
+        }
+
+        // Factor a batch of HPD matrices and solve against them
+        Matrix<F> X, A, B;
+        Uniform( X, n*n, batchCount );
+        Zeros( A, n*n, batchCount );
+        HerkBatched( LOWER, NORMAL, n, n, Real(1), X, Real(0), A );
+        for( Int b=0; b<batchCount; ++b )
+        {
+            auto XB = Unpack( X, n, n, b );
+            Matrix<F> AB;
+            Herk( LOWER, NORMAL, Real(1), XB, AB );
+            CheckBlock( A, n, n, b, AB, tol, "Herk" );
+            for( Int j=0; j<n; ++j )
+                A(j+j*n,b) += F(n);
+        }
+        auto L( A );
+        CholeskyBatched( LOWER, n, L );
+        Uniform( B, n*k, batchCount );
+        auto XBatch( B );
+        TrsmBatched
+        ( LEFT, LOWER, NORMAL, NON_UNIT, n, k, F(1), L, XBatch );
+        for( Int b=0; b<batchCount; ++b )
+        {
+            auto AB = Unpack( A, n, n, b );
+            Cholesky( LOWER, AB );
+            CheckBlock( L, n, n, b, AB, tol, "Cholesky" );
+
+            auto BB = Unpack( B, n, k, b );
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), AB, BB );
+            CheckBlock( XBatch, n, k, b, BB, tol, "Trsm" );
+        }
+        if( print )
+            Print( L, "L" );
+    }
+
+    // A matrix which is not HPD should be reported after the whole batch
+    Matrix<F> A;
+    Zeros( A, 4, 3 );
+    for( Int b=0; b<3; ++b )
+    {
+        A(0,b) = F(4);
+        A(3,b) = F(4);
+    }
+    A(3,1) = F(-4);
+    bool threw = false;
+    try { CholeskyBatched( UPPER, 2, A ); }
+    catch( NonHPDMatrixException& ) { threw = true; }
+    if( !threw || A(3,2) != F(2) )
+        LogicError("CholeskyBatched did not report the non-HPD matrix");
+}
+
+template<typename F>
+void TestDistBatched( const Grid& g, Int batchCount )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*limits::Epsilon<Real>();
+    OutputFromRoot(g.Comm(),"Testing distributed with ",TypeName<F>());
+
+    // The random batches are drawn in [MC,MR] so that every process agrees
+    // upon them regardless of the sequential tests run on the root
+    const Int n = 8;
+    DistMatrix<F> ADist(g), BDist(g), CDist(g);
+    Uniform( ADist, n*n, batchCount );
+    Uniform( BDist, n*n, batchCount );
+    Uniform( CDist, n*n, batchCount );
+    DistMatrix<F,STAR,STAR> A( ADist ), B( BDist ), C( CDist );
+    GemmBatched( NORMAL, NORMAL, n, n, n, F(1), ADist, B, F(1), CDist );
+    GemmBatched( NORMAL, NORMAL, n, n, n,
+                 F(1), A.Matrix(), B.Matrix(), F(1), C.Matrix() );
+    DistMatrix<F,STAR,STAR> CComputed( CDist );
+    Axpy( F(-1), C.Matrix(), CComputed.Matrix() );
+    const Real error = FrobeniusNorm( CComputed.Matrix() );
+    if( error > tol*FrobeniusNorm( C.Matrix() ) )
+        LogicError("Distributed GemmBatched had error ",error);
+
+    // Every process should learn of a failure upon any other process
+    DistMatrix<F,STAR,VR> I(g);
+    Zeros( I, n*n, batchCount );
+    for( Int jLoc=0; jLoc<I.LocalWidth(); ++jLoc )
+        for( Int i=0; i<n; ++i )
+            I.SetLocal( i+i*n, jLoc, F(1) );
+    I.Set( 0, batchCount-1, F(-1) );
+    bool threw = false;
+    try { CholeskyBatched( LOWER, n, I ); }
+    catch( NonHPDMatrixException& ) { threw = true; }
+    if( !threw )
+        LogicError("Distributed CholeskyBatched did not report a failure");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int batchCount = Input("--batchCount","batch size",50);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestBatched<float>( batchCount, print );
+            TestBatched<Complex<float>>( batchCount, print );
+            TestBatched<double>( batchCount, print );
+            TestBatched<Complex<double>>( batchCount, print );
+        }
+
+        const Grid g( std::move(comm) );
+        TestDistBatched<double>( g, batchCount );
+        TestDistBatched<Complex<double>>( g, batchCount );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Compare the tiled, in-place Trrk kernels with a full Gemm whose result is
+  restricted to the triangle: entries within the triangle must match to
+  within rounding, and entries outside of it must be left untouched. Each
+  orientation is checked with several tile sizes (including ones which do not
+  divide the matrix) both sequentially and through the distributed LocalTrrk.
+*/
+#include <El.hpp>
+using namespace El;
+
+// E := (C - C0) - trapezoid(beta C0 + alpha op(A) op(B) - C0), which must
+// vanish everywhere
+template<typename T, class MatrixType>
+Base<T> RelativeError
+( UpperOrLower uplo, Orientation orientA, Orientation orientB,
+  T alpha, const MatrixType& A, const MatrixType& B,
+  T beta, const MatrixType& C0, const MatrixType& C )
+{
+    MatrixType R( C0 );
+    Gemm( orientA, orientB, alpha, A, B, beta, R );
+    Axpy( T(-1), C0, R );
+    MakeTrapezoidal( uplo, R );
+    MatrixType E( C );
+    Axpy( T(-1), C0, E );
+    Axpy( T(-1), R, E );
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    return FrobeniusNorm( E ) /
+      ( Max(k,Int(1))*limits::Epsilon<Base<T>>()*
+        Max(FrobeniusNorm(C0)+FrobeniusNorm(R),Base<T>(1)) );
+}
+
+template<typename T>
+void TestSequential( Int n, Int k, const vector<Int>& tileSizes )
+{
+    Output("Testing sequential Trrk with ",TypeName<T>());
+    PushIndent();
+    const T alpha = T(3), beta = T(-2);
+    const Int oldTileSize = LocalTrrkBlocksize<T>();
+    for( auto orientA : { NORMAL, TRANSPOSE, ADJOINT } )
+    {
+        for( auto orientB : { NORMAL, TRANSPOSE, ADJOINT } )
+        {
+            Matrix<T> A, B, C0;
+            if( orientA == NORMAL )
+                Uniform( A, n, k );
+            else
+                Uniform( A, k, n );
+            if( orientB == NORMAL )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            Uniform( C0, n, n );
+            for( auto uplo : { LOWER, UPPER } )
+            {
+                for( auto tileSize : tileSizes )
+                {
+                    SetLocalTrrkBlocksize<T>( tileSize );
+                    Matrix<T> C( C0 );
+                    Trrk( uplo, orientA, orientB, alpha, A, B, beta, C );
+                    const Base<T> relErr =
+                      RelativeError
+                      ( uplo, orientA, orientB, alpha, A, B, beta, C0, C );
+                    if( relErr > Base<T>(10) )
+                        LogicError
+                        ("Trrk(",UpperOrLowerToChar(uplo),",",
+                         OrientationToChar(orientA),",",
+                         OrientationToChar(orientB),") with tiles of ",
+                         tileSize," had a relative error of ",relErr);
+                }
+            }
+        }
+    }
+
+#ifdef EL_HYBRID
+    // Calls from within a parallel region must not spawn nested teams
+    SetLocalTrrkBlocksize<T>( tileSizes.front() );
+    Matrix<T> A, B, C0;
+    Uniform( A, n, k );
+    Uniform( B, k, n );
+    Uniform( C0, n, n );
+    bool failed = false;
+    #pragma omp parallel reduction(||:failed)
+    {
+        Matrix<T> C( C0 );
+        Trrk( LOWER, NORMAL, NORMAL, alpha, A, B, beta, C );
+        failed = RelativeError
+          ( LOWER, NORMAL, NORMAL, alpha, A, B, beta, C0, C ) > Base<T>(10);
+    }
+    if( failed )
+        LogicError("Trrk within a parallel region was incorrect");
+#endif
+    SetLocalTrrkBlocksize<T>( oldTileSize );
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributed
+( Int n, Int k, const vector<Int>& tileSizes, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing distributed Trrk with ",TypeName<T>());
+    PushIndent();
+    const T alpha = T(3), beta = T(-2);
+    const Int oldTileSize = LocalTrrkBlocksize<T>();
+    for( auto orientA : { NORMAL, TRANSPOSE, ADJOINT } )
+    {
+        for( auto orientB : { NORMAL, TRANSPOSE, ADJOINT } )
+        {
+            DistMatrix<T> A(g), B(g), C0(g);
+            if( orientA == NORMAL )
+                Uniform( A, n, k );
+            else
+                Uniform( A, k, n );
+            if( orientB == NORMAL )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            Uniform( C0, n, n );
+            for( auto uplo : { LOWER, UPPER } )
+            {
+                for( auto tileSize : tileSizes )
+                {
+                    SetLocalTrrkBlocksize<T>( tileSize );
+                    DistMatrix<T> C( C0 );
+                    Trrk( uplo, orientA, orientB, alpha, A, B, beta, C );
+                    const Base<T> relErr =
+                      RelativeError
+                      ( uplo, orientA, orientB, alpha, A, B, beta, C0, C );
+                    if( relErr > Base<T>(10) )
+                        LogicError
+                        ("Distributed Trrk(",UpperOrLowerToChar(uplo),",",
+                         OrientationToChar(orientA),",",
+                         OrientationToChar(orientB),") with tiles of ",
+                         tileSize," had a relative error of ",relErr);
+                }
+            }
+        }
+    }
+    SetLocalTrrkBlocksize<T>( oldTileSize );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","size of C",70);
+        const Int k = Input("--k","inner dimension",30);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        // A single tile, tiles which do not divide n, and 1x1 tiles
+        const vector<Int> tileSizes = { n, 7, 1 };
+        const Grid g( mpi::NewWorldComm() );
+        if( g.Rank() == 0 )
+        {
+            TestSequential<float>( n, k, tileSizes );
+            TestSequential<Complex<float>>( n, k, tileSizes );
+            TestSequential<double>( n, k, tileSizes );
+            TestSequential<Complex<double>>( n, k, tileSizes );
+        }
+        TestDistributed<float>( n, k, tileSizes, g );
+        TestDistributed<Complex<float>>( n, k, tileSizes, g );
+        TestDistributed<double>( n, k, tileSizes, g );
+        TestDistributed<Complex<double>>( n, k, tileSizes, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
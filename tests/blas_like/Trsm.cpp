@@ -18,6 +18,7 @@ void TestTrsm
   Int m,
   Int n,
   F alpha,
+  TrsmAlgorithm alg,
   const Grid& g,
   bool print )
 {
@@ -53,7 +54,7 @@ void TestTrsm
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    Trsm( side, uplo, orientation, diag, alpha, A, Y );
+    Trsm( side, uplo, orientation, diag, alpha, A, Y, false, alg );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops =
@@ -78,6 +79,91 @@ void TestTrsm
     PopIndent();
 }
 
+// Solve with the original blocked variant, TRSM_LARGE. Since it only exists
+// for solves from the left, solves from the right are recast as left solves
+// against the transpose (or adjoint) of B, e.g., X A = B as A^H X^H = B^H.
+template<typename F>
+void BlockedSolve
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  UnitOrNonUnit diag, F alpha, const DistMatrix<F>& S, DistMatrix<F>& X )
+{
+    if( side == LEFT )
+    {
+        Trsm
+        ( LEFT, uplo, orientation, diag, alpha, S, X, false, TRSM_LARGE );
+        return;
+    }
+    const bool conjugate = ( orientation != TRANSPOSE );
+    DistMatrix<F> XAdj( X.Grid() );
+    Transpose( X, XAdj, conjugate );
+    Trsm
+    ( LEFT, uplo, ( orientation == NORMAL ? ADJOINT : NORMAL ), diag,
+      ( conjugate ? Conj(alpha) : alpha ), S, XAdj, false, TRSM_LARGE );
+    Transpose( XAdj, X, conjugate );
+}
+
+// Check each of the newer variants (and the default selection) against the
+// original blocked variant, TRSM_LARGE, for every combination of side,
+// triangle, orientation, and diagonal
+template<typename F>
+void TestVariants( Int m, Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Comparing Trsm variants with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    const F alpha = F(3);
+    const pair<TrsmAlgorithm,string> algs[] =
+      { { TRSM_RECURSIVE, "recursive" }, { TRSM_LOOKAHEAD, "lookahead" },
+        { TRSM_DEFAULT, "default" } };
+    for( auto side : { LEFT, RIGHT } )
+    {
+        const Int k = ( side == LEFT ? m : n );
+        for( auto uplo : { LOWER, UPPER } )
+        {
+            // A diagonally-dominant triangle (with small off-diagonal entries
+            // so that the unit-diagonal solves are also well-conditioned)
+            DistMatrix<F> S(g);
+            Uniform( S, k, k );
+            S *= F(1)/F(k);
+            MakeTrapezoidal( uplo, S );
+            ShiftDiagonal( S, F(2) );
+            for( auto orientation : { NORMAL, TRANSPOSE, ADJOINT } )
+            {
+                for( auto diag : { NON_UNIT, UNIT } )
+                {
+                    DistMatrix<F> B(g);
+                    Uniform( B, m, n );
+                    DistMatrix<F> XRef( B );
+                    BlockedSolve
+                    ( side, uplo, orientation, diag, alpha, S, XRef );
+                    const Real refFrob = FrobeniusNorm( XRef );
+                    for( const auto& alg : algs )
+                    {
+                        if( alg.first == TRSM_LOOKAHEAD && side == RIGHT )
+                            continue;
+                        DistMatrix<F> X( B );
+                        Trsm
+                        ( side, uplo, orientation, diag, alpha, S, X, false,
+                          alg.first );
+                        X -= XRef;
+                        const Real relErr = FrobeniusNorm( X ) / refFrob;
+                        if( relErr > Real(10)*k*eps )
+                            LogicError
+                            ("The ",alg.second," variant of Trsm",
+                             LeftOrRightToChar(side),
+                             UpperOrLowerToChar(uplo),
+                             OrientationToChar(orientation),
+                             UnitOrNonUnitToChar(diag),
+                             " differed from the blocked variant by ",relErr);
+                    }
+                }
+            }
+        }
+    }
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -96,7 +182,10 @@ main( int argc, char* argv[] )
         const char diagChar = Input("--diag","(non-)unit diagonal: N/U",'N');
         const Int m = Input("--m","height of result",100);
         const Int n = Input("--n","width of result",100);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",8);
+        const Int algInt =
+          Input("--alg","0: default, 1: large, 2: medium, 3: small, "
+                "4: recursive, 5: lookahead",0);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -109,55 +198,69 @@ main( int argc, char* argv[] )
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         const Orientation orientation = CharToOrientation( transChar );
         const UnitOrNonUnit diag = CharToUnitOrNonUnit( diagChar );
+        const TrsmAlgorithm alg = static_cast<TrsmAlgorithm>(algInt);
         SetBlocksize( nb );
 
         ComplainIfDebug();
         OutputFromRoot
-        (comm,"Will test Trsm ",sideChar,uploChar,transChar,diagChar);
+        (g.Comm(),"Will test Trsm ",sideChar,uploChar,transChar,diagChar);
 
         TestTrsm<float>
         ( side, uplo, orientation, diag,
           m, n,
           float(3),
+          alg,
           g, print );
         TestTrsm<Complex<float>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<float>(3),
+          alg,
           g, print );
 
         TestTrsm<double>
         ( side, uplo, orientation, diag,
           m, n,
           double(3),
+          alg,
           g, print );
         TestTrsm<Complex<double>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<double>(3),
+          alg,
           g, print );
 
+        TestVariants<float>( m, n, g );
+        TestVariants<Complex<float>>( m, n, g );
+        TestVariants<double>( m, n, g );
+        TestVariants<Complex<double>>( m, n, g );
+
 #ifdef EL_HAVE_QD
         TestTrsm<DoubleDouble>
         ( side, uplo, orientation, diag,
           m, n,
           DoubleDouble(3),
+          alg,
           g, print );
         TestTrsm<QuadDouble>
         ( side, uplo, orientation, diag,
           m, n,
           QuadDouble(3),
+          alg,
           g, print );
 
         TestTrsm<Complex<DoubleDouble>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<DoubleDouble>(3),
+          alg,
           g, print );
         TestTrsm<Complex<QuadDouble>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<QuadDouble>(3),
+          alg,
           g, print );
 #endif
 
@@ -166,11 +269,13 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           Quad(3),
+          alg,
           g, print );
         TestTrsm<Complex<Quad>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<Quad>(3),
+          alg,
           g, print );
 #endif
 
@@ -179,11 +284,13 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           BigFloat(3),
+          alg,
           g, print );
         TestTrsm<Complex<BigFloat>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<BigFloat>(3),
+          alg,
           g, print );
 #endif
     }
@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test asynchronous checkpointing of distributed matrices and restoring them
+  onto both the original and different distributions and grids.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckAgainst
+( const Matrix<T>& ALoc, const AbstractDistMatrix<T>& A, const string& label )
+{
+    if( ALoc.Height() != A.Height() || ALoc.Width() != A.Width() )
+        RuntimeError(label,": dimensions did not match");
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                ALoc.Get(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) )
+                RuntimeError(label," did not match the checkpointed matrix");
+}
+
+template<typename T>
+void TestCheckpoint
+( Int m, Int n, const Grid& g, const Grid& gTrans, const string& basename )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+
+    // Every process generates the same sequential matrices
+    SetRandomSeed( 1234 );
+    Matrix<T> ALoc, BLoc, CLoc;
+    Uniform( ALoc, m, n );
+    Uniform( BLoc, n, m );
+    Uniform( CLoc, m, n );
+
+    DistMatrix<T> A(g);
+    DistMatrix<T,VC,STAR> B(g);
+    DistMatrix<T,STAR,STAR> C(g);
+    SetRandomSeed( 1234 );
+    Uniform( A, m, n );
+    Uniform( B, n, m );
+    Uniform( C, m, n );
+
+    Checkpointer checkpointer( g, basename );
+    checkpointer.Stage( "A", A );
+    checkpointer.Stage( "B", B );
+    checkpointer.Stage( "C", C );
+    checkpointer.Commit( 1 );
+
+    // The manifest is only written once every process has written its file
+    const string manifest1 = basename + ".1.manifest";
+    if( std::ifstream( manifest1.c_str() ).is_open() )
+        RuntimeError("The manifest was written before the barrier");
+
+    // Modifying the matrices does not affect the pending checkpoint
+    Zero( A );
+    Zero( B );
+    checkpointer.Stage( "A", A );
+    checkpointer.Commit( 2 );
+    if( mpi::Rank(g.Comm()) == 0 &&
+        !std::ifstream( manifest1.c_str() ).is_open() )
+        RuntimeError("Committing did not complete the previous checkpoint");
+    checkpointer.Wait();
+    mpi::Barrier( g.Comm() );
+
+    // Restore onto the original distributions
+    Restore( A, basename, 1, "A" );
+    Restore( B, basename, 1, "B" );
+    Restore( C, basename, 1, "C" );
+    CheckAgainst( ALoc, A, "[MC,MR] A" );
+    CheckAgainst( BLoc, B, "[VC,STAR] B" );
+    CheckAgainst( CLoc, C, "[STAR,STAR] C" );
+
+    // Restore onto different distributions and grids
+    DistMatrix<T,STAR,VR> ATrans(gTrans);
+    Restore( ATrans, basename, 1, "A" );
+    CheckAgainst( ALoc, ATrans, "[STAR,VR] A" );
+    DistMatrix<T,MC,MR,BLOCK> BBlock(gTrans);
+    Restore( BBlock, basename, 1, "B" );
+    CheckAgainst( BLoc, BBlock, "Block [MC,MR] B" );
+    DistMatrix<T> CTrans(gTrans);
+    Restore( CTrans, basename, 1, "C" );
+    CheckAgainst( CLoc, CTrans, "[MC,MR] C" );
+
+    // The second checkpoint only contains the zeroed A
+    Matrix<T> ZLoc;
+    Zeros( ZLoc, m, n );
+    Restore( ATrans, basename, 2, "A" );
+    CheckAgainst( ZLoc, ATrans, "Second [STAR,VR] A" );
+
+    mpi::Barrier( g.Comm() );
+    const int commRank = mpi::Rank( g.Comm() );
+    for( Int step=1; step<=2; ++step )
+    {
+        const string prefix = basename + "." + std::to_string(step);
+        std::remove
+        ( (prefix+"."+std::to_string(commRank)+".ckpt").c_str() );
+        if( commRank == 0 )
+            std::remove( (prefix+".manifest").c_str() );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm(), COLUMN_MAJOR );
+        const Grid gTrans( std::move(comm), 1, ROW_MAJOR );
+
+        TestCheckpoint<float>( m, n, g, gTrans, "Checkpoint_float" );
+        TestCheckpoint<double>( m, n, g, gTrans, "Checkpoint_double" );
+        TestCheckpoint<Complex<double>>
+        ( m, n, g, gTrans, "Checkpoint_complex" );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
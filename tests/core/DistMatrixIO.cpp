@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test writing and reading distributed matrices in the BINARY and BINARY_FLAT
+  formats, where each process accesses its own entries of the file.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const string& label )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        RuntimeError(label,": dimensions did not match");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                RuntimeError(label,": entry (",i,",",j,") did not match");
+}
+
+template<typename T>
+void TestIO( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const string basename = "DistMatrixIO_" + TypeName<T>();
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    Write( A, basename, BINARY );
+    DistMatrix<T,VC,STAR> B(g);
+    Read( B, basename+".bin", BINARY );
+    CheckEqual( A, B, "BINARY [VC,STAR]" );
+
+    DistMatrix<T,STAR,STAR> C(g);
+    Read( C, basename+".bin", BINARY );
+    CheckEqual( A, C, "BINARY [STAR,STAR]" );
+
+    // The file should be identical to one written sequentially
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    if( mpi::Rank(g.Comm()) == 0 )
+    {
+        Matrix<T> ALoc;
+        Read( ALoc, basename+".bin", BINARY );
+        if( ALoc.Height() != m || ALoc.Width() != n )
+            RuntimeError("Sequential read produced the wrong dimensions");
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( ALoc(i,j) != A_STAR_STAR.GetLocal(i,j) )
+                    RuntimeError
+                    ("Sequential read of entry (",i,",",j,") did not match");
+    }
+
+    DistMatrix<T,MR,MC> D(g);
+    Transpose( A, D );
+    Write( D, basename, BINARY_FLAT );
+    DistMatrix<T,MD,STAR> E(g);
+    E.Resize( n, m );
+    Read( E, basename+".dat", BINARY_FLAT );
+    CheckEqual( D, E, "BINARY_FLAT [MD,STAR]" );
+
+    const Range<Int> I(m/4,m/2), J(n/3,END);
+    DistMatrix<T,STAR,VR> F(g);
+    ReadSubmatrix( F, basename+".bin", I, J );
+    CheckEqual( DistMatrix<T>(A(I,IR(n/3,n))), F, "Submatrix [STAR,VR]" );
+
+    DistMatrix<T> G(g);
+    ReadSubmatrix( G, basename+".dat", J, I, BINARY_FLAT, n );
+    CheckEqual( DistMatrix<T,MR,MC>(D(IR(n/3,n),I)), G, "Flat submatrix" );
+
+    // Submatrices which do not fit within the stored matrix are rejected
+    bool rejected = false;
+    try { ReadSubmatrix( G, basename+".bin", I, IR(n/3,n+1) ); }
+    catch( std::exception& ) { rejected = true; }
+    if( !rejected )
+        RuntimeError("An out-of-range submatrix was not rejected");
+
+    mpi::Barrier( g.Comm() );
+    if( mpi::Rank(g.Comm()) == 0 )
+    {
+        std::remove( (basename+".bin").c_str() );
+        std::remove( (basename+".dat").c_str() );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+// Headers whose dimensions do not agree with the size of the file, including
+// ones whose product would overflow, must be rejected
+void TestCorruptHeaders( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing corrupt headers");
+    const string filename = "DistMatrixIO_corrupt.bin";
+    const Int badDims[][2] =
+      { { m, n+1 }, { -m, -n }, { Int(1) << 40, Int(1) << 40 } };
+    for( const auto& dims : badDims )
+    {
+        if( mpi::Rank(g.Comm()) == 0 )
+        {
+            std::ofstream file( filename, std::ios::binary );
+            file.write( reinterpret_cast<const char*>(dims), 2*sizeof(Int) );
+            const vector<double> entries( m*n, 1. );
+            file.write
+            ( reinterpret_cast<const char*>(entries.data()),
+              entries.size()*sizeof(double) );
+        }
+        mpi::Barrier( g.Comm() );
+        DistMatrix<double> A(g);
+        bool rejected = false;
+        try { Read( A, filename, BINARY ); }
+        catch( std::exception& ) { rejected = true; }
+        if( !rejected )
+            RuntimeError
+            ("A ",dims[0]," x ",dims[1]," header was not rejected");
+        mpi::Barrier( g.Comm() );
+    }
+    if( mpi::Rank(g.Comm()) == 0 )
+        std::remove( filename.c_str() );
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        TestIO<float>( m, n, g );
+        TestIO<double>( m, n, g );
+        TestIO<Complex<double>>( m, n, g );
+        TestCorruptHeaders( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test applying swap sequences and general permutations to the rows and
+  columns of distributed matrices against sequential row and column swaps.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckAgainst
+( const Matrix<T>& ALoc, const AbstractDistMatrix<T>& A, const string& label )
+{
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                ALoc.Get(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) )
+                RuntimeError(label," did not match the sequential result");
+}
+
+template<typename T>
+void TestDistPermutation( Int n, Int offset, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const Int size = n - offset;
+
+    // The root generates the pivot sequence and the matrix, and every process
+    // keeps a full copy of both
+    Matrix<Int> dests( size, 1 );
+    for( Int k=0; k<size; ++k )
+        dests(k) = k + SampleUniform<Int>(0,size-k);
+    SyncInfo<Device::CPU> syncInfo;
+    mpi::Broadcast( dests.Buffer(), size, 0, g.Comm(), syncInfo );
+    Matrix<T> ALoc;
+    Uniform( ALoc, n, n );
+    mpi::Broadcast( ALoc.Buffer(), n*n, 0, g.Comm(), syncInfo );
+
+    DistPermutation P(g);
+    P.MakeIdentity( size );
+    P.ReserveSwaps( size );
+    for( Int k=0; k<size; ++k )
+        P.Swap( k, dests(k) );
+
+    DistMatrix<T> A(g);
+    A.Resize( n, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, ALoc.Get(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) );
+    DistMatrix<T,VC,STAR> B(g);
+    B = A;
+
+    // The swap sequence is applied with a single exchange
+    Matrix<T> ARowsLoc( ALoc ), AColsLoc( ALoc );
+    for( Int k=0; k<size; ++k )
+    {
+        RowSwap( ARowsLoc, k+offset, dests(k)+offset );
+        ColSwap( AColsLoc, k+offset, dests(k)+offset );
+    }
+    P.PermuteRows( A, offset );
+    CheckAgainst( ARowsLoc, A, "Swap sequence rows of [MC,MR]" );
+    P.PermuteRows( B, offset );
+    CheckAgainst( ARowsLoc, B, "Swap sequence rows of [VC,STAR]" );
+    P.InversePermuteRows( A, offset );
+    CheckAgainst( ALoc, A, "Inverse swap sequence rows" );
+    P.PermuteCols( A, offset );
+    CheckAgainst( AColsLoc, A, "Swap sequence columns" );
+    P.InversePermuteCols( A, offset );
+    CheckAgainst( ALoc, A, "Inverse swap sequence columns" );
+
+    // Querying an image converts the swaps into a general permutation
+    const Int image = P.Image( 0 );
+    if( ARowsLoc.Get(image+offset,0) != ALoc.Get(offset,0) )
+        RuntimeError("Image did not match the swap sequence");
+    P.PermuteRows( A, offset );
+    CheckAgainst( ARowsLoc, A, "General rows" );
+    P.InversePermuteRows( A, offset );
+    CheckAgainst( ALoc, A, "Inverse general rows" );
+    P.PermuteCols( A, offset );
+    CheckAgainst( AColsLoc, A, "General columns" );
+    P.InversePermuteCols( A, offset );
+    CheckAgainst( ALoc, A, "Inverse general columns" );
+
+    // The sequential general permutation is applied in place along its cycles
+    Permutation PLoc;
+    PLoc.MakeIdentity( size );
+    PLoc.ReserveSwaps( size );
+    for( Int k=0; k<size; ++k )
+        PLoc.Swap( k, dests(k) );
+    PLoc.MakeArbitrary();
+    Matrix<T> CLoc( ALoc );
+    PLoc.PermuteRows( CLoc, offset );
+    PLoc.PermuteCols( CLoc, offset );
+    PLoc.InversePermuteRows( CLoc, offset );
+    PLoc.InversePermuteRows( ARowsLoc, offset );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            if( CLoc.Get(i,j) != AColsLoc.Get(i,j) ||
+                ARowsLoc.Get(i,j) != ALoc.Get(i,j) )
+                RuntimeError("Sequential general permutation did not match");
+
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--size","size of matrix",37);
+        const Int offset = Input("--offset","permutation offset",5);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        TestDistPermutation<float>( n, 0, g );
+        TestDistPermutation<double>( n, offset, g );
+        TestDistPermutation<Complex<double>>( n, offset, g );
+        TestDistPermutation<Int>( n, offset, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test the huge-page CPU memory mode: matrices above the threshold must be
+  aligned to huge pages and accounted for in the statistics, and products
+  formed with them must match those formed with ordinary memory.
+*/
+#include <El.hpp>
+using namespace El;
+
+void ReportStats()
+{
+    const auto stats = hugepages::Stats();
+    Output
+    ("Huge pages: ",stats.mappedBytes," bytes mapped, ",stats.explicitBytes,
+     " explicit, ",stats.transparentBytes," transparent, ",
+     stats.explicitFailures," explicit failures");
+}
+
+template<typename T>
+void TestHugePages( Int m, Int n, Int k )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    Matrix<T> A, B, C;
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Gemm( NORMAL, NORMAL, T(1), A, B, C );
+
+    Matrix<T> AHuge, BHuge, CHuge;
+    for( Matrix<T>* X : { &AHuge, &BHuge, &CHuge } )
+        X->SetMemoryMode( HUGE_PAGE_MEMORY_MODE );
+    Copy( A, AHuge );
+    Copy( B, BHuge );
+    Gemm( NORMAL, NORMAL, T(1), AHuge, BHuge, CHuge );
+
+    const size_t pageSize = hugepages::PageSize();
+    for( const Matrix<T>* X : { &AHuge, &BHuge, &CHuge } )
+    {
+        const size_t bytes = X->MemorySize()*sizeof(T);
+        const bool aligned =
+          reinterpret_cast<uintptr_t>(X->LockedBuffer()) % pageSize == 0;
+        if( bytes >= hugepages::Threshold() && !aligned )
+            LogicError("A huge-page buffer was not aligned to a huge page");
+    }
+    const auto stats = hugepages::Stats();
+    if( stats.mappedBytes < AHuge.MemorySize()*sizeof(T) ||
+        stats.explicitBytes+stats.transparentBytes > stats.mappedBytes )
+        LogicError("Inconsistent huge-page statistics");
+    ReportStats();
+
+    Axpy( T(-1), C, CHuge );
+    const Base<T> error = FrobeniusNorm( CHuge ) / FrobeniusNorm( C );
+    Output("Relative error: ",error);
+    if( error > 10*k*limits::Epsilon<Base<T>>() )
+        RuntimeError("Results differ");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",600);
+        const Int n = Input("--width","width of matrix",500);
+        const Int k = Input("--inner","inner dimension",550);
+        const Int threshold =
+          Input("--threshold","smallest huge-page allocation (bytes)",1<<20);
+        const bool useExplicit =
+          Input("--explicit","try explicit huge pages first?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        hugepages::SetThreshold( threshold );
+        hugepages::SetUseExplicit( useExplicit );
+        TestHugePages<float>( m, n, k );
+        TestHugePages<double>( m, n, k );
+        TestHugePages<Complex<double>>( m, n, k );
+
+        // Release the cached huge pages
+        DestroyHugePageHostMemoryPool();
+        if( hugepages::Stats().mappedBytes != 0 )
+            LogicError("Huge pages were not released with their pool");
+        ReportStats();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test memory-mapped reading of the BINARY, BINARY_FLAT, and NUMPY formats.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const Matrix<T>& B, const string& label )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        RuntimeError(label,": dimensions did not match");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                RuntimeError(label,": entry (",i,",",j,") did not match");
+}
+
+template<typename T>
+void CheckAttached
+( const Matrix<T>& A, const MappedFile& mapping, const string& label )
+{
+    const char* buffer = reinterpret_cast<const char*>(A.LockedBuffer());
+    if( !A.Locked() || buffer < mapping.Data() ||
+        buffer >= mapping.Data()+mapping.Size() )
+        RuntimeError(label,": matrix was not attached to the mapping");
+}
+
+template<typename T>
+void TestMappedRead( Int m, Int n, const string& prefix )
+{
+    Output("Testing with ",TypeName<T>());
+    const string basename = prefix + TypeName<T>();
+
+    Matrix<T> A;
+    Uniform( A, m, n );
+
+    Write( A, basename, NUMPY );
+    Matrix<T> B;
+    Read( B, basename+".npy" );
+    CheckEqual( A, B, "NUMPY Read" );
+    {
+        Matrix<T> C;
+        auto mapping = ReadMapped( C, basename+".npy", AUTO, ADVISE_WILLNEED );
+        CheckAttached( C, *mapping, "NUMPY" );
+        CheckEqual( A, C, "NUMPY ReadMapped" );
+    }
+
+    Write( A, basename, BINARY );
+    {
+        Matrix<T> C;
+        auto mapping = ReadMapped( C, basename+".bin" );
+        CheckEqual( A, C, "BINARY ReadMapped" );
+    }
+
+    Write( A, basename, BINARY_FLAT );
+    {
+        Matrix<T> C( m, n );
+        auto mapping = ReadMapped( C, basename+".dat" );
+        CheckAttached( C, *mapping, "BINARY_FLAT" );
+        CheckEqual( A, C, "BINARY_FLAT ReadMapped" );
+    }
+
+    // A C-ordered array must be transposed into place
+    {
+        const string filename = basename + "_c.npy";
+        Matrix<T> ATrans;
+        Transpose( A, ATrans );
+        Write( ATrans, basename+"_t", NUMPY );
+
+        // Rewrite the header of the transpose as a C-ordered array of the
+        // original shape, which describes the same bytes
+        std::ifstream in( basename+"_t.npy", std::ios::binary );
+        string contents
+        ( (std::istreambuf_iterator<char>(in)),
+          std::istreambuf_iterator<char>() );
+        const string fortran = "'fortran_order': True";
+        const auto pos = contents.find( fortran );
+        contents.replace( pos, fortran.size(), "'fortran_order': False" );
+        // Keep the header length fixed by dropping a byte of its padding
+        contents.erase( contents.find('\n')-1, 1 );
+        const string oldShape = "(" + std::to_string(n) + ", " +
+                                std::to_string(m) + ")";
+        const string newShape = "(" + std::to_string(m) + ", " +
+                                std::to_string(n) + ")";
+        contents.replace( contents.find(oldShape), oldShape.size(), newShape );
+        std::ofstream out( filename, std::ios::binary );
+        out << contents;
+        out.close();
+
+        Matrix<T> C;
+        auto mapping = ReadMapped( C, filename );
+        CheckEqual( A, C, "C-ordered NUMPY ReadMapped" );
+        std::remove( filename.c_str() );
+        std::remove( (basename+"_t.npy").c_str() );
+    }
+
+    std::remove( (basename+".npy").c_str() );
+    std::remove( (basename+".bin").c_str() );
+    std::remove( (basename+".dat").c_str() );
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",31);
+        const Int n = Input("--width","width of matrix",17);
+        ProcessInput();
+        PrintInputReport();
+
+        const string prefix =
+          "MappedRead_" + std::to_string(mpi::Rank(mpi::COMM_WORLD)) + "_";
+        TestMappedRead<float>( m, n, prefix );
+        TestMappedRead<double>( m, n, prefix );
+        TestMappedRead<Complex<float>>( m, n, prefix );
+        TestMappedRead<Complex<double>>( m, n, prefix );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test the NUMA-aware CPU memory modes by computing the same products with
+  matrices stored in each mode, repeatedly resizing them so that the
+  first-touch pass and the node-local pools are exercised. The first-touch
+  hook records which thread zeroed which bytes, so that the static column
+  partition can be checked even on a single NUMA node.
+*/
+#include <El.hpp>
+#include <mutex>
+using namespace El;
+
+struct Touch
+{
+    const char* begin;
+    size_t bytes;
+    int thread;
+};
+
+std::mutex touchMutex;
+vector<Touch> touches;
+
+void RecordTouch( const void* begin, size_t bytes, int thread )
+{
+    std::lock_guard<std::mutex> lock( touchMutex );
+    touches.push_back( Touch{static_cast<const char*>(begin),bytes,thread} );
+}
+
+// Each thread of the first-touch pass must have zeroed exactly its columns
+// of the static partition, in which the first width % team threads own one
+// more column than the rest
+template<typename T>
+void CheckFirstTouch( const Matrix<T>& A )
+{
+    int team = 0;
+    for( const auto& touch : touches )
+        team = Max( team, touch.thread+1 );
+    if( Int(touches.size()) != team )
+        LogicError("Expected one first-touch range per thread");
+    const Int width = A.Width(), ldim = A.LDim();
+    const char* buffer = reinterpret_cast<const char*>( A.LockedBuffer() );
+    const Int quotient = width / team, remainder = width % team;
+    for( const auto& touch : touches )
+    {
+        const Int thread = touch.thread;
+        const Int beg = thread*quotient + Min(thread,remainder);
+        const Int end = beg + quotient + (thread < remainder ? 1 : 0);
+        if( touch.begin != buffer + beg*ldim*sizeof(T) ||
+            touch.bytes != size_t((end-beg)*ldim)*sizeof(T) )
+            LogicError
+            ("Thread ",thread," of ",team," did not touch columns [",beg,",",
+             end,") of a ",A.Height()," x ",width," matrix with leading "
+             "dimension ",ldim);
+    }
+}
+
+template<typename T>
+void TestNuma( Int m, Int n, Int k, Int numThreads )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    Matrix<T> A, B, C;
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Gemm( NORMAL, NORMAL, T(1), A, B, C );
+
+    const vector<std::pair<unsigned,string>> modes =
+      { { NUMA_INTERLEAVED_MEMORY_MODE, "interleaved" },
+        { NUMA_FIRST_TOUCH_MEMORY_MODE, "first-touch" },
+        { NUMA_LOCAL_POOL_MEMORY_MODE, "node-local pool" } };
+    for( const auto& mode : modes )
+    {
+        Matrix<T> ANuma, BNuma, CNuma;
+        for( Matrix<T>* X : { &ANuma, &BNuma, &CNuma } )
+        {
+            X->SetMemoryMode( mode.first );
+            X->SetThreadPartition( numThreads );
+        }
+        if( CNuma.MemoryMode() != mode.first ||
+            CNuma.ThreadPartition() != numThreads )
+            LogicError("Memory mode or thread partition was not recorded");
+
+        // Fresh matrices, then growth to a larger leading dimension
+        for( Int step=1; step<=2; ++step )
+        {
+            touches.clear();
+            CNuma.Resize( step*m, step*n );
+            if( mode.first == NUMA_FIRST_TOUCH_MEMORY_MODE )
+                CheckFirstTouch( CNuma );
+            else if( !touches.empty() )
+                LogicError(mode.second," buffer was first touched");
+        }
+        Copy( A, ANuma );
+        Copy( B, BNuma );
+        Gemm( NORMAL, NORMAL, T(1), ANuma, BNuma, CNuma );
+        Axpy( T(-1), C, CNuma );
+        const Base<T> error = FrobeniusNorm( CNuma ) / FrobeniusNorm( C );
+        Output(mode.second,": relative error ",error);
+        if( error > 10*k*limits::Epsilon<Base<T>>() )
+            RuntimeError(mode.second,": results differ");
+    }
+
+    // Raw buffers in each mode
+    for( const auto& mode : modes )
+    {
+        Memory<T,Device::CPU> memory( m*n, mode.first );
+        MemZero( memory.Buffer(), m*n );
+        memory.Require( 2*m*n );
+        memory.Empty();
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",80);
+        const Int k = Input("--inner","inner dimension",60);
+        const Int numThreads = Input("--numThreads","threads per matrix",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const int numNodes = numa::NumNodes();
+        const int node = numa::CurrentNode();
+        Output("Running on NUMA node ",node," of ",numNodes);
+        if( numNodes < 1 || node < 0 || node >= numNodes )
+            LogicError("Invalid NUMA node information");
+
+        numa::SetFirstTouchHook( RecordTouch );
+        TestNuma<float>( m, n, k, numThreads );
+        TestNuma<double>( m, n, k, numThreads );
+        TestNuma<Complex<double>>( m, n, k, numThreads );
+        numa::SetFirstTouchHook( nullptr );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test out-of-core matrices along with their Gemm and Cholesky factorization,
+  using caches small enough that tiles are repeatedly evicted and reloaded.
+*/
+#include <El.hpp>
+#include "TiledHelpers/CheckClose.hpp"
+using namespace El;
+using helpers::CheckClose;
+
+template<typename F>
+void TestOutOfCore
+( Int m, Int n, Int k, const OutOfCoreCtrl& ctrl, const string& mode )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>()," (",mode,")");
+    PushIndent();
+    const Real tol = 100*Max(Max(m,n),k)*limits::Epsilon<Real>();
+
+    Matrix<F> A, B, C;
+    Uniform( A, m, k );
+    Uniform( B, n, k );
+    Uniform( C, m, n );
+    OutOfCoreMatrix<F> AOOC( m, k, ctrl ), BOOC( n, k, ctrl ),
+                       COOC( m, n, ctrl );
+    AOOC.Import( A );
+    BOOC.Import( B );
+    COOC.Import( C );
+
+    Matrix<F> CExport;
+    COOC.Export( CExport );
+    CheckClose( CExport, C, Real(0), "Import/Export" );
+
+    const F alpha = F(2), beta = F(-1);
+    Gemm( NORMAL, ADJOINT, alpha, AOOC, BOOC, beta, COOC );
+    Gemm( NORMAL, ADJOINT, alpha, A, B, beta, C );
+    COOC.Export( CExport );
+    CheckClose( CExport, C, tol, "Gemm" );
+
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        // Form a Hermitian positive-definite matrix, H = A A^H + m I
+        Matrix<F> H;
+        Identity( H, m, m );
+        Herk( uplo, NORMAL, Real(1), A, Real(m), H );
+        OutOfCoreMatrix<F> HOOC( m, m, ctrl );
+        HOOC.Import( H );
+        Cholesky( uplo, HOOC );
+        Cholesky( uplo, H );
+        Matrix<F> HExport;
+        HOOC.Export( HExport );
+        MakeTrapezoidal( uplo, HExport );
+        MakeTrapezoidal( uplo, H );
+        CheckClose
+        ( HExport, H, tol, uplo == LOWER ? "Lower Cholesky" : "Upper Cholesky" );
+    }
+
+    const auto stats = COOC.Stats();
+    Output
+    ("C: ",stats.hits," hits, ",stats.misses," misses, ",stats.reads,
+     " reads, ",stats.writes," writes, ",stats.prefetches," prefetches");
+    PopIndent();
+}
+
+// A and B may be the same matrix, even if its cache only holds one tile
+template<typename F>
+void TestAliasedGemm( Int m, Int k, const OutOfCoreCtrl& ctrl )
+{
+    typedef Base<F> Real;
+    Output("Testing aliased Gemm with ",TypeName<F>());
+    PushIndent();
+    const Real tol = 100*Max(m,k)*limits::Epsilon<Real>();
+    Matrix<F> A, C;
+    Uniform( A, m, k );
+    Zeros( C, m, m );
+    Gemm( NORMAL, ADJOINT, F(1), A, A, F(0), C );
+    for( const Int cacheTiles : { Int(1), ctrl.cacheTiles } )
+    {
+        OutOfCoreCtrl aliasCtrl( ctrl );
+        aliasCtrl.cacheTiles = cacheTiles;
+        OutOfCoreMatrix<F> AOOC( m, k, aliasCtrl ), COOC( m, m, ctrl );
+        AOOC.Import( A );
+        Gemm( NORMAL, ADJOINT, F(1), AOOC, AOOC, F(0), COOC );
+        Matrix<F> CExport;
+        COOC.Export( CExport );
+        CheckClose
+        ( CExport, C, tol, "A A^H with "+std::to_string(cacheTiles)+
+          " cached tiles" );
+    }
+    PopIndent();
+}
+
+// Flush must not write back a modified tile while it is still pinned
+void TestFlush( Int tileSize )
+{
+    Output("Testing Flush with a pinned tile");
+    OutOfCoreCtrl ctrl;
+    ctrl.tileSize = tileSize;
+    ctrl.cacheTiles = 4;
+    ctrl.asyncIO = false;
+    OutOfCoreMatrix<double> A( 2*tileSize, 2*tileSize, ctrl );
+    auto tile = A.Pin( 0, 0 );
+    Fill( tile, 1. );
+    A.Unpin( 0, 0, true );
+    A.Pin( 0, 0 );
+    A.Flush();
+    if( A.Stats().writes != 0 )
+        LogicError("A pinned tile was written back");
+    A.Unpin( 0, 0, false );
+    A.Flush();
+    if( A.Stats().writes != 1 )
+        LogicError("The unpinned tile was not written back");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",75);
+        const Int n = Input("--width","width of matrix",60);
+        const Int k = Input("--inner","inner dimension",45);
+        const Int tileSize = Input("--tileSize","size of the tiles",16);
+        const Int cacheTiles = Input("--cacheTiles","tiles per cache",6);
+        ProcessInput();
+        PrintInputReport();
+
+        OutOfCoreCtrl ctrl;
+        ctrl.tileSize = tileSize;
+        ctrl.cacheTiles = cacheTiles;
+        for( Int mode=0; mode<3; ++mode )
+        {
+            ctrl.asyncIO = ( mode != 1 );
+            ctrl.memoryMapped = ( mode == 2 );
+            const string name = ( mode == 0 ? "asynchronous I/O" :
+                                  mode == 1 ? "synchronous I/O" :
+                                              "memory-mapped" );
+            TestOutOfCore<float>( m, n, k, ctrl, name );
+            TestOutOfCore<double>( m, n, k, ctrl, name );
+            TestOutOfCore<Complex<float>>( m, n, k, ctrl, name );
+            TestOutOfCore<Complex<double>>( m, n, k, ctrl, name );
+        }
+        TestAliasedGemm<double>( m, k, ctrl );
+        TestAliasedGemm<Complex<float>>( m, k, ctrl );
+        TestFlush( tileSize );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
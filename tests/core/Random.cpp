@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test that random matrices are identical regardless of the distribution and
+  the shape of the process grid.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckAgainst
+( const Matrix<T>& ALoc, const AbstractDistMatrix<T>& A, const string& label )
+{
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                ALoc.Get(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) )
+                RuntimeError(label," did not match the sequential result");
+}
+
+template<typename T>
+void CheckReplicas( const AbstractDistMatrix<T>& A, const string& label )
+{
+    Matrix<T> ARoot( A.LockedMatrix() );
+    Broadcast( ARoot, A.RedundantComm(), 0 );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) != ARoot.Get(iLoc,jLoc) )
+                RuntimeError(label," differed between its copies");
+}
+
+template<typename T>
+void TestRandom( Int m, Int n, const Grid& g, const Grid& gTrans )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const unsigned long long seed = 1234;
+
+    Matrix<T> GLoc, ULoc;
+    SetRandomSeed( seed );
+    Gaussian( GLoc, m, n );
+    Uniform( ULoc, m, n );
+
+    DistMatrix<T> G(g), U(g);
+    SetRandomSeed( seed );
+    Gaussian( G, m, n );
+    Uniform( U, m, n );
+    CheckAgainst( GLoc, G, "[MC,MR] Gaussian" );
+    CheckAgainst( ULoc, U, "[MC,MR] Uniform" );
+
+    DistMatrix<T,VC,STAR> GVC(gTrans);
+    DistMatrix<T,STAR,STAR> UStar(gTrans);
+    SetRandomSeed( seed );
+    Gaussian( GVC, m, n );
+    Uniform( UStar, m, n );
+    CheckAgainst( GLoc, GVC, "[VC,STAR] Gaussian" );
+    CheckAgainst( ULoc, UStar, "[STAR,STAR] Uniform" );
+
+    DistMatrix<T,MC,MR,BLOCK> GBlock(gTrans);
+    SetRandomSeed( seed );
+    Gaussian( GBlock, m, n );
+    CheckAgainst( GLoc, GBlock, "Block [MC,MR] Gaussian" );
+
+    // The copies of redundantly-distributed matrices must agree even if the
+    // processes were seeded differently
+    DistMatrix<T,STAR,STAR> UReplicated(g);
+    DistMatrix<T,MC,STAR> GRowReplicated(g);
+    SetRandomSeed( seed + mpi::Rank(g.Comm()) );
+    Uniform( UReplicated, m, n );
+    Gaussian( GRowReplicated, m, n );
+    CheckReplicas( UReplicated, "[STAR,STAR] Uniform" );
+    CheckReplicas( GRowReplicated, "[MC,STAR] Gaussian" );
+
+    SetRandomSeed( seed );
+    Gaussian( GBlock, m, n );
+    // Successive calls should consume different streams
+    Gaussian( GBlock, m, n );
+    if( m > 0 && n > 0 && GBlock.Get(0,0) == GLoc.Get(0,0) )
+        RuntimeError("Successive calls produced the same entries");
+
+    T mean = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            mean += GLoc.Get(i,j) / T(m*n);
+    if( Abs(mean) > Base<T>(0.1) )
+        RuntimeError("Unexpected mean of Gaussian sample: ",mean);
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm(), COLUMN_MAJOR );
+        const Grid gTrans( std::move(comm), 1, ROW_MAJOR );
+
+        TestRandom<float>( m, n, g, gTrans );
+        TestRandom<Complex<float>>( m, n, g, gTrans );
+        TestRandom<double>( m, n, g, gTrans );
+        TestRandom<Complex<double>>( m, n, g, gTrans );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,293 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test the sequential and distributed readers of the ASCII and Matrix Market
+  formats, including the symmetric, Hermitian, skew-symmetric, and pattern
+  variants of the latter.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckAgainst
+( const Matrix<T>& ALoc, const Matrix<T>& B, const string& label )
+{
+    if( ALoc.Height() != B.Height() || ALoc.Width() != B.Width() )
+        RuntimeError(label,": dimensions did not match");
+    for( Int j=0; j<B.Width(); ++j )
+        for( Int i=0; i<B.Height(); ++i )
+            if( B.Get(i,j) != ALoc.Get(i,j) )
+                RuntimeError(label,": entry (",i,",",j,") did not match");
+}
+
+template<typename T>
+void CheckAgainst
+( const Matrix<T>& ALoc, const AbstractDistMatrix<T>& A, const string& label )
+{
+    if( ALoc.Height() != A.Height() || ALoc.Width() != A.Width() )
+        RuntimeError(label,": dimensions did not match");
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                ALoc.Get(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) )
+                RuntimeError(label,": entry did not match");
+}
+
+// Read the file sequentially and into two different distributions
+template<typename T>
+void CheckRead
+( const Matrix<T>& ALoc, const string& filename, FileFormat format,
+  const Grid& g, const string& label )
+{
+    Matrix<T> B;
+    Read( B, filename, format );
+    CheckAgainst( ALoc, B, label+" Matrix" );
+
+    DistMatrix<T> A(g);
+    Read( A, filename, format, false );
+    CheckAgainst( ALoc, A, label+" [MC,MR]" );
+
+    DistMatrix<T,VC,STAR> AVC(g);
+    Read( AVC, filename, format, false );
+    CheckAgainst( ALoc, AVC, label+" [VC,STAR]" );
+}
+
+template<typename Real>
+void WriteValue( ofstream& file, const Real& value )
+{ file << value; }
+
+template<typename Real>
+void WriteValue( ofstream& file, const Complex<Real>& value )
+{ file << value.real() << " " << value.imag(); }
+
+template<typename T>
+void TestTextRead( Int m, Int n, const Grid& g, const string& prefix )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    const bool isRoot = ( g.Rank() == 0 );
+    const string field = ( IsComplex<T>::value ? "complex" : "real" );
+    const string basename = prefix + TypeName<T>();
+
+    // Every process generates the same matrices
+    SetRandomSeed( 1234 );
+    Matrix<T> A, S;
+    Uniform( A, m, n );
+    Uniform( S, n, n );
+
+    ofstream file;
+    auto open =
+      [&]( const string& filename )
+      {
+          file.open( filename.c_str() );
+          file.precision( std::numeric_limits<Base<T>>::max_digits10 );
+      };
+
+    // ASCII
+    const string asciiName = basename + ".txt";
+    if( isRoot )
+    {
+        open( asciiName );
+        for( Int i=0; i<m; ++i )
+        {
+            for( Int j=0; j<n; ++j )
+                file << A.Get(i,j) << " ";
+            file << "\n";
+            // Blank lines are ignored
+            if( i == m/2 )
+                file << "  \n";
+        }
+        file.close();
+    }
+    mpi::Barrier( g.Comm() );
+    CheckRead( A, asciiName, ASCII, g, "ASCII" );
+
+    // A general coordinate matrix with a duplicated entry
+    const string generalName = basename + "_general.mtx";
+    if( isRoot )
+    {
+        open( generalName );
+        file << "%%MatrixMarket matrix coordinate " << field << " general\n"
+             << "% A comment\n"
+             << m << " " << n << " " << m*n+1 << "\n";
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=0; i<m; ++i )
+            {
+                file << i+1 << " " << j+1 << " ";
+                WriteValue( file, A.Get(i,j) );
+                file << "\n";
+            }
+        }
+        file << "1 1 ";
+        WriteValue( file, T(0) );
+        file << "\n";
+        file.close();
+    }
+    mpi::Barrier( g.Comm() );
+    CheckRead( A, generalName, MATRIX_MARKET, g, "General coordinate" );
+
+    // A symmetric (or Hermitian) array which stores its lower triangle
+    Matrix<T> H( S );
+    const bool conjugate = IsComplex<T>::value;
+    MakeSymmetric( LOWER, H, conjugate );
+    const string hermName = basename + "_herm.mtx";
+    if( isRoot )
+    {
+        open( hermName );
+        file << "%%MatrixMarket matrix array " << field << " "
+             << ( conjugate ? "hermitian" : "symmetric" ) << "\n"
+             << n << " " << n << "\n";
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=j; i<n; ++i )
+            {
+                WriteValue( file, H.Get(i,j) );
+                file << "\n";
+            }
+        }
+        file.close();
+    }
+    mpi::Barrier( g.Comm() );
+    CheckRead( H, hermName, MATRIX_MARKET, g, "Symmetric array" );
+
+    // A skew-symmetric coordinate matrix
+    Matrix<T> K( S );
+    FillDiagonal( K, T(0) );
+    MakeSymmetric( LOWER, K );
+    ScaleTrapezoid( T(-1), UPPER, K, 1 );
+    const string skewName = basename + "_skew.mtx";
+    if( isRoot )
+    {
+        open( skewName );
+        file << "%%MatrixMarket matrix coordinate " << field
+             << " skew-symmetric\n"
+             << n << " " << n << " " << (n*(n-1))/2 << "\n";
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int i=j+1; i<n; ++i )
+            {
+                file << i+1 << " " << j+1 << " ";
+                WriteValue( file, K.Get(i,j) );
+                file << "\n";
+            }
+        }
+        file.close();
+    }
+    mpi::Barrier( g.Comm() );
+    CheckRead( K, skewName, MATRIX_MARKET, g, "Skew-symmetric coordinate" );
+
+    // A symmetric pattern
+    Matrix<T> P;
+    Zeros( P, n, n );
+    const string patternName = basename + "_pattern.mtx";
+    if( isRoot )
+    {
+        open( patternName );
+        file << "%%MatrixMarket matrix coordinate pattern symmetric\n"
+             << n << " " << n << " " << n << "\n";
+        for( Int j=0; j<n; ++j )
+            file << n << " " << j+1 << "\n";
+        file.close();
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        P.Set( n-1, j, T(1) );
+        P.Set( j, n-1, T(1) );
+    }
+    mpi::Barrier( g.Comm() );
+    CheckRead( P, patternName, MATRIX_MARKET, g, "Symmetric pattern" );
+
+    mpi::Barrier( g.Comm() );
+    if( isRoot )
+    {
+        std::remove( asciiName.c_str() );
+        std::remove( generalName.c_str() );
+        std::remove( hermName.c_str() );
+        std::remove( skewName.c_str() );
+        std::remove( patternName.c_str() );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+// Single-precision values must be parsed directly rather than through double,
+// which would round twice: the first token lies just above the midpoint of
+// two floats but rounds to the midpoint itself in double precision.
+void TestSingleRounding( const Grid& g, const string& prefix )
+{
+    OutputFromRoot(g.Comm(),"Testing single-precision rounding");
+    const bool isRoot = ( g.Rank() == 0 );
+    const char* tokens[] =
+      { "1.00000005960464477539062500001", "0.1", "16777217", "3.4e38",
+        "-7.006e-3" };
+    const Int n = sizeof(tokens)/sizeof(tokens[0]);
+    Matrix<float> AReal(1,n);
+    Matrix<Complex<float>> AComplex(n,1);
+    for( Int j=0; j<n; ++j )
+    {
+        AReal.Set( 0, j, std::strtof(tokens[j],nullptr) );
+        AComplex.Set
+        ( j, 0, Complex<float>(std::strtof(tokens[j],nullptr),
+                               std::strtof(tokens[n-1-j],nullptr)) );
+    }
+    if( AReal.Get(0,0) == float(std::strtod(tokens[0],nullptr)) )
+        LogicError("The first token no longer exercises double rounding");
+
+    const string asciiName = prefix + "rounding.txt";
+    const string mmName = prefix + "rounding.mtx";
+    if( isRoot )
+    {
+        ofstream file( asciiName.c_str() );
+        for( Int j=0; j<n; ++j )
+            file << tokens[j] << " ";
+        file << "\n";
+        file.close();
+        file.open( mmName.c_str() );
+        file << "%%MatrixMarket matrix coordinate complex general\n"
+             << n << " 1 " << n << "\n";
+        for( Int j=0; j<n; ++j )
+            file << j+1 << " 1 " << tokens[j] << " " << tokens[n-1-j] << "\n";
+        file.close();
+    }
+    mpi::Barrier( g.Comm() );
+    CheckRead( AReal, asciiName, ASCII, g, "Single-precision ASCII" );
+    CheckRead( AComplex, mmName, MATRIX_MARKET, g, "Single-precision complex" );
+
+    mpi::Barrier( g.Comm() );
+    if( isRoot )
+    {
+        std::remove( asciiName.c_str() );
+        std::remove( mmName.c_str() );
+    }
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        const string prefix = "TextRead_";
+        TestTextRead<float>( m, n, g, prefix );
+        TestTextRead<double>( m, n, g, prefix );
+        TestTextRead<Complex<float>>( m, n, g, prefix );
+        TestTextRead<Complex<double>>( m, n, g, prefix );
+        TestSingleRounding( g, prefix );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test tile-major matrices, their tile-aligned views, and the tile-major Gemm,
+  Trsm, Herk, and Cholesky against their column-major counterparts. The tile
+  sizes exercise ragged edge tiles, dimensions which are exact multiples of
+  the tile size, and a single tile spanning the entire matrix.
+*/
+#include <El.hpp>
+#include "TiledHelpers/CheckClose.hpp"
+using namespace El;
+using helpers::CheckClose;
+
+template<typename F>
+void TestTileMatrix( Int m, Int n, Int k, Int tileSize )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>()," and ",tileSize," x ",tileSize,
+           " tiles");
+    PushIndent();
+    const Real tol = 100*Max(Max(m,n),k)*limits::Epsilon<Real>();
+
+    Matrix<F> A, B, C;
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Uniform( C, m, n );
+    TileMatrix<F> ATile( tileSize ), BTile( tileSize ), CTile( tileSize );
+    Copy( A, ATile );
+    Copy( B, BTile );
+    Copy( C, CTile );
+    CheckClose( CTile, C, Real(0), "Conversion" );
+
+    // Entry access and tile-aligned views
+    for( Int j=0; j<n; j+=3 )
+        for( Int i=0; i<m; i+=2 )
+            if( CTile.Get(i,j) != C(i,j) )
+                LogicError("Entry (",i,",",j,") was not preserved");
+    if( CTile.TileRows() != (m+tileSize-1)/tileSize ||
+        CTile.TileCols() != (n+tileSize-1)/tileSize )
+        LogicError("Unexpected number of tiles");
+    const Int iBeg = ( tileSize < m ? tileSize : 0 ),
+              jBeg = ( tileSize < n ? tileSize : 0 );
+    auto CSubTile = CTile( IR(iBeg,END), IR(jBeg,END) );
+    auto CSub = C( IR(iBeg,END), IR(jBeg,END) );
+    CSubTile.Update( 0, 0, F(1) );
+    CSub(0,0) += F(1);
+    CheckClose( CSubTile, CSub, Real(0), "Tile-aligned view" );
+    CheckClose( CTile, C, Real(0), "Update through a view" );
+
+    const F alpha = F(2), beta = F(-1);
+    Gemm( NORMAL, NORMAL, alpha, ATile, BTile, beta, CTile );
+    Gemm( NORMAL, NORMAL, alpha, A, B, beta, C );
+    CheckClose( CTile, C, tol, "Gemm" );
+
+    // Only the stored triangles of H and its factors are compared
+    Matrix<F> H;
+    Identity( H, m, m );
+    TileMatrix<F> HTile( tileSize );
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        const string triangle = ( uplo == LOWER ? "Lower " : "Upper " );
+
+        // Form a Hermitian positive-definite matrix, H = A A^H + m I
+        Identity( H, m, m );
+        Copy( H, HTile );
+        Herk( uplo, NORMAL, Real(1), ATile, Real(m), HTile );
+        Herk( uplo, NORMAL, Real(1), A, Real(m), H );
+        Matrix<F> HCol;
+        Copy( HTile, HCol );
+        MakeTrapezoidal( uplo, HCol );
+        Matrix<F> HTrap( H );
+        MakeTrapezoidal( uplo, HTrap );
+        CheckClose( HCol, HTrap, tol, triangle+"Herk" );
+
+        Cholesky( uplo, HTile );
+        Cholesky( uplo, H );
+        Copy( HTile, HCol );
+        MakeTrapezoidal( uplo, HCol );
+        MakeTrapezoidal( uplo, H );
+        CheckClose( HCol, H, tol, triangle+"Cholesky" );
+
+        for( auto side : { LEFT, RIGHT } )
+        {
+            for( auto orient : { NORMAL, ADJOINT } )
+            {
+                Matrix<F> X;
+                if( side == LEFT )
+                    Uniform( X, m, n );
+                else
+                    Uniform( X, n, m );
+                TileMatrix<F> XTile( tileSize );
+                Copy( X, XTile );
+                Trsm( side, uplo, orient, NON_UNIT, alpha, HTile, XTile );
+                Trsm( side, uplo, orient, NON_UNIT, alpha, H, X );
+                CheckClose
+                ( XTile, X, tol,
+                  triangle+(side == LEFT ? "left " : "right ")+
+                  (orient == NORMAL ? "Trsm" : "adjoint Trsm") );
+            }
+        }
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",44);
+        const Int n = Input("--width","width of matrix",33);
+        const Int k = Input("--inner","inner dimension",22);
+        const Int tileSize = Input("--tileSize","size of the ragged tiles",8);
+        ProcessInput();
+        PrintInputReport();
+
+        // Ragged edge tiles, tiles which evenly divide every dimension, and a
+        // single tile
+        const Int tileSizes[] = { tileSize, GCD(GCD(m,n),k), Max(Max(m,n),k) };
+        for( const Int size : tileSizes )
+        {
+            TestTileMatrix<float>( m, n, k, size );
+            TestTileMatrix<double>( m, n, k, size );
+            TestTileMatrix<Complex<float>>( m, n, k, size );
+            TestTileMatrix<Complex<double>>( m, n, k, size );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
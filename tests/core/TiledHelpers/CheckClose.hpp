@@ -0,0 +1,32 @@
+#include <El.hpp>
+
+namespace helpers
+{
+
+// Check that the relative Frobenius-norm difference of A and B (relative to
+// at least one) is within tol
+template <typename F>
+void CheckClose(
+    El::Matrix<F> const& A, El::Matrix<F> const& B, El::Base<F> tol,
+    std::string const& label)
+{
+    El::Matrix<F> E(A);
+    El::Axpy(F(-1), B, E);
+    El::Base<F> const error =
+        El::FrobeniusNorm(E) / El::Max(El::FrobeniusNorm(B), El::Base<F>(1));
+    El::Output(label, ": relative error ", error);
+    if (error > tol)
+        El::RuntimeError(label, ": unacceptably large error");
+}
+
+template <typename F>
+void CheckClose(
+    El::TileMatrix<F> const& A, El::Matrix<F> const& B, El::Base<F> tol,
+    std::string const& label)
+{
+    El::Matrix<F> ACol;
+    El::Copy(A, ACol);
+    CheckClose(ACol, B, tol, label);
+}
+
+}// namespace helpers
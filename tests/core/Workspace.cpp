@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Test the workspace arenas: blocks must be aligned and reclaimed in stack
+  order, the chunks acquired while growing must be merged once the arena
+  empties, blocks may be freed by (and outlive) other threads, and
+  distributed products, Cholesky factorizations, and redistributions which
+  draw their temporaries from the workspace must match those which do not
+  while leaving the arena empty (and no larger) after repeated calls.
+*/
+#include <El.hpp>
+#include <thread>
+using namespace El;
+
+void TestArena()
+{
+    Output("Testing the arena");
+    PushIndent();
+    WorkspaceArena arena;
+    auto aligned =
+      []( const void* ptr )
+      { return reinterpret_cast<uintptr_t>(ptr) % WorkspaceArena::Alignment
+               == 0; };
+
+    void* a = arena.Allocate( 100 );
+    void* b = arena.Allocate( 1000 );
+    void* c = arena.Allocate( 10 );
+    if( !aligned(a) || !aligned(b) || !aligned(c) )
+        LogicError("Workspace blocks were not aligned");
+
+    // Freeing out of order only reclaims a block once those above it are freed
+    arena.Free( b );
+    if( arena.NumBlocks() != 3 )
+        LogicError("A buried block was popped");
+    arena.Free( c );
+    if( arena.NumBlocks() != 1 )
+        LogicError("Freed blocks were not popped: ",arena.NumBlocks());
+    void* d = arena.Allocate( 1000 );
+    if( d != b )
+        LogicError("The top of the stack was not reused");
+    arena.Free( d );
+    arena.Free( a );
+    if( arena.NumBlocks() != 0 || arena.Used() != 0 )
+        LogicError("The arena was not emptied");
+
+    // Grow beyond the first chunk and check that the chunks are merged
+    const size_t blockSize = arena.Capacity()/3;
+    vector<void*> blocks;
+    for( Int i=0; i<10; ++i )
+        blocks.push_back( arena.Allocate( blockSize ) );
+    const size_t capacity = arena.Capacity();
+    Output
+    (arena.NumChunks()," chunks holding ",capacity," bytes (high water of ",
+     arena.HighWater(),")");
+    if( arena.NumChunks() < 2 )
+        LogicError("The arena did not grow into new chunks");
+    for( auto ptr : blocks )
+        arena.Free( ptr );
+    arena.Trim();
+    if( arena.NumChunks() != 1 || arena.Capacity() != capacity )
+        LogicError("The chunks were not merged");
+    blocks.clear();
+    for( Int i=0; i<10; ++i )
+        blocks.push_back( arena.Allocate( blockSize ) );
+    if( arena.NumChunks() != 1 )
+        LogicError("The merged arena acquired another chunk");
+    for( auto ptr = blocks.rbegin(); ptr != blocks.rend(); ++ptr )
+        arena.Free( *ptr );
+
+    arena.Reserve( 4*capacity );
+    if( arena.Capacity() < 4*capacity )
+        LogicError("The arena was not reserved");
+    arena.Release();
+    if( arena.Capacity() != 0 )
+        LogicError("The arena was not released");
+    PopIndent();
+}
+
+void TestThreads()
+{
+    Output("Testing frees from other threads");
+    PushIndent();
+    auto& arena = DefaultWorkspaceArena();
+
+    // A block freed by another thread is reclaimed by its own arena
+    void* ptr = arena.Allocate( 100 );
+    std::thread( [&]() { WorkspaceArena::FreeBlock( ptr ); } ).join();
+    if( arena.NumBlocks() != 0 )
+        LogicError("A block freed by another thread was not reclaimed");
+
+    // A matrix whose workspace memory outlives the thread which allocated it
+    Matrix<double> A;
+    std::thread(
+      [&]()
+      {
+          A.SetMemoryMode( WORKSPACE_MEMORY_MODE );
+          Ones( A, 20, 10 );
+      } ).join();
+    if( A.Get(19,9) != 1. )
+        LogicError("The memory of an exited thread's arena was lost");
+    A.Empty();
+    if( arena.NumBlocks() != 0 )
+        LogicError("Another thread's block was freed into this arena");
+    PopIndent();
+}
+
+template<typename T>
+void CheckEqual( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+                 const string& label )
+{
+    DistMatrix<T> E( A );
+    Axpy( T(-1), B, E );
+    if( FrobeniusNorm( E ) != Base<T>(0) )
+        LogicError(label,": results with and without the workspace differ");
+}
+
+template<typename T>
+void TestWorkspace( Int m, Int n, Int k, const Grid& g )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    auto& arena = DefaultWorkspaceArena();
+    const pair<GemmAlgorithm,string> algs[] =
+      { { GEMM_SUMMA_A, "SUMMA A" }, { GEMM_SUMMA_B, "SUMMA B" },
+        { GEMM_SUMMA_C, "SUMMA C" } };
+    for( auto orientA : { NORMAL, TRANSPOSE } )
+    {
+        for( auto orientB : { NORMAL, TRANSPOSE } )
+        {
+            DistMatrix<T> A(g), B(g);
+            if( orientA == NORMAL )
+                Uniform( A, m, k );
+            else
+                Uniform( A, k, m );
+            if( orientB == NORMAL )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            for( const auto& alg : algs )
+            {
+                const string label =
+                  alg.second+" "+(orientA==NORMAL ? "N" : "T")+
+                  (orientB==NORMAL ? "N" : "T");
+                DistMatrix<T> C(g), CRef(g);
+                SetUseWorkspace( false );
+                Zeros( CRef, m, n );
+                Gemm( orientA, orientB, T(1), A, B, T(0), CRef, alg.first );
+                SetUseWorkspace( true );
+                Zeros( C, m, n );
+                Gemm( orientA, orientB, T(1), A, B, T(0), C, alg.first );
+                const size_t capacity = arena.Capacity();
+                Gemm( orientA, orientB, T(1), A, B, T(0), C, alg.first );
+                CheckEqual( C, CRef, label );
+                if( arena.NumBlocks() != 0 )
+                    LogicError(label,": workspace blocks were left behind");
+                if( arena.Capacity() != capacity || arena.NumChunks() > 1 )
+                    LogicError(label,": the workspace grew on a repeat call");
+            }
+        }
+    }
+
+    // The panels of Cholesky factorizations
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        const string label = ( uplo == LOWER ? "Lower" : "Upper" )+
+          string(" Cholesky");
+        DistMatrix<T> H(g), L(g), LRef(g);
+        HermitianUniformSpectrum( H, m, 1, 10 );
+        SetUseWorkspace( false );
+        LRef = H;
+        Cholesky( uplo, LRef );
+        SetUseWorkspace( true );
+        L = H;
+        Cholesky( uplo, L );
+        const size_t capacity = arena.Capacity();
+        L = H;
+        Cholesky( uplo, L );
+        CheckEqual( L, LRef, label );
+        if( arena.NumBlocks() != 0 )
+            LogicError(label,": workspace blocks were left behind");
+        if( arena.Capacity() != capacity || arena.NumChunks() > 1 )
+            LogicError(label,": the workspace grew on a repeat call");
+    }
+
+    // A redistribution through Copy, whose packing buffers are drawn from the
+    // workspace
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,VR,STAR> AVR(g), AVRRef(g);
+    DistMatrix<T,MR,MC> AMRMC(g), AMRMCRef(g);
+    SetUseWorkspace( false );
+    Copy( A, AVRRef );
+    Copy( A, AMRMCRef );
+    SetUseWorkspace( true );
+    Copy( A, AVR );
+    Copy( A, AMRMC );
+    CheckEqual( AVR, AVRRef, "[VR,*] redistribution" );
+    CheckEqual( AMRMC, AMRMCRef, "[MR,MC] redistribution" );
+    if( arena.NumBlocks() != 0 )
+        LogicError("Redistributions left workspace blocks behind");
+    if( AVR.LockedMatrix().MemoryMode() == WORKSPACE_MEMORY_MODE )
+        LogicError("A redistribution target was moved into the workspace");
+    Output
+    ("Workspace: ",arena.Capacity()," bytes in ",arena.NumChunks(),
+     " chunks (high water of ",arena.HighWater(),")");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",80);
+        const Int k = Input("--inner","inner dimension",90);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        const Grid g( mpi::NewWorldComm() );
+        TestArena();
+        TestThreads();
+        TestWorkspace<float>( m, n, k, g );
+        TestWorkspace<double>( m, n, k, g );
+        TestWorkspace<Complex<double>>( m, n, k, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
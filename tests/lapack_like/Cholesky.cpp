@@ -24,17 +24,18 @@ void TestCorrectness
 
     // Test correctness by multiplying a random set of vectors by A, then
     // using the Cholesky factorization to solve.
-    Matrix<F> X, Y;
+    Matrix<F> AHerm( AOrig ), X, Y;
+    MakeHermitian( uplo, AHerm );
     Uniform( X, n, numRHS );
     Zeros( Y, n, numRHS );
-    Hemm( LEFT, uplo, F(1), AOrig, X, F(0), Y );
+    Gemm( NORMAL, NORMAL, F(1), AHerm, X, F(0), Y );
     const Real oneNormY = OneNorm( Y );
 
     if( pivot )
         cholesky::SolveAfter( uplo, NORMAL, A, p, Y );
     else
         cholesky::SolveAfter( uplo, NORMAL, A, Y );
-    X -= Y;
+    Axpy( F(-1), Y, X );
     const Real infNormE = InfinityNorm( X );
     const Real relErr = infNormE / (eps*n*oneNormY);
 
@@ -60,10 +61,11 @@ void TestCorrectness
 
     // Test correctness by multiplying a random set of vectors by A, then
     // using the Cholesky factorization to solve.
-    DistMatrix<F> X(g), Y(g);
+    DistMatrix<F> AHerm( AOrig ), X(g), Y(g);
+    MakeHermitian( uplo, AHerm );
     Uniform( X, n, numRHS );
     Zeros( Y, n, numRHS );
-    Hemm( LEFT, uplo, F(1), AOrig, X, F(0), Y );
+    Gemm( NORMAL, NORMAL, F(1), AHerm, X, F(0), Y );
     const Real oneNormY = OneNorm( Y );
 
     if( pivot )
@@ -81,6 +83,83 @@ void TestCorrectness
         LogicError("Relative error was unacceptably large");
 }
 
+// The lookahead variant of the distributed lower Cholesky factorization
+// should agree with the right-looking variant up to rounding for each depth.
+// The panels are made narrow enough that the deepest lookahead still leaves
+// several panels whose trailing updates are deferred.
+template<typename F>
+void TestLookahead( const DistMatrix<F>& AOrig, Int nbLookahead )
+{
+    typedef Base<F> Real;
+    const Grid& g = AOrig.Grid();
+    const Int n = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Int lookahead = CholeskyLookahead();
+    const Int nb = Blocksize();
+    SetBlocksize( nbLookahead );
+
+    DistMatrix<F> LRef( AOrig );
+    SetCholeskyLookahead( 0 );
+    Cholesky( LOWER, LRef );
+    MakeTrapezoidal( LOWER, LRef );
+    const Real frobL = FrobeniusNorm( LRef );
+    for( const Int depth : { 1, 2, 3 } )
+    {
+        DistMatrix<F> L( AOrig );
+        SetCholeskyLookahead( depth );
+        Cholesky( LOWER, L );
+        MakeTrapezoidal( LOWER, L );
+        L -= LRef;
+        const Real relErr = FrobeniusNorm( L ) / (eps*n*frobL);
+        OutputFromRoot
+        (g.Comm(),"Lookahead of ",depth,
+         ": || L_lookahead - L ||_F / (eps n || L ||_F) = ",relErr);
+        if( relErr > Real(100) )
+            LogicError("The lookahead variant differed from the original");
+    }
+    SetCholeskyLookahead( lookahead );
+    SetBlocksize( nb );
+}
+
+#ifdef EL_HYBRID
+// With several OpenMP threads, the sequential factorization of a matrix wider
+// than the blocksize schedules its tile operations as tasks; it should agree
+// with the blocked variants, which are used with a single thread
+template<typename F>
+void TestTiled( Int m )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const int numThreads = omp_get_max_threads();
+    const Int nb = Blocksize();
+    // Use enough tiles that there are independent tasks at every step
+    SetBlocksize( Max(m/6,Int(1)) );
+
+    Matrix<F> A;
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    for( auto uplo : { LOWER, UPPER } )
+    {
+        Matrix<F> L( A ), LRef( A );
+        omp_set_num_threads( Max(numThreads,2) );
+        Cholesky( uplo, L );
+        omp_set_num_threads( 1 );
+        Cholesky( uplo, LRef );
+        omp_set_num_threads( numThreads );
+        MakeTrapezoidal( uplo, L );
+        MakeTrapezoidal( uplo, LRef );
+        const Real frobL = FrobeniusNorm( LRef );
+        Axpy( F(-1), LRef, L );
+        const Real relErr = FrobeniusNorm( L ) / (eps*m*frobL);
+        Output
+        ("Tiled ",UpperOrLowerToChar(uplo),
+         ": || L_tiled - L_blocked ||_F / (eps m || L ||_F) = ",relErr);
+        if( relErr > Real(100) )
+            LogicError("The tiled variant differed from the blocked one");
+    }
+    SetBlocksize( nb );
+}
+#endif // EL_HYBRID
+
 template<typename F>
 void TestSequentialCholesky
 ( UpperOrLower uplo,
@@ -126,6 +205,10 @@ void TestSequentialCholesky
         Print( GetRealPartOfDiagonal(A), "diag(A)" );
     if( correctness )
         TestCorrectness( pivot, uplo, A, p, AOrig );
+#ifdef EL_HYBRID
+    if( correctness && !pivot )
+        TestTiled<F>( m );
+#endif
     PopIndent();
 }
 
@@ -139,7 +222,8 @@ void TestCholesky
   bool print,
   bool printDiag,
   bool correctness,
-  bool scalapack )
+  bool scalapack,
+  Int nbLookahead )
 {
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
@@ -185,6 +269,8 @@ void TestCholesky
         Print( GetRealPartOfDiagonal(A), "diag(A)" );
     if( correctness )
         TestCorrectness( pivot, uplo, A, p, AOrig );
+    if( correctness && uplo == LOWER && !pivot && !scalapack )
+        TestLookahead( AOrig, nbLookahead );
     PopIndent();
 }
 
@@ -192,7 +278,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    const mpi::Comm& comm = mpi::COMM_WORLD;
 
     try
     {
@@ -202,6 +288,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int nbLookahead =
+          Input("--nbLookahead","blocksize when testing the lookahead",16);
         const bool pivot = Input("--pivot","use pivoting?",false);
         const bool correctness = Input
             ("--correctness","test correctness?",true);
@@ -226,7 +314,7 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid g( comm, gridHeight, order );
+        const Grid g( mpi::NewWorldComm(), gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
 
@@ -272,49 +360,49 @@ main( int argc, char* argv[] )
 
         TestCholesky<float>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<Complex<float>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<double>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<Complex<double>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<QuadDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
 
         TestCholesky<Complex<DoubleDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<Complex<QuadDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<Complex<Quad>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
         TestCholesky<Complex<BigFloat>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, nbLookahead );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -24,17 +24,18 @@ void TestCorrectness
 
     Matrix<Field> B( A );
     Herk( uplo, NORMAL, alpha, V, Real(1), B );
+    MakeHermitian( uplo, B );
 
     // Test correctness by multiplying a random set of vectors by
     // A + alpha V V^H, then using the Cholesky factorization to solve.
     Matrix<Field> X, Y;
     Uniform( X, n, numRHS );
     Zeros( Y, n, numRHS );
-    Hemm( LEFT, uplo, Field(1), B, X, Field(0), Y );
+    Gemm( NORMAL, NORMAL, Field(1), B, X, Field(0), Y );
     const Real oneNormY = OneNorm( Y );
 
     cholesky::SolveAfter( uplo, NORMAL, T, Y );
-    X -= Y;
+    Axpy( Field(-1), Y, X );
     const Real infNormE = InfinityNorm( X );
     const Real relError = infNormE / (eps*n*oneNormY);
 
@@ -61,13 +62,14 @@ void TestCorrectness
 
     DistMatrix<Field> B( A );
     Herk( uplo, NORMAL, alpha, V, Real(1), B );
+    MakeHermitian( uplo, B );
 
     // Test correctness by multiplying a random set of vectors by
     // A + alpha V V^H, then using the Cholesky factorization to solve.
     DistMatrix<Field> X(grid), Y(grid);
     Uniform( X, n, numRHS );
     Zeros( Y, n, numRHS );
-    Hemm( LEFT, uplo, Field(1), B, X, Field(0), Y );
+    Gemm( NORMAL, NORMAL, Field(1), B, X, Field(0), Y );
     const Real oneNormY = OneNorm( Y );
 
     cholesky::SolveAfter( uplo, NORMAL, T, Y );
@@ -116,7 +118,7 @@ void TestCholeskyMod
 
     Matrix<Field> V, VMod;
     Uniform( V, m, n );
-    V *= Field(1)/Sqrt(Field(m)*Field(n));
+    Scale( Field(1)/Sqrt(Field(m)*Field(n)), V );
     VMod = V;
     if( print )
         Print( V, "V" );
@@ -186,11 +188,160 @@ void TestCholeskyMod
     PopIndent();
 }
 
+// Compare a modified Cholesky factor with the factor of the modified matrix,
+// B, computed from scratch
+template<typename Field>
+void CheckAgainstRefactor
+( UpperOrLower uplo, const Matrix<Field>& T, const Matrix<Field>& B,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    const Int m = B.Height();
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<Field> TRef( B );
+    Cholesky( uplo, TRef );
+    MakeTrapezoidal( uplo, TRef );
+    Matrix<Field> E( T );
+    MakeTrapezoidal( uplo, E );
+    Axpy( Field(-1), TRef, E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( TRef );
+    Output(label,": || T - chol(B) ||_F / || chol(B) ||_F = ",relError);
+    if( relError > Real(10)*m*eps )
+        LogicError(label," did not match the refactored matrix");
+}
+
+template<typename Field>
+void CheckAgainstRefactor
+( UpperOrLower uplo, const DistMatrix<Field>& T, const DistMatrix<Field>& B,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    const Int m = B.Height();
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<Field> TRef( B );
+    Cholesky( uplo, TRef );
+    MakeTrapezoidal( uplo, TRef );
+    DistMatrix<Field> E( T );
+    MakeTrapezoidal( uplo, E );
+    E -= TRef;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( TRef );
+    OutputFromRoot
+    (B.Grid().Comm(),label,": || T - chol(B) ||_F / || chol(B) ||_F = ",
+     relError);
+    if( relError > Real(10)*m*eps )
+        LogicError(label," did not match the refactored matrix");
+}
+
+// Apply rank-one modifications (which use the unblocked sweeps), rank-n
+// modifications (which use the blocked algorithm), and a sequence of small
+// modifications batched through a queue of rank maxRank, and compare each
+// result with the factor of the modified matrix computed from scratch. The
+// total downdate is kept below the smallest eigenvalue of A so that every
+// intermediate matrix remains positive-definite.
+template<typename Field>
+void TestAgainstRefactor
+( UpperOrLower uplo, Int m, Int n, Int maxRank, Int numPushes )
+{
+    typedef Base<Field> Real;
+    Output("Comparing against refactorization with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A;
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    for( const Int k : { Int(1), n } )
+    {
+        for( const Real alpha : { Real(3), Real(-1)/Real(2) } )
+        {
+            Matrix<Field> T( A ), V, B( A );
+            Cholesky( uplo, T );
+            Uniform( V, m, k );
+            Scale( Field(1)/Sqrt(Field(m)*Field(k)), V );
+            Herk( uplo, NORMAL, alpha, V, Real(1), B );
+            CholeskyMod( uplo, T, alpha, V );
+            CheckAgainstRefactor
+            ( uplo, T, B, BuildString("Rank-",k," mod with alpha=",alpha) );
+        }
+    }
+
+    Matrix<Field> T( A ), B( A );
+    Cholesky( uplo, T );
+    {
+        CholeskyModQueue<Field> queue( uplo, T, maxRank );
+        for( Int push=0; push<numPushes; ++push )
+        {
+            // Cycle through ranks of 1, 2, and (once) more than maxRank
+            const Int k = ( push == numPushes/2 ? maxRank+1 : 1+push%2 );
+            const Real alpha =
+              ( push % 3 == 2 ? Real(-1)/Real(2*numPushes) : Real(1) );
+            Matrix<Field> V;
+            Uniform( V, m, k );
+            Scale( Field(1)/Sqrt(Field(m)*Field(k)), V );
+            Herk( uplo, NORMAL, alpha, V, Real(1), B );
+            queue.Push( alpha, V );
+        }
+        queue.Flush();
+        if( queue.NumPendingUpdates() != 0 || queue.NumPendingDowndates() != 0 )
+            LogicError("The queue was not emptied by Flush");
+    }
+    CheckAgainstRefactor( uplo, T, B, "Queued mods" );
+    PopIndent();
+}
+
+template<typename Field>
+void TestAgainstRefactor
+( const Grid& grid, UpperOrLower uplo, Int m, Int n, Int maxRank,
+  Int numPushes )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (grid.Comm(),"Comparing against refactorization with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid);
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    for( const Int k : { Int(1), n } )
+    {
+        for( const Real alpha : { Real(3), Real(-1)/Real(2) } )
+        {
+            DistMatrix<Field> T( A ), V(grid), B( A );
+            Cholesky( uplo, T );
+            Uniform( V, m, k );
+            V *= Field(1)/Sqrt(Field(m)*Field(k));
+            Herk( uplo, NORMAL, alpha, V, Real(1), B );
+            CholeskyMod( uplo, T, alpha, V );
+            CheckAgainstRefactor
+            ( uplo, T, B, BuildString("Rank-",k," mod with alpha=",alpha) );
+        }
+    }
+
+    DistMatrix<Field> T( A ), B( A );
+    Cholesky( uplo, T );
+    {
+        DistCholeskyModQueue<Field> queue( uplo, T, maxRank );
+        for( Int push=0; push<numPushes; ++push )
+        {
+            const Int k = ( push == numPushes/2 ? maxRank+1 : 1+push%2 );
+            const Real alpha =
+              ( push % 3 == 2 ? Real(-1)/Real(2*numPushes) : Real(1) );
+            DistMatrix<Field> V(grid);
+            Uniform( V, m, k );
+            V *= Field(1)/Sqrt(Field(m)*Field(k));
+            Herk( uplo, NORMAL, alpha, V, Real(1), B );
+            queue.Push( alpha, V );
+        }
+        queue.Flush();
+        if( queue.NumPendingUpdates() != 0 || queue.NumPendingDowndates() != 0 )
+            LogicError("The queue was not emptied by Flush");
+    }
+    CheckAgainstRefactor( uplo, T, B, "Queued mods" );
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    const mpi::Comm& comm = mpi::COMM_WORLD;
 
     try
     {
@@ -199,7 +350,9 @@ main( int argc, char* argv[] )
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int m = Input("--m","height of matrix",100);
         const Int n = Input("--n","rank of update",5);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const Int maxRank = Input("--maxRank","rank of the mod queue",4);
+        const Int numPushes = Input("--numPushes","number of queued mods",12);
         const double alpha = Input("--alpha","update scaling",3.);
         const bool sequential =
           Input("--sequential","test sequential?",true);
@@ -219,12 +372,12 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid g( comm, gridHeight, order );
+        const Grid g( mpi::NewWorldComm(), gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
         ComplainIfDebug();
 
-        if( sequential && mpi::Rank() == 0 )
+        if( sequential && mpi::Rank(comm) == 0 )
         {
             TestCholeskyMod<float>
             ( uplo, m, n, alpha, correctness, print );
@@ -236,6 +389,13 @@ main( int argc, char* argv[] )
             TestCholeskyMod<Complex<double>>
             ( uplo, m, n, alpha, correctness, print );
 
+            TestAgainstRefactor<float>( uplo, m, n, maxRank, numPushes );
+            TestAgainstRefactor<Complex<float>>
+            ( uplo, m, n, maxRank, numPushes );
+            TestAgainstRefactor<double>( uplo, m, n, maxRank, numPushes );
+            TestAgainstRefactor<Complex<double>>
+            ( uplo, m, n, maxRank, numPushes );
+
 #ifdef EL_HAVE_QD
             TestCholeskyMod<DoubleDouble>
             ( uplo, m, n, alpha, correctness, print );
@@ -273,6 +433,13 @@ main( int argc, char* argv[] )
         TestCholeskyMod<Complex<double>>
         ( g, uplo, m, n, alpha, correctness, print );
 
+        TestAgainstRefactor<float>( g, uplo, m, n, maxRank, numPushes );
+        TestAgainstRefactor<Complex<float>>
+        ( g, uplo, m, n, maxRank, numPushes );
+        TestAgainstRefactor<double>( g, uplo, m, n, maxRank, numPushes );
+        TestAgainstRefactor<Complex<double>>
+        ( g, uplo, m, n, maxRank, numPushes );
+
 #ifdef EL_HAVE_QD
         TestCholeskyMod<DoubleDouble>
         ( g, uplo, m, n, alpha, correctness, print );
@@ -92,18 +92,117 @@ void TestQR
     PopIndent();
 }
 
+// Form A = X diag(sigma) Y^H, where X and Y have orthonormal columns and the
+// singular values are logarithmically spaced in [1/kappa,1]
+template<typename F>
+void KnownSpectrum( DistMatrix<F,VC,STAR>& A, Int m, Int n, Base<F> kappa )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<F,VC,STAR> X(g), Y(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    DistMatrix<Real,STAR,STAR> sigma(g);
+    Gaussian( X, m, n );
+    qr::ExplicitTS( X, R );
+    Gaussian( Y, n, n );
+    qr::ExplicitTS( Y, R );
+    sigma.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real theta = ( n == 1 ? Real(0) : Real(j)/Real(n-1) );
+        sigma.SetLocal( j, 0, Pow( kappa, -theta ) );
+    }
+    DiagonalScale( RIGHT, NORMAL, sigma, X );
+    DistMatrix<F,STAR,STAR> Y_STAR_STAR( Y );
+    A.Resize( m, n );
+    LocalGemm( NORMAL, ADJOINT, F(1), X, Y_STAR_STAR, F(0), A );
+}
+
+// Check || I - Q^H Q ||_F and || A - Q R ||_F / || A ||_F
+template<typename F>
+void CheckQR2
+( const Matrix<F>& Q, const Matrix<F>& R, const Matrix<F>& A,
+  const string& label, const mpi::Comm& comm )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real tol = 10*m*limits::Epsilon<Real>();
+    Matrix<F> Z;
+    Identity( Z, n, n );
+    Herk( UPPER, ADJOINT, Real(-1), Q, Real(1), Z );
+    const Real orthogError = HermitianFrobeniusNorm( UPPER, Z );
+    Matrix<F> E( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, R, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( A );
+    OutputFromRoot
+    (comm,label,": || I - Q^H Q ||_F = ",orthogError,
+     ", || A - Q R ||_F / || A ||_F = ",relError);
+    if( orthogError > tol || relError > tol )
+        LogicError(label,": unacceptably inaccurate CholeskyQR2");
+}
+
+// CholeskyQR2 of a well-conditioned matrix and of one too ill-conditioned
+// for unshifted Cholesky QR, which must be factored by the shifted variant
+template<typename F>
+void TestCholeskyQR2( const Grid& g, Int m, Int n )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing CholeskyQR2 with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    // The second condition number exceeds the 1/sqrt(eps) which unshifted
+    // Cholesky QR accepts, but is small enough that a single shifted pass
+    // leaves a matrix which CholeskyQR2 can orthonormalize
+    for( const Real kappa : { Real(10), Pow(eps,Real(-5)/Real(8)) } )
+    {
+        const bool illConditioned = ( kappa > Real(1)/Sqrt(eps) );
+        const string label =
+          ( illConditioned ? "Ill-conditioned" : "Well-conditioned" );
+        DistMatrix<F,VC,STAR> A(g), Q(g);
+        DistMatrix<F,STAR,STAR> R(g);
+        KnownSpectrum( A, m, n, kappa );
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+
+        // Without the shift, the ill-conditioned Gram matrix is rejected
+        CholeskyQRCtrl<Real> ctrl;
+        ctrl.allowShift = false;
+        Q = A;
+        bool rejected = false;
+        try { qr::CholeskyQR2( Q, R, ctrl ); }
+        catch( NonHPDMatrixException& ) { rejected = true; }
+        if( rejected != illConditioned )
+            LogicError(label,": the unshifted Gram matrix was ",
+                       rejected ? "rejected" : "accepted");
+
+        Q = A;
+        qr::CholeskyQR2( Q, R );
+        DistMatrix<F,STAR,STAR> Q_STAR_STAR( Q );
+        CheckQR2
+        ( Q_STAR_STAR.Matrix(), R.Matrix(), A_STAR_STAR.Matrix(),
+          label+" distributed", g.Comm() );
+
+        Matrix<F> QSeq( A_STAR_STAR.Matrix() ), RSeq;
+        qr::CholeskyQR2( QSeq, RSeq );
+        CheckQR2
+        ( QSeq, RSeq, A_STAR_STAR.Matrix(), label+" sequential", g.Comm() );
+    }
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
 
     try
     {
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
-        const Int n = Input("--width","width of matrix",100);
+        const Int n = Input("--width","width of matrix",20);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int mQR2 = Input("--heightQR2","height for CholeskyQR2",200);
+        const Int nQR2 = Input("--widthQR2","width for CholeskyQR2",20);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -118,7 +217,7 @@ main( int argc, char* argv[] )
 #endif
 
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid g( comm, order );
+        const Grid g( mpi::NewWorldComm(), order );
         SetBlocksize( nb );
         ComplainIfDebug();
 
@@ -128,6 +227,11 @@ main( int argc, char* argv[] )
         TestQR<double>( g, m, n, testCorrectness, print );
         TestQR<Complex<double>>( g, m, n, testCorrectness, print );
 
+        TestCholeskyQR2<float>( g, mQR2, nQR2 );
+        TestCholeskyQR2<Complex<float>>( g, mQR2, nQR2 );
+        TestCholeskyQR2<double>( g, mQR2, nQR2 );
+        TestCholeskyQR2<Complex<double>>( g, mQR2, nQR2 );
+
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>( g, m, n, testCorrectness, print );
         TestQR<QuadDouble>( g, m, n, testCorrectness, print );
@@ -31,12 +31,14 @@ void TestCorrectness
     Output("||Q^H Q - I||_oo / (eps n) = ",relOrthogError);
 
     // X := A Q
+    Matrix<F> AHerm( AOrig );
+    MakeHermitian( uplo, AHerm );
     Zeros( X, n, k );
-    Hemm( LEFT, uplo, F(1), AOrig, Q, F(0), X );
+    Gemm( NORMAL, NORMAL, F(1), AHerm, Q, F(0), X );
     // Find the residual ||X-QW||_oo = ||AQ-QW||_oo
     Matrix<F> QW( Q );
     DiagonalScale( RIGHT, NORMAL, w, QW );
-    X -= QW;
+    Axpy( F(-1), QW, X );
     const Real oneNormA = HermitianOneNorm( uplo, AOrig );
     if( oneNormA == Real(0) )
         LogicError("Tried to test relative accuracy on zero matrix...");
@@ -74,13 +76,15 @@ void TestCorrectness
     OutputFromRoot(g.Comm(),"||Q^H Q - I||_oo / (eps n) = ",relOrthogError);
 
     // X := A Q
+    DistMatrix<F> AHerm( AOrig );
+    MakeHermitian( uplo, AHerm );
     X.AlignWith( Q );
     Zeros( X, n, k );
-    Hemm( LEFT, uplo, F(1), AOrig, Q, F(0), X );
+    Gemm( NORMAL, NORMAL, F(1), AHerm, Q, F(0), X );
     // Find the residual ||X-QW||_oo = ||AQ-QW||_oo
     DistMatrix<F> QW( Q );
     DiagonalScale( RIGHT, NORMAL, w, QW );
-    X -= QW;
+    Axpy( F(-1), QW, X );
     const Real oneNormA = HermitianOneNorm( uplo, AOrig );
     if( oneNormA == Real(0) )
         LogicError("Tried to test relative accuracy on zero matrix...");
@@ -187,6 +191,54 @@ void TestHermitianEig
     PopIndent();
 }
 
+// The eigenvalues from the distributed divide-and-conquer eigensolver should
+// match those of the sequential one and those of the tridiagonal QR
+// algorithm (which is used when only eigenvalues are requested)
+template<typename F>
+void TestAgainstSequential
+( Int m,
+  UpperOrLower uplo,
+  bool clustered,
+  const Grid& g,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot
+    (g.Comm(),"Comparing with the sequential solver with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), Q(g);
+    DistMatrix<Real,STAR,STAR> w(g);
+    if( clustered )
+        Wilkinson( A, m/2 );
+    else
+        HermitianUniformSpectrum( A, m, -10, 10 );
+    const Int n = A.Height();
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    const Real oneNormA = HermitianOneNorm( uplo, A_STAR_STAR.Matrix() );
+    HermitianEig( uplo, A, w, Q, ctrl );
+
+    Matrix<F> ASeq( A_STAR_STAR.Matrix() ), QSeq;
+    Matrix<Real> wSeq, wQR;
+    HermitianEig( uplo, ASeq, wSeq, QSeq, ctrl );
+    ASeq = A_STAR_STAR.Matrix();
+    HermitianEig( uplo, ASeq, wQR, ctrl );
+
+    Matrix<Real> wDiff( w.Matrix() );
+    Axpy( Real(-1), wSeq, wDiff );
+    const Real seqError = MaxNorm( wDiff ) / (n*eps*oneNormA);
+    wDiff = w.Matrix();
+    Axpy( Real(-1), wQR, wDiff );
+    const Real qrError = MaxNorm( wDiff ) / (n*eps*oneNormA);
+    OutputFromRoot
+    (g.Comm(),"||w - w_seq||_oo / (eps n ||A||_1) = ",seqError,
+     ", ||w - w_QR||_oo / (eps n ||A||_1) = ",qrError);
+    if( seqError > Real(10) || qrError > Real(10) )
+        LogicError("The distributed eigenvalues differed from the sequential");
+    PopIndent();
+}
+
 template<typename F>
 void TestSuite
 ( Int m,
@@ -216,6 +268,7 @@ void TestSuite
     HermitianEigCtrl<F> ctrl;
     ctrl.timeStages = ctrlDbl.timeStages;
     ctrl.useScaLAPACK = ctrlDbl.useScaLAPACK;
+    ctrl.bandwidth = ctrlDbl.bandwidth;
     ctrl.tridiagCtrl.symvCtrl.bsize =
       ctrlDbl.tridiagCtrl.symvCtrl.bsize;
     ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv =
@@ -224,6 +277,7 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.tridiagEigCtrl.dcCtrl.cutoff = ctrlDbl.tridiagEigCtrl.dcCtrl.cutoff;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -253,6 +307,9 @@ void TestSuite
         OutputFromRoot(g.Comm(),"Nonstandard distributions:");
         TestHermitianEig<F,MR,MC,MC>
         ( m, uplo, onlyEigvals, clustered, correctness, print, g, ctrl );
+
+        if( correctness && !onlyEigvals )
+            TestAgainstSequential<F>( m, uplo, clustered, g, ctrl );
     }
 
     PopIndent();
@@ -262,7 +319,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    const mpi::Comm& comm = mpi::COMM_WORLD;
 
     try
     {
@@ -285,11 +342,15 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for nb)",16);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv based Symv",true);
         const bool useScaLAPACK =
           Input("--useScaLAPACK","test ScaLAPACK?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const Int dcCutoff =
+          Input("--dcCutoff","height at which D&C stops recursing",16);
         const bool sequential =
           Input("--sequential","test sequential?",true);
         const bool distributed =
@@ -307,7 +368,7 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid g( comm, gridHeight, order );
+        const Grid g( mpi::NewWorldComm(), gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         const auto alg = static_cast<HermitianTridiagEigAlg>(algInt);
         SetBlocksize( nb );
@@ -338,12 +399,14 @@ main( int argc, char* argv[] )
         HermitianEigCtrl<double> ctrl;
         ctrl.timeStages = timeStages;
         ctrl.useScaLAPACK = useScaLAPACK;
+        ctrl.bandwidth = bandwidth;
         ctrl.tridiagCtrl.symvCtrl.bsize = nbLocal;
         ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
         ctrl.tridiagEigCtrl.sort = sort;
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.tridiagEigCtrl.dcCtrl.cutoff = dcCutoff;
 
         if( testReal )
         {
@@ -0,0 +1,204 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve against well-conditioned and ill-conditioned HPD matrices with the
+// default control (whose tolerance is n eps) and check that every column
+// reaches a backward error of n eps and that the solution matches that of a
+// Cholesky solve in the original precision to within the condition number.
+// With classical refinement disabled (and no fallback), the moderately
+// ill-conditioned case must instead converge through GMRES-based refinement.
+
+// A = Z diag(w) Z^H, with Z a Haar matrix and the eigenvalues w logarithmically
+// spaced in [1/condition,1]
+template<typename Field>
+void KnownSpectrum
+( UpperOrLower uplo, Matrix<Field>& A, Int n, Base<Field> condition )
+{
+    typedef Base<Field> Real;
+    Matrix<Real> w( n, 1 );
+    for( Int i=0; i<n; ++i )
+        w(i) = Pow( condition, -Real(i)/Real(Max(n-1,1)) );
+    Matrix<Field> Z;
+    Haar( Z, n );
+    HermitianFromEVD( uplo, A, w, Z );
+    MakeHermitian( uplo, A );
+}
+
+template<typename Field>
+void KnownSpectrum
+( UpperOrLower uplo, DistMatrix<Field>& A, Int n, Base<Field> condition )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Real,STAR,STAR> w( n, 1, A.Grid() );
+    for( Int i=0; i<n; ++i )
+        w.SetLocal( i, 0, Pow( condition, -Real(i)/Real(Max(n-1,1)) ) );
+    DistMatrix<Field> Z( A.Grid() );
+    Haar( Z, n );
+    HermitianFromEVD( uplo, A, w, Z );
+    MakeHermitian( uplo, A );
+}
+
+template<typename Real>
+MixedPrecisionHPDSolveCtrl<Real> SolveCtrl( bool gmresOnly )
+{
+    MixedPrecisionHPDSolveCtrl<Real> ctrl;
+    if( gmresOnly )
+    {
+        ctrl.maxRefineIts = 0;
+        ctrl.fallback = false;
+    }
+    return ctrl;
+}
+
+template<typename Field>
+void CheckInfo
+( const MixedPrecisionHPDSolveInfo<Base<Field>>& info, Int n,
+  Base<Field> condition, bool gmresOnly, bool print )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const string label =
+      ( gmresOnly ? "GMRES-refined solve" : "Mixed-precision solve" );
+    if( print )
+        Output
+        (label,": ",info.refineIts," refinement steps, ",info.gmresRefineIts,
+         " GMRES refinement steps (",info.gmresIts," iterations), ",
+         (info.fellBack ? "fell back, " : ""),"backward error of ",
+         info.backwardError);
+    if( !info.converged )
+        LogicError(label," did not converge");
+    if( info.backwardError > n*eps )
+        LogicError
+        (label," had a backward error of ",info.backwardError," > n eps");
+
+    // A single-precision factorization is far more than enough for a
+    // condition number of 10, but cannot resolve one of 1e10, which is
+    // beyond the reciprocal of the single-precision epsilon
+    if( condition <= Real(10) && info.fellBack )
+        LogicError(label," fell back for a well-conditioned matrix");
+    if( condition >= Real(1e10) && !info.fellBack )
+        LogicError(label," did not fall back for an ill-conditioned matrix");
+    if( gmresOnly && (info.refineIts != 0 || info.gmresRefineIts == 0 ||
+                      info.gmresIts == 0) )
+        LogicError(label," did not take its corrections from GMRES");
+}
+
+template<typename Field>
+void TestSequential
+( UpperOrLower uplo, Int n, Int numRHS, Base<Field> condition,
+  bool gmresOnly=false )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Output
+    ("Testing sequential ",(gmresOnly?"GMRES-refined ":""),"solve with ",
+     TypeName<Field>()," and condition ",condition);
+    PushIndent();
+
+    Matrix<Field> A, B, X, XRef;
+    KnownSpectrum( uplo, A, n, condition );
+    Uniform( B, n, numRHS );
+    X = B;
+    const auto info =
+      MixedPrecisionHPDSolve( uplo, NORMAL, A, X, SolveCtrl<Real>(gmresOnly) );
+    CheckInfo<Field>( info, n, condition, gmresOnly, true );
+
+    XRef = B;
+    HPDSolve( uplo, NORMAL, A, XRef );
+    Axpy( Field(-1), XRef, X );
+    const Real relDiff = FrobeniusNorm( X ) / FrobeniusNorm( XRef );
+    Output("|| X - XRef ||_F / || XRef ||_F = ",relDiff);
+    if( relDiff > Real(10)*condition*n*eps )
+        LogicError("The mixed-precision solution differed by ",relDiff);
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed
+( const Grid& g, UpperOrLower uplo, Int n, Int numRHS, Base<Field> condition,
+  bool gmresOnly=false )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot
+    (g.Comm(),"Testing distributed ",(gmresOnly?"GMRES-refined ":""),
+     "solve with ",TypeName<Field>()," and condition ",condition);
+    PushIndent();
+
+    DistMatrix<Field> A(g), B(g), X(g), XRef(g);
+    KnownSpectrum( uplo, A, n, condition );
+    Uniform( B, n, numRHS );
+    X = B;
+    const auto info =
+      MixedPrecisionHPDSolve( uplo, NORMAL, A, X, SolveCtrl<Real>(gmresOnly) );
+    CheckInfo<Field>( info, n, condition, gmresOnly, g.Rank() == 0 );
+
+    XRef = B;
+    HPDSolve( uplo, NORMAL, A, XRef );
+    Axpy( Field(-1), XRef, X );
+    const Real relDiff = FrobeniusNorm( X ) / FrobeniusNorm( XRef );
+    OutputFromRoot(g.Comm(),"|| X - XRef ||_F / || XRef ||_F = ",relDiff);
+    if( relDiff > Real(10)*condition*n*eps )
+        LogicError("The mixed-precision solution differed by ",relDiff);
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int n = Input("--n","size of HPD matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+        const Grid g( mpi::NewWorldComm() );
+        ComplainIfDebug();
+
+        // The second condition number requires several refinement steps,
+        // while the third is beyond the reach of a single-precision
+        // factorization, so that the solver must fall back to a
+        // double-precision factorization
+        for( const double condition : { 10., 1.e6, 1.e10 } )
+        {
+            if( sequential && g.Rank() == 0 )
+            {
+                TestSequential<double>( uplo, n, numRHS, condition );
+                TestSequential<Complex<double>>( uplo, n, numRHS, condition );
+            }
+            TestDistributed<double>( g, uplo, n, numRHS, condition );
+            TestDistributed<Complex<double>>( g, uplo, n, numRHS, condition );
+        }
+
+        // Without classical refinement, the second condition number must be
+        // handled by GMRES-based refinement preconditioned by the
+        // single-precision factorization
+        const double condition = 1.e6;
+        if( sequential && g.Rank() == 0 )
+        {
+            TestSequential<double>( uplo, n, numRHS, condition, true );
+            TestSequential<Complex<double>>
+            ( uplo, n, numRHS, condition, true );
+        }
+        TestDistributed<double>( g, uplo, n, numRHS, condition, true );
+        TestDistributed<Complex<double>>( g, uplo, n, numRHS, condition, true );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
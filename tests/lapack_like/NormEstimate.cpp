@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form A = X diag(sigma) Y^H, where X and Y have orthonormal columns and the
+// singular values are linearly spaced in [1/kappa,1]
+template<typename F>
+void KnownSpectrum
+( DistMatrix<F>& A, Int m, Int n, Base<F> kappa, bool hermitian )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<F,VC,STAR> X(g), Y(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    DistMatrix<Real,STAR,STAR> sigma(g);
+    Gaussian( X, m, minDim );
+    qr::ExplicitTS( X, R );
+    if( hermitian )
+        Y = X;
+    else
+    {
+        Gaussian( Y, n, minDim );
+        qr::ExplicitTS( Y, R );
+    }
+    sigma.Resize( minDim, 1 );
+    for( Int j=0; j<minDim; ++j )
+    {
+        const Real theta = ( minDim == 1 ? Real(0) : Real(j)/Real(minDim-1) );
+        sigma.SetLocal( j, 0, 1 - theta*(1-1/kappa) );
+    }
+    auto XScaled( X );
+    DiagonalScale( RIGHT, NORMAL, sigma, XScaled );
+    Gemm( NORMAL, ADJOINT, F(1), XScaled, Y, A );
+}
+
+template<typename F>
+void TestEstimates
+( const Grid& g,
+  Int m,
+  Int n,
+  Base<F> kappa,
+  Int blockSize,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    const Real tol = Pow( limits::Epsilon<Real>(), Real(1)/Real(2) );
+
+    DistMatrix<F> A(g);
+    KnownSpectrum( A, m, n, kappa, false );
+    if( print )
+        Print( A, "A" );
+    TwoNormEstimateCtrl<Real> ctrl;
+    ctrl.tol = tol;
+    for( auto alg : { TWO_NORM_EST_LANCZOS, TWO_NORM_EST_POWER } )
+    {
+        ctrl.alg = alg;
+        ctrl.blockSize = ( alg == TWO_NORM_EST_POWER ? blockSize : 1 );
+        Timer timer;
+        timer.Start();
+        const Real estimate = TwoNormEstimate( A, ctrl );
+        const double runTime = timer.Stop();
+        const Real relError = Abs(estimate-Real(1));
+        OutputFromRoot
+        (g.Comm(),(alg==TWO_NORM_EST_LANCZOS ? "Lanczos" : "Block power"),
+         " two-norm estimate: ",estimate," (relative error ",relError,
+         ") in ",runTime," seconds");
+        if( estimate > Real(1) + 100*limits::Epsilon<Real>() )
+            LogicError("Two-norm estimate was not a lower bound");
+        if( relError > Sqrt(tol) )
+            LogicError("Unacceptably inaccurate two-norm estimate");
+    }
+
+    // The overloads which take a tolerance directly stop once successive
+    // estimates differ by at most tol max(m,n), regardless of the scale of A,
+    // so that a tiny matrix converges immediately
+    {
+        auto ATiny( A );
+        ATiny *= Real(1)/Real(1000);
+        const Real legacyTol = Real(1)/Real(100);
+        const Real estimate = TwoNormEstimate( ATiny, legacyTol, 2 );
+        OutputFromRoot
+        (g.Comm(),"Absolute-tolerance estimate of a scaled matrix: ",estimate);
+        if( estimate > Real(1)/Real(1000) + 100*limits::Epsilon<Real>() )
+            LogicError("Two-norm estimate was not a lower bound");
+    }
+
+    // Form a Hermitian positive-definite matrix with two-norm condition
+    // number kappa
+    DistMatrix<F> H(g);
+    KnownSpectrum( H, n, n, kappa, true );
+    ctrl.alg = TWO_NORM_EST_LANCZOS;
+    const Real twoCond = HPDTwoConditionEstimate( LOWER, H, ctrl );
+    const Real twoCondError = Abs(twoCond-kappa) / kappa;
+    OutputFromRoot
+    (g.Comm(),"Two-norm condition estimate: ",twoCond,
+     " (relative error ",twoCondError,")");
+    if( twoCondError > Sqrt(tol) )
+        LogicError("Unacceptably inaccurate two-norm condition estimate");
+
+    // Compare the one-norm estimate against the explicit inverse
+    const Real oneCond = HPDOneConditionEstimate( LOWER, H );
+    DistMatrix<F> HInv(g);
+    auto HChol( H );
+    Cholesky( LOWER, HChol );
+    Identity( HInv, n, n );
+    cholesky::SolveAfter( LOWER, NORMAL, HChol, HInv );
+    const Real oneCondExact = OneNorm( H )*OneNorm( HInv );
+    OutputFromRoot
+    (g.Comm(),"One-norm condition estimate: ",oneCond," (exact ",
+     oneCondExact,")");
+    // Hager's method only guarantees a lower bound, but is rarely off by more
+    // than a factor of three
+    if( oneCond > oneCondExact*(1+Sqrt(tol)) || 3*oneCond < oneCondExact )
+        LogicError("Unacceptably inaccurate one-norm condition estimate");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",100);
+        const double kappa = Input("--kappa","condition number",100.);
+        const Int blockSize =
+          Input("--blockSize","block size for the power method",4);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestEstimates<float>( g, m, n, kappa, blockSize, print );
+        TestEstimates<Complex<float>>( g, m, n, kappa, blockSize, print );
+        TestEstimates<double>( g, m, n, kappa, blockSize, print );
+        TestEstimates<Complex<double>>( g, m, n, kappa, blockSize, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
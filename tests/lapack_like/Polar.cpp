@@ -0,0 +1,293 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form A = X diag(sigma) Y^H, where X and Y have orthonormal columns and the
+// singular values are logarithmically spaced in [1/kappa,1]. If hermitian is
+// true, then Y = X and every other sign of sigma is flipped.
+template<typename F>
+void KnownSpectrum
+( DistMatrix<F>& A, Int m, Int n, Base<F> kappa, bool hermitian )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<F,VC,STAR> X(g), Y(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    DistMatrix<Real,STAR,STAR> sigma(g);
+    Gaussian( X, m, minDim );
+    qr::ExplicitTS( X, R );
+    if( hermitian )
+        Y = X;
+    else
+    {
+        Gaussian( Y, n, minDim );
+        qr::ExplicitTS( Y, R );
+    }
+    sigma.Resize( minDim, 1 );
+    for( Int j=0; j<minDim; ++j )
+    {
+        const Real theta = ( minDim == 1 ? Real(0) : Real(j)/Real(minDim-1) );
+        const Real value = Pow( kappa, -theta );
+        sigma.SetLocal( j, 0, ( hermitian && j % 2 ? -value : value ) );
+    }
+    auto XScaled( X );
+    DiagonalScale( RIGHT, NORMAL, sigma, XScaled );
+    Gemm( NORMAL, ADJOINT, F(1), XScaled, Y, A );
+}
+
+template<typename F>
+Base<F> OrthogonalityError( const DistMatrix<F>& Q )
+{
+    DistMatrix<F> Z( Q.Grid() );
+    Identity( Z, Q.Width(), Q.Width() );
+    Gemm( ADJOINT, NORMAL, F(-1), Q, Q, F(1), Z );
+    return FrobeniusNorm( Z );
+}
+
+template<typename F>
+void TestPolar
+( const Grid& g,
+  Int m,
+  Int n,
+  Base<F> kappa,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 100*Max(m,n)*eps;
+
+    DistMatrix<F> A(g), Q(g), P(g);
+    KnownSpectrum( A, m, n, kappa, false );
+    if( print )
+        Print( A, "A" );
+    const Real frobA = FrobeniusNorm( A );
+
+    // Distributed matrices default to QDWH
+    Q = A;
+    Timer timer;
+    timer.Start();
+    auto info = Polar( Q, P );
+    const double runTime = timer.Stop();
+    OutputFromRoot
+    (g.Comm(),"QDWH: ",info.qdwhInfo.numIts," iterations (",
+     info.qdwhInfo.numQRIts," QR, ",info.qdwhInfo.numCholIts,
+     " Cholesky) in ",runTime," seconds");
+    if( info.qdwhInfo.numIts == 0 )
+        LogicError("The distributed polar decomposition did not use QDWH");
+    const Real orthError = OrthogonalityError( Q );
+    Gemm( NORMAL, NORMAL, F(-1), Q, P, F(1), A );
+    const Real relError = FrobeniusNorm( A ) / frobA;
+    OutputFromRoot
+    (g.Comm(),"|| I - Q^H Q ||_F = ",orthError,
+     ", || A - Q P ||_F / || A ||_F = ",relError);
+    if( orthError > tol || relError > tol )
+        LogicError("Unacceptably inaccurate polar decomposition");
+
+    // The gathered SVD must be requested, and should agree with QDWH on
+    // A = (A - Q P) + Q P
+    PolarCtrl svdCtrl;
+    svdCtrl.gatherSVD = true;
+    DistMatrix<F> QSVD( A );
+    Gemm( NORMAL, NORMAL, F(1), Q, P, F(1), QSVD );
+    info = Polar( QSVD, svdCtrl );
+    if( info.qdwhInfo.numIts != 0 )
+        LogicError("The gathered SVD was not used");
+    QSVD -= Q;
+    const Real svdError = FrobeniusNorm( QSVD ) / Sqrt(Real(n));
+    OutputFromRoot(g.Comm(),"|| Q_SVD - Q ||_F / sqrt(n) = ",svdError);
+    if( svdError > Sqrt(tol) )
+        LogicError("The SVD and QDWH polar factors differed");
+
+    // The Hermitian polar decomposition of an indefinite matrix yields its sign
+    DistMatrix<F> H(g), S(g), N(g);
+    KnownSpectrum( H, n, n, kappa, true );
+    const Real frobH = FrobeniusNorm( H );
+    S = H;
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    info = HermitianPolar( LOWER, S, N, polarCtrl );
+    OutputFromRoot
+    (g.Comm(),"Hermitian QDWH: ",info.qdwhInfo.numIts," iterations (",
+     info.qdwhInfo.numQRIts," QR, ",info.qdwhInfo.numCholIts," Cholesky)");
+    const Real hermOrthError = OrthogonalityError( S );
+    MakeHermitian( LOWER, N );
+    DistMatrix<F> E( H );
+    Gemm( NORMAL, NORMAL, F(-1), S, N, F(1), E );
+    const Real hermRelError = FrobeniusNorm( E ) / frobH;
+    OutputFromRoot
+    (g.Comm(),"|| I - S^H S ||_F = ",hermOrthError,
+     ", || H - S N ||_F / || H ||_F = ",hermRelError);
+    // Since the eigenvalues of H alternate in sign, its sign is only computed
+    // to an accuracy proportional to kappa eps, and the Hermitian iteration
+    // (which symmetrizes every iterate) inherits this in its residual
+    const Real hermTol = Max( tol, 10*kappa*eps );
+    if( hermOrthError > tol || hermRelError > hermTol )
+        LogicError("Unacceptably inaccurate Hermitian polar decomposition");
+
+    // The Newton iteration for the sign should agree with QDWH
+    DistMatrix<F> SNewton( H );
+    const auto signInfo = Sign( SNewton );
+    OutputFromRoot
+    (g.Comm(),"Sign: ",signInfo.numIts," iterations (",
+     signInfo.numNewtonSchulzIts," Newton-Schulz)");
+    if( signInfo.numNewtonSchulzIts == 0 )
+        LogicError("The sign iteration never switched to Newton-Schulz");
+    SNewton -= S;
+    const Real signError = FrobeniusNorm( SNewton ) / Sqrt(Real(n));
+    OutputFromRoot(g.Comm(),"|| sign(H) - S ||_F / sqrt(n) = ",signError);
+    if( signError > Sqrt(tol) )
+        LogicError("Unacceptably inaccurate matrix sign");
+
+    // The (unstable) Newton iteration for the square root is only reliable for
+    // well-conditioned matrices, so test it on M^2, where M = I + N
+    DistMatrix<F> M( N ), MSquared(g), MRoot(g);
+    ShiftDiagonal( M, F(1) );
+    Gemm( NORMAL, NORMAL, F(1), M, M, MSquared );
+    MRoot = MSquared;
+    SquareRoot( MRoot );
+    MRoot -= M;
+    const Real rootError = FrobeniusNorm( MRoot ) / FrobeniusNorm( M );
+    OutputFromRoot
+    (g.Comm(),"|| sqrt(M^2) - M ||_F / || M ||_F = ",rootError);
+    if( rootError > tol )
+        LogicError("Unacceptably inaccurate matrix square root");
+    PopIndent();
+}
+
+// The sequential drivers, on the same matrices gathered onto each process
+template<typename F>
+void TestSequential
+( const Grid& g,
+  Int m,
+  Int n,
+  Base<F> kappa )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing sequential drivers with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 100*Max(m,n)*eps;
+
+    DistMatrix<F> ADist(g), HDist(g);
+    KnownSpectrum( ADist, m, n, kappa, false );
+    KnownSpectrum( HDist, n, n, kappa, true );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( ADist ), H_STAR_STAR( HDist );
+    const Matrix<F>& A = A_STAR_STAR.Matrix();
+    const Matrix<F>& H = H_STAR_STAR.Matrix();
+
+    // QDWH
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    Matrix<F> Q( A ), P, Z, E;
+    auto info = Polar( Q, P, polarCtrl );
+    OutputFromRoot
+    (g.Comm(),"QDWH: ",info.qdwhInfo.numIts," iterations (",
+     info.qdwhInfo.numQRIts," QR, ",info.qdwhInfo.numCholIts," Cholesky)");
+    if( info.qdwhInfo.numIts == 0 )
+        LogicError("QDWH was not used");
+    Identity( Z, n, n );
+    Gemm( ADJOINT, NORMAL, F(-1), Q, Q, F(1), Z );
+    const Real orthError = FrobeniusNorm( Z );
+    E = A;
+    Gemm( NORMAL, NORMAL, F(-1), Q, P, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( A );
+    OutputFromRoot
+    (g.Comm(),"|| I - Q^H Q ||_F = ",orthError,
+     ", || A - Q P ||_F / || A ||_F = ",relError);
+    if( orthError > tol || relError > tol )
+        LogicError("Unacceptably inaccurate sequential QDWH");
+
+    // The default SVD
+    Matrix<F> QSVD( A );
+    Polar( QSVD );
+    Axpy( F(-1), Q, QSVD );
+    const Real svdError = FrobeniusNorm( QSVD ) / Sqrt(Real(n));
+    OutputFromRoot(g.Comm(),"|| Q_SVD - Q ||_F / sqrt(n) = ",svdError);
+    if( svdError > Sqrt(tol) )
+        LogicError("The sequential SVD and QDWH polar factors differed");
+
+    // The sign with and without the switch to Newton-Schulz, which should
+    // agree with the sign from the EVD
+    Matrix<F> S( H ), SNewton( H ), SEig( H );
+    const auto signInfo = Sign( S );
+    SignCtrl<Real> newtonCtrl;
+    newtonCtrl.newtonSchulz = false;
+    const auto newtonInfo = Sign( SNewton, newtonCtrl );
+    OutputFromRoot
+    (g.Comm(),"Sign: ",signInfo.numIts," iterations (",
+     signInfo.numNewtonSchulzIts," Newton-Schulz), ",newtonInfo.numIts,
+     " without Newton-Schulz");
+    if( signInfo.numNewtonSchulzIts == 0 )
+        LogicError("The sign iteration never switched to Newton-Schulz");
+    if( newtonInfo.numNewtonSchulzIts != 0 )
+        LogicError("The sign iteration switched to Newton-Schulz anyway");
+    HermitianSign( LOWER, SEig );
+    MakeHermitian( LOWER, SEig );
+    Axpy( F(-1), SEig, S );
+    Axpy( F(-1), SEig, SNewton );
+    const Real signError = FrobeniusNorm( S ) / Sqrt(Real(n));
+    const Real newtonError = FrobeniusNorm( SNewton ) / Sqrt(Real(n));
+    OutputFromRoot
+    (g.Comm(),"|| sign(H) - S_EVD ||_F / sqrt(n) = ",signError," (",newtonError,
+     " without Newton-Schulz)");
+    if( signError > Sqrt(tol) || newtonError > Sqrt(tol) )
+        LogicError("Unacceptably inaccurate sequential matrix sign");
+
+    // The square root of M^2, where M = I + |H|
+    Matrix<F> M( H ), MSquared, MRoot;
+    HermitianPolar( LOWER, M, P );
+    MakeHermitian( LOWER, P );
+    M = P;
+    ShiftDiagonal( M, F(1) );
+    Gemm( NORMAL, NORMAL, F(1), M, M, MSquared );
+    MRoot = MSquared;
+    SquareRoot( MRoot );
+    Axpy( F(-1), M, MRoot );
+    const Real rootError = FrobeniusNorm( MRoot ) / FrobeniusNorm( M );
+    OutputFromRoot(g.Comm(),"|| sqrt(M^2) - M ||_F / || M ||_F = ",rootError);
+    if( rootError > tol )
+        LogicError("Unacceptably inaccurate sequential matrix square root");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",150);
+        const Int n = Input("--width","width of matrix",100);
+        const double kappa = Input("--kappa","condition number",1e4);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestSequential<float>( g, m, n, Min(kappa,1e3) );
+        TestSequential<Complex<float>>( g, m, n, Min(kappa,1e3) );
+        TestSequential<double>( g, m, n, kappa );
+        TestSequential<Complex<double>>( g, m, n, kappa );
+        TestPolar<float>( g, m, n, Min(kappa,1e3), print );
+        TestPolar<Complex<float>>( g, m, n, Min(kappa,1e3), print );
+        TestPolar<double>( g, m, n, kappa, print );
+        TestPolar<Complex<double>>( g, m, n, kappa, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
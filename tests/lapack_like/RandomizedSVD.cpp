@@ -0,0 +1,337 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form A = X diag(sigma) Y^H, where X and Y have orthonormal columns and the
+// singular values decay geometrically
+template<typename F>
+void GeometricSpectrum
+( DistMatrix<F>& A,
+  DistMatrix<Base<F>,STAR,STAR>& sigma,
+  Int m,
+  Int n,
+  Base<F> decay )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int minDim = Min(m,n);
+    DistMatrix<F,VC,STAR> X(g), Y(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    Gaussian( X, m, minDim );
+    qr::ExplicitTS( X, R );
+    Gaussian( Y, n, minDim );
+    qr::ExplicitTS( Y, R );
+    sigma.Resize( minDim, 1 );
+    for( Int j=0; j<minDim; ++j )
+        sigma.SetLocal( j, 0, Pow(decay,Real(j)) );
+    DiagonalScale( RIGHT, NORMAL, sigma, X );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+}
+
+// An a priori bound on || (I - Q Q^H) A ||_2 for the basis Q of the sampled
+// range, which is assumed to hold since the failure probabilities are tiny
+template<typename Real>
+Real RangeErrorBound
+( const Matrix<Real>& sigma,
+  Int m,
+  Int n,
+  Int rank,
+  const RandomizedSVDCtrl<Real>& ctrl )
+{
+    if( ctrl.adaptive )
+    {
+        // Unless 10^-blockSize luck strikes, the sampling stops once the
+        // error is below tol max_j || A omega_j ||_2, where each of the
+        // Gaussian omega_j is (overwhelmingly likely to be) shorter than
+        // 2 sqrt(n)
+        const Real tol =
+          ( ctrl.tol == Real(0) ? Sqrt(limits::Epsilon<Real>()) : ctrl.tol );
+        return 2*Sqrt(Real(n))*tol*sigma(0);
+    }
+    // With probability at least 1 - 6 p^-p [Halko, Martinsson, and Tropp,
+    // "Finding structure with randomness", Cor. 10.10],
+    //
+    //   || (I - Q Q^H) A ||_2 <=
+    //     (1 + 11 sqrt(k+p) sqrt(min(m,n)))^(1/(2q+1)) sigma_{k+1},
+    //
+    // where p is the oversampling and q the number of power iterations
+    const Int k = rank;
+    const Int p = ctrl.oversampling;
+    const Int q = ctrl.numPowerIts;
+    if( k+p >= Min(m,n) )
+        return Real(0);
+    const Real factor = 1 + 11*Sqrt(Real(k+p))*Sqrt(Real(Min(m,n)));
+    return Pow( factor, Real(1)/Real(2*q+1) )*sigma(k);
+}
+
+// Since the singular values of Q^H A are those of Q Q^H A, each computed
+// singular value lies within rangeError of the exact one (and cannot exceed
+// it), and, as the discarded singular values of Q^H A are bounded by those
+// of A, || A - U S V^H ||_2 <= sigma_{k+1} + rangeError.
+// The entries of a sequential or replicated vector
+template<typename Real>
+const Matrix<Real>& Entries( const Matrix<Real>& s ) { return s; }
+template<typename Real>
+const Matrix<Real>& Entries( const DistMatrix<Real,STAR,STAR>& s )
+{ return s.LockedMatrix(); }
+
+// || A ||_2, from the singular values of a copy of A
+template<typename F>
+Base<F> SpectralNorm( const Matrix<F>& A )
+{
+    Matrix<F> B( A );
+    Matrix<Base<F>> s( Min(A.Height(),A.Width()), 1 );
+    lapack::SVD( B.Height(), B.Width(), B.Buffer(), B.LDim(), s.Buffer() );
+    return ( s.Height() > 0 ? s(0) : Base<F>(0) );
+}
+template<typename F>
+Base<F> SpectralNorm( const DistMatrix<F>& A )
+{
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    return SpectralNorm( A_STAR_STAR.LockedMatrix() );
+}
+
+template<typename F,class MatrixType,class VectorType>
+void TestCorrectness
+( const mpi::Comm& comm,
+        MatrixType& A,
+  const MatrixType& U,
+  const VectorType& s,
+  const MatrixType& V,
+  const Matrix<Base<F>>& sigma,
+  Base<F> rangeError,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = s.Height();
+    const Int maxDim = Max(m,n);
+    const Real eps = limits::Epsilon<Real>();
+    const Real roundoff = 10*eps*maxDim*sigma(0);
+    const Real sigmaNext = ( k < sigma.Height() ? sigma(k) : Real(0) );
+    OutputFromRoot(comm,"a priori range error bound = ",rangeError);
+
+    // Form I - U^H U
+    OutputFromRoot(comm,"Testing orthogonality of U...");
+    PushIndent();
+    auto Z( U );
+    Identity( Z, k, k );
+    Gemm( ADJOINT, NORMAL, F(-1), U, U, F(1), Z );
+    const Real infOrthogUError = InfinityNorm( Z );
+    const Real relOrthogUError = infOrthogUError / (eps*maxDim);
+    OutputFromRoot
+    (comm,"||U' U - I||_oo / (eps Max(m,n)) = ",relOrthogUError);
+    PopIndent();
+
+    // Form I - V^H V
+    OutputFromRoot(comm,"Testing orthogonality of V...");
+    PushIndent();
+    Identity( Z, k, k );
+    Gemm( ADJOINT, NORMAL, F(-1), V, V, F(1), Z );
+    const Real infOrthogVError = InfinityNorm( Z );
+    const Real relOrthogVError = infOrthogVError / (eps*maxDim);
+    OutputFromRoot
+    (comm,"||V' V - I||_oo / (eps Max(m,n)) = ",relOrthogVError);
+    PopIndent();
+
+    // Compare against the exact singular values
+    OutputFromRoot(comm,"Testing the singular values...");
+    PushIndent();
+    Real maxValueError = 0, maxExcess = 0;
+    for( Int j=0; j<k; ++j )
+    {
+        const Real s_j = Entries( s )(j);
+        maxValueError = Max( maxValueError, Abs(s_j-sigma(j)) );
+        maxExcess = Max( maxExcess, s_j-sigma(j) );
+    }
+    const Real relValueError = maxValueError / (rangeError+roundoff);
+    const Real relExcess = maxExcess / roundoff;
+    OutputFromRoot
+    (comm,"max_j |s_j - sigma_j| / (bound + 10 eps Max(m,n) ||A||_2) = ",
+     relValueError);
+    OutputFromRoot
+    (comm,"max_j (s_j - sigma_j) / (10 eps Max(m,n) ||A||_2) = ",relExcess);
+    PopIndent();
+
+    // Form A - U S V^H
+    OutputFromRoot(comm,"Testing if A ~= U S V'...");
+    PushIndent();
+    auto VCopy( V );
+    DiagonalScale( RIGHT, NORMAL, s, VCopy );
+    Gemm( NORMAL, ADJOINT, F(-1), U, VCopy, F(1), A );
+    if( print )
+        Print( A, "A - U S V'" );
+    const Real twoError = SpectralNorm( A );
+    const Real relError = twoError / (sigmaNext + rangeError + roundoff);
+    OutputFromRoot
+    (comm,"||A - U S V'||_2 / (sigma_{k+1} + bound + 10 eps Max(m,n) ||A||_2) "
+     "= ",relError);
+    PopIndent();
+
+    if( relOrthogUError > Real(10) )
+        LogicError("Unacceptably large relative orthog error for U");
+    if( relOrthogVError > Real(10) )
+        LogicError("Unacceptably large relative orthog error for V");
+    if( relValueError > Real(1) )
+        LogicError("Singular values violated the range error bound");
+    if( relExcess > Real(1) )
+        LogicError("Singular values exceeded the exact ones");
+    if( relError > Real(1) )
+        LogicError("Approximation violated the range error bound");
+}
+
+template<typename F>
+void TestRandomizedSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Int rank,
+  bool adaptive,
+  bool sequential,
+  const RandomizedSVDCtrl<Base<F>>& baseCtrl,
+  bool correctness,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing ",(sequential?"sequential ":"distributed "),
+     (adaptive?"adaptive ":"fixed-rank "),"randomized SVD with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), U(g), V(g);
+    DistMatrix<Real,STAR,STAR> s(g), sigma(g);
+    GeometricSpectrum( A, sigma, m, n, Real(1)/Real(2) );
+    if( print )
+        Print( A, "A" );
+
+    auto ctrl( baseCtrl );
+    ctrl.adaptive = adaptive;
+    if( adaptive )
+        ctrl.tol = Pow( limits::Epsilon<Real>(), Real(2)/Real(3) );
+    const Real rangeError =
+      RangeErrorBound( sigma.LockedMatrix(), m, n, rank, ctrl );
+
+    if( sequential )
+    {
+        // Each process factors its own copy (with its own samples)
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+        Matrix<F> ALoc( A_STAR_STAR.Matrix() ), ULoc, VLoc;
+        Matrix<Real> sLoc;
+        OutputFromRoot(g.Comm(),"Starting sequential randomized SVD...");
+        Timer timer;
+        timer.Start();
+        RandomizedSVD( ALoc, ULoc, sLoc, VLoc, rank, ctrl );
+        const double runTime = timer.Stop();
+        OutputFromRoot(g.Comm(),"Time = ",runTime," seconds");
+        OutputFromRoot(g.Comm(),"Computed rank = ",sLoc.Height());
+        const bool printLoc = print && mpi::Rank(g.Comm()) == 0;
+        if( printLoc )
+        {
+            Print( ULoc, "U" );
+            Print( sLoc, "s" );
+            Print( VLoc, "V" );
+        }
+        if( correctness )
+            TestCorrectness<F>
+            ( g.Comm(), ALoc, ULoc, sLoc, VLoc, sigma.LockedMatrix(),
+              rangeError, printLoc );
+        PopIndent();
+        return;
+    }
+
+    OutputFromRoot(g.Comm(),"Starting randomized SVD...");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    RandomizedSVD( A, U, s, V, rank, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = timer.Stop();
+    OutputFromRoot(g.Comm(),"Time = ",runTime," seconds");
+    OutputFromRoot(g.Comm(),"Computed rank = ",s.Height());
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+    if( correctness )
+        TestCorrectness<F>
+        ( g.Comm(), A, U, s, V, sigma.LockedMatrix(),
+          rangeError, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",200);
+        const Int rank = Input("--rank","target rank",20);
+        const Int maxRank =
+          Input("--maxRank","maximum rank for adaptive mode",100);
+        const Int oversampling = Input("--oversampling","oversampling",10);
+        const Int numPowerIts =
+          Input("--numPowerIts","number of power iterations",2);
+        const Int blockSize =
+          Input("--blockSize","adaptive sample blocksize",10);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( std::move(comm), order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        OutputFromRoot(g.Comm(),"Will test RandomizedSVD");
+
+        RandomizedSVDCtrl<float> ctrlSingle;
+        ctrlSingle.oversampling = oversampling;
+        ctrlSingle.numPowerIts = numPowerIts;
+        ctrlSingle.blockSize = blockSize;
+        RandomizedSVDCtrl<double> ctrlDouble;
+        ctrlDouble.oversampling = oversampling;
+        ctrlDouble.numPowerIts = numPowerIts;
+        ctrlDouble.blockSize = blockSize;
+
+        for( bool sequential : {false,true} )
+        {
+            for( bool adaptive : {false,true} )
+            {
+                const Int r = ( adaptive ? maxRank : rank );
+                TestRandomizedSVD<float>
+                ( g, m, n, r, adaptive, sequential, ctrlSingle,
+                  correctness, print );
+                TestRandomizedSVD<Complex<float>>
+                ( g, m, n, r, adaptive, sequential, ctrlSingle,
+                  correctness, print );
+
+                TestRandomizedSVD<double>
+                ( g, m, n, r, adaptive, sequential, ctrlDouble,
+                  correctness, print );
+                TestRandomizedSVD<Complex<double>>
+                ( g, m, n, r, adaptive, sequential, ctrlDouble,
+                  correctness, print );
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -54,11 +54,77 @@ void TestCorrectness
         LogicError("Unacceptably large relative error");
 }
 
+// Apply the implicit Q and its adjoint: Q^H (Q C) must recover C, Q C must
+// match the explicit Q times C, and the least-squares solution X of
+// min || A X - B ||_F must satisfy the normal equations A^H (A X - B) = 0
+template<typename F>
+void TestImplicit
+( const DistMatrix<F,VC,STAR>& A,
+  const DistMatrix<F,VC,STAR>& Q,
+  const qr::TreeData<F>& treeData,
+  Int numRHS )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int maxDim = Max(m,n);
+    const Real eps = limits::Epsilon<Real>();
+
+    OutputFromRoot(g.Comm(),"Testing the implicit Q...");
+    PushIndent();
+    DistMatrix<F,STAR,STAR> C(g);
+    Uniform( C, n, numRHS );
+    const Real frobC = FrobeniusNorm( C );
+    DistMatrix<F,VC,STAR> B(g), BExplicit(g);
+    qr::ts::ApplyQ( A, treeData, C.Matrix(), B );
+    Zeros( BExplicit, m, numRHS );
+    LocalGemm( NORMAL, NORMAL, F(1), Q, C, F(0), BExplicit );
+    BExplicit -= B;
+    const Real explicitError = FrobeniusNorm( BExplicit ) / (eps*maxDim*frobC);
+    Matrix<F> CRound;
+    qr::ts::ApplyQAdjoint( A, treeData, B, CRound );
+    Axpy( F(-1), C.Matrix(), CRound );
+    const Real roundError = FrobeniusNorm( CRound ) / (eps*maxDim*frobC);
+    OutputFromRoot
+    (g.Comm(),"||Q C - Q_explicit C||_F / (eps Max(m,n) ||C||_F) = ",
+     explicitError,", ||Q^H Q C - C||_F / (eps Max(m,n) ||C||_F) = ",
+     roundError);
+    PopIndent();
+
+    OutputFromRoot(g.Comm(),"Testing the least-squares solve...");
+    PushIndent();
+    Uniform( B, m, numRHS );
+    DistMatrix<F,STAR,STAR> X(g);
+    X.Resize( n, numRHS );
+    qr::ts::SolveAfter( A, treeData, B, X.Matrix() );
+    const Real frobA = FrobeniusNorm( A );
+    const Real frobB = FrobeniusNorm( B );
+    const Real frobX = FrobeniusNorm( X );
+    LocalGemm( NORMAL, NORMAL, F(1), A, X, F(-1), B );
+    DistMatrix<F> AHR(g);
+    Gemm( ADJOINT, NORMAL, F(1), A, B, AHR );
+    const Real lsError =
+      FrobeniusNorm( AHR ) / (eps*maxDim*frobA*(frobA*frobX+frobB));
+    OutputFromRoot
+    (g.Comm(),"||A^H (A X - B)||_F / "
+     "(eps Max(m,n) ||A||_F (||A||_F ||X||_F + ||B||_F)) = ",lsError);
+    PopIndent();
+
+    if( explicitError > Real(10) )
+        LogicError("The implicit and explicit Q differed");
+    if( roundError > Real(10) )
+        LogicError("Applying Q and then its adjoint did not recover C");
+    if( lsError > Real(10) )
+        LogicError("Unacceptably large least-squares residual");
+}
+
 template<typename F>
 void TestQR
 ( const Grid& g,
   Int m,
   Int n,
+  qr::TSQRTree tree,
   bool correctness,
   bool print )
 {
@@ -78,7 +144,7 @@ void TestQR
     OutputFromRoot(g.Comm(),"Starting TSQR factorization...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    qr::ExplicitTS( AFact, R );
+    qr::ExplicitTS( AFact, R, tree );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
@@ -91,16 +157,45 @@ void TestQR
         Print( R, "R" );
     }
     if( correctness )
-        TestCorrectness( AFact, R, A );
+    {
+        DistMatrix<F,VC,STAR> ACopy( A );
+        TestCorrectness( AFact, R, ACopy );
+        auto treeData = qr::TS( A, tree );
+        TestImplicit( A, AFact, treeData, Max(n/2,Int(1)) );
+    }
     PopIndent();
     OutputFromRoot(g.Comm(),"");
 }
 
+template<typename F>
+void TestTrees
+( const Grid& g,
+  Int m,
+  Int n,
+  bool correctness,
+  bool print )
+{
+    const pair<qr::TSQRTree,string> trees[] =
+      { { qr::TSQR_BINARY, "binary" }, { qr::TSQR_BUTTERFLY, "butterfly" },
+        { qr::TSQR_HIERARCHICAL, "hierarchical" } };
+    const int commSize = g.Size();
+    for( const auto& tree : trees )
+    {
+        // The butterfly tree requires a power-of-two number of processes
+        if( tree.first == qr::TSQR_BUTTERFLY && (commSize & (commSize-1)) )
+            continue;
+        OutputFromRoot(g.Comm(),"Testing the ",tree.second," tree");
+        PushIndent();
+        TestQR<F>( g, m, n, tree.first, correctness, print );
+        PopIndent();
+    }
+}
+
 int 
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    const mpi::Comm& comm = mpi::COMM_WORLD;
 
     try
     {
@@ -122,44 +217,44 @@ main( int argc, char* argv[] )
 #endif
 
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid g( comm, order );
+        const Grid g( mpi::NewWorldComm(), order );
         SetBlocksize( nb );
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test TSQR");
 
-        TestQR<float>
+        TestTrees<float>
         ( g, m, n, correctness, print );
-        TestQR<Complex<float>>
+        TestTrees<Complex<float>>
         ( g, m, n, correctness, print );
 
-        TestQR<double>
+        TestTrees<double>
         ( g, m, n, correctness, print );
-        TestQR<Complex<double>>
+        TestTrees<Complex<double>>
         ( g, m, n, correctness, print );
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>
+        TestTrees<DoubleDouble>
         ( g, m, n, correctness, print );
-        TestQR<QuadDouble>
+        TestTrees<QuadDouble>
         ( g, m, n, correctness, print );
 
-        TestQR<Complex<DoubleDouble>>
+        TestTrees<Complex<DoubleDouble>>
         ( g, m, n, correctness, print );
-        TestQR<Complex<QuadDouble>>
+        TestTrees<Complex<QuadDouble>>
         ( g, m, n, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>
+        TestTrees<Quad>
         ( g, m, n, correctness, print );
-        TestQR<Complex<Quad>>
+        TestTrees<Complex<Quad>>
         ( g, m, n, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>
+        TestTrees<BigFloat>
         ( g, m, n, correctness, print );
-        TestQR<Complex<BigFloat>>
+        TestTrees<Complex<BigFloat>>
         ( g, m, n, correctness, print );
 #endif
     }